@@ -10,15 +10,17 @@ void UT66BackendSubsystem::FetchAccountStatus()
 		return;
 	}
 
-	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = CreateRequest(TEXT("GET"), TEXT("/api/account-status"));
+	FT66BackendHttpRequest Request = CreateRequest(TEXT("GET"), TEXT("/api/account-status"));
 	SetAuthHeaders(Request);
-	Request->OnProcessRequestComplete().BindUObject(this, &UT66BackendSubsystem::OnAccountStatusResponseReceived);
-	Request->ProcessRequest();
+	SendRequest(MoveTemp(Request), [this](const FT66BackendHttpResponse& Response)
+	{
+		OnAccountStatusResponseReceived(Response);
+	});
 }
 
-void UT66BackendSubsystem::OnAccountStatusResponseReceived(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bConnectedSuccessfully)
+void UT66BackendSubsystem::OnAccountStatusResponseReceived(const FT66BackendHttpResponse& Response)
 {
-	if (!bConnectedSuccessfully || !Response.IsValid() || Response->GetResponseCode() != 200)
+	if (!Response.IsOk())
 	{
 		LastAccountStatusReason.Reset();
 		LastAccountAppealStatus.Reset();
@@ -28,7 +30,7 @@ void UT66BackendSubsystem::OnAccountStatusResponseReceived(FHttpRequestPtr Reque
 	}
 
 	TSharedPtr<FJsonObject> Json;
-	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Response->GetContentAsString());
+	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Response.Body);
 	if (!FJsonSerializer::Deserialize(Reader, Json) || !Json.IsValid())
 	{
 		LastAccountStatusReason.Reset();
@@ -69,11 +71,13 @@ void UT66BackendSubsystem::SubmitRunReport(const FString& TargetEntryId, const F
 	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Payload);
 	FJsonSerializer::Serialize(Root.ToSharedRef(), Writer);
 
-	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = CreateRequest(TEXT("POST"), TEXT("/api/report-run"));
+	FT66BackendHttpRequest Request = CreateRequest(TEXT("POST"), TEXT("/api/report-run"));
 	SetAuthHeaders(Request);
-	Request->SetContentAsString(Payload);
-	Request->OnProcessRequestComplete().BindUObject(this, &UT66BackendSubsystem::OnRunReportResponseReceived);
-	Request->ProcessRequest();
+	Request.SetContentAsString(Payload);
+	SendRequest(MoveTemp(Request), [this](const FT66BackendHttpResponse& Response)
+	{
+		OnRunReportResponseReceived(Response);
+	});
 }
 
 void UT66BackendSubsystem::SubmitAppeal(const FString& Message, FString EvidenceUrl)
@@ -103,11 +107,13 @@ void UT66BackendSubsystem::SubmitAppeal(const FString& Message, FString Evidence
 	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Payload);
 	FJsonSerializer::Serialize(Root.ToSharedRef(), Writer);
 
-	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = CreateRequest(TEXT("POST"), TEXT("/api/submit-appeal"));
+	FT66BackendHttpRequest Request = CreateRequest(TEXT("POST"), TEXT("/api/submit-appeal"));
 	SetAuthHeaders(Request);
-	Request->SetContentAsString(Payload);
-	Request->OnProcessRequestComplete().BindUObject(this, &UT66BackendSubsystem::OnAppealResponseReceived);
-	Request->ProcessRequest();
+	Request.SetContentAsString(Payload);
+	SendRequest(MoveTemp(Request), [this](const FT66BackendHttpResponse& Response)
+	{
+		OnAppealResponseReceived(Response);
+	});
 }
 
 void UT66BackendSubsystem::UpdateProofOfRun(const FString& EntryId, const FString& ProofUrl)
@@ -134,11 +140,13 @@ void UT66BackendSubsystem::UpdateProofOfRun(const FString& EntryId, const FStrin
 	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Payload);
 	FJsonSerializer::Serialize(Root.ToSharedRef(), Writer);
 
-	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = CreateRequest(TEXT("PUT"), TEXT("/api/proof-of-run"));
+	FT66BackendHttpRequest Request = CreateRequest(TEXT("PUT"), TEXT("/api/proof-of-run"));
 	SetAuthHeaders(Request);
-	Request->SetContentAsString(Payload);
-	Request->OnProcessRequestComplete().BindUObject(this, &UT66BackendSubsystem::OnProofOfRunResponseReceived);
-	Request->ProcessRequest();
+	Request.SetContentAsString(Payload);
+	SendRequest(MoveTemp(Request), [this](const FT66BackendHttpResponse& Response)
+	{
+		OnProofOfRunResponseReceived(Response);
+	});
 }
 
 void UT66BackendSubsystem::SubmitBugReport(
@@ -191,11 +199,13 @@ void UT66BackendSubsystem::SubmitBugReport(
 	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Payload);
 	FJsonSerializer::Serialize(Root.ToSharedRef(), Writer);
 
-	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = CreateRequest(TEXT("POST"), TEXT("/api/bug-report"));
+	FT66BackendHttpRequest Request = CreateRequest(TEXT("POST"), TEXT("/api/bug-report"));
 	SetAuthHeaders(Request);
-	Request->SetContentAsString(Payload);
-	Request->OnProcessRequestComplete().BindUObject(this, &UT66BackendSubsystem::OnBugReportResponseReceived);
-	Request->ProcessRequest();
+	Request.SetContentAsString(Payload);
+	SendRequest(MoveTemp(Request), [this](const FT66BackendHttpResponse& Response)
+	{
+		OnBugReportResponseReceived(Response);
+	});
 }
 
 void UT66BackendSubsystem::FetchClientLaunchPolicy(int32 LocalSteamBuildId, const FString& SteamAppId, const FString& SteamBetaName)
@@ -218,23 +228,25 @@ void UT66BackendSubsystem::FetchClientLaunchPolicy(int32 LocalSteamBuildId, cons
 		*EncodedBetaName,
 		LocalSteamBuildId);
 
-	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = CreateRequest(TEXT("GET"), Endpoint);
-	Request->OnProcessRequestComplete().BindUObject(this, &UT66BackendSubsystem::OnClientLaunchPolicyResponseReceived, LocalSteamBuildId);
-	Request->ProcessRequest();
+	FT66BackendHttpRequest Request = CreateRequest(TEXT("GET"), Endpoint);
+	SendRequest(MoveTemp(Request), [this, LocalSteamBuildId](const FT66BackendHttpResponse& Response)
+	{
+		OnClientLaunchPolicyResponseReceived(Response, LocalSteamBuildId);
+	});
 }
 
-void UT66BackendSubsystem::OnRunReportResponseReceived(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bConnectedSuccessfully)
+void UT66BackendSubsystem::OnRunReportResponseReceived(const FT66BackendHttpResponse& Response)
 {
-	if (!bConnectedSuccessfully || !Response.IsValid())
+	if (!Response.bConnectedSuccessfully)
 	{
 		OnRunReportComplete.Broadcast(false, TEXT("Run report failed."));
 		return;
 	}
 
 	TSharedPtr<FJsonObject> Json;
-	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Response->GetContentAsString());
+	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Response.Body);
 	const bool bParsed = FJsonSerializer::Deserialize(Reader, Json) && Json.IsValid();
-	const int32 Code = Response->GetResponseCode();
+	const int32 Code = Response.Code;
 	if (Code == 200 && bParsed && Json->GetStringField(TEXT("status")) == TEXT("submitted"))
 	{
 		OnRunReportComplete.Broadcast(true, TEXT("Run reported."));
@@ -244,18 +256,18 @@ void UT66BackendSubsystem::OnRunReportResponseReceived(FHttpRequestPtr Request,
 	OnRunReportComplete.Broadcast(false, ExtractResponseMessage(Json, TEXT("Run report failed.")));
 }
 
-void UT66BackendSubsystem::OnAppealResponseReceived(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bConnectedSuccessfully)
+void UT66BackendSubsystem::OnAppealResponseReceived(const FT66BackendHttpResponse& Response)
 {
-	if (!bConnectedSuccessfully || !Response.IsValid())
+	if (!Response.bConnectedSuccessfully)
 	{
 		OnAppealSubmitComplete.Broadcast(false, TEXT("Appeal submission failed."));
 		return;
 	}
 
 	TSharedPtr<FJsonObject> Json;
-	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Response->GetContentAsString());
+	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Response.Body);
 	const bool bParsed = FJsonSerializer::Deserialize(Reader, Json) && Json.IsValid();
-	const int32 Code = Response->GetResponseCode();
+	const int32 Code = Response.Code;
 	if (Code == 200 && bParsed && Json->GetStringField(TEXT("status")) == TEXT("submitted"))
 	{
 		OnAppealSubmitComplete.Broadcast(true, TEXT("Appeal submitted."));
@@ -265,18 +277,18 @@ void UT66BackendSubsystem::OnAppealResponseReceived(FHttpRequestPtr Request, FHt
 	OnAppealSubmitComplete.Broadcast(false, ExtractResponseMessage(Json, TEXT("Appeal submission failed.")));
 }
 
-void UT66BackendSubsystem::OnProofOfRunResponseReceived(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bConnectedSuccessfully)
+void UT66BackendSubsystem::OnProofOfRunResponseReceived(const FT66BackendHttpResponse& Response)
 {
-	if (!bConnectedSuccessfully || !Response.IsValid())
+	if (!Response.bConnectedSuccessfully)
 	{
 		OnProofOfRunComplete.Broadcast(false, TEXT("Proof of run update failed."));
 		return;
 	}
 
 	TSharedPtr<FJsonObject> Json;
-	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Response->GetContentAsString());
+	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Response.Body);
 	const bool bParsed = FJsonSerializer::Deserialize(Reader, Json) && Json.IsValid();
-	const int32 Code = Response->GetResponseCode();
+	const int32 Code = Response.Code;
 	if (Code == 200 && bParsed && Json->GetStringField(TEXT("status")) == TEXT("updated"))
 	{
 		OnProofOfRunComplete.Broadcast(true, TEXT("Proof of run updated."));
@@ -286,18 +298,18 @@ void UT66BackendSubsystem::OnProofOfRunResponseReceived(FHttpRequestPtr Request,
 	OnProofOfRunComplete.Broadcast(false, ExtractResponseMessage(Json, TEXT("Proof of run update failed.")));
 }
 
-void UT66BackendSubsystem::OnBugReportResponseReceived(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bConnectedSuccessfully)
+void UT66BackendSubsystem::OnBugReportResponseReceived(const FT66BackendHttpResponse& Response)
 {
-	if (!bConnectedSuccessfully || !Response.IsValid())
+	if (!Response.bConnectedSuccessfully)
 	{
 		OnBugReportComplete.Broadcast(false, TEXT("Bug report failed."));
 		return;
 	}
 
 	TSharedPtr<FJsonObject> Json;
-	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Response->GetContentAsString());
+	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Response.Body);
 	const bool bParsed = FJsonSerializer::Deserialize(Reader, Json) && Json.IsValid();
-	const int32 Code = Response->GetResponseCode();
+	const int32 Code = Response.Code;
 	if (Code == 200 && bParsed && Json->GetStringField(TEXT("status")) == TEXT("submitted"))
 	{
 		OnBugReportComplete.Broadcast(true, TEXT("Bug report submitted."));
@@ -307,9 +319,9 @@ void UT66BackendSubsystem::OnBugReportResponseReceived(FHttpRequestPtr Request,
 	OnBugReportComplete.Broadcast(false, ExtractResponseMessage(Json, TEXT("Bug report failed.")));
 }
 
-void UT66BackendSubsystem::OnClientLaunchPolicyResponseReceived(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bConnectedSuccessfully, int32 LocalSteamBuildId)
+void UT66BackendSubsystem::OnClientLaunchPolicyResponseReceived(const FT66BackendHttpResponse& Response, int32 LocalSteamBuildId)
 {
-	if (!bConnectedSuccessfully || !Response.IsValid() || Response->GetResponseCode() != 200)
+	if (!Response.IsOk())
 	{
 		LastClientLaunchPolicyMessage.Reset();
 		LastRequiredSteamBuildId = 0;
@@ -321,7 +333,7 @@ void UT66BackendSubsystem::OnClientLaunchPolicyResponseReceived(FHttpRequestPtr
 	}
 
 	TSharedPtr<FJsonObject> Json;
-	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Response->GetContentAsString());
+	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Response.Body);
 	if (!FJsonSerializer::Deserialize(Reader, Json) || !Json.IsValid())
 	{
 		LastClientLaunchPolicyMessage.Reset();
@@ -384,21 +396,23 @@ void UT66BackendSubsystem::PingHealth()
 		return;
 	}
 
-	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = CreateRequest(TEXT("GET"), TEXT("/api/health"));
-	Request->OnProcessRequestComplete().BindUObject(this, &UT66BackendSubsystem::OnHealthResponseReceived);
-	Request->ProcessRequest();
+	FT66BackendHttpRequest Request = CreateRequest(TEXT("GET"), TEXT("/api/health"));
+	SendRequest(MoveTemp(Request), [this](const FT66BackendHttpResponse& Response)
+	{
+		OnHealthResponseReceived(Response);
+	});
 }
 
-void UT66BackendSubsystem::OnHealthResponseReceived(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bConnectedSuccessfully)
+void UT66BackendSubsystem::OnHealthResponseReceived(const FT66BackendHttpResponse& Response)
 {
-	if (!bConnectedSuccessfully || !Response.IsValid())
+	if (!Response.bConnectedSuccessfully)
 	{
 		UE_LOG(LogT66Backend, Warning, TEXT("Backend: health ping FAILED (connection error)."));
 		return;
 	}
 
-	const int32 Code = Response->GetResponseCode();
+	const int32 Code = Response.Code;
 	UE_LOG(LogT66Backend, Log, TEXT("Backend: health ping response code=%d body=%s"),
-		Code, *Response->GetContentAsString().Left(200));
+		Code, *Response.Body.Left(200));
 }
 
@@ -18,9 +18,11 @@ void UT66BackendSubsystem::FetchDailyLeaderboard(const FString& Filter)
 	PendingLeaderboardFetches.Add(CacheKey);
 
 	const FString Endpoint = FString::Printf(TEXT("/api/daily/leaderboard?filter=%s"), *NormalizedFilter);
-	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = CreateRequest(TEXT("GET"), Endpoint);
-	Request->OnProcessRequestComplete().BindUObject(this, &UT66BackendSubsystem::OnLeaderboardResponseReceived, CacheKey);
-	Request->ProcessRequest();
+	FT66BackendHttpRequest Request = CreateRequest(TEXT("GET"), Endpoint);
+	SendRequest(MoveTemp(Request), [this, CacheKey](const FT66BackendHttpResponse& Response)
+	{
+		OnLeaderboardResponseReceived(Response, CacheKey);
+	});
 }
 
 void UT66BackendSubsystem::FetchMyRank(
@@ -48,7 +50,9 @@ void UT66BackendSubsystem::FetchMyRankFiltered(
 		{
 			if (UT66SteamHelper* Steam = GI->GetSubsystem<UT66SteamHelper>())
 			{
-				ResolvedFilterContext = FString::Join(Steam->GetFriendSteamIds(), TEXT(","));
+				TArray<FString> FriendIds = Steam->GetFriendSteamIds();
+				FriendIds.Sort();
+				ResolvedFilterContext = FString::Join(FriendIds, TEXT(","));
 			}
 		}
 	}
@@ -85,10 +89,12 @@ void UT66BackendSubsystem::FetchMyRankFiltered(
 	}
 
 	PendingMyRankFetches.Add(RankKey);
-	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = CreateRequest(TEXT("GET"), Endpoint);
+	FT66BackendHttpRequest Request = CreateRequest(TEXT("GET"), Endpoint);
 	SetAuthHeaders(Request);
-	Request->OnProcessRequestComplete().BindUObject(this, &UT66BackendSubsystem::OnMyRankResponseReceived, RankKey);
-	Request->ProcessRequest();
+	SendRequest(MoveTemp(Request), [this, RankKey](const FT66BackendHttpResponse& Response)
+	{
+		OnMyRankResponseReceived(Response, RankKey);
+	});
 }
 
 FString UT66BackendSubsystem::MakeMyRankCacheKey(
@@ -132,44 +138,69 @@ bool UT66BackendSubsystem::GetCachedMyRank(const FString& Key, bool& bOutSuccess
 	return false;
 }
 
-void UT66BackendSubsystem::OnMyRankResponseReceived(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bConnectedSuccessfully, FString RankKey)
+void UT66BackendSubsystem::OnMyRankResponseReceived(const FT66BackendHttpResponse& Response, FString RankKey)
 {
-	PendingMyRankFetches.Remove(RankKey);
+	if (!Response.IsOk())
+	{
+		ApplyMyRankResponse(RankKey, FCachedMyRank());
+		return;
+	}
 
-	FCachedMyRank Cached;
-	if (!bConnectedSuccessfully || !Response.IsValid() || Response->GetResponseCode() != 200)
+	// 304 for a rank we already hold: it is still current, so skip the parse.
+	if (const FCachedMyRank* Existing = MyRankCache.Find(RankKey); Response.bNotModified && Existing && Existing->bSuccess)
 	{
-		MyRankCache.Add(RankKey, Cached);
-		OnMyRankComplete.Broadcast(false, 0, 0);
-		OnMyRankDataReady.Broadcast(RankKey, false, 0, 0);
+		const FCachedMyRank Cached = *Existing;
+		ApplyMyRankResponse(RankKey, Cached);
 		return;
 	}
 
+	T66ParseOffGameThread<FCachedMyRank>(
+		this,
+		[Body = Response.Body]()
+		{
+			FCachedMyRank Parsed;
+			Parsed.bSuccess = ParseMyRankResponse(Body, Parsed);
+			return Parsed;
+		},
+		[RankKey](UT66BackendSubsystem& Backend, FCachedMyRank&& Parsed)
+		{
+			Backend.ApplyMyRankResponse(RankKey, Parsed);
+		});
+}
+
+bool UT66BackendSubsystem::ParseMyRankResponse(const FString& Body, FCachedMyRank& OutRank)
+{
 	TSharedPtr<FJsonObject> Json;
-	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Response->GetContentAsString());
+	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Body);
 	if (!FJsonSerializer::Deserialize(Reader, Json) || !Json.IsValid())
 	{
-		MyRankCache.Add(RankKey, Cached);
-		OnMyRankComplete.Broadcast(false, 0, 0);
-		OnMyRankDataReady.Broadcast(RankKey, false, 0, 0);
-		return;
+		return false;
 	}
 
-	int32 Rank = 0;
+	OutRank.Rank = 0;
 	if (Json->HasTypedField<EJson::Number>(TEXT("rank")))
 	{
-		Rank = static_cast<int32>(Json->GetNumberField(TEXT("rank")));
+		OutRank.Rank = static_cast<int32>(Json->GetNumberField(TEXT("rank")));
 	}
-	const int32 Total = static_cast<int32>(Json->GetNumberField(TEXT("total_entries")));
+	OutRank.TotalEntries = static_cast<int32>(Json->GetNumberField(TEXT("total_entries")));
+	return true;
+}
 
-	Cached.bSuccess = true;
-	Cached.Rank = Rank;
-	Cached.TotalEntries = Total;
+void UT66BackendSubsystem::ApplyMyRankResponse(const FString& RankKey, const FCachedMyRank& Cached)
+{
+	PendingMyRankFetches.Remove(RankKey);
 	MyRankCache.Add(RankKey, Cached);
 
-	UE_LOG(LogT66Backend, Log, TEXT("Backend: my-rank = %d / %d"), Rank, Total);
-	OnMyRankComplete.Broadcast(true, Rank, Total);
-	OnMyRankDataReady.Broadcast(RankKey, true, Rank, Total);
+	if (!Cached.bSuccess)
+	{
+		OnMyRankComplete.Broadcast(false, 0, 0);
+		OnMyRankDataReady.Broadcast(RankKey, false, 0, 0);
+		return;
+	}
+
+	UE_LOG(LogT66Backend, Log, TEXT("Backend: my-rank = %d / %d"), Cached.Rank, Cached.TotalEntries);
+	OnMyRankComplete.Broadcast(true, Cached.Rank, Cached.TotalEntries);
+	OnMyRankDataReady.Broadcast(RankKey, true, Cached.Rank, Cached.TotalEntries);
 }
 
 // ── Account Status ───────────────────────────────────────────
@@ -216,7 +247,10 @@ void UT66BackendSubsystem::FetchLeaderboard(
 		{
 			if (UT66SteamHelper* Steam = GI->GetSubsystem<UT66SteamHelper>())
 			{
-				FriendIds = FString::Join(Steam->GetFriendSteamIds(), TEXT(","));
+				// Sorted so the URL, and with it request coalescing and the ETag cache, is stable across fetches.
+				TArray<FString> SortedFriendIds = Steam->GetFriendSteamIds();
+				SortedFriendIds.Sort();
+				FriendIds = FString::Join(SortedFriendIds, TEXT(","));
 			}
 		}
 
@@ -225,10 +259,12 @@ void UT66BackendSubsystem::FetchLeaderboard(
 			TEXT("/api/leaderboard/friends?type=%s&time=%s&party=%s&difficulty=%s&friend_ids=%s"),
 			*Type, *Time, *Party, *Difficulty, *FriendIds);
 
-		TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = CreateRequest(TEXT("GET"), Endpoint);
+		FT66BackendHttpRequest Request = CreateRequest(TEXT("GET"), Endpoint);
 		SetAuthHeaders(Request);
-		Request->OnProcessRequestComplete().BindUObject(this, &UT66BackendSubsystem::OnLeaderboardResponseReceived, Key);
-		Request->ProcessRequest();
+		SendRequest(MoveTemp(Request), [this, Key](const FT66BackendHttpResponse& Response)
+		{
+			OnLeaderboardResponseReceived(Response, Key);
+		});
 
 		UE_LOG(LogT66Backend, Log, TEXT("Backend: fetching friends leaderboard key=%s (friends=%d)"),
 			*Key, FriendIds.IsEmpty() ? 0 : FriendIds.Len());
@@ -240,9 +276,11 @@ void UT66BackendSubsystem::FetchLeaderboard(
 			TEXT("/api/leaderboard?type=%s&time=%s&party=%s&difficulty=%s&filter=%s"),
 			*Type, *Time, *Party, *Difficulty, *Filter);
 
-		TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = CreateRequest(TEXT("GET"), Endpoint);
-		Request->OnProcessRequestComplete().BindUObject(this, &UT66BackendSubsystem::OnLeaderboardResponseReceived, Key);
-		Request->ProcessRequest();
+		FT66BackendHttpRequest Request = CreateRequest(TEXT("GET"), Endpoint);
+		SendRequest(MoveTemp(Request), [this, Key](const FT66BackendHttpResponse& Response)
+		{
+			OnLeaderboardResponseReceived(Response, Key);
+		});
 
 		UE_LOG(LogT66Backend, Log, TEXT("Backend: fetching leaderboard key=%s"), *Key);
 	}
@@ -253,22 +291,16 @@ bool UT66BackendSubsystem::HasCachedLeaderboard(const FString& Key) const
 	return LeaderboardCache.Contains(Key);
 }
 
-TArray<FLeaderboardEntry> UT66BackendSubsystem::GetCachedLeaderboard(const FString& Key) const
+FT66LeaderboardSnapshotPtr UT66BackendSubsystem::GetCachedLeaderboard(const FString& Key) const
 {
-	if (const FCachedLeaderboard* Found = LeaderboardCache.Find(Key))
-	{
-		return Found->Entries;
-	}
-	return {};
+	const FT66LeaderboardSnapshotPtr* Found = LeaderboardCache.Find(Key);
+	return Found ? *Found : nullptr;
 }
 
 int32 UT66BackendSubsystem::GetCachedTotalEntries(const FString& Key) const
 {
-	if (const FCachedLeaderboard* Found = LeaderboardCache.Find(Key))
-	{
-		return Found->TotalEntries;
-	}
-	return 0;
+	const FT66LeaderboardSnapshotPtr* Found = LeaderboardCache.Find(Key);
+	return (Found && Found->IsValid()) ? (*Found)->TotalEntries : 0;
 }
 
 ET66Difficulty UT66BackendSubsystem::ApiStringToDifficulty(const FString& S)
@@ -291,47 +323,59 @@ ET66PartySize UT66BackendSubsystem::ApiStringToPartySize(const FString& S)
 }
 
 void UT66BackendSubsystem::OnLeaderboardResponseReceived(
-	FHttpRequestPtr Request, FHttpResponsePtr Response, bool bConnectedSuccessfully, FString LeaderboardKey)
+	const FT66BackendHttpResponse& Response, FString LeaderboardKey)
 {
-	PendingLeaderboardFetches.Remove(LeaderboardKey);
-	const bool bIsSpeedRunLeaderboard = LeaderboardKey.StartsWith(TEXT("speedrun_"));
-
-	if (!bConnectedSuccessfully || !Response.IsValid() || Response->GetResponseCode() != 200)
+	if (!Response.IsOk())
 	{
 		UE_LOG(LogT66Backend, Warning, TEXT("Backend: leaderboard fetch failed for key=%s (code=%d)"),
-			*LeaderboardKey, Response.IsValid() ? Response->GetResponseCode() : 0);
-		if (TryPopulateDevelopmentDummyLeaderboard(LeaderboardKey))
-		{
-			OnLeaderboardDataReady.Broadcast(LeaderboardKey);
-		}
+			*LeaderboardKey, Response.Code);
+		ApplyLeaderboardResponse(LeaderboardKey, nullptr);
 		return;
 	}
 
+	// 304: the shared snapshot already in the cache is current; readers keep the same pointer.
+	if (const FT66LeaderboardSnapshotPtr* Existing = LeaderboardCache.Find(LeaderboardKey); Response.bNotModified && Existing && Existing->IsValid())
+	{
+		ApplyLeaderboardResponse(LeaderboardKey, *Existing);
+		return;
+	}
+
+	// The key stays in PendingLeaderboardFetches until the parsed snapshot lands, so no duplicate fetch starts meanwhile.
+	const bool bIsSpeedRunLeaderboard = LeaderboardKey.StartsWith(TEXT("speedrun_"));
+	T66ParseOffGameThread<FT66LeaderboardSnapshotPtr>(
+		this,
+		[Body = Response.Body, bIsSpeedRunLeaderboard]()
+		{
+			return ParseLeaderboardResponse(Body, bIsSpeedRunLeaderboard);
+		},
+		[LeaderboardKey](UT66BackendSubsystem& Backend, FT66LeaderboardSnapshotPtr&& Snapshot)
+		{
+			if (!Snapshot.IsValid())
+			{
+				UE_LOG(LogT66Backend, Warning, TEXT("Backend: leaderboard JSON parse failed for key=%s"), *LeaderboardKey);
+			}
+			Backend.ApplyLeaderboardResponse(LeaderboardKey, MoveTemp(Snapshot));
+		});
+}
+
+FT66LeaderboardSnapshotPtr UT66BackendSubsystem::ParseLeaderboardResponse(const FString& Body, const bool bIsSpeedRunLeaderboard)
+{
 	TSharedPtr<FJsonObject> Json;
-	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Response->GetContentAsString());
+	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Body);
 	if (!FJsonSerializer::Deserialize(Reader, Json) || !Json.IsValid())
 	{
-		UE_LOG(LogT66Backend, Warning, TEXT("Backend: leaderboard JSON parse failed for key=%s"), *LeaderboardKey);
-		if (TryPopulateDevelopmentDummyLeaderboard(LeaderboardKey))
-		{
-			OnLeaderboardDataReady.Broadcast(LeaderboardKey);
-		}
-		return;
+		return nullptr;
 	}
 
 	const TArray<TSharedPtr<FJsonValue>>* EntriesArray = nullptr;
 	if (!Json->TryGetArrayField(TEXT("entries"), EntriesArray) || !EntriesArray)
 	{
-		UE_LOG(LogT66Backend, Warning, TEXT("Backend: leaderboard missing entries array for key=%s"), *LeaderboardKey);
-		if (TryPopulateDevelopmentDummyLeaderboard(LeaderboardKey))
-		{
-			OnLeaderboardDataReady.Broadcast(LeaderboardKey);
-		}
-		return;
+		return nullptr;
 	}
 
-	FCachedLeaderboard Cached;
-	Cached.TotalEntries = static_cast<int32>(Json->GetNumberField(TEXT("total_entries")));
+	TSharedRef<FT66LeaderboardSnapshot, ESPMode::ThreadSafe> Snapshot = MakeShared<FT66LeaderboardSnapshot, ESPMode::ThreadSafe>();
+	Snapshot->TotalEntries = static_cast<int32>(Json->GetNumberField(TEXT("total_entries")));
+	Snapshot->Entries.Reserve(EntriesArray->Num());
 
 	for (const TSharedPtr<FJsonValue>& Val : *EntriesArray)
 	{
@@ -407,18 +451,33 @@ void UT66BackendSubsystem::OnLeaderboardResponseReceived(
 			Entry.AvatarUrl = AvUrl;
 		}
 
-		Cached.Entries.Add(Entry);
+		Snapshot->Entries.Add(MoveTemp(Entry));
 	}
 
-	if (Cached.Entries.Num() == 0 && TryPopulateDevelopmentDummyLeaderboard(LeaderboardKey))
+	return Snapshot;
+}
+
+void UT66BackendSubsystem::ApplyLeaderboardResponse(const FString& LeaderboardKey, FT66LeaderboardSnapshotPtr Snapshot)
+{
+	PendingLeaderboardFetches.Remove(LeaderboardKey);
+
+	if (!Snapshot.IsValid() || Snapshot->Entries.Num() == 0)
 	{
-		OnLeaderboardDataReady.Broadcast(LeaderboardKey);
-		return;
+		if (TryPopulateDevelopmentDummyLeaderboard(LeaderboardKey))
+		{
+			OnLeaderboardDataReady.Broadcast(LeaderboardKey);
+			return;
+		}
+
+		if (!Snapshot.IsValid())
+		{
+			return;
+		}
 	}
 
-	const int32 NumEntries = Cached.Entries.Num();
-	const int32 TotalEntries = Cached.TotalEntries;
-	LeaderboardCache.Add(LeaderboardKey, MoveTemp(Cached));
+	const int32 NumEntries = Snapshot->Entries.Num();
+	const int32 TotalEntries = Snapshot->TotalEntries;
+	LeaderboardCache.Add(LeaderboardKey, MoveTemp(Snapshot));
 
 	UE_LOG(LogT66Backend, Log, TEXT("Backend: leaderboard fetched key=%s entries=%d total=%d"),
 		*LeaderboardKey, NumEntries, TotalEntries);
@@ -443,9 +502,11 @@ void UT66BackendSubsystem::FetchRunSummary(const FString& EntryId)
 	PendingRunSummaryFetches.Add(EntryId);
 
 	const FString Endpoint = FString::Printf(TEXT("/api/run-summary/%s"), *EntryId);
-	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = CreateRequest(TEXT("GET"), Endpoint);
-	Request->OnProcessRequestComplete().BindUObject(this, &UT66BackendSubsystem::OnRunSummaryResponseReceived, EntryId);
-	Request->ProcessRequest();
+	FT66BackendHttpRequest Request = CreateRequest(TEXT("GET"), Endpoint);
+	SendRequest(MoveTemp(Request), [this, EntryId](const FT66BackendHttpResponse& Response)
+	{
+		OnRunSummaryResponseReceived(Response, EntryId);
+	});
 
 	UE_LOG(LogT66Backend, Log, TEXT("Backend: fetching run summary for entry=%s"), *EntryId);
 }
@@ -463,32 +524,42 @@ UT66LeaderboardRunSummarySaveGame* UT66BackendSubsystem::GetCachedRunSummary(con
 }
 
 void UT66BackendSubsystem::OnRunSummaryResponseReceived(
-	FHttpRequestPtr Request, FHttpResponsePtr Response, bool bConnectedSuccessfully, FString EntryId)
+	const FT66BackendHttpResponse& Response, FString EntryId)
 {
-	PendingRunSummaryFetches.Remove(EntryId);
-
-	if (!bConnectedSuccessfully || !Response.IsValid() || Response->GetResponseCode() != 200)
+	if (!Response.IsOk())
 	{
+		PendingRunSummaryFetches.Remove(EntryId);
 		UE_LOG(LogT66Backend, Warning, TEXT("Backend: run-summary fetch failed for entry=%s (code=%d)"),
-			*EntryId, Response.IsValid() ? Response->GetResponseCode() : 0);
+			*EntryId, Response.Code);
 		return;
 	}
 
-	TSharedPtr<FJsonObject> Json;
-	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Response->GetContentAsString());
-	if (!FJsonSerializer::Deserialize(Reader, Json) || !Json.IsValid())
-	{
-		UE_LOG(LogT66Backend, Warning, TEXT("Backend: run-summary JSON parse failed for entry=%s"), *EntryId);
-		return;
-	}
+	// Deserializing the body is the expensive part; copying fields into the save-game object needs NewObject and stays here.
+	T66ParseOffGameThread<TSharedPtr<FJsonObject>>(
+		this,
+		[Body = Response.Body]()
+		{
+			TSharedPtr<FJsonObject> Json;
+			T66DeserializeJsonObjectString(Body, Json);
+			return Json;
+		},
+		[EntryId](UT66BackendSubsystem& Backend, TSharedPtr<FJsonObject>&& Json)
+		{
+			Backend.PendingRunSummaryFetches.Remove(EntryId);
+			if (!Json.IsValid())
+			{
+				UE_LOG(LogT66Backend, Warning, TEXT("Backend: run-summary JSON parse failed for entry=%s"), *EntryId);
+				return;
+			}
 
-	UT66LeaderboardRunSummarySaveGame* Snapshot = ParseRunSummaryFromJson(Json, this);
-	if (Snapshot)
-	{
-		RunSummaryCache.Add(EntryId, Snapshot);
-		UE_LOG(LogT66Backend, Log, TEXT("Backend: run summary cached for entry=%s (hero=%s, score=%d)"),
-			*EntryId, *Snapshot->HeroID.ToString(), Snapshot->Score);
-		OnRunSummaryReady.Broadcast(EntryId);
-	}
+			UT66LeaderboardRunSummarySaveGame* Snapshot = ParseRunSummaryFromJson(Json, &Backend);
+			if (Snapshot)
+			{
+				Backend.RunSummaryCache.Add(EntryId, Snapshot);
+				UE_LOG(LogT66Backend, Log, TEXT("Backend: run summary cached for entry=%s (hero=%s, score=%d)"),
+					*EntryId, *Snapshot->HeroID.ToString(), Snapshot->Score);
+				Backend.OnRunSummaryReady.Broadcast(EntryId);
+			}
+		});
 }
 
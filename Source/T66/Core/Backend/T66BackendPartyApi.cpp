@@ -51,11 +51,13 @@ bool UT66BackendSubsystem::SendPartyInvite(const FString& TargetSteamId, const F
 	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Payload);
 	FJsonSerializer::Serialize(Root.ToSharedRef(), Writer);
 
-	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = CreateRequest(TEXT("POST"), TEXT("/api/party-invite/send"));
+	FT66BackendHttpRequest Request = CreateRequest(TEXT("POST"), TEXT("/api/party-invite/send"));
 	SetAuthHeaders(Request);
-	Request->SetContentAsString(Payload);
-	Request->OnProcessRequestComplete().BindUObject(this, &UT66BackendSubsystem::OnSendPartyInviteResponseReceived);
-	Request->ProcessRequest();
+	Request.SetContentAsString(Payload);
+	SendRequest(MoveTemp(Request), [this](const FT66BackendHttpResponse& Response)
+	{
+		OnSendPartyInviteResponseReceived(Response);
+	});
 
 	UE_LOG(LogT66Backend, Log, TEXT("Backend: sending party invite to %s"), *TargetSteamId);
 	return true;
@@ -83,7 +85,12 @@ void UT66BackendSubsystem::PollPendingPartyInvites(bool bForce)
 
 	const double NowSeconds = FPlatformTime::Seconds();
 	const double MinPollIntervalSeconds = static_cast<double>(FMath::Max(0.05f, CVarT66PartyInvitePollMinIntervalSeconds.GetValueOnGameThread()));
-	if (!bForce && (NowSeconds - LastPartyInvitePollTimeSeconds) < MinPollIntervalSeconds)
+	if (bForce)
+	{
+		// An explicit poll means someone is acting on invites right now; drop back to the fast cadence.
+		PartyInvitePollIntervalSeconds = MinPollIntervalSeconds;
+	}
+	else if ((NowSeconds - LastPartyInvitePollTimeSeconds) < FMath::Max(MinPollIntervalSeconds, PartyInvitePollIntervalSeconds))
 	{
 		return;
 	}
@@ -92,11 +99,12 @@ void UT66BackendSubsystem::PollPendingPartyInvites(bool bForce)
 	bPartyInvitePollInFlight = true;
 	bPartyInvitePollRequestedWhileInFlight = false;
 
-	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = CreateRequest(TEXT("GET"), TEXT("/api/party-invite/pending"));
-	PendingPartyInvitePollRequest = Request;
+	FT66BackendHttpRequest Request = CreateRequest(TEXT("GET"), TEXT("/api/party-invite/pending"));
 	SetAuthHeaders(Request);
-	Request->OnProcessRequestComplete().BindUObject(this, &UT66BackendSubsystem::OnPendingPartyInvitesResponseReceived);
-	Request->ProcessRequest();
+	SendRequest(MoveTemp(Request), [this](const FT66BackendHttpResponse& Response)
+	{
+		OnPendingPartyInvitesResponseReceived(Response);
+	});
 }
 
 bool UT66BackendSubsystem::RespondToPartyInvite(const FString& InviteId, bool bAccept)
@@ -117,11 +125,13 @@ bool UT66BackendSubsystem::RespondToPartyInvite(const FString& InviteId, bool bA
 	FJsonSerializer::Serialize(Root.ToSharedRef(), Writer);
 
 	const FString Action = bAccept ? TEXT("accept") : TEXT("reject");
-	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = CreateRequest(TEXT("POST"), TEXT("/api/party-invite/respond"));
+	FT66BackendHttpRequest Request = CreateRequest(TEXT("POST"), TEXT("/api/party-invite/respond"));
 	SetAuthHeaders(Request);
-	Request->SetContentAsString(Payload);
-	Request->OnProcessRequestComplete().BindUObject(this, &UT66BackendSubsystem::OnRespondPartyInviteResponseReceived, InviteId, Action);
-	Request->ProcessRequest();
+	Request.SetContentAsString(Payload);
+	SendRequest(MoveTemp(Request), [this, InviteId, Action](const FT66BackendHttpResponse& Response)
+	{
+		OnRespondPartyInviteResponseReceived(Response, InviteId, Action);
+	});
 
 	UE_LOG(LogT66Backend, Log, TEXT("Backend: responding to party invite %s with %s"), *InviteId, *Action);
 	return true;
@@ -133,6 +143,19 @@ bool UT66BackendSubsystem::HandlePartyInvitePollTicker(float DeltaTime)
 	return true;
 }
 
+void UT66BackendSubsystem::UpdatePartyInvitePollBackoff(const bool bActivity)
+{
+	const double MinPollIntervalSeconds = static_cast<double>(FMath::Max(0.05f, CVarT66PartyInvitePollMinIntervalSeconds.GetValueOnGameThread()));
+	if (bActivity)
+	{
+		PartyInvitePollIntervalSeconds = MinPollIntervalSeconds;
+		return;
+	}
+
+	const double MaxPollIntervalSeconds = FMath::Max(MinPollIntervalSeconds, static_cast<double>(CVarT66PartyInvitePollIdleMaxIntervalSeconds.GetValueOnGameThread()));
+	PartyInvitePollIntervalSeconds = FMath::Clamp(FMath::Max(PartyInvitePollIntervalSeconds, MinPollIntervalSeconds) * 2.0, MinPollIntervalSeconds, MaxPollIntervalSeconds);
+}
+
 void UT66BackendSubsystem::SetPendingPartyInvites(TArray<FT66PartyInviteEntry>&& NewInvites)
 {
 	if (T66ArePartyInviteArraysEqual(PendingPartyInvites, NewInvites))
@@ -247,27 +270,25 @@ void UT66BackendSubsystem::SubmitMultiplayerDiagnostic(const FT66MultiplayerDiag
 	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Payload);
 	FJsonSerializer::Serialize(Root.ToSharedRef(), Writer);
 
-	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = CreateRequest(TEXT("POST"), TEXT("/api/client-diagnostics"));
+	FT66BackendHttpRequest Request = CreateRequest(TEXT("POST"), TEXT("/api/client-diagnostics"));
 	SetAuthHeaders(Request);
-	Request->SetContentAsString(Payload);
-	Request->OnProcessRequestComplete().BindUObject(
-		this,
-		&UT66BackendSubsystem::OnClientDiagnosticsResponseReceived,
-		Diagnostic.EventName,
-		Diagnostic.InviteId);
-	Request->ProcessRequest();
+	Request.SetContentAsString(Payload);
+	SendRequest(MoveTemp(Request), [this, EventName = Diagnostic.EventName, InviteId = Diagnostic.InviteId](const FT66BackendHttpResponse& Response)
+	{
+		OnClientDiagnosticsResponseReceived(Response, EventName, InviteId);
+	});
 }
 
-void UT66BackendSubsystem::OnSendPartyInviteResponseReceived(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bConnectedSuccessfully)
+void UT66BackendSubsystem::OnSendPartyInviteResponseReceived(const FT66BackendHttpResponse& Response)
 {
 	TSharedPtr<FJsonObject> Json;
-	if (bConnectedSuccessfully && Response.IsValid())
+	if (Response.bConnectedSuccessfully)
 	{
-		TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Response->GetContentAsString());
+		TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Response.Body);
 		FJsonSerializer::Deserialize(Reader, Json);
 	}
 
-	const bool bSuccess = bConnectedSuccessfully && Response.IsValid() && Response->GetResponseCode() == 200;
+	const bool bSuccess = Response.IsOk();
 	const FString Message = ExtractResponseMessage(Json, bSuccess ? TEXT("Party invite sent.") : TEXT("Party invite failed."));
 	FString InviteId;
 	FString HostSteamId;
@@ -315,20 +336,27 @@ void UT66BackendSubsystem::OnSendPartyInviteResponseReceived(FHttpRequestPtr Req
 	}
 }
 
-void UT66BackendSubsystem::OnPendingPartyInvitesResponseReceived(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bConnectedSuccessfully)
+void UT66BackendSubsystem::OnPendingPartyInvitesResponseReceived(const FT66BackendHttpResponse& Response)
 {
 	bPartyInvitePollInFlight = false;
 	const bool bRepollAfterCompletion = bPartyInvitePollRequestedWhileInFlight;
 	bPartyInvitePollRequestedWhileInFlight = false;
-	if (TSharedPtr<IHttpRequest, ESPMode::ThreadSafe> PendingInviteRequest = PendingPartyInvitePollRequest.Pin();
-		PendingInviteRequest.Get() == Request.Get())
+
+	if (!Response.bConnectedSuccessfully)
 	{
-		PendingPartyInvitePollRequest.Reset();
+		UE_LOG(LogT66Backend, Verbose, TEXT("Backend: pending party invite poll failed."));
+		UpdatePartyInvitePollBackoff(false);
+		if (bRepollAfterCompletion)
+		{
+			PollPendingPartyInvites(true);
+		}
+		return;
 	}
 
-	if (!bConnectedSuccessfully || !Response.IsValid())
+	// 304: the invite list is exactly what was applied last time, so there is nothing to parse or diff.
+	if (Response.bNotModified)
 	{
-		UE_LOG(LogT66Backend, Verbose, TEXT("Backend: pending party invite poll failed."));
+		UpdatePartyInvitePollBackoff(false);
 		if (bRepollAfterCompletion)
 		{
 			PollPendingPartyInvites(true);
@@ -337,10 +365,11 @@ void UT66BackendSubsystem::OnPendingPartyInvitesResponseReceived(FHttpRequestPtr
 	}
 
 	TSharedPtr<FJsonObject> Json;
-	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Response->GetContentAsString());
+	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Response.Body);
 	if (!FJsonSerializer::Deserialize(Reader, Json) || !Json.IsValid())
 	{
 		UE_LOG(LogT66Backend, Warning, TEXT("Backend: failed to parse pending party invites JSON."));
+		UpdatePartyInvitePollBackoff(false);
 		if (bRepollAfterCompletion)
 		{
 			PollPendingPartyInvites(true);
@@ -348,9 +377,10 @@ void UT66BackendSubsystem::OnPendingPartyInvitesResponseReceived(FHttpRequestPtr
 		return;
 	}
 
-	if (Response->GetResponseCode() != 200)
+	if (Response.Code != 200)
 	{
-		UE_LOG(LogT66Backend, Warning, TEXT("Backend: pending party invite poll returned HTTP %d."), Response->GetResponseCode());
+		UE_LOG(LogT66Backend, Warning, TEXT("Backend: pending party invite poll returned HTTP %d."), Response.Code);
+		UpdatePartyInvitePollBackoff(false);
 		if (bRepollAfterCompletion)
 		{
 			PollPendingPartyInvites(true);
@@ -374,6 +404,7 @@ void UT66BackendSubsystem::OnPendingPartyInvitesResponseReceived(FHttpRequestPtr
 		SubmitMultiplayerDiagnostic(Diagnostic);
 	}
 
+	UpdatePartyInvitePollBackoff(!T66ArePartyInviteArraysEqual(PendingPartyInvites, ParsedInvites));
 	SetPendingPartyInvites(MoveTemp(ParsedInvites));
 
 	if (bRepollAfterCompletion)
@@ -383,20 +414,18 @@ void UT66BackendSubsystem::OnPendingPartyInvitesResponseReceived(FHttpRequestPtr
 }
 
 void UT66BackendSubsystem::OnRespondPartyInviteResponseReceived(
-	FHttpRequestPtr Request,
-	FHttpResponsePtr Response,
-	bool bConnectedSuccessfully,
+	const FT66BackendHttpResponse& Response,
 	FString InviteId,
 	FString Action)
 {
 	TSharedPtr<FJsonObject> Json;
-	if (bConnectedSuccessfully && Response.IsValid())
+	if (Response.bConnectedSuccessfully)
 	{
-		TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Response->GetContentAsString());
+		TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Response.Body);
 		FJsonSerializer::Deserialize(Reader, Json);
 	}
 
-	const bool bSuccess = bConnectedSuccessfully && Response.IsValid() && Response->GetResponseCode() == 200;
+	const bool bSuccess = Response.IsOk();
 	FString HostSteamId;
 	FString TargetSteamId;
 	FString HostLobbyId;
@@ -470,7 +499,7 @@ void UT66BackendSubsystem::OnRespondPartyInviteResponseReceived(
 	Diagnostic.TargetSteamId = TargetSteamId;
 	Diagnostic.LobbyId = HostLobbyId;
 	Diagnostic.SourceAppId = HostAppId;
-	Diagnostic.ExtraFields.Add(TEXT("http_code"), FString::FromInt(Response.IsValid() ? Response->GetResponseCode() : 0));
+	Diagnostic.ExtraFields.Add(TEXT("http_code"), FString::FromInt(Response.Code));
 	Diagnostic.ExtraFields.Add(TEXT("has_host_steam_id"), HostSteamId.IsEmpty() ? TEXT("false") : TEXT("true"));
 	Diagnostic.ExtraFields.Add(TEXT("has_host_lobby_id"), HostLobbyId.IsEmpty() ? TEXT("false") : TEXT("true"));
 	Diagnostic.ExtraFields.Add(TEXT("has_host_app_id"), HostAppId.IsEmpty() ? TEXT("false") : TEXT("true"));
@@ -501,13 +530,11 @@ void UT66BackendSubsystem::OnRespondPartyInviteResponseReceived(
 }
 
 void UT66BackendSubsystem::OnClientDiagnosticsResponseReceived(
-	FHttpRequestPtr Request,
-	FHttpResponsePtr Response,
-	bool bConnectedSuccessfully,
+	const FT66BackendHttpResponse& Response,
 	FString EventName,
 	FString InviteId)
 {
-	if (bConnectedSuccessfully && Response.IsValid() && Response->GetResponseCode() == 200)
+	if (Response.IsOk())
 	{
 		UE_LOG(LogT66Backend, Verbose, TEXT("Backend: multiplayer diagnostic submitted event=%s invite=%s"), *EventName, *InviteId);
 		return;
@@ -519,7 +546,7 @@ void UT66BackendSubsystem::OnClientDiagnosticsResponseReceived(
 		TEXT("Backend: multiplayer diagnostic submit failed event=%s invite=%s code=%d"),
 		*EventName,
 		*InviteId,
-		Response.IsValid() ? Response->GetResponseCode() : 0);
+		Response.Code);
 }
 
 // ── Fetch Leaderboard ────────────────────────────────────────
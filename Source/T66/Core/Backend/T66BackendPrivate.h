@@ -6,14 +6,13 @@
 #include "Core/Backend/T66BackendRunSerializer.h"
 #include "Core/Backend/T66BackendRunSummaryParser.h"
 #include "Core/Backend/T66BackendDailyClimbJson.h"
+#include "Core/Backend/T66BackendTransport.h"
 #include "Core/T66SessionSubsystem.h"
 #include "Core/T66LagTrackerSubsystem.h"
 #include "Core/T66LeaderboardPacingUtils.h"
 #include "Core/T66LeaderboardRunSummarySaveGame.h"
 #include "Core/T66SteamHelper.h"
-#include "HttpModule.h"
-#include "Interfaces/IHttpRequest.h"
-#include "Interfaces/IHttpResponse.h"
+#include "Async/Async.h"
 #include "Dom/JsonObject.h"
 #include "Dom/JsonValue.h"
 #include "GenericPlatform/GenericPlatformHttp.h"
@@ -37,6 +36,11 @@ DECLARE_LOG_CATEGORY_EXTERN(LogT66Backend, Log, All);
 
 extern TAutoConsoleVariable<float> CVarT66PartyInvitePollMinIntervalSeconds;
 extern TAutoConsoleVariable<float> CVarT66PartyInvitePollTickerIntervalSeconds;
+extern TAutoConsoleVariable<float> CVarT66PartyInvitePollIdleMaxIntervalSeconds;
+extern TAutoConsoleVariable<float> CVarT66SubmitRunRetryBaseSeconds;
+extern TAutoConsoleVariable<float> CVarT66SubmitRunRetryMaxSeconds;
+extern TAutoConsoleVariable<int32> CVarT66SubmitRunMaxAttemptsPerSession;
+extern TAutoConsoleVariable<int32> CVarT66SubmitRunOutboxMaxAgeDays;
 
 inline void T66SetJsonStringIfNotEmpty(const TSharedPtr<FJsonObject>& Json, const FString& FieldName, const FString& Value)
 {
@@ -114,6 +118,30 @@ inline TArray<FT66PartyInviteEntry> T66ParsePendingPartyInvites(const TSharedPtr
 	return Result;
 }
 
+/**
+ * Runs Parse on a worker and hands the result to Apply on the game thread, skipping Apply when the
+ * subsystem has been torn down in between. Keeps JSON deserialization out of HTTP completion callbacks.
+ */
+template <typename ResultType>
+void T66ParseOffGameThread(
+	UT66BackendSubsystem* Backend,
+	TUniqueFunction<ResultType()>&& Parse,
+	TUniqueFunction<void(UT66BackendSubsystem&, ResultType&&)>&& Apply)
+{
+	TWeakObjectPtr<UT66BackendSubsystem> WeakBackend(Backend);
+	Async(EAsyncExecution::ThreadPool, [WeakBackend, Parse = MoveTemp(Parse), Apply = MoveTemp(Apply)]() mutable
+	{
+		ResultType Result = Parse();
+		AsyncTask(ENamedThreads::GameThread, [WeakBackend, Result = MoveTemp(Result), Apply = MoveTemp(Apply)]() mutable
+		{
+			if (UT66BackendSubsystem* LiveBackend = WeakBackend.Get())
+			{
+				Apply(*LiveBackend, MoveTemp(Result));
+			}
+		});
+	});
+}
+
 inline bool T66SerializeJsonObjectToString(const TSharedPtr<FJsonObject>& Json, FString& OutJsonString)
 {
 	return T66BackendRunSerializer::SerializeJsonObjectToString(Json, OutJsonString);
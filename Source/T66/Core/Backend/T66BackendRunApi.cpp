@@ -2,6 +2,20 @@
 
 #include "Core/Backend/T66BackendPrivate.h"
 
+namespace
+{
+	bool T66IsRetryableSubmitRunFailure(const bool bConnectedSuccessfully, const int32 ResponseCode)
+	{
+		return !bConnectedSuccessfully || ResponseCode == 408 || ResponseCode == 429 || ResponseCode >= 500;
+	}
+
+	/** The Steam ticket expired; the payload is still good once a fresh ticket is set. */
+	bool T66IsExpiredTicketSubmitRunFailure(const bool bConnectedSuccessfully, const int32 ResponseCode)
+	{
+		return bConnectedSuccessfully && ResponseCode == 401;
+	}
+}
+
 void UT66BackendSubsystem::SubmitRunToBackend(
 	const FString& DisplayName,
 	int32 Score,
@@ -30,7 +44,8 @@ void UT66BackendSubsystem::SubmitRunToBackend(
 		return;
 	}
 
-	const TSharedPtr<FJsonObject> LocalRunObject = T66BackendRunSerializer::BuildRunJsonObject(
+	// Only the plain copy crosses to the worker; the JSON tree and its serialization never run on the game thread.
+	FT66BackendRunSnapshot LocalRun = T66BackendRunSerializer::CaptureRunSnapshot(
 		HeroId,
 		CompanionId,
 		Difficulty,
@@ -40,56 +55,102 @@ void UT66BackendSubsystem::SubmitRunToBackend(
 		TimeMs,
 		Snapshot);
 
-	FString LocalRunJson;
-	if (!T66SerializeJsonObjectToString(LocalRunObject, LocalRunJson))
+	if (PartySize == ET66PartySize::Solo)
 	{
-		UE_LOG(LogT66Backend, Warning, TEXT("Backend: cannot submit run — failed to serialize run summary payload."));
-		OnSubmitRunComplete.Broadcast(false, 0, 0, false);
-		OnSubmitRunDataReady.Broadcast(RequestKey, false, 0, 0, 0, 0, false, false);
+		QueueSubmitRunBody([LocalRun = MoveTemp(LocalRun), DisplayName, RequestKey]()
+		{
+			TSharedPtr<FJsonObject> Root = MakeShared<FJsonObject>();
+			Root->SetStringField(TEXT("display_name"), DisplayName);
+			if (!RequestKey.IsEmpty())
+			{
+				Root->SetStringField(TEXT("submission_id"), RequestKey);
+			}
+			Root->SetObjectField(TEXT("run"), T66BackendRunSerializer::BuildRunJsonObject(LocalRun));
+			return Root;
+		}, RequestKey);
+
+		UE_LOG(LogT66Backend, Log, TEXT("Backend: submitting run (Score=%d, Difficulty=%s, Party=%s)"),
+			Score, *DifficultyToApiString(Difficulty), *PartySizeToApiString(PartySize));
 		return;
 	}
 
+	FPendingCoopSubmit Submit;
+	Submit.DisplayName = DisplayName;
+	Submit.Score = Score;
+	Submit.TimeMs = TimeMs;
+	Submit.Difficulty = Difficulty;
+	Submit.PartySize = PartySize;
+	Submit.StageReached = StageReached;
+	Submit.HeroId = HeroId;
+	Submit.CompanionId = CompanionId;
+	Submit.RequestKey = RequestKey;
+
+	TWeakObjectPtr<UT66BackendSubsystem> WeakThis(this);
+	Async(EAsyncExecution::ThreadPool, [WeakThis, LocalRun = MoveTemp(LocalRun), Submit = MoveTemp(Submit)]() mutable
+	{
+		const bool bSerialized = T66SerializeJsonObjectToString(T66BackendRunSerializer::BuildRunJsonObject(LocalRun), Submit.HostRunJson);
+		AsyncTask(ENamedThreads::GameThread, [WeakThis, Submit = MoveTemp(Submit), bSerialized]()
+		{
+			UT66BackendSubsystem* Backend = WeakThis.Get();
+			if (!Backend)
+			{
+				return;
+			}
+
+			if (!bSerialized)
+			{
+				UE_LOG(LogT66Backend, Warning, TEXT("Backend: cannot submit run — failed to serialize run summary payload."));
+				Backend->OnSubmitRunComplete.Broadcast(false, 0, 0, false);
+				Backend->OnSubmitRunDataReady.Broadcast(Submit.RequestKey, false, 0, 0, 0, 0, false, false);
+				return;
+			}
+
+			Backend->ContinueCoopSubmitRun(Submit);
+		});
+	});
+}
+
+void UT66BackendSubsystem::ContinueCoopSubmitRun(const FPendingCoopSubmit& Submit)
+{
+	const FString& RequestKey = Submit.RequestKey;
 	UGameInstance* GI = GetGameInstance();
 	UT66SessionSubsystem* SessionSubsystem = GI ? GI->GetSubsystem<UT66SessionSubsystem>() : nullptr;
 
-	if (PartySize != ET66PartySize::Solo)
+	if (!SessionSubsystem || !SessionSubsystem->IsPartySessionActive())
 	{
-		if (!SessionSubsystem || !SessionSubsystem->IsPartySessionActive())
-		{
-			UE_LOG(LogT66Backend, Log, TEXT("Backend: skipping co-op submit because no active party session was found."));
-			OnSubmitRunComplete.Broadcast(false, 0, 0, false);
-			OnSubmitRunDataReady.Broadcast(RequestKey, false, 0, 0, 0, 0, false, false);
-			return;
-		}
+		UE_LOG(LogT66Backend, Log, TEXT("Backend: skipping co-op submit because no active party session was found."));
+		OnSubmitRunComplete.Broadcast(false, 0, 0, false);
+		OnSubmitRunDataReady.Broadcast(RequestKey, false, 0, 0, 0, 0, false, false);
+		return;
+	}
 
-		const bool bCachedForHost = SessionSubsystem->SubmitLocalPartyRunSummaryToHost(RequestKey, LocalRunJson);
-		if (!bCachedForHost)
-		{
-			UE_LOG(LogT66Backend, Warning, TEXT("Backend: skipping co-op submit because the local run summary could not be handed to the host."));
-			OnSubmitRunComplete.Broadcast(false, 0, 0, false);
-			OnSubmitRunDataReady.Broadcast(RequestKey, false, 0, 0, 0, 0, false, false);
-			return;
-		}
+	const bool bCachedForHost = SessionSubsystem->SubmitLocalPartyRunSummaryToHost(RequestKey, Submit.HostRunJson);
+	if (!bCachedForHost)
+	{
+		UE_LOG(LogT66Backend, Warning, TEXT("Backend: skipping co-op submit because the local run summary could not be handed to the host."));
+		OnSubmitRunComplete.Broadcast(false, 0, 0, false);
+		OnSubmitRunDataReady.Broadcast(RequestKey, false, 0, 0, 0, 0, false, false);
+		return;
+	}
 
-		if (!SessionSubsystem->IsLocalPlayerPartyHost())
-		{
-			UE_LOG(LogT66Backend, Log, TEXT("Backend: forwarded co-op run summary to host; non-host client will not submit directly."));
-			OnSubmitRunComplete.Broadcast(false, 0, 0, false);
-			OnSubmitRunDataReady.Broadcast(RequestKey, false, 0, 0, 0, 0, false, false);
-			return;
-		}
+	if (!SessionSubsystem->IsLocalPlayerPartyHost())
+	{
+		UE_LOG(LogT66Backend, Log, TEXT("Backend: forwarded co-op run summary to host; non-host client will not submit directly."));
+		OnSubmitRunComplete.Broadcast(false, 0, 0, false);
+		OnSubmitRunDataReady.Broadcast(RequestKey, false, 0, 0, 0, 0, false, false);
+		return;
 	}
 
 	(void)TrySubmitRunToBackendNow(
-		DisplayName,
-		Score,
-		TimeMs,
-		Difficulty,
-		PartySize,
-		StageReached,
-		HeroId,
-		CompanionId,
-		LocalRunJson,
+		Submit.DisplayName,
+		Submit.Score,
+		Submit.TimeMs,
+		Submit.Difficulty,
+		Submit.PartySize,
+		Submit.StageReached,
+		Submit.HeroId,
+		Submit.CompanionId,
+		Submit.HostRunJson,
 		RequestKey);
 }
 
@@ -251,24 +312,176 @@ bool UT66BackendSubsystem::TrySubmitRunToBackendNow(
 	}
 
 	Root->SetObjectField(TEXT("run"), HostRunObject);
-	SendSubmitRunRequest(Root, RequestKey);
+	QueueSubmitRunBody([Root]() { return Root; }, RequestKey);
 
 	UE_LOG(LogT66Backend, Log, TEXT("Backend: submitting run (Score=%d, Difficulty=%s, Party=%s)"),
 		Score, *DifficultyToApiString(Difficulty), *PartySizeToApiString(PartySize));
 	return true;
 }
 
-void UT66BackendSubsystem::SendSubmitRunRequest(const TSharedPtr<FJsonObject>& Root, const FString& RequestKey)
+void UT66BackendSubsystem::QueueSubmitRunBody(TFunction<TSharedPtr<FJsonObject>()>&& BuildRoot, const FString& RequestKey)
 {
-	FString Payload;
-	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Payload);
-	FJsonSerializer::Serialize(Root.ToSharedRef(), Writer);
+	TWeakObjectPtr<UT66BackendSubsystem> WeakThis(this);
+	Async(EAsyncExecution::ThreadPool, [WeakThis, BuildRoot = MoveTemp(BuildRoot), OwnerSteamId = GetSignedInSteamId(), RequestKey]()
+	{
+		FT66RunOutboxEntry Entry;
+		const bool bQueued = T66BackendRunOutbox::WriteEntry(BuildRoot(), OwnerSteamId, RequestKey, Entry);
+		AsyncTask(ENamedThreads::GameThread, [WeakThis, Entry = MoveTemp(Entry), RequestKey, bQueued]() mutable
+		{
+			UT66BackendSubsystem* Backend = WeakThis.Get();
+			if (!Backend)
+			{
+				// The file is already on disk; the next launch drains it.
+				return;
+			}
+
+			if (!bQueued)
+			{
+				UE_LOG(LogT66Backend, Warning, TEXT("Backend: cannot submit run — failed to write the run payload to the outbox."));
+				Backend->OnSubmitRunComplete.Broadcast(false, 0, 0, false);
+				Backend->OnSubmitRunDataReady.Broadcast(RequestKey, false, 0, 0, 0, 0, false, false);
+				return;
+			}
+
+			UE_LOG(LogT66Backend, Verbose, TEXT("Backend: queued run %s (%d bytes, %d gzipped)."), *Entry.Id, Entry.UncompressedSize, Entry.GzipBody.Num());
+			TArray<FT66RunOutboxEntry> Entries;
+			Entries.Add(MoveTemp(Entry));
+			Backend->AddRunOutboxEntries(MoveTemp(Entries));
+		});
+	});
+}
+
+FString UT66BackendSubsystem::GetSignedInSteamId() const
+{
+	const UGameInstance* GI = GetGameInstance();
+	const UT66SteamHelper* SteamHelper = GI ? GI->GetSubsystem<UT66SteamHelper>() : nullptr;
+	return SteamHelper ? SteamHelper->GetLocalSteamId() : FString();
+}
+
+void UT66BackendSubsystem::LoadRunOutboxForOwner(const FString& OwnerSteamId)
+{
+	RunOutboxOwnerSteamId = OwnerSteamId;
+	bRunOutboxOwnerLoaded = true;
+
+	// Another account's runs stay on disk for that account's next session; answers still in flight for them are dropped.
+	RunOutbox.RemoveAll([&OwnerSteamId](const FT66RunOutboxEntry& Entry) { return Entry.OwnerSteamId != OwnerSteamId; });
+
+	// Runs that never got a definitive answer last session are still on disk; load them off the game thread.
+	TWeakObjectPtr<UT66BackendSubsystem> WeakThis(this);
+	const int64 OutboxMaxAgeSeconds = static_cast<int64>(FMath::Max(1, CVarT66SubmitRunOutboxMaxAgeDays.GetValueOnGameThread())) * 24 * 60 * 60;
+	Async(EAsyncExecution::ThreadPool, [WeakThis, OwnerSteamId, OutboxMaxAgeSeconds]()
+	{
+		TArray<FT66RunOutboxEntry> Entries = T66BackendRunOutbox::LoadEntries(OwnerSteamId, OutboxMaxAgeSeconds);
+		if (Entries.Num() == 0)
+		{
+			return;
+		}
 
-	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = CreateRequest(TEXT("POST"), TEXT("/api/submit-run"));
+		AsyncTask(ENamedThreads::GameThread, [WeakThis, OwnerSteamId, Entries = MoveTemp(Entries)]() mutable
+		{
+			UT66BackendSubsystem* Backend = WeakThis.Get();
+			// The account may have switched again while the folder was being read.
+			if (!Backend || Backend->RunOutboxOwnerSteamId != OwnerSteamId)
+			{
+				return;
+			}
+
+			UE_LOG(LogT66Backend, Log, TEXT("Backend: draining %d queued run submission(s) from a previous session."), Entries.Num());
+			Backend->AddRunOutboxEntries(MoveTemp(Entries));
+		});
+	});
+}
+
+void UT66BackendSubsystem::AddRunOutboxEntries(TArray<FT66RunOutboxEntry>&& Entries)
+{
+	for (FT66RunOutboxEntry& Entry : Entries)
+	{
+		if (!RunOutbox.ContainsByPredicate([&Entry](const FT66RunOutboxEntry& Existing) { return Existing.Id == Entry.Id; }))
+		{
+			RunOutbox.Add(MoveTemp(Entry));
+		}
+	}
+
+	if (RunOutbox.Num() > 0 && !RunOutboxTickerHandle.IsValid())
+	{
+		RunOutboxTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+			FTickerDelegate::CreateUObject(this, &UT66BackendSubsystem::HandleRunOutboxTicker),
+			1.0f);
+	}
+
+	PumpRunOutbox();
+}
+
+bool UT66BackendSubsystem::HandleRunOutboxTicker(float DeltaTime)
+{
+	(void)DeltaTime;
+
+	PumpRunOutbox();
+	if (RunOutbox.Num() <= 0)
+	{
+		RunOutboxTickerHandle.Reset();
+		return false;
+	}
+
+	return true;
+}
+
+void UT66BackendSubsystem::PumpRunOutbox()
+{
+	if (!IsBackendConfigured() || !HasSteamTicket())
+	{
+		return;
+	}
+
+	// The ticket authenticates the signed-in account, so it may only carry that account's runs.
+	const FString SignedInSteamId = GetSignedInSteamId();
+	const double Now = FPlatformTime::Seconds();
+	TArray<FString, TInlineAllocator<4>> DueIds;
+	for (FT66RunOutboxEntry& Entry : RunOutbox)
+	{
+		if (!Entry.bInFlight && Entry.NextAttemptTimeSeconds <= Now && Entry.OwnerSteamId == SignedInSteamId)
+		{
+			Entry.bInFlight = true;
+			DueIds.Add(Entry.Id);
+		}
+	}
+
+	// Sending can complete synchronously with a fake transport, which mutates RunOutbox; look entries up by id.
+	for (const FString& OutboxId : DueIds)
+	{
+		const FT66RunOutboxEntry* Entry = RunOutbox.FindByPredicate([&OutboxId](const FT66RunOutboxEntry& Candidate) { return Candidate.Id == OutboxId; });
+		if (!Entry)
+		{
+			continue;
+		}
+
+		SendRunOutboxEntry(*Entry);
+	}
+}
+
+void UT66BackendSubsystem::SendRunOutboxEntry(const FT66RunOutboxEntry& Entry)
+{
+	FT66BackendHttpRequest Request = CreateRequest(TEXT("POST"), TEXT("/api/submit-run"));
 	SetAuthHeaders(Request);
-	Request->SetContentAsString(Payload);
-	Request->OnProcessRequestComplete().BindUObject(this, &UT66BackendSubsystem::OnSubmitRunResponseReceived, RequestKey);
-	Request->ProcessRequest();
+	if (bGzipSubmitRunBody)
+	{
+		Request.SetHeader(TEXT("Content-Encoding"), TEXT("gzip"));
+		Request.Content = Entry.GzipBody;
+	}
+	else
+	{
+		TArray<uint8> Body;
+		if (!T66BackendRunOutbox::DecompressBody(Entry, Body))
+		{
+			HandleSubmitRunResult(Entry.Id, true, 400, FString());
+			return;
+		}
+		Request.Content = MoveTemp(Body);
+	}
+	SendRequest(MoveTemp(Request), [this, OutboxId = Entry.Id](const FT66BackendHttpResponse& Response)
+	{
+		HandleSubmitRunResult(OutboxId, Response.bConnectedSuccessfully, Response.Code, Response.Body);
+	});
 }
 
 void UT66BackendSubsystem::FetchCurrentDailyClimb()
@@ -281,13 +494,15 @@ void UT66BackendSubsystem::FetchCurrentDailyClimb()
 		return;
 	}
 
-	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = CreateRequest(TEXT("GET"), TEXT("/api/daily/current"));
+	FT66BackendHttpRequest Request = CreateRequest(TEXT("GET"), TEXT("/api/daily/current"));
 	if (HasSteamTicket())
 	{
 		SetAuthHeaders(Request);
 	}
-	Request->OnProcessRequestComplete().BindUObject(this, &UT66BackendSubsystem::OnDailyClimbStatusResponseReceived, FString(TEXT("current")));
-	Request->ProcessRequest();
+	SendRequest(MoveTemp(Request), [this](const FT66BackendHttpResponse& Response)
+	{
+		OnDailyClimbStatusResponseReceived(Response, FString(TEXT("current")));
+	});
 }
 
 void UT66BackendSubsystem::StartDailyClimbAttempt()
@@ -308,11 +523,13 @@ void UT66BackendSubsystem::StartDailyClimbAttempt()
 		return;
 	}
 
-	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = CreateRequest(TEXT("POST"), TEXT("/api/daily/start"));
+	FT66BackendHttpRequest Request = CreateRequest(TEXT("POST"), TEXT("/api/daily/start"));
 	SetAuthHeaders(Request);
-	Request->SetContentAsString(TEXT("{}"));
-	Request->OnProcessRequestComplete().BindUObject(this, &UT66BackendSubsystem::OnDailyClimbStatusResponseReceived, FString(TEXT("start")));
-	Request->ProcessRequest();
+	Request.SetContentAsString(TEXT("{}"));
+	SendRequest(MoveTemp(Request), [this](const FT66BackendHttpResponse& Response)
+	{
+		OnDailyClimbStatusResponseReceived(Response, FString(TEXT("start")));
+	});
 }
 
 void UT66BackendSubsystem::SubmitDailyClimbRun(
@@ -355,11 +572,13 @@ void UT66BackendSubsystem::SubmitDailyClimbRun(
 	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Payload);
 	FJsonSerializer::Serialize(Root.ToSharedRef(), Writer);
 
-	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = CreateRequest(TEXT("POST"), TEXT("/api/daily/submit"));
+	FT66BackendHttpRequest Request = CreateRequest(TEXT("POST"), TEXT("/api/daily/submit"));
 	SetAuthHeaders(Request);
-	Request->SetContentAsString(Payload);
-	Request->OnProcessRequestComplete().BindUObject(this, &UT66BackendSubsystem::OnDailyClimbSubmitResponseReceived, RequestKey);
-	Request->ProcessRequest();
+	Request.SetContentAsString(Payload);
+	SendRequest(MoveTemp(Request), [this, RequestKey](const FT66BackendHttpResponse& Response)
+	{
+		OnDailyClimbSubmitResponseReceived(Response, RequestKey);
+	});
 }
 
 bool UT66BackendSubsystem::HandlePendingCoopSubmitTicker(float DeltaTime)
@@ -417,21 +636,78 @@ bool UT66BackendSubsystem::HandlePendingCoopSubmitTicker(float DeltaTime)
 	return true;
 }
 
-void UT66BackendSubsystem::OnSubmitRunResponseReceived(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bConnectedSuccessfully, FString RequestKey)
+void UT66BackendSubsystem::HandleSubmitRunResult(const FString& OutboxId, bool bConnectedSuccessfully, int32 ResponseCode, const FString& ResponseBody)
 {
-	if (!bConnectedSuccessfully || !Response.IsValid())
+	const int32 EntryIndex = RunOutbox.IndexOfByPredicate([&OutboxId](const FT66RunOutboxEntry& Entry) { return Entry.Id == OutboxId; });
+	if (EntryIndex == INDEX_NONE)
 	{
-		UE_LOG(LogT66Backend, Warning, TEXT("Backend: submit-run failed (connection error)."));
-		LastSubmitRunStatus = TEXT("connection_error");
-		LastSubmitRunReason = TEXT("connection_error");
-		OnSubmitRunComplete.Broadcast(false, 0, 0, false);
-		OnSubmitRunDataReady.Broadcast(RequestKey, false, 0, 0, 0, 0, false, false);
 		return;
 	}
 
-	const int32 Code = Response->GetResponseCode();
-	const FString Body = Response->GetContentAsString();
+	FT66RunOutboxEntry& Entry = RunOutbox[EntryIndex];
+	Entry.bInFlight = false;
+
+	const bool bTicketExpired = T66IsExpiredTicketSubmitRunFailure(bConnectedSuccessfully, ResponseCode);
+	if (bTicketExpired || T66IsRetryableSubmitRunFailure(bConnectedSuccessfully, ResponseCode))
+	{
+		++Entry.AttemptCount;
+		const float BaseDelay = FMath::Max(0.5f, CVarT66SubmitRunRetryBaseSeconds.GetValueOnGameThread());
+		const float MaxDelay = FMath::Max(BaseDelay, CVarT66SubmitRunRetryMaxSeconds.GetValueOnGameThread());
+		const float Delay = FMath::Min(MaxDelay, BaseDelay * FMath::Pow(2.f, static_cast<float>(FMath::Min(Entry.AttemptCount - 1, 16))));
+		Entry.NextAttemptTimeSeconds = FPlatformTime::Seconds() + Delay * FMath::FRandRange(0.8f, 1.2f);
+
+		UE_LOG(LogT66Backend, Warning, TEXT("Backend: submit-run attempt %d failed (%s, code=%d); run %s stays queued, retry in %.0fs."),
+			Entry.AttemptCount,
+			bTicketExpired ? TEXT("ticket expired") : (bConnectedSuccessfully ? TEXT("server error") : TEXT("connection error")),
+			ResponseCode,
+			*Entry.Id,
+			Delay);
+
+		// A fresh ticket pulls the retry forward (see SetSteamTicketHex); the backoff covers Steam never answering.
+		if (bTicketExpired && !bRunOutboxTicketRefreshPending)
+		{
+			UGameInstance* GI = GetGameInstance();
+			if (UT66SteamHelper* SteamHelper = GI ? GI->GetSubsystem<UT66SteamHelper>() : nullptr)
+			{
+				bRunOutboxTicketRefreshPending = true;
+				SteamHelper->RequestNewTicket();
+			}
+		}
+
+		// Let the end-of-run UI settle on the first failure; the queue keeps retrying underneath it.
+		if (!Entry.bRestored && !Entry.bFailureReported)
+		{
+			Entry.bFailureReported = true;
+			LastSubmitRunStatus = bTicketExpired ? TEXT("ticket_expired") : (bConnectedSuccessfully ? TEXT("server_error") : TEXT("connection_error"));
+			LastSubmitRunReason = TEXT("queued_for_retry");
+			OnSubmitRunComplete.Broadcast(false, 0, 0, false);
+			OnSubmitRunDataReady.Broadcast(Entry.RequestKey, false, 0, 0, 0, 0, false, false);
+		}
+
+		if (Entry.AttemptCount >= FMath::Max(1, CVarT66SubmitRunMaxAttemptsPerSession.GetValueOnGameThread()))
+		{
+			UE_LOG(LogT66Backend, Warning, TEXT("Backend: run %s left in the outbox for the next launch."), *Entry.Id);
+			RunOutbox.RemoveAt(EntryIndex);
+		}
+		return;
+	}
+
+	// Any other answer is final for this payload, so it leaves the outbox whether or not it was accepted.
+	const FT66RunOutboxEntry Delivered = MoveTemp(Entry);
+	RunOutbox.RemoveAt(EntryIndex);
+	T66BackendRunOutbox::DeleteEntry(Delivered);
+
+	if (Delivered.bRestored)
+	{
+		UE_LOG(LogT66Backend, Log, TEXT("Backend: delivered run %s queued by a previous session (code=%d)."), *Delivered.Id, ResponseCode);
+		return;
+	}
+
+	ApplySubmitRunResponse(Delivered.RequestKey, ResponseCode, ResponseBody);
+}
 
+void UT66BackendSubsystem::ApplySubmitRunResponse(const FString& RequestKey, int32 Code, const FString& Body)
+{
 	TSharedPtr<FJsonObject> Json;
 	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Body);
 	if (!FJsonSerializer::Deserialize(Reader, Json) || !Json.IsValid())
@@ -519,12 +795,10 @@ void UT66BackendSubsystem::OnSubmitRunResponseReceived(FHttpRequestPtr Request,
 }
 
 void UT66BackendSubsystem::OnDailyClimbStatusResponseReceived(
-	FHttpRequestPtr Request,
-	FHttpResponsePtr Response,
-	bool bConnectedSuccessfully,
+	const FT66BackendHttpResponse& Response,
 	FString RequestTag)
 {
-	if (!bConnectedSuccessfully || !Response.IsValid())
+	if (!Response.bConnectedSuccessfully)
 	{
 		LastDailyClimbStatus = TEXT("connection_error");
 		LastDailyClimbMessage = TEXT("Daily Climb request failed.");
@@ -533,7 +807,7 @@ void UT66BackendSubsystem::OnDailyClimbStatusResponseReceived(
 	}
 
 	TSharedPtr<FJsonObject> Json;
-	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Response->GetContentAsString());
+	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Response.Body);
 	if (!FJsonSerializer::Deserialize(Reader, Json) || !Json.IsValid())
 	{
 		LastDailyClimbStatus = TEXT("parse_error");
@@ -558,12 +832,10 @@ void UT66BackendSubsystem::OnDailyClimbStatusResponseReceived(
 }
 
 void UT66BackendSubsystem::OnDailyClimbSubmitResponseReceived(
-	FHttpRequestPtr Request,
-	FHttpResponsePtr Response,
-	bool bConnectedSuccessfully,
+	const FT66BackendHttpResponse& Response,
 	FString RequestKey)
 {
-	if (!bConnectedSuccessfully || !Response.IsValid())
+	if (!Response.bConnectedSuccessfully)
 	{
 		LastDailyClimbStatus = TEXT("connection_error");
 		LastDailyClimbMessage = TEXT("Daily Climb submit failed.");
@@ -572,7 +844,7 @@ void UT66BackendSubsystem::OnDailyClimbSubmitResponseReceived(
 	}
 
 	TSharedPtr<FJsonObject> Json;
-	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Response->GetContentAsString());
+	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Response.Body);
 	if (!FJsonSerializer::Deserialize(Reader, Json) || !Json.IsValid())
 	{
 		LastDailyClimbStatus = TEXT("parse_error");
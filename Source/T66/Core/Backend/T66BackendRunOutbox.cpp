@@ -0,0 +1,169 @@
+// Copyright Tribulation 66. All Rights Reserved.
+
+#include "Core/Backend/T66BackendRunOutbox.h"
+#include "Core/Backend/T66BackendRunSerializer.h"
+#include "Dom/JsonObject.h"
+#include "HAL/FileManager.h"
+#include "Misc/Compression.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Guid.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace
+{
+	constexpr uint32 T66RunOutboxMagic = 0x54363652; // "T66R"
+	constexpr int32 T66RunOutboxVersion = 1;
+	const TCHAR* const T66RunOutboxExtension = TEXT(".t66run");
+
+	bool T66ReadOutboxFile(const FString& FilePath, FT66RunOutboxEntry& OutEntry)
+	{
+		TArray<uint8> Bytes;
+		if (!FFileHelper::LoadFileToArray(Bytes, *FilePath))
+		{
+			return false;
+		}
+
+		FMemoryReader Reader(Bytes);
+		uint32 Magic = 0;
+		int32 Version = 0;
+		Reader << Magic;
+		Reader << Version;
+		if (Reader.IsError() || Magic != T66RunOutboxMagic || Version != T66RunOutboxVersion)
+		{
+			return false;
+		}
+
+		Reader << OutEntry.RequestKey;
+		Reader << OutEntry.CreatedUnixSeconds;
+		Reader << OutEntry.UncompressedSize;
+		Reader << OutEntry.GzipBody;
+		if (Reader.IsError() || OutEntry.UncompressedSize <= 0 || OutEntry.GzipBody.Num() == 0)
+		{
+			return false;
+		}
+
+		OutEntry.Id = FPaths::GetBaseFilename(FilePath);
+		OutEntry.FilePath = FilePath;
+		return true;
+	}
+}
+
+FString T66BackendRunOutbox::GetOutboxDirectory(const FString& OwnerSteamId)
+{
+	const FString OwnerFolder = OwnerSteamId.IsEmpty() ? FString(TEXT("Local")) : FPaths::MakeValidFileName(OwnerSteamId);
+	return FPaths::ProjectSavedDir() / TEXT("T66") / TEXT("SubmitRunOutbox") / OwnerFolder;
+}
+
+bool T66BackendRunOutbox::WriteEntry(const TSharedPtr<FJsonObject>& Root, const FString& OwnerSteamId, const FString& RequestKey, FT66RunOutboxEntry& OutEntry)
+{
+	if (!Root.IsValid())
+	{
+		return false;
+	}
+
+	OutEntry = FT66RunOutboxEntry();
+	OutEntry.Id = FGuid::NewGuid().ToString(EGuidFormats::Digits);
+	OutEntry.OwnerSteamId = OwnerSteamId;
+	OutEntry.RequestKey = RequestKey;
+	OutEntry.CreatedUnixSeconds = FDateTime::UtcNow().ToUnixTimestamp();
+
+	// The backend caches responses per submission_id, so a stable id makes every retry idempotent.
+	if (!Root->HasField(TEXT("submission_id")))
+	{
+		Root->SetStringField(TEXT("submission_id"), OutEntry.Id);
+	}
+
+	FString Json;
+	if (!T66BackendRunSerializer::SerializeJsonObjectToCondensedString(Root, Json))
+	{
+		return false;
+	}
+
+	const FTCHARToUTF8 Utf8(*Json);
+	OutEntry.UncompressedSize = Utf8.Length();
+	int32 CompressedSize = FCompression::CompressMemoryBound(NAME_Gzip, OutEntry.UncompressedSize);
+	OutEntry.GzipBody.SetNumUninitialized(CompressedSize);
+	if (!FCompression::CompressMemory(NAME_Gzip, OutEntry.GzipBody.GetData(), CompressedSize, Utf8.Get(), OutEntry.UncompressedSize))
+	{
+		return false;
+	}
+	OutEntry.GzipBody.SetNum(CompressedSize);
+
+	TArray<uint8> Bytes;
+	FMemoryWriter Writer(Bytes);
+	uint32 Magic = T66RunOutboxMagic;
+	int32 Version = T66RunOutboxVersion;
+	Writer << Magic;
+	Writer << Version;
+	Writer << OutEntry.RequestKey;
+	Writer << OutEntry.CreatedUnixSeconds;
+	Writer << OutEntry.UncompressedSize;
+	Writer << OutEntry.GzipBody;
+
+	// Write-then-rename so a crash mid-write never leaves a truncated entry for the next launch to trip on.
+	const FString Directory = GetOutboxDirectory(OwnerSteamId);
+	IFileManager::Get().MakeDirectory(*Directory, true);
+	OutEntry.FilePath = Directory / (OutEntry.Id + T66RunOutboxExtension);
+	const FString TempPath = OutEntry.FilePath + TEXT(".tmp");
+	if (!FFileHelper::SaveArrayToFile(Bytes, *TempPath) || !IFileManager::Get().Move(*OutEntry.FilePath, *TempPath))
+	{
+		IFileManager::Get().Delete(*TempPath, false, false, true);
+		return false;
+	}
+
+	return true;
+}
+
+TArray<FT66RunOutboxEntry> T66BackendRunOutbox::LoadEntries(const FString& OwnerSteamId, const int64 MaxAgeSeconds)
+{
+	TArray<FT66RunOutboxEntry> Entries;
+	const FString Directory = GetOutboxDirectory(OwnerSteamId);
+
+	TArray<FString> FileNames;
+	IFileManager::Get().FindFiles(FileNames, *(Directory / (FString(TEXT("*")) + T66RunOutboxExtension)), true, false);
+
+	const int64 NowUnixSeconds = FDateTime::UtcNow().ToUnixTimestamp();
+	for (const FString& FileName : FileNames)
+	{
+		const FString FilePath = Directory / FileName;
+		FT66RunOutboxEntry Entry;
+		if (!T66ReadOutboxFile(FilePath, Entry) || NowUnixSeconds - Entry.CreatedUnixSeconds > MaxAgeSeconds)
+		{
+			IFileManager::Get().Delete(*FilePath, false, false, true);
+			continue;
+		}
+
+		Entry.OwnerSteamId = OwnerSteamId;
+		Entry.bRestored = true;
+		Entries.Add(MoveTemp(Entry));
+	}
+
+	Entries.Sort([](const FT66RunOutboxEntry& A, const FT66RunOutboxEntry& B)
+	{
+		return A.CreatedUnixSeconds < B.CreatedUnixSeconds;
+	});
+	return Entries;
+}
+
+bool T66BackendRunOutbox::DecompressBody(const FT66RunOutboxEntry& Entry, TArray<uint8>& OutBody)
+{
+	OutBody.SetNumUninitialized(Entry.UncompressedSize);
+	if (!FCompression::UncompressMemory(NAME_Gzip, OutBody.GetData(), Entry.UncompressedSize, Entry.GzipBody.GetData(), Entry.GzipBody.Num()))
+	{
+		OutBody.Reset();
+		return false;
+	}
+
+	return true;
+}
+
+void T66BackendRunOutbox::DeleteEntry(const FT66RunOutboxEntry& Entry)
+{
+	if (!Entry.FilePath.IsEmpty())
+	{
+		IFileManager::Get().Delete(*Entry.FilePath, false, false, true);
+	}
+}
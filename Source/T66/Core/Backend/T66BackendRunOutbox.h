@@ -0,0 +1,44 @@
+// Copyright Tribulation 66. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FJsonObject;
+
+/** One /api/submit-run body waiting for a definitive backend answer, persisted under Saved/T66/SubmitRunOutbox/<SteamId>. */
+struct FT66RunOutboxEntry
+{
+	/** File stem; also used as submission_id when the caller did not supply a request key. */
+	FString Id;
+	/** Steam account that finished the run; only that account's ticket may post it. */
+	FString OwnerSteamId;
+	FString RequestKey;
+	FString FilePath;
+	int64 CreatedUnixSeconds = 0;
+	int32 UncompressedSize = 0;
+	TArray<uint8> GzipBody;
+
+	int32 AttemptCount = 0;
+	double NextAttemptTimeSeconds = 0.0;
+	bool bInFlight = false;
+	bool bFailureReported = false;
+	/** Left over from a previous launch; nobody in this session is waiting on its result. */
+	bool bRestored = false;
+};
+
+/** File-level helpers for the submit-run outbox. Everything except DeleteEntry is meant to run on a worker. */
+namespace T66BackendRunOutbox
+{
+	/** Per-account folder; runs queued without a signed-in Steam ID share a "Local" folder. */
+	FString GetOutboxDirectory(const FString& OwnerSteamId);
+
+	/** Serializes Root as condensed JSON, gzips it and writes a new outbox file for OwnerSteamId. Stamps submission_id when missing. */
+	bool WriteEntry(const TSharedPtr<FJsonObject>& Root, const FString& OwnerSteamId, const FString& RequestKey, FT66RunOutboxEntry& OutEntry);
+
+	/** Every readable entry OwnerSteamId left on disk; corrupt or expired files are deleted along the way. */
+	TArray<FT66RunOutboxEntry> LoadEntries(const FString& OwnerSteamId, int64 MaxAgeSeconds);
+
+	bool DecompressBody(const FT66RunOutboxEntry& Entry, TArray<uint8>& OutBody);
+	void DeleteEntry(const FT66RunOutboxEntry& Entry);
+}
@@ -5,6 +5,7 @@
 #include "Dom/JsonObject.h"
 #include "Serialization/JsonReader.h"
 #include "Serialization/JsonSerializer.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
 #include "Serialization/JsonWriter.h"
 
 namespace
@@ -95,7 +96,7 @@ namespace
 	}
 }
 
-TSharedPtr<FJsonObject> T66BackendRunSerializer::BuildRunJsonObject(
+FT66BackendRunSnapshot T66BackendRunSerializer::CaptureRunSnapshot(
 	const FString& HeroId,
 	const FString& CompanionId,
 	ET66Difficulty Difficulty,
@@ -103,38 +104,101 @@ TSharedPtr<FJsonObject> T66BackendRunSerializer::BuildRunJsonObject(
 	int32 StageReached,
 	int32 Score,
 	int32 TimeMs,
-	UT66LeaderboardRunSummarySaveGame* Snapshot)
+	const UT66LeaderboardRunSummarySaveGame* Snapshot)
 {
-	TSharedPtr<FJsonObject> RunObj = MakeShared<FJsonObject>();
-	RunObj->SetStringField(TEXT("hero_id"), HeroId);
-	RunObj->SetStringField(TEXT("companion_id"), CompanionId);
-	RunObj->SetStringField(TEXT("difficulty"), T66DifficultyToApiString(Difficulty));
-	RunObj->SetStringField(TEXT("party_size"), T66PartySizeToApiString(PartySize));
-	RunObj->SetNumberField(TEXT("stage_reached"), T66MakeBackendCompatibleStageReached(Difficulty, StageReached));
-	RunObj->SetNumberField(TEXT("local_stage_reached"), T66NormalizeLocalStageReached(Difficulty, StageReached));
-	RunObj->SetNumberField(TEXT("score"), Score);
-	RunObj->SetNumberField(TEXT("time_ms"), TimeMs);
+	FT66BackendRunSnapshot Run;
+	Run.HeroId = HeroId;
+	Run.CompanionId = CompanionId;
+	Run.Difficulty = Difficulty;
+	Run.PartySize = PartySize;
+	Run.StageReached = StageReached;
+	Run.Score = Score;
+	Run.TimeMs = TimeMs;
 
 	if (!Snapshot)
+	{
+		return Run;
+	}
+
+	Run.bHasSummary = true;
+	Run.HeroLevel = Snapshot->HeroLevel;
+	Run.DamageStat = Snapshot->DamageStat;
+	Run.AttackSpeedStat = Snapshot->AttackSpeedStat;
+	Run.AttackScaleStat = Snapshot->AttackScaleStat;
+	Run.AccuracyStat = Snapshot->AccuracyStat;
+	Run.ArmorStat = Snapshot->ArmorStat;
+	Run.EvasionStat = Snapshot->EvasionStat;
+	Run.LuckStat = Snapshot->LuckStat;
+	Run.SpeedStat = Snapshot->SpeedStat;
+	Run.SecondaryStatValues = Snapshot->SecondaryStatValues;
+	Run.LuckRating0To100 = Snapshot->LuckRating0To100;
+	Run.SeedLuck0To100 = Snapshot->SeedLuck0To100;
+	Run.LuckModifierPercent = Snapshot->LuckModifierPercent;
+	Run.EffectiveLuck = Snapshot->EffectiveLuck;
+	Run.LuckRatingQuantity0To100 = Snapshot->LuckRatingQuantity0To100;
+	Run.LuckRatingQuality0To100 = Snapshot->LuckRatingQuality0To100;
+	Run.SkillRating0To100 = Snapshot->SkillRating0To100;
+	Run.RunSeed = Snapshot->RunSeed;
+	Run.LuckQuantitySampleCount = Snapshot->LuckQuantitySampleCount;
+	Run.LuckQualitySampleCount = Snapshot->LuckQualitySampleCount;
+	Run.LuckQuantityAccumulators = Snapshot->LuckQuantityAccumulators;
+	Run.LuckQualityAccumulators = Snapshot->LuckQualityAccumulators;
+	Run.AntiCheatLuckEvents = Snapshot->AntiCheatLuckEvents;
+	Run.bAntiCheatLuckEventsTruncated = Snapshot->bAntiCheatLuckEventsTruncated;
+	Run.AntiCheatHitCheckEvents = Snapshot->AntiCheatHitCheckEvents;
+	Run.bAntiCheatHitCheckEventsTruncated = Snapshot->bAntiCheatHitCheckEventsTruncated;
+	Run.IncomingHitChecks = Snapshot->IncomingHitChecks;
+	Run.DamageTakenHitCount = Snapshot->DamageTakenHitCount;
+	Run.DodgeCount = Snapshot->DodgeCount;
+	Run.MaxConsecutiveDodges = Snapshot->MaxConsecutiveDodges;
+	Run.TotalEvasionChance = Snapshot->TotalEvasionChance;
+	Run.AntiCheatEvasionBuckets = Snapshot->AntiCheatEvasionBuckets;
+	Run.AntiCheatPressureWindowSummary = Snapshot->AntiCheatPressureWindowSummary;
+	Run.AntiCheatGamblerSummaries = Snapshot->AntiCheatGamblerSummaries;
+	Run.AntiCheatGamblerEvents = Snapshot->AntiCheatGamblerEvents;
+	Run.bAntiCheatGamblerEventsTruncated = Snapshot->bAntiCheatGamblerEventsTruncated;
+	Run.IntegrityContext = Snapshot->IntegrityContext;
+	Run.ScoreBudgetContext = Snapshot->ScoreBudgetContext;
+	Run.EquippedIdols = Snapshot->EquippedIdols;
+	Run.Inventory = Snapshot->Inventory;
+	Run.EventLog = Snapshot->EventLog;
+	Run.DamageBySource = Snapshot->DamageBySource;
+	Run.StagePacingPoints = Snapshot->StagePacingPoints;
+	return Run;
+}
+
+TSharedPtr<FJsonObject> T66BackendRunSerializer::BuildRunJsonObject(const FT66BackendRunSnapshot& Run)
+{
+	TSharedPtr<FJsonObject> RunObj = MakeShared<FJsonObject>();
+	RunObj->SetStringField(TEXT("hero_id"), Run.HeroId);
+	RunObj->SetStringField(TEXT("companion_id"), Run.CompanionId);
+	RunObj->SetStringField(TEXT("difficulty"), T66DifficultyToApiString(Run.Difficulty));
+	RunObj->SetStringField(TEXT("party_size"), T66PartySizeToApiString(Run.PartySize));
+	RunObj->SetNumberField(TEXT("stage_reached"), T66MakeBackendCompatibleStageReached(Run.Difficulty, Run.StageReached));
+	RunObj->SetNumberField(TEXT("local_stage_reached"), T66NormalizeLocalStageReached(Run.Difficulty, Run.StageReached));
+	RunObj->SetNumberField(TEXT("score"), Run.Score);
+	RunObj->SetNumberField(TEXT("time_ms"), Run.TimeMs);
+
+	if (!Run.bHasSummary)
 	{
 		return RunObj;
 	}
 
-	RunObj->SetNumberField(TEXT("hero_level"), Snapshot->HeroLevel);
+	RunObj->SetNumberField(TEXT("hero_level"), Run.HeroLevel);
 
 	TSharedPtr<FJsonObject> StatsObj = MakeShared<FJsonObject>();
-	StatsObj->SetNumberField(TEXT("damage"), Snapshot->DamageStat);
-	StatsObj->SetNumberField(TEXT("attack_speed"), Snapshot->AttackSpeedStat);
-	StatsObj->SetNumberField(TEXT("attack_scale"), Snapshot->AttackScaleStat);
-	StatsObj->SetNumberField(TEXT("accuracy"), Snapshot->AccuracyStat);
-	StatsObj->SetNumberField(TEXT("armor"), Snapshot->ArmorStat);
-	StatsObj->SetNumberField(TEXT("evasion"), Snapshot->EvasionStat);
-	StatsObj->SetNumberField(TEXT("luck"), Snapshot->LuckStat);
-	StatsObj->SetNumberField(TEXT("speed"), Snapshot->SpeedStat);
+	StatsObj->SetNumberField(TEXT("damage"), Run.DamageStat);
+	StatsObj->SetNumberField(TEXT("attack_speed"), Run.AttackSpeedStat);
+	StatsObj->SetNumberField(TEXT("attack_scale"), Run.AttackScaleStat);
+	StatsObj->SetNumberField(TEXT("accuracy"), Run.AccuracyStat);
+	StatsObj->SetNumberField(TEXT("armor"), Run.ArmorStat);
+	StatsObj->SetNumberField(TEXT("evasion"), Run.EvasionStat);
+	StatsObj->SetNumberField(TEXT("luck"), Run.LuckStat);
+	StatsObj->SetNumberField(TEXT("speed"), Run.SpeedStat);
 	RunObj->SetObjectField(TEXT("stats"), StatsObj);
 
 	TSharedPtr<FJsonObject> SecObj = MakeShared<FJsonObject>();
-	for (const auto& Pair : Snapshot->SecondaryStatValues)
+	for (const auto& Pair : Run.SecondaryStatValues)
 	{
 		FString KeyName;
 		switch (Pair.Key)
@@ -183,22 +247,22 @@ TSharedPtr<FJsonObject> T66BackendRunSerializer::BuildRunJsonObject(
 	}
 	RunObj->SetObjectField(TEXT("secondary_stats"), SecObj);
 
-	if (Snapshot->LuckRating0To100 >= 0) RunObj->SetNumberField(TEXT("luck_rating"), Snapshot->LuckRating0To100);
-	if (Snapshot->SeedLuck0To100 >= 0) RunObj->SetNumberField(TEXT("seed_luck"), Snapshot->SeedLuck0To100);
-	if (Snapshot->LuckModifierPercent > 0.f) RunObj->SetNumberField(TEXT("luck_modifier_percent"), Snapshot->LuckModifierPercent);
-	if (Snapshot->EffectiveLuck > 0.f) RunObj->SetNumberField(TEXT("effective_luck"), Snapshot->EffectiveLuck);
-	if (Snapshot->LuckRatingQuantity0To100 >= 0) RunObj->SetNumberField(TEXT("luck_quantity"), Snapshot->LuckRatingQuantity0To100);
-	if (Snapshot->LuckRatingQuality0To100 >= 0) RunObj->SetNumberField(TEXT("luck_quality"), Snapshot->LuckRatingQuality0To100);
-	if (Snapshot->SkillRating0To100 >= 0) RunObj->SetNumberField(TEXT("skill_rating"), Snapshot->SkillRating0To100);
+	if (Run.LuckRating0To100 >= 0) RunObj->SetNumberField(TEXT("luck_rating"), Run.LuckRating0To100);
+	if (Run.SeedLuck0To100 >= 0) RunObj->SetNumberField(TEXT("seed_luck"), Run.SeedLuck0To100);
+	if (Run.LuckModifierPercent > 0.f) RunObj->SetNumberField(TEXT("luck_modifier_percent"), Run.LuckModifierPercent);
+	if (Run.EffectiveLuck > 0.f) RunObj->SetNumberField(TEXT("effective_luck"), Run.EffectiveLuck);
+	if (Run.LuckRatingQuantity0To100 >= 0) RunObj->SetNumberField(TEXT("luck_quantity"), Run.LuckRatingQuantity0To100);
+	if (Run.LuckRatingQuality0To100 >= 0) RunObj->SetNumberField(TEXT("luck_quality"), Run.LuckRatingQuality0To100);
+	if (Run.SkillRating0To100 >= 0) RunObj->SetNumberField(TEXT("skill_rating"), Run.SkillRating0To100);
 
 	TSharedPtr<FJsonObject> AntiCheatObj = MakeShared<FJsonObject>();
-	AntiCheatObj->SetNumberField(TEXT("run_seed"), Snapshot->RunSeed);
-	AntiCheatObj->SetNumberField(TEXT("luck_quantity_sample_count"), Snapshot->LuckQuantitySampleCount);
-	AntiCheatObj->SetNumberField(TEXT("luck_quality_sample_count"), Snapshot->LuckQualitySampleCount);
-	if (Snapshot->LuckQuantityAccumulators.Num() > 0)
+	AntiCheatObj->SetNumberField(TEXT("run_seed"), Run.RunSeed);
+	AntiCheatObj->SetNumberField(TEXT("luck_quantity_sample_count"), Run.LuckQuantitySampleCount);
+	AntiCheatObj->SetNumberField(TEXT("luck_quality_sample_count"), Run.LuckQualitySampleCount);
+	if (Run.LuckQuantityAccumulators.Num() > 0)
 	{
 		TArray<TSharedPtr<FJsonValue>> QuantityCategoryArr;
-		for (const FT66SavedLuckAccumulator& Accumulator : Snapshot->LuckQuantityAccumulators)
+		for (const FT66SavedLuckAccumulator& Accumulator : Run.LuckQuantityAccumulators)
 		{
 			TSharedPtr<FJsonObject> CategoryObj = MakeShared<FJsonObject>();
 			CategoryObj->SetStringField(TEXT("category"), Accumulator.Category.ToString());
@@ -209,10 +273,10 @@ TSharedPtr<FJsonObject> T66BackendRunSerializer::BuildRunJsonObject(
 		}
 		AntiCheatObj->SetArrayField(TEXT("luck_quantity_categories"), QuantityCategoryArr);
 	}
-	if (Snapshot->LuckQualityAccumulators.Num() > 0)
+	if (Run.LuckQualityAccumulators.Num() > 0)
 	{
 		TArray<TSharedPtr<FJsonValue>> QualityCategoryArr;
-		for (const FT66SavedLuckAccumulator& Accumulator : Snapshot->LuckQualityAccumulators)
+		for (const FT66SavedLuckAccumulator& Accumulator : Run.LuckQualityAccumulators)
 		{
 			TSharedPtr<FJsonObject> CategoryObj = MakeShared<FJsonObject>();
 			CategoryObj->SetStringField(TEXT("category"), Accumulator.Category.ToString());
@@ -223,10 +287,10 @@ TSharedPtr<FJsonObject> T66BackendRunSerializer::BuildRunJsonObject(
 		}
 		AntiCheatObj->SetArrayField(TEXT("luck_quality_categories"), QualityCategoryArr);
 	}
-	if (Snapshot->AntiCheatLuckEvents.Num() > 0)
+	if (Run.AntiCheatLuckEvents.Num() > 0)
 	{
 		TArray<TSharedPtr<FJsonValue>> LuckEventArr;
-		for (const FT66AntiCheatLuckEvent& Event : Snapshot->AntiCheatLuckEvents)
+		for (const FT66AntiCheatLuckEvent& Event : Run.AntiCheatLuckEvents)
 		{
 			TSharedPtr<FJsonObject> EventObj = MakeShared<FJsonObject>();
 			const TCHAR* EventTypeString = TEXT("quantity_roll");
@@ -282,11 +346,11 @@ TSharedPtr<FJsonObject> T66BackendRunSerializer::BuildRunJsonObject(
 		}
 		AntiCheatObj->SetArrayField(TEXT("luck_events"), LuckEventArr);
 	}
-	AntiCheatObj->SetBoolField(TEXT("luck_events_truncated"), Snapshot->bAntiCheatLuckEventsTruncated);
-	if (Snapshot->AntiCheatHitCheckEvents.Num() > 0)
+	AntiCheatObj->SetBoolField(TEXT("luck_events_truncated"), Run.bAntiCheatLuckEventsTruncated);
+	if (Run.AntiCheatHitCheckEvents.Num() > 0)
 	{
 		TArray<TSharedPtr<FJsonValue>> HitCheckEventArr;
-		for (const FT66AntiCheatHitCheckEvent& Event : Snapshot->AntiCheatHitCheckEvents)
+		for (const FT66AntiCheatHitCheckEvent& Event : Run.AntiCheatHitCheckEvents)
 		{
 			TSharedPtr<FJsonObject> EventObj = MakeShared<FJsonObject>();
 			EventObj->SetNumberField(TEXT("time_seconds"), Event.TimeSeconds);
@@ -297,16 +361,16 @@ TSharedPtr<FJsonObject> T66BackendRunSerializer::BuildRunJsonObject(
 		}
 		AntiCheatObj->SetArrayField(TEXT("hit_check_events"), HitCheckEventArr);
 	}
-	AntiCheatObj->SetBoolField(TEXT("hit_check_events_truncated"), Snapshot->bAntiCheatHitCheckEventsTruncated);
-	AntiCheatObj->SetNumberField(TEXT("incoming_hit_checks"), Snapshot->IncomingHitChecks);
-	AntiCheatObj->SetNumberField(TEXT("damage_taken_hit_count"), Snapshot->DamageTakenHitCount);
-	AntiCheatObj->SetNumberField(TEXT("dodge_count"), Snapshot->DodgeCount);
-	AntiCheatObj->SetNumberField(TEXT("max_consecutive_dodges"), Snapshot->MaxConsecutiveDodges);
-	AntiCheatObj->SetNumberField(TEXT("total_evasion_chance"), Snapshot->TotalEvasionChance);
-	if (Snapshot->AntiCheatEvasionBuckets.Num() > 0)
+	AntiCheatObj->SetBoolField(TEXT("hit_check_events_truncated"), Run.bAntiCheatHitCheckEventsTruncated);
+	AntiCheatObj->SetNumberField(TEXT("incoming_hit_checks"), Run.IncomingHitChecks);
+	AntiCheatObj->SetNumberField(TEXT("damage_taken_hit_count"), Run.DamageTakenHitCount);
+	AntiCheatObj->SetNumberField(TEXT("dodge_count"), Run.DodgeCount);
+	AntiCheatObj->SetNumberField(TEXT("max_consecutive_dodges"), Run.MaxConsecutiveDodges);
+	AntiCheatObj->SetNumberField(TEXT("total_evasion_chance"), Run.TotalEvasionChance);
+	if (Run.AntiCheatEvasionBuckets.Num() > 0)
 	{
 		TArray<TSharedPtr<FJsonValue>> EvasionBucketArr;
-		for (const FT66AntiCheatEvasionBucketSummary& Bucket : Snapshot->AntiCheatEvasionBuckets)
+		for (const FT66AntiCheatEvasionBucketSummary& Bucket : Run.AntiCheatEvasionBuckets)
 		{
 			TSharedPtr<FJsonObject> BucketObj = MakeShared<FJsonObject>();
 			BucketObj->SetNumberField(TEXT("bucket_index"), Bucket.BucketIndex);
@@ -322,27 +386,27 @@ TSharedPtr<FJsonObject> T66BackendRunSerializer::BuildRunJsonObject(
 	}
 	{
 		TSharedPtr<FJsonObject> PressureObj = MakeShared<FJsonObject>();
-		PressureObj->SetNumberField(TEXT("window_seconds"), Snapshot->AntiCheatPressureWindowSummary.WindowSeconds);
-		PressureObj->SetNumberField(TEXT("active_windows"), Snapshot->AntiCheatPressureWindowSummary.ActiveWindows);
-		PressureObj->SetNumberField(TEXT("pressured_windows_4_plus"), Snapshot->AntiCheatPressureWindowSummary.PressuredWindows4Plus);
-		PressureObj->SetNumberField(TEXT("pressured_windows_8_plus"), Snapshot->AntiCheatPressureWindowSummary.PressuredWindows8Plus);
-		PressureObj->SetNumberField(TEXT("zero_damage_windows_4_plus"), Snapshot->AntiCheatPressureWindowSummary.ZeroDamageWindows4Plus);
-		PressureObj->SetNumberField(TEXT("zero_damage_windows_8_plus"), Snapshot->AntiCheatPressureWindowSummary.ZeroDamageWindows8Plus);
-		PressureObj->SetNumberField(TEXT("near_perfect_windows_8_plus"), Snapshot->AntiCheatPressureWindowSummary.NearPerfectWindows8Plus);
-		PressureObj->SetNumberField(TEXT("max_hit_checks_in_window"), Snapshot->AntiCheatPressureWindowSummary.MaxHitChecksInWindow);
-		PressureObj->SetNumberField(TEXT("max_dodges_in_window"), Snapshot->AntiCheatPressureWindowSummary.MaxDodgesInWindow);
-		PressureObj->SetNumberField(TEXT("max_damage_applied_in_window"), Snapshot->AntiCheatPressureWindowSummary.MaxDamageAppliedInWindow);
-		PressureObj->SetNumberField(TEXT("max_expected_dodges_in_window"), Snapshot->AntiCheatPressureWindowSummary.MaxExpectedDodgesInWindow);
-		PressureObj->SetNumberField(TEXT("total_hit_checks"), Snapshot->AntiCheatPressureWindowSummary.TotalHitChecks);
-		PressureObj->SetNumberField(TEXT("total_dodges"), Snapshot->AntiCheatPressureWindowSummary.TotalDodges);
-		PressureObj->SetNumberField(TEXT("total_damage_applied"), Snapshot->AntiCheatPressureWindowSummary.TotalDamageApplied);
-		PressureObj->SetNumberField(TEXT("total_expected_dodges"), Snapshot->AntiCheatPressureWindowSummary.TotalExpectedDodges);
+		PressureObj->SetNumberField(TEXT("window_seconds"), Run.AntiCheatPressureWindowSummary.WindowSeconds);
+		PressureObj->SetNumberField(TEXT("active_windows"), Run.AntiCheatPressureWindowSummary.ActiveWindows);
+		PressureObj->SetNumberField(TEXT("pressured_windows_4_plus"), Run.AntiCheatPressureWindowSummary.PressuredWindows4Plus);
+		PressureObj->SetNumberField(TEXT("pressured_windows_8_plus"), Run.AntiCheatPressureWindowSummary.PressuredWindows8Plus);
+		PressureObj->SetNumberField(TEXT("zero_damage_windows_4_plus"), Run.AntiCheatPressureWindowSummary.ZeroDamageWindows4Plus);
+		PressureObj->SetNumberField(TEXT("zero_damage_windows_8_plus"), Run.AntiCheatPressureWindowSummary.ZeroDamageWindows8Plus);
+		PressureObj->SetNumberField(TEXT("near_perfect_windows_8_plus"), Run.AntiCheatPressureWindowSummary.NearPerfectWindows8Plus);
+		PressureObj->SetNumberField(TEXT("max_hit_checks_in_window"), Run.AntiCheatPressureWindowSummary.MaxHitChecksInWindow);
+		PressureObj->SetNumberField(TEXT("max_dodges_in_window"), Run.AntiCheatPressureWindowSummary.MaxDodgesInWindow);
+		PressureObj->SetNumberField(TEXT("max_damage_applied_in_window"), Run.AntiCheatPressureWindowSummary.MaxDamageAppliedInWindow);
+		PressureObj->SetNumberField(TEXT("max_expected_dodges_in_window"), Run.AntiCheatPressureWindowSummary.MaxExpectedDodgesInWindow);
+		PressureObj->SetNumberField(TEXT("total_hit_checks"), Run.AntiCheatPressureWindowSummary.TotalHitChecks);
+		PressureObj->SetNumberField(TEXT("total_dodges"), Run.AntiCheatPressureWindowSummary.TotalDodges);
+		PressureObj->SetNumberField(TEXT("total_damage_applied"), Run.AntiCheatPressureWindowSummary.TotalDamageApplied);
+		PressureObj->SetNumberField(TEXT("total_expected_dodges"), Run.AntiCheatPressureWindowSummary.TotalExpectedDodges);
 		AntiCheatObj->SetObjectField(TEXT("pressure_window_summary"), PressureObj);
 	}
-	if (Snapshot->AntiCheatGamblerSummaries.Num() > 0)
+	if (Run.AntiCheatGamblerSummaries.Num() > 0)
 	{
 		TArray<TSharedPtr<FJsonValue>> GamblerSummaryArr;
-		for (const FT66AntiCheatGamblerGameSummary& Summary : Snapshot->AntiCheatGamblerSummaries)
+		for (const FT66AntiCheatGamblerGameSummary& Summary : Run.AntiCheatGamblerSummaries)
 		{
 			const TCHAR* GameTypeString = TEXT("coin_flip");
 			switch (Summary.GameType)
@@ -369,10 +433,10 @@ TSharedPtr<FJsonObject> T66BackendRunSerializer::BuildRunJsonObject(
 		}
 		AntiCheatObj->SetArrayField(TEXT("gambler_summary"), GamblerSummaryArr);
 	}
-	if (Snapshot->AntiCheatGamblerEvents.Num() > 0)
+	if (Run.AntiCheatGamblerEvents.Num() > 0)
 	{
 		TArray<TSharedPtr<FJsonValue>> GamblerEventArr;
-		for (const FT66AntiCheatGamblerEvent& Event : Snapshot->AntiCheatGamblerEvents)
+		for (const FT66AntiCheatGamblerEvent& Event : Run.AntiCheatGamblerEvents)
 		{
 			const TCHAR* GameTypeString = TEXT("coin_flip");
 			switch (Event.GameType)
@@ -423,45 +487,45 @@ TSharedPtr<FJsonObject> T66BackendRunSerializer::BuildRunJsonObject(
 		}
 		AntiCheatObj->SetArrayField(TEXT("gambler_events"), GamblerEventArr);
 	}
-	AntiCheatObj->SetBoolField(TEXT("gambler_events_truncated"), Snapshot->bAntiCheatGamblerEventsTruncated);
+	AntiCheatObj->SetBoolField(TEXT("gambler_events_truncated"), Run.bAntiCheatGamblerEventsTruncated);
 	RunObj->SetObjectField(TEXT("anti_cheat_context"), AntiCheatObj);
 
 	TSharedPtr<FJsonObject> IntegrityObj = MakeShared<FJsonObject>();
-	IntegrityObj->SetStringField(TEXT("verdict"), Snapshot->IntegrityContext.Verdict);
-	IntegrityObj->SetStringField(TEXT("steam_app_id"), Snapshot->IntegrityContext.SteamAppId);
-	IntegrityObj->SetNumberField(TEXT("steam_build_id"), Snapshot->IntegrityContext.SteamBuildId);
-	if (!Snapshot->IntegrityContext.SteamBetaName.IsEmpty())
+	IntegrityObj->SetStringField(TEXT("verdict"), Run.IntegrityContext.Verdict);
+	IntegrityObj->SetStringField(TEXT("steam_app_id"), Run.IntegrityContext.SteamAppId);
+	IntegrityObj->SetNumberField(TEXT("steam_build_id"), Run.IntegrityContext.SteamBuildId);
+	if (!Run.IntegrityContext.SteamBetaName.IsEmpty())
 	{
-		IntegrityObj->SetStringField(TEXT("steam_beta_name"), Snapshot->IntegrityContext.SteamBetaName);
+		IntegrityObj->SetStringField(TEXT("steam_beta_name"), Run.IntegrityContext.SteamBetaName);
 	}
-	if (!Snapshot->IntegrityContext.ManifestId.IsEmpty())
+	if (!Run.IntegrityContext.ManifestId.IsEmpty())
 	{
-		IntegrityObj->SetStringField(TEXT("manifest_id"), Snapshot->IntegrityContext.ManifestId);
+		IntegrityObj->SetStringField(TEXT("manifest_id"), Run.IntegrityContext.ManifestId);
 	}
-	if (!Snapshot->IntegrityContext.ManifestRootHash.IsEmpty())
+	if (!Run.IntegrityContext.ManifestRootHash.IsEmpty())
 	{
-		IntegrityObj->SetStringField(TEXT("manifest_root_hash"), Snapshot->IntegrityContext.ManifestRootHash);
+		IntegrityObj->SetStringField(TEXT("manifest_root_hash"), Run.IntegrityContext.ManifestRootHash);
 	}
-	if (!Snapshot->IntegrityContext.ModuleListHash.IsEmpty())
+	if (!Run.IntegrityContext.ModuleListHash.IsEmpty())
 	{
-		IntegrityObj->SetStringField(TEXT("module_list_hash"), Snapshot->IntegrityContext.ModuleListHash);
+		IntegrityObj->SetStringField(TEXT("module_list_hash"), Run.IntegrityContext.ModuleListHash);
 	}
-	if (!Snapshot->IntegrityContext.MountedContentHash.IsEmpty())
+	if (!Run.IntegrityContext.MountedContentHash.IsEmpty())
 	{
-		IntegrityObj->SetStringField(TEXT("mounted_content_hash"), Snapshot->IntegrityContext.MountedContentHash);
+		IntegrityObj->SetStringField(TEXT("mounted_content_hash"), Run.IntegrityContext.MountedContentHash);
 	}
-	if (!Snapshot->IntegrityContext.BaselineHash.IsEmpty())
+	if (!Run.IntegrityContext.BaselineHash.IsEmpty())
 	{
-		IntegrityObj->SetStringField(TEXT("baseline_hash"), Snapshot->IntegrityContext.BaselineHash);
+		IntegrityObj->SetStringField(TEXT("baseline_hash"), Run.IntegrityContext.BaselineHash);
 	}
-	if (!Snapshot->IntegrityContext.FinalHash.IsEmpty())
+	if (!Run.IntegrityContext.FinalHash.IsEmpty())
 	{
-		IntegrityObj->SetStringField(TEXT("final_hash"), Snapshot->IntegrityContext.FinalHash);
+		IntegrityObj->SetStringField(TEXT("final_hash"), Run.IntegrityContext.FinalHash);
 	}
-	if (Snapshot->IntegrityContext.Reasons.Num() > 0)
+	if (Run.IntegrityContext.Reasons.Num() > 0)
 	{
 		TArray<TSharedPtr<FJsonValue>> ReasonArr;
-		for (const FString& Reason : Snapshot->IntegrityContext.Reasons)
+		for (const FString& Reason : Run.IntegrityContext.Reasons)
 		{
 			ReasonArr.Add(MakeShared<FJsonValueString>(Reason));
 		}
@@ -470,65 +534,65 @@ TSharedPtr<FJsonObject> T66BackendRunSerializer::BuildRunJsonObject(
 	RunObj->SetObjectField(TEXT("integrity_context"), IntegrityObj);
 
 	TSharedPtr<FJsonObject> ScoreBudgetObj = MakeShared<FJsonObject>();
-	ScoreBudgetObj->SetNumberField(TEXT("enemy_score_budget"), Snapshot->ScoreBudgetContext.EnemyScoreBudget);
-	ScoreBudgetObj->SetNumberField(TEXT("boss_score_budget"), Snapshot->ScoreBudgetContext.BossScoreBudget);
-	ScoreBudgetObj->SetNumberField(TEXT("enemy_score_awarded"), Snapshot->ScoreBudgetContext.EnemyScoreAwarded);
-	ScoreBudgetObj->SetNumberField(TEXT("boss_score_awarded"), Snapshot->ScoreBudgetContext.BossScoreAwarded);
-	ScoreBudgetObj->SetNumberField(TEXT("registered_enemy_spawns"), Snapshot->ScoreBudgetContext.RegisteredEnemySpawns);
-	ScoreBudgetObj->SetNumberField(TEXT("registered_boss_spawns"), Snapshot->ScoreBudgetContext.RegisteredBossSpawns);
-	ScoreBudgetObj->SetNumberField(TEXT("peak_score_per_minute"), Snapshot->ScoreBudgetContext.GetPeakAwardedScorePerMinute());
-	ScoreBudgetObj->SetBoolField(TEXT("exceeded_legal_score"), Snapshot->ScoreBudgetContext.bExceededLegalScore);
-	ScoreBudgetObj->SetNumberField(TEXT("first_exceeded_at_stage"), Snapshot->ScoreBudgetContext.FirstExceededAtStage);
-	ScoreBudgetObj->SetNumberField(TEXT("first_exceeded_at_run_seconds"), Snapshot->ScoreBudgetContext.FirstExceededAtRunSeconds);
-	if (Snapshot->ScoreBudgetContext.AwardedScorePerMinute.Num() > 0)
+	ScoreBudgetObj->SetNumberField(TEXT("enemy_score_budget"), Run.ScoreBudgetContext.EnemyScoreBudget);
+	ScoreBudgetObj->SetNumberField(TEXT("boss_score_budget"), Run.ScoreBudgetContext.BossScoreBudget);
+	ScoreBudgetObj->SetNumberField(TEXT("enemy_score_awarded"), Run.ScoreBudgetContext.EnemyScoreAwarded);
+	ScoreBudgetObj->SetNumberField(TEXT("boss_score_awarded"), Run.ScoreBudgetContext.BossScoreAwarded);
+	ScoreBudgetObj->SetNumberField(TEXT("registered_enemy_spawns"), Run.ScoreBudgetContext.RegisteredEnemySpawns);
+	ScoreBudgetObj->SetNumberField(TEXT("registered_boss_spawns"), Run.ScoreBudgetContext.RegisteredBossSpawns);
+	ScoreBudgetObj->SetNumberField(TEXT("peak_score_per_minute"), Run.ScoreBudgetContext.GetPeakAwardedScorePerMinute());
+	ScoreBudgetObj->SetBoolField(TEXT("exceeded_legal_score"), Run.ScoreBudgetContext.bExceededLegalScore);
+	ScoreBudgetObj->SetNumberField(TEXT("first_exceeded_at_stage"), Run.ScoreBudgetContext.FirstExceededAtStage);
+	ScoreBudgetObj->SetNumberField(TEXT("first_exceeded_at_run_seconds"), Run.ScoreBudgetContext.FirstExceededAtRunSeconds);
+	if (Run.ScoreBudgetContext.AwardedScorePerMinute.Num() > 0)
 	{
 		TArray<TSharedPtr<FJsonValue>> ScorePerMinuteArr;
-		for (const int32 ScoreValue : Snapshot->ScoreBudgetContext.AwardedScorePerMinute)
+		for (const int32 ScoreValue : Run.ScoreBudgetContext.AwardedScorePerMinute)
 		{
 			ScorePerMinuteArr.Add(MakeShared<FJsonValueNumber>(ScoreValue));
 		}
 		ScoreBudgetObj->SetArrayField(TEXT("awarded_score_per_minute"), ScorePerMinuteArr);
 	}
-	if (Snapshot->ScoreBudgetContext.AwardedScorePerStage.Num() > 0)
+	if (Run.ScoreBudgetContext.AwardedScorePerStage.Num() > 0)
 	{
 		TArray<TSharedPtr<FJsonValue>> ScorePerStageArr;
-		for (const int32 ScoreValue : Snapshot->ScoreBudgetContext.AwardedScorePerStage)
+		for (const int32 ScoreValue : Run.ScoreBudgetContext.AwardedScorePerStage)
 		{
 			ScorePerStageArr.Add(MakeShared<FJsonValueNumber>(ScoreValue));
 		}
 		ScoreBudgetObj->SetArrayField(TEXT("awarded_score_per_stage"), ScorePerStageArr);
 	}
-	if (!Snapshot->ScoreBudgetContext.FailureReason.IsEmpty())
+	if (!Run.ScoreBudgetContext.FailureReason.IsEmpty())
 	{
-		ScoreBudgetObj->SetStringField(TEXT("failure_reason"), Snapshot->ScoreBudgetContext.FailureReason);
+		ScoreBudgetObj->SetStringField(TEXT("failure_reason"), Run.ScoreBudgetContext.FailureReason);
 	}
 	RunObj->SetObjectField(TEXT("score_budget_context"), ScoreBudgetObj);
 
 	TArray<TSharedPtr<FJsonValue>> IdolArr;
-	for (const FName& Idol : Snapshot->EquippedIdols)
+	for (const FName& Idol : Run.EquippedIdols)
 	{
 		IdolArr.Add(MakeShared<FJsonValueString>(Idol.ToString()));
 	}
 	RunObj->SetArrayField(TEXT("equipped_idols"), IdolArr);
 
 	TArray<TSharedPtr<FJsonValue>> InvArr;
-	for (const FName& Item : Snapshot->Inventory)
+	for (const FName& Item : Run.Inventory)
 	{
 		InvArr.Add(MakeShared<FJsonValueString>(Item.ToString()));
 	}
 	RunObj->SetArrayField(TEXT("inventory"), InvArr);
 
 	TArray<TSharedPtr<FJsonValue>> LogArr;
-	for (const FString& Msg : Snapshot->EventLog)
+	for (const FString& Msg : Run.EventLog)
 	{
 		LogArr.Add(MakeShared<FJsonValueString>(Msg));
 	}
 	RunObj->SetArrayField(TEXT("event_log"), LogArr);
 
-	if (Snapshot->StagePacingPoints.Num() > 0)
+	if (Run.StagePacingPoints.Num() > 0)
 	{
 		TArray<TSharedPtr<FJsonValue>> StageSplitArr;
-		for (const FT66StagePacingPoint& Point : Snapshot->StagePacingPoints)
+		for (const FT66StagePacingPoint& Point : Run.StagePacingPoints)
 		{
 			const int32 SplitMs = FMath::RoundToInt(FMath::Max(0.f, Point.ElapsedSeconds) * 1000.f);
 			StageSplitArr.Add(MakeShared<FJsonValueNumber>(SplitMs));
@@ -537,7 +601,7 @@ TSharedPtr<FJsonObject> T66BackendRunSerializer::BuildRunJsonObject(
 	}
 
 	TSharedPtr<FJsonObject> DmgObj = MakeShared<FJsonObject>();
-	for (const auto& Pair : Snapshot->DamageBySource)
+	for (const auto& Pair : Run.DamageBySource)
 	{
 		DmgObj->SetNumberField(Pair.Key.ToString(), Pair.Value);
 	}
@@ -546,6 +610,19 @@ TSharedPtr<FJsonObject> T66BackendRunSerializer::BuildRunJsonObject(
 	return RunObj;
 }
 
+TSharedPtr<FJsonObject> T66BackendRunSerializer::BuildRunJsonObject(
+	const FString& HeroId,
+	const FString& CompanionId,
+	ET66Difficulty Difficulty,
+	ET66PartySize PartySize,
+	int32 StageReached,
+	int32 Score,
+	int32 TimeMs,
+	UT66LeaderboardRunSummarySaveGame* Snapshot)
+{
+	return BuildRunJsonObject(CaptureRunSnapshot(HeroId, CompanionId, Difficulty, PartySize, StageReached, Score, TimeMs, Snapshot));
+}
+
 bool T66BackendRunSerializer::SerializeJsonObjectToString(const TSharedPtr<FJsonObject>& Json, FString& OutJsonString)
 {
 	if (!Json.IsValid())
@@ -558,6 +635,18 @@ bool T66BackendRunSerializer::SerializeJsonObjectToString(const TSharedPtr<FJson
 	return FJsonSerializer::Serialize(Json.ToSharedRef(), Writer);
 }
 
+bool T66BackendRunSerializer::SerializeJsonObjectToCondensedString(const TSharedPtr<FJsonObject>& Json, FString& OutJsonString)
+{
+	if (!Json.IsValid())
+	{
+		return false;
+	}
+
+	OutJsonString.Reset();
+	TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&OutJsonString);
+	return FJsonSerializer::Serialize(Json.ToSharedRef(), Writer);
+}
+
 bool T66BackendRunSerializer::DeserializeJsonObjectString(const FString& JsonString, TSharedPtr<FJsonObject>& OutJson)
 {
 	OutJson.Reset();
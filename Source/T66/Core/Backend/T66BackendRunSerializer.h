@@ -3,13 +3,87 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Core/T66LeaderboardRunSummarySaveGame.h"
 #include "Data/T66DataTypes.h"
 
 class FJsonObject;
-class UT66LeaderboardRunSummarySaveGame;
+
+/**
+ * Plain copy of everything the submit-run payload reads from a run summary save game.
+ * Captured on the game thread so the JSON tree can be built on a worker without touching UObjects.
+ */
+struct FT66BackendRunSnapshot
+{
+	FString HeroId;
+	FString CompanionId;
+	ET66Difficulty Difficulty = ET66Difficulty::Easy;
+	ET66PartySize PartySize = ET66PartySize::Solo;
+	int32 StageReached = 1;
+	int32 Score = 0;
+	int32 TimeMs = 0;
+
+	/** False when the run was submitted without a summary; only the fields above are sent then. */
+	bool bHasSummary = false;
+	int32 HeroLevel = 1;
+	int32 DamageStat = 1;
+	int32 AttackSpeedStat = 1;
+	int32 AttackScaleStat = 1;
+	int32 AccuracyStat = 1;
+	int32 ArmorStat = 1;
+	int32 EvasionStat = 1;
+	int32 LuckStat = 1;
+	int32 SpeedStat = 1;
+	TMap<ET66SecondaryStatType, float> SecondaryStatValues;
+	int32 LuckRating0To100 = -1;
+	int32 SeedLuck0To100 = -1;
+	float LuckModifierPercent = 0.f;
+	float EffectiveLuck = 0.f;
+	int32 LuckRatingQuantity0To100 = -1;
+	int32 LuckRatingQuality0To100 = -1;
+	int32 SkillRating0To100 = -1;
+	int32 RunSeed = 0;
+	int32 LuckQuantitySampleCount = 0;
+	int32 LuckQualitySampleCount = 0;
+	TArray<FT66SavedLuckAccumulator> LuckQuantityAccumulators;
+	TArray<FT66SavedLuckAccumulator> LuckQualityAccumulators;
+	TArray<FT66AntiCheatLuckEvent> AntiCheatLuckEvents;
+	bool bAntiCheatLuckEventsTruncated = false;
+	TArray<FT66AntiCheatHitCheckEvent> AntiCheatHitCheckEvents;
+	bool bAntiCheatHitCheckEventsTruncated = false;
+	int32 IncomingHitChecks = 0;
+	int32 DamageTakenHitCount = 0;
+	int32 DodgeCount = 0;
+	int32 MaxConsecutiveDodges = 0;
+	float TotalEvasionChance = 0.f;
+	TArray<FT66AntiCheatEvasionBucketSummary> AntiCheatEvasionBuckets;
+	FT66AntiCheatPressureWindowSummary AntiCheatPressureWindowSummary;
+	TArray<FT66AntiCheatGamblerGameSummary> AntiCheatGamblerSummaries;
+	TArray<FT66AntiCheatGamblerEvent> AntiCheatGamblerEvents;
+	bool bAntiCheatGamblerEventsTruncated = false;
+	FT66RunIntegrityContext IntegrityContext;
+	FT66ScoreBudget ScoreBudgetContext;
+	TArray<FName> EquippedIdols;
+	TArray<FName> Inventory;
+	TArray<FString> EventLog;
+	TMap<FName, int32> DamageBySource;
+	TArray<FT66StagePacingPoint> StagePacingPoints;
+};
 
 namespace T66BackendRunSerializer
 {
+	FT66BackendRunSnapshot CaptureRunSnapshot(
+		const FString& HeroId,
+		const FString& CompanionId,
+		ET66Difficulty Difficulty,
+		ET66PartySize PartySize,
+		int32 StageReached,
+		int32 Score,
+		int32 TimeMs,
+		const UT66LeaderboardRunSummarySaveGame* Snapshot);
+
+	/** Safe to call from any thread. */
+	TSharedPtr<FJsonObject> BuildRunJsonObject(const FT66BackendRunSnapshot& Run);
+
 	TSharedPtr<FJsonObject> BuildRunJsonObject(
 		const FString& HeroId,
 		const FString& CompanionId,
@@ -21,5 +95,7 @@ namespace T66BackendRunSerializer
 		UT66LeaderboardRunSummarySaveGame* Snapshot);
 
 	bool SerializeJsonObjectToString(const TSharedPtr<FJsonObject>& Json, FString& OutJsonString);
+	/** Single-line JSON for request bodies; the pretty form above stays for locally cached summaries. */
+	bool SerializeJsonObjectToCondensedString(const TSharedPtr<FJsonObject>& Json, FString& OutJsonString);
 	bool DeserializeJsonObjectString(const FString& JsonString, TSharedPtr<FJsonObject>& OutJson);
 }
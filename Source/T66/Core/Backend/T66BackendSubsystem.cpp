@@ -17,6 +17,36 @@ TAutoConsoleVariable<float> CVarT66PartyInvitePollTickerIntervalSeconds(
 	TEXT("Ticker cadence used to drive invite polling while the backend subsystem is alive."),
 	ECVF_Default);
 
+TAutoConsoleVariable<float> CVarT66PartyInvitePollIdleMaxIntervalSeconds(
+	TEXT("T66.Backend.PartyInvitePollIdleMaxIntervalSeconds"),
+	3.f,
+	TEXT("Ceiling for the party invite poll interval, which doubles per unchanged poll and resets on any change."),
+	ECVF_Default);
+
+TAutoConsoleVariable<float> CVarT66SubmitRunRetryBaseSeconds(
+	TEXT("T66.Backend.SubmitRunRetryBaseSeconds"),
+	4.f,
+	TEXT("Delay before the first retry of a queued run submission; doubles per failed attempt."),
+	ECVF_Default);
+
+TAutoConsoleVariable<float> CVarT66SubmitRunRetryMaxSeconds(
+	TEXT("T66.Backend.SubmitRunRetryMaxSeconds"),
+	300.f,
+	TEXT("Upper bound on the backoff between run submission retries."),
+	ECVF_Default);
+
+TAutoConsoleVariable<int32> CVarT66SubmitRunMaxAttemptsPerSession(
+	TEXT("T66.Backend.SubmitRunMaxAttemptsPerSession"),
+	10,
+	TEXT("Failed attempts after which a queued run waits on disk for the next launch."),
+	ECVF_Default);
+
+TAutoConsoleVariable<int32> CVarT66SubmitRunOutboxMaxAgeDays(
+	TEXT("T66.Backend.SubmitRunOutboxMaxAgeDays"),
+	7,
+	TEXT("Queued runs older than this are discarded instead of being submitted."),
+	ECVF_Default);
+
 namespace
 {
 	struct FT66DummyLeaderboardIdentity
@@ -207,6 +237,7 @@ void UT66BackendSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 	Super::Initialize(Collection);
 
 	GConfig->GetString(TEXT("T66.Online"), TEXT("BackendBaseUrl"), BackendBaseUrl, GGameIni);
+	GConfig->GetBool(TEXT("T66.Online"), TEXT("bGzipSubmitRunBody"), bGzipSubmitRunBody, GGameIni);
 
 	if (BackendBaseUrl.IsEmpty())
 	{
@@ -242,17 +273,21 @@ void UT66BackendSubsystem::Deinitialize()
 		PendingCoopSubmitTickerHandle.Reset();
 	}
 
-	if (TSharedPtr<IHttpRequest, ESPMode::ThreadSafe> PendingInviteRequest = PendingPartyInvitePollRequest.Pin())
+	if (RunOutboxTickerHandle.IsValid())
 	{
-		PendingInviteRequest->OnProcessRequestComplete().Unbind();
-		PendingInviteRequest->CancelRequest();
-		PendingPartyInvitePollRequest.Reset();
+		FTSTicker::GetCoreTicker().RemoveTicker(RunOutboxTickerHandle);
+		RunOutboxTickerHandle.Reset();
 	}
 
+	RequestScheduler->Reset();
+
 	bPartyInvitePollInFlight = false;
 	bPartyInvitePollRequestedWhileInFlight = false;
 	PendingPartyInvites.Reset();
 	PendingCoopSubmitRequests.Reset();
+	RunOutbox.Reset();
+	RunOutboxOwnerSteamId.Reset();
+	bRunOutboxOwnerLoaded = false;
 	PendingPartyInvitesChanged.Clear();
 	PartyInviteActionComplete.Clear();
 
@@ -261,8 +296,27 @@ void UT66BackendSubsystem::Deinitialize()
 
 void UT66BackendSubsystem::SetSteamTicketHex(const FString& TicketHex)
 {
+	const bool bTicketChanged = CachedSteamTicketHex != TicketHex;
 	CachedSteamTicketHex = TicketHex;
 	UE_LOG(LogT66Backend, Log, TEXT("Backend: Steam ticket set (%d hex chars)"), TicketHex.Len());
+
+	// The ticket speaks for whoever is signed in now; swap in that account's queued runs before sending anything.
+	const FString SignedInSteamId = GetSignedInSteamId();
+	if (HasSteamTicket() && (!bRunOutboxOwnerLoaded || RunOutboxOwnerSteamId != SignedInSteamId))
+	{
+		LoadRunOutboxForOwner(SignedInSteamId);
+	}
+
+	// Runs rejected with the old ticket go out again now instead of waiting out their backoff.
+	bRunOutboxTicketRefreshPending = false;
+	if (bTicketChanged && HasSteamTicket() && RunOutbox.Num() > 0)
+	{
+		for (FT66RunOutboxEntry& Entry : RunOutbox)
+		{
+			Entry.NextAttemptTimeSeconds = 0.0;
+		}
+		PumpRunOutbox();
+	}
 }
 
 void UT66BackendSubsystem::SeedDevelopmentDummyLeaderboardsIfNeeded()
@@ -307,9 +361,9 @@ bool UT66BackendSubsystem::TryPopulateDevelopmentDummyLeaderboard(const FString&
 		return false;
 	}
 
-	if (const FCachedLeaderboard* Existing = LeaderboardCache.Find(Key))
+	if (const FT66LeaderboardSnapshotPtr* Existing = LeaderboardCache.Find(Key))
 	{
-		if (Existing->Entries.Num() > 0)
+		if (Existing->IsValid() && (*Existing)->Entries.Num() > 0)
 		{
 			return true;
 		}
@@ -327,8 +381,8 @@ bool UT66BackendSubsystem::TryPopulateDevelopmentDummyLeaderboard(const FString&
 	const int32 BaseScore = bScoreBoard ? (bAllTime ? 9400 : 8200) : (bAllTime ? 7600 : 7000);
 	const float BaseTime = bScoreBoard ? (bAllTime ? 244.0f : 258.0f) : (bAllTime ? 231.0f : 239.0f);
 
-	FCachedLeaderboard Cached;
-	Cached.TotalEntries = 5;
+	TSharedRef<FT66LeaderboardSnapshot, ESPMode::ThreadSafe> Cached = MakeShared<FT66LeaderboardSnapshot, ESPMode::ThreadSafe>();
+	Cached->TotalEntries = 5;
 
 	for (int32 EntryIndex = 0; EntryIndex < 5; ++EntryIndex)
 	{
@@ -336,7 +390,7 @@ bool UT66BackendSubsystem::TryPopulateDevelopmentDummyLeaderboard(const FString&
 		const int32 FilterScoreModifier = (FilterIndex == 0) ? 0 : (FilterIndex == 1 ? -220 : -360);
 		const float FilterTimeModifier = (FilterIndex == 0) ? 0.f : (FilterIndex == 1 ? 6.5f : 11.0f);
 
-		FLeaderboardEntry& Entry = Cached.Entries.AddDefaulted_GetRef();
+		FLeaderboardEntry& Entry = Cached->Entries.AddDefaulted_GetRef();
 		Entry.Rank = Rank;
 		Entry.PlayerName = T66GetDummyPlayerName(Identity.Filter, EntryIndex);
 		Entry.PlayerNames = { Entry.PlayerName };
@@ -359,26 +413,55 @@ bool UT66BackendSubsystem::TryPopulateDevelopmentDummyLeaderboard(const FString&
 		RunSummaryCache.FindOrAdd(Entry.EntryId) = T66BuildDummyRunSummary(this, Identity, Entry, Entry.PlayerName);
 	}
 
-	LeaderboardCache.Add(Key, MoveTemp(Cached));
+	LeaderboardCache.Add(Key, Cached);
 	UE_LOG(LogT66Backend, Log, TEXT("Backend: seeded dummy leaderboard for key=%s"), *Key);
 	return true;
 #endif
 }
 
-TSharedRef<IHttpRequest, ESPMode::ThreadSafe> UT66BackendSubsystem::CreateRequest(const FString& Verb, const FString& Endpoint) const
+FT66BackendHttpRequest UT66BackendSubsystem::CreateRequest(const FString& Verb, const FString& Endpoint) const
 {
-	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(FString::Printf(TEXT("%s%s"), *BackendBaseUrl, *Endpoint));
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
+	FT66BackendHttpRequest Request;
+	Request.Url = FString::Printf(TEXT("%s%s"), *BackendBaseUrl, *Endpoint);
+	Request.Verb = Verb;
+	Request.SetHeader(TEXT("Content-Type"), TEXT("application/json"));
 	return Request;
 }
 
-void UT66BackendSubsystem::SetAuthHeaders(TSharedRef<IHttpRequest, ESPMode::ThreadSafe>& Request) const
+void UT66BackendSubsystem::SetAuthHeaders(FT66BackendHttpRequest& Request) const
 {
 	if (!CachedSteamTicketHex.IsEmpty())
 	{
-		Request->SetHeader(TEXT("X-Steam-Ticket"), CachedSteamTicketHex);
+		Request.SetHeader(TEXT("X-Steam-Ticket"), CachedSteamTicketHex);
+	}
+}
+
+void UT66BackendSubsystem::SendRequest(FT66BackendHttpRequest&& Request, IT66BackendTransport::FOnComplete&& OnComplete)
+{
+	TWeakObjectPtr<UT66BackendSubsystem> WeakThis(this);
+	RequestScheduler->Send(MoveTemp(Request), [WeakThis, OnComplete = MoveTemp(OnComplete)](const FT66BackendHttpResponse& Response)
+	{
+		if (WeakThis.IsValid())
+		{
+			OnComplete(Response);
+		}
+	});
+}
+
+void UT66BackendSubsystem::SetBackendTransport(TSharedPtr<IT66BackendTransport> Transport)
+{
+	RequestScheduler->SetTransport(MoveTemp(Transport));
+
+	// Everything that was waiting on the old transport is gone; let the owners issue fresh requests.
+	PendingLeaderboardFetches.Reset();
+	PendingMyRankFetches.Reset();
+	PendingRunSummaryFetches.Reset();
+	bPartyInvitePollInFlight = false;
+	bPartyInvitePollRequestedWhileInFlight = false;
+	bRunOutboxTicketRefreshPending = false;
+	for (FT66RunOutboxEntry& Entry : RunOutbox)
+	{
+		Entry.bInFlight = false;
 	}
 }
 
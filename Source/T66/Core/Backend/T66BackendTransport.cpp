@@ -0,0 +1,323 @@
+// Copyright Tribulation 66. All Rights Reserved.
+
+#include "Core/Backend/T66BackendTransport.h"
+#include "HttpModule.h"
+#include "Interfaces/IHttpResponse.h"
+
+namespace
+{
+	constexpr int32 T66MaxValidatedBodies = 128;
+
+	FString T66GetUrlPath(const FString& Url)
+	{
+		int32 PathStart = 0;
+		const int32 SchemeEnd = Url.Find(TEXT("://"));
+		if (SchemeEnd != INDEX_NONE)
+		{
+			PathStart = Url.Find(TEXT("/"), ESearchCase::CaseSensitive, ESearchDir::FromStart, SchemeEnd + 3);
+			if (PathStart == INDEX_NONE)
+			{
+				return TEXT("/");
+			}
+		}
+
+		const int32 QueryStart = Url.Find(TEXT("?"), ESearchCase::CaseSensitive, ESearchDir::FromStart, PathStart);
+		return QueryStart == INDEX_NONE ? Url.Mid(PathStart) : Url.Mid(PathStart, QueryStart - PathStart);
+	}
+
+	FString T66MakeRouteKey(const FString& Verb, const FString& Path)
+	{
+		return Verb.ToUpper() + TEXT(" ") + Path;
+	}
+}
+
+void FT66BackendHttpRequest::SetHeader(const FString& Name, const FString& Value)
+{
+	for (TPair<FString, FString>& Header : Headers)
+	{
+		if (Header.Key.Equals(Name, ESearchCase::IgnoreCase))
+		{
+			Header.Value = Value;
+			return;
+		}
+	}
+
+	Headers.Emplace(Name, Value);
+}
+
+void FT66BackendHttpRequest::RemoveHeader(const FString& Name)
+{
+	Headers.RemoveAll([&Name](const TPair<FString, FString>& Header)
+	{
+		return Header.Key.Equals(Name, ESearchCase::IgnoreCase);
+	});
+}
+
+const FString* FT66BackendHttpRequest::FindHeader(const FString& Name) const
+{
+	for (const TPair<FString, FString>& Header : Headers)
+	{
+		if (Header.Key.Equals(Name, ESearchCase::IgnoreCase))
+		{
+			return &Header.Value;
+		}
+	}
+
+	return nullptr;
+}
+
+void FT66BackendHttpRequest::SetContentAsString(const FString& Body)
+{
+	const FTCHARToUTF8 Utf8(*Body);
+	Content.Reset(Utf8.Length());
+	Content.Append(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
+}
+
+// ── HTTP ─────────────────────────────────────────────────────
+
+void FT66HttpBackendTransport::Send(const FT66BackendHttpRequest& Request, FOnComplete&& OnComplete)
+{
+	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = FHttpModule::Get().CreateRequest();
+	HttpRequest->SetURL(Request.Url);
+	HttpRequest->SetVerb(Request.Verb);
+	for (const TPair<FString, FString>& Header : Request.Headers)
+	{
+		HttpRequest->SetHeader(Header.Key, Header.Value);
+	}
+	if (Request.Content.Num() > 0)
+	{
+		HttpRequest->SetContent(TArray<uint8>(Request.Content));
+	}
+
+	HttpRequest->OnProcessRequestComplete().BindLambda(
+		[OnComplete = MoveTemp(OnComplete)](FHttpRequestPtr, FHttpResponsePtr HttpResponse, bool bConnectedSuccessfully)
+		{
+			FT66BackendHttpResponse Response;
+			Response.bConnectedSuccessfully = bConnectedSuccessfully && HttpResponse.IsValid();
+			if (Response.bConnectedSuccessfully)
+			{
+				Response.Code = HttpResponse->GetResponseCode();
+				Response.Body = HttpResponse->GetContentAsString();
+				Response.ETag = HttpResponse->GetHeader(TEXT("ETag"));
+			}
+			OnComplete(Response);
+		});
+
+	InFlightRequests.RemoveAll([](const TWeakPtr<IHttpRequest, ESPMode::ThreadSafe>& Existing)
+	{
+		const TSharedPtr<IHttpRequest, ESPMode::ThreadSafe> Pinned = Existing.Pin();
+		return !Pinned.IsValid() || EHttpRequestStatus::IsFinished(Pinned->GetStatus());
+	});
+	InFlightRequests.Add(HttpRequest);
+	HttpRequest->ProcessRequest();
+}
+
+void FT66HttpBackendTransport::CancelAll()
+{
+	for (const TWeakPtr<IHttpRequest, ESPMode::ThreadSafe>& WeakRequest : InFlightRequests)
+	{
+		if (const TSharedPtr<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = WeakRequest.Pin())
+		{
+			HttpRequest->OnProcessRequestComplete().Unbind();
+			HttpRequest->CancelRequest();
+		}
+	}
+	InFlightRequests.Reset();
+}
+
+// ── Fake ─────────────────────────────────────────────────────
+
+void FT66FakeBackendTransport::SetRoute(const FString& Verb, const FString& Path, const FRoute& Route)
+{
+	Routes.Add(T66MakeRouteKey(Verb, Path), Route);
+}
+
+void FT66FakeBackendTransport::Send(const FT66BackendHttpRequest& Request, FOnComplete&& OnComplete)
+{
+	SentRequests.Add(Request);
+
+	FT66BackendHttpResponse Response;
+	if (const FRoute* Route = Routes.Find(T66MakeRouteKey(Request.Verb, T66GetUrlPath(Request.Url))))
+	{
+		Response.bConnectedSuccessfully = true;
+		Response.ETag = Route->ETag;
+		const FString* IfNoneMatch = Request.FindHeader(TEXT("If-None-Match"));
+		if (!Route->ETag.IsEmpty() && IfNoneMatch && *IfNoneMatch == Route->ETag)
+		{
+			Response.Code = 304;
+		}
+		else
+		{
+			Response.Code = Route->Code;
+			Response.Body = Route->Body;
+		}
+	}
+
+	if (bHoldResponses)
+	{
+		HeldResponses.Emplace(MoveTemp(Response), MoveTemp(OnComplete));
+		return;
+	}
+
+	OnComplete(Response);
+}
+
+void FT66FakeBackendTransport::FlushHeldResponses()
+{
+	TArray<TPair<FT66BackendHttpResponse, FOnComplete>> Pending = MoveTemp(HeldResponses);
+	HeldResponses.Reset();
+	for (TPair<FT66BackendHttpResponse, FOnComplete>& Held : Pending)
+	{
+		Held.Value(Held.Key);
+	}
+}
+
+// ── Scheduler ────────────────────────────────────────────────
+
+FT66BackendRequestScheduler::FT66BackendRequestScheduler()
+	: Transport(MakeShared<FT66HttpBackendTransport>())
+{
+}
+
+void FT66BackendRequestScheduler::SetTransport(TSharedPtr<IT66BackendTransport> InTransport)
+{
+	Reset();
+	Transport = InTransport.IsValid() ? InTransport.ToSharedRef() : StaticCastSharedRef<IT66BackendTransport>(MakeShared<FT66HttpBackendTransport>());
+}
+
+void FT66BackendRequestScheduler::Reset()
+{
+	++Generation;
+	Transport->CancelAll();
+	InFlightGets.Reset();
+	ValidatedBodies.Reset();
+	ValidatedBodyOrder.Reset();
+}
+
+FString FT66BackendRequestScheduler::MakeGetKey(const FT66BackendHttpRequest& Request)
+{
+	// Authenticated GETs answer per caller, so the headers are part of the identity.
+	uint32 HeaderHash = 0;
+	for (const TPair<FString, FString>& Header : Request.Headers)
+	{
+		HeaderHash = HashCombine(HeaderHash, HashCombine(GetTypeHash(Header.Key), GetTypeHash(Header.Value)));
+	}
+	return FString::Printf(TEXT("%s|%08x"), *Request.Url, HeaderHash);
+}
+
+void FT66BackendRequestScheduler::Send(FT66BackendHttpRequest&& Request, IT66BackendTransport::FOnComplete&& OnComplete)
+{
+	const TWeakPtr<FT66BackendRequestScheduler> WeakThis = AsShared();
+	const uint32 SentGeneration = Generation;
+
+	if (!Request.Verb.Equals(TEXT("GET"), ESearchCase::IgnoreCase))
+	{
+		Transport->Send(Request, [WeakThis, SentGeneration, OnComplete = MoveTemp(OnComplete)](const FT66BackendHttpResponse& Response)
+		{
+			const TSharedPtr<FT66BackendRequestScheduler> Scheduler = WeakThis.Pin();
+			if (Scheduler.IsValid() && Scheduler->Generation == SentGeneration)
+			{
+				OnComplete(Response);
+			}
+		});
+		return;
+	}
+
+	const FString Key = MakeGetKey(Request);
+	if (TArray<IT66BackendTransport::FOnComplete>* Waiters = InFlightGets.Find(Key))
+	{
+		Waiters->Add(MoveTemp(OnComplete));
+		++CoalescedRequestCount;
+		return;
+	}
+
+	InFlightGets.Add(Key).Add(MoveTemp(OnComplete));
+	if (const FValidatedBody* Cached = ValidatedBodies.Find(Key))
+	{
+		Request.SetHeader(TEXT("If-None-Match"), Cached->ETag);
+	}
+
+	SendGet(Key, Request);
+}
+
+void FT66BackendRequestScheduler::SendGet(const FString& Key, const FT66BackendHttpRequest& Request)
+{
+	const TWeakPtr<FT66BackendRequestScheduler> WeakThis = AsShared();
+	const uint32 SentGeneration = Generation;
+	// The completion keeps its own copy so an orphaned 304 can be re-sent without the validator.
+	Transport->Send(Request, [WeakThis, Key, SentGeneration, SentRequest = Request](const FT66BackendHttpResponse& Response)
+	{
+		if (const TSharedPtr<FT66BackendRequestScheduler> Scheduler = WeakThis.Pin())
+		{
+			Scheduler->CompleteGet(Key, SentGeneration, SentRequest, Response);
+		}
+	});
+}
+
+void FT66BackendRequestScheduler::CompleteGet(const FString& Key, const uint32 SentGeneration, const FT66BackendHttpRequest& Request, FT66BackendHttpResponse Response)
+{
+	if (SentGeneration != Generation || !InFlightGets.Contains(Key))
+	{
+		return;
+	}
+
+	if (Response.bConnectedSuccessfully && Response.Code == 304)
+	{
+		const FValidatedBody* Cached = ValidatedBodies.Find(Key);
+		if (!Cached)
+		{
+			// The validator's body was evicted while this request was out; ask again for the full body.
+			if (Request.FindHeader(TEXT("If-None-Match")))
+			{
+				FT66BackendHttpRequest Retry = Request;
+				Retry.RemoveHeader(TEXT("If-None-Match"));
+				SendGet(Key, Retry);
+				return;
+			}
+		}
+		else
+		{
+			Response.Code = 200;
+			Response.Body = Cached->Body;
+			Response.ETag = Cached->ETag;
+			Response.bNotModified = true;
+			++NotModifiedCount;
+			TouchValidatedBody(Key);
+		}
+	}
+	else if (Response.IsOk() && !Response.ETag.IsEmpty())
+	{
+		if (!ValidatedBodies.Contains(Key) && ValidatedBodyOrder.Num() >= T66MaxValidatedBodies)
+		{
+			const FString LeastRecentKey = ValidatedBodyOrder[0];
+			ForgetValidatedBody(LeastRecentKey);
+		}
+		ValidatedBodies.Add(Key, FValidatedBody{ Response.ETag, Response.Body });
+		TouchValidatedBody(Key);
+	}
+	else if (Response.bConnectedSuccessfully)
+	{
+		ForgetValidatedBody(Key);
+	}
+
+	TArray<IT66BackendTransport::FOnComplete> Waiters;
+	InFlightGets.RemoveAndCopyValue(Key, Waiters);
+
+	// Waiters may issue the same GET again; the key is already free for that.
+	for (IT66BackendTransport::FOnComplete& Waiter : Waiters)
+	{
+		Waiter(Response);
+	}
+}
+
+void FT66BackendRequestScheduler::TouchValidatedBody(const FString& Key)
+{
+	ValidatedBodyOrder.RemoveSingle(Key);
+	ValidatedBodyOrder.Add(Key);
+}
+
+void FT66BackendRequestScheduler::ForgetValidatedBody(const FString& Key)
+{
+	ValidatedBodies.Remove(Key);
+	ValidatedBodyOrder.RemoveSingle(Key);
+}
@@ -0,0 +1,139 @@
+// Copyright Tribulation 66. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Interfaces/IHttpRequest.h"
+
+/** One backend call as a transport sees it. Url is absolute; Content is sent verbatim. */
+struct FT66BackendHttpRequest
+{
+	FString Verb;
+	FString Url;
+	TArray<TPair<FString, FString>> Headers;
+	TArray<uint8> Content;
+
+	void SetHeader(const FString& Name, const FString& Value);
+	void RemoveHeader(const FString& Name);
+	const FString* FindHeader(const FString& Name) const;
+	void SetContentAsString(const FString& Body);
+};
+
+struct FT66BackendHttpResponse
+{
+	bool bConnectedSuccessfully = false;
+	/** Zero when not connected. */
+	int32 Code = 0;
+	FString Body;
+	FString ETag;
+	/** The server answered 304 and Body was served from the scheduler's validator cache; Code reads 200. */
+	bool bNotModified = false;
+
+	bool IsOk() const { return bConnectedSuccessfully && Code == 200; }
+};
+
+/**
+ * Moves requests to the backend and back. The subsystem uses HTTP by default; tests inject
+ * FT66FakeBackendTransport through UT66BackendSubsystem::SetBackendTransport to run offline.
+ */
+class IT66BackendTransport
+{
+public:
+	/** Must be invoked exactly once per Send, on the game thread, unless CancelAll drops it first. */
+	using FOnComplete = TFunction<void(const FT66BackendHttpResponse& /*Response*/)>;
+
+	virtual ~IT66BackendTransport() = default;
+	virtual void Send(const FT66BackendHttpRequest& Request, FOnComplete&& OnComplete) = 0;
+
+	/** Abandons every outstanding request without invoking its callback. */
+	virtual void CancelAll() {}
+};
+
+class FT66HttpBackendTransport final : public IT66BackendTransport
+{
+public:
+	virtual void Send(const FT66BackendHttpRequest& Request, FOnComplete&& OnComplete) override;
+	virtual void CancelAll() override;
+
+private:
+	TArray<TWeakPtr<IHttpRequest, ESPMode::ThreadSafe>> InFlightRequests;
+};
+
+/**
+ * In-process backend stand-in. Routes are matched on verb and URL path (query ignored); unrouted
+ * requests fail as if the connection dropped. Honors If-None-Match against the route's ETag.
+ */
+class FT66FakeBackendTransport final : public IT66BackendTransport
+{
+public:
+	struct FRoute
+	{
+		int32 Code = 200;
+		FString Body;
+		FString ETag;
+	};
+
+	void SetRoute(const FString& Verb, const FString& Path, const FRoute& Route);
+	void ClearRoutes() { Routes.Reset(); }
+
+	/** While held, responses queue until FlushHeldResponses so tests can observe in-flight state. */
+	void SetHoldResponses(bool bHold) { bHoldResponses = bHold; }
+	void FlushHeldResponses();
+
+	const TArray<FT66BackendHttpRequest>& GetSentRequests() const { return SentRequests; }
+	void ClearSentRequests() { SentRequests.Reset(); }
+
+	virtual void Send(const FT66BackendHttpRequest& Request, FOnComplete&& OnComplete) override;
+	virtual void CancelAll() override { HeldResponses.Reset(); }
+
+private:
+	TMap<FString, FRoute> Routes;
+	TArray<FT66BackendHttpRequest> SentRequests;
+	TArray<TPair<FT66BackendHttpResponse, FOnComplete>> HeldResponses;
+	bool bHoldResponses = false;
+};
+
+/**
+ * Game-thread front end over a transport. Identical GETs issued while one is in flight share its
+ * response, and GET bodies that carried an ETag are revalidated with If-None-Match so an unchanged
+ * resource costs a 304 instead of a full body.
+ */
+class FT66BackendRequestScheduler : public TSharedFromThis<FT66BackendRequestScheduler>
+{
+public:
+	FT66BackendRequestScheduler();
+
+	/** Null restores HTTP. Outstanding requests on the old transport are cancelled. */
+	void SetTransport(TSharedPtr<IT66BackendTransport> InTransport);
+
+	void Send(FT66BackendHttpRequest&& Request, IT66BackendTransport::FOnComplete&& OnComplete);
+
+	/** Cancels everything in flight and forgets cached validators. */
+	void Reset();
+
+	int32 GetCoalescedRequestCount() const { return CoalescedRequestCount; }
+	int32 GetNotModifiedCount() const { return NotModifiedCount; }
+
+private:
+	struct FValidatedBody
+	{
+		FString ETag;
+		FString Body;
+	};
+
+	static FString MakeGetKey(const FT66BackendHttpRequest& Request);
+	void SendGet(const FString& Key, const FT66BackendHttpRequest& Request);
+	void CompleteGet(const FString& Key, uint32 SentGeneration, const FT66BackendHttpRequest& Request, FT66BackendHttpResponse Response);
+	void TouchValidatedBody(const FString& Key);
+	void ForgetValidatedBody(const FString& Key);
+
+	TSharedRef<IT66BackendTransport> Transport;
+	TMap<FString, TArray<IT66BackendTransport::FOnComplete>> InFlightGets;
+	TMap<FString, FValidatedBody> ValidatedBodies;
+	/** Least recently used key first; eviction drops from the front. */
+	TArray<FString> ValidatedBodyOrder;
+	/** Bumped on Reset/SetTransport so late completions from a dropped transport are ignored. */
+	uint32 Generation = 0;
+	int32 CoalescedRequestCount = 0;
+	int32 NotModifiedCount = 0;
+};
@@ -186,21 +186,22 @@ void UT66RunStateSubsystem::AddMaxHearts(int32 DeltaHearts)
 }
 
 
-void UT66RunStateSubsystem::NotifyEnemyKilledByHero()
+void UT66RunStateSubsystem::NotifyEnemyKilledByHero(const int32 KillCount)
 {
+	if (KillCount <= 0) return;
 	UWorld* World = GetGameInstance() ? GetGameInstance()->GetWorld() : nullptr;
 	if (!World) return;
 	const double Now = World->GetTimeSeconds();
 
 	if (PassiveType == ET66PassiveType::RallyingBlow)
 	{
-		RallyStacks = FMath::Min(3, RallyStacks + 1);
+		RallyStacks = FMath::Min(3, RallyStacks + KillCount);
 		RallyTimerEndWorldTime = Now + 3.0;
 	}
 
 	if (PassiveType == ET66PassiveType::ChaosTheory)
 	{
-		ChaosTheoryBounceStacks = FMath::Min(3, ChaosTheoryBounceStacks + 1);
+		ChaosTheoryBounceStacks = FMath::Min(3, ChaosTheoryBounceStacks + KillCount);
 		ChaosTheoryTimerEndWorldTime = Now + 5.0;
 	}
 }
@@ -3,8 +3,10 @@
 #include "Core/T66AudioSubsystem.h"
 
 #include "Core/T66PlayerSettingsSubsystem.h"
+#include "Engine/AssetManager.h"
 #include "Engine/DataTable.h"
 #include "Engine/Engine.h"
+#include "Engine/StreamableManager.h"
 #include "Kismet/GameplayStatics.h"
 #include "Sound/SoundAttenuation.h"
 #include "Sound/SoundBase.h"
@@ -29,19 +31,29 @@ void UT66AudioSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 
 void UT66AudioSubsystem::Deinitialize()
 {
+	for (const TSharedPtr<FStreamableHandle>& Handle : ActiveLoadHandles)
+	{
+		if (Handle.IsValid())
+		{
+			Handle->CancelHandle();
+		}
+	}
+
+	ActiveLoadHandles.Reset();
 	AudioEventTable = nullptr;
-	AudioEvents.Reset();
-	CachedSounds.Reset();
-	CachedAttenuations.Reset();
-	CachedConcurrencies.Reset();
-	LastPlayTimeByEvent.Reset();
-	WarnedMissingSoundPaths.Reset();
+	ResidentAssets.Reset();
+	AssetSlots.Reset();
+	Events.Reset();
+	EventHandleByID.Reset();
 	Super::Deinitialize();
 }
 
 void UT66AudioSubsystem::LoadAudioEvents()
 {
-	AudioEvents.Reset();
+	Events.Reset();
+	EventHandleByID.Reset();
+	AssetSlots.Reset();
+	ResidentAssets.Reset();
 
 	AudioEventTable = LoadObject<UDataTable>(nullptr, T66AudioEventTablePath);
 	if (!AudioEventTable)
@@ -59,42 +71,193 @@ void UT66AudioSubsystem::LoadAudioEvents()
 		return;
 	}
 
+	TMap<FSoftObjectPath, int32> HandleByPath;
 	for (const FName& RowName : AudioEventTable->GetRowNames())
 	{
 		const FT66AudioEventRow* Row = AudioEventTable->FindRow<FT66AudioEventRow>(RowName, TEXT("T66AudioSubsystem"));
-		if (Row)
+		if (!Row)
 		{
-			AudioEvents.Add(RowName, *Row);
+			continue;
 		}
+
+		FResolvedAudioEvent& Event = Events.AddDefaulted_GetRef();
+		Event.EventID = RowName;
+		Event.Row = *Row;
+		Event.Group = ResolvePreloadGroup(RowName, *Row);
+		for (const FSoftObjectPath& SoundPath : Row->SoundAssetPaths)
+		{
+			const int32 SoundHandle = RegisterAsset(SoundPath, EAssetKind::Sound, HandleByPath);
+			if (SoundHandle != INDEX_NONE)
+			{
+				Event.SoundHandles.Add(SoundHandle);
+			}
+		}
+		Event.AttenuationHandle = RegisterAsset(Row->AttenuationAssetPath, EAssetKind::Attenuation, HandleByPath);
+		Event.ConcurrencyHandle = RegisterAsset(Row->ConcurrencyAssetPath, EAssetKind::Concurrency, HandleByPath);
+		EventHandleByID.Add(RowName, Events.Num() - 1);
 	}
 
-	UE_LOG(LogT66Audio, Log, TEXT("Loaded %d audio event rows from %s."), AudioEvents.Num(), T66AudioEventTablePath);
+	ResidentAssets.SetNum(AssetSlots.Num());
+	UE_LOG(LogT66Audio, Log, TEXT("Loaded %d audio event rows (%d unique assets) from %s."), Events.Num(), AssetSlots.Num(), T66AudioEventTablePath);
+}
+
+int32 UT66AudioSubsystem::RegisterAsset(const FSoftObjectPath& AssetPath, const EAssetKind Kind, TMap<FSoftObjectPath, int32>& HandleByPath)
+{
+	if (AssetPath.IsNull())
+	{
+		return INDEX_NONE;
+	}
+
+	if (const int32* Existing = HandleByPath.Find(AssetPath))
+	{
+		return *Existing;
+	}
+
+	FAudioAssetSlot& Slot = AssetSlots.AddDefaulted_GetRef();
+	Slot.Path = AssetPath;
+	Slot.Kind = Kind;
+	const int32 Handle = AssetSlots.Num() - 1;
+	HandleByPath.Add(AssetPath, Handle);
+	return Handle;
 }
 
 void UT66AudioSubsystem::PrimeConfiguredAssets()
 {
-	for (const TPair<FName, FT66AudioEventRow>& Pair : AudioEvents)
+	// Boot priming only covers rows flagged for it; UI streams first so frontend clicks are ready soonest.
+	static const ET66AudioPreloadGroup PrimeOrder[] = { ET66AudioPreloadGroup::UI, ET66AudioPreloadGroup::Combat, ET66AudioPreloadGroup::Boss };
+	for (const ET66AudioPreloadGroup Group : PrimeOrder)
+	{
+		TArray<int32> AssetHandles;
+		for (const FResolvedAudioEvent& Event : Events)
+		{
+			if (Event.Group == Group && Event.Row.bEnabled && Event.Row.bPrimeOnLoad)
+			{
+				AppendEventAssetHandles(Event, AssetHandles);
+			}
+		}
+
+		RequestAssetLoad(MoveTemp(AssetHandles), Group == ET66AudioPreloadGroup::UI
+			? FStreamableManager::AsyncLoadHighPriority
+			: FStreamableManager::DefaultAsyncLoadPriority);
+	}
+}
+
+void UT66AudioSubsystem::PreloadEventGroup(const ET66AudioPreloadGroup Group)
+{
+	TArray<int32> AssetHandles;
+	for (const FResolvedAudioEvent& Event : Events)
+	{
+		if (Event.Group == Group && Event.Row.bEnabled)
+		{
+			AppendEventAssetHandles(Event, AssetHandles);
+		}
+	}
+
+	RequestAssetLoad(MoveTemp(AssetHandles), Group == ET66AudioPreloadGroup::Boss
+		? FStreamableManager::DefaultAsyncLoadPriority
+		: FStreamableManager::AsyncLoadHighPriority);
+}
+
+void UT66AudioSubsystem::PreloadStageAudio()
+{
+	PreloadEventGroup(ET66AudioPreloadGroup::Combat);
+	PreloadEventGroup(ET66AudioPreloadGroup::Boss);
+}
+
+void UT66AudioSubsystem::AppendEventAssetHandles(const FResolvedAudioEvent& Event, TArray<int32>& OutHandles) const
+{
+	for (const int32 SoundHandle : Event.SoundHandles)
+	{
+		OutHandles.AddUnique(SoundHandle);
+	}
+	if (Event.AttenuationHandle != INDEX_NONE)
+	{
+		OutHandles.AddUnique(Event.AttenuationHandle);
+	}
+	if (Event.ConcurrencyHandle != INDEX_NONE)
+	{
+		OutHandles.AddUnique(Event.ConcurrencyHandle);
+	}
+}
+
+void UT66AudioSubsystem::RequestAssetLoad(TArray<int32> AssetHandles, const TAsyncLoadPriority Priority)
+{
+	TArray<FSoftObjectPath> Paths;
+	for (int32 Index = AssetHandles.Num() - 1; Index >= 0; --Index)
+	{
+		FAudioAssetSlot& Slot = AssetSlots[AssetHandles[Index]];
+		if (Slot.State != EAssetState::Unrequested)
+		{
+			AssetHandles.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+			continue;
+		}
+
+		Slot.State = EAssetState::Loading;
+		Paths.Add(Slot.Path);
+	}
+
+	if (Paths.Num() <= 0)
+	{
+		return;
+	}
+
+	TSharedPtr<FStreamableHandle> Handle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+		Paths,
+		FStreamableDelegate::CreateUObject(this, &UT66AudioSubsystem::HandleAssetsLoaded, AssetHandles),
+		Priority);
+	if (!Handle.IsValid())
+	{
+		HandleAssetsLoaded(MoveTemp(AssetHandles));
+		return;
+	}
+
+	if (!Handle->HasLoadCompleted())
+	{
+		ActiveLoadHandles.Add(Handle);
+	}
+}
+
+void UT66AudioSubsystem::HandleAssetsLoaded(TArray<int32> AssetHandles)
+{
+	ActiveLoadHandles.RemoveAll([](const TSharedPtr<FStreamableHandle>& Handle)
+	{
+		return !Handle.IsValid() || Handle->HasLoadCompleted() || Handle->WasCanceled();
+	});
+
+	for (const int32 AssetHandle : AssetHandles)
 	{
-		const FT66AudioEventRow& Row = Pair.Value;
-		if (!Row.bEnabled || !Row.bPrimeOnLoad)
+		if (!AssetSlots.IsValidIndex(AssetHandle))
 		{
 			continue;
 		}
 
-		for (const FSoftObjectPath& SoundPath : Row.SoundAssetPaths)
+		FAudioAssetSlot& Slot = AssetSlots[AssetHandle];
+		UObject* Asset = Slot.Path.ResolveObject();
+		const bool bMatchesKind =
+			(Slot.Kind == EAssetKind::Sound && Cast<USoundBase>(Asset))
+			|| (Slot.Kind == EAssetKind::Attenuation && Cast<USoundAttenuation>(Asset))
+			|| (Slot.Kind == EAssetKind::Concurrency && Cast<USoundConcurrency>(Asset));
+		if (!bMatchesKind)
 		{
-			ResolveSound(SoundPath, false);
+			Slot.State = EAssetState::Missing;
+			ResidentAssets[AssetHandle] = nullptr;
+			if (Slot.Kind == EAssetKind::Sound)
+			{
+				UE_LOG(LogT66Audio, Warning, TEXT("Audio sound asset missing or not a USoundBase: %s"), *Slot.Path.ToString());
+			}
+			continue;
 		}
 
-		ResolveAttenuation(Row.AttenuationAssetPath);
-		ResolveConcurrency(Row.ConcurrencyAssetPath);
+		Slot.State = EAssetState::Loaded;
+		ResidentAssets[AssetHandle] = Asset;
 	}
 }
 
 bool UT66AudioSubsystem::IsEventConfigured(const FName EventID) const
 {
-	const FT66AudioEventRow* Row = AudioEvents.Find(EventID);
-	return Row && Row->bEnabled && Row->SoundAssetPaths.Num() > 0;
+	const int32* EventHandle = EventHandleByID.Find(EventID);
+	const FResolvedAudioEvent* Event = EventHandle ? &Events[*EventHandle] : nullptr;
+	return Event && Event->Row.bEnabled && Event->SoundHandles.Num() > 0;
 }
 
 bool UT66AudioSubsystem::PlayEvent(FName EventID, UObject* WorldContextObject, const FVector Location, AActor* OwningActor)
@@ -104,41 +267,55 @@ bool UT66AudioSubsystem::PlayEvent(FName EventID, UObject* WorldContextObject, c
 		return false;
 	}
 
-	const FT66AudioEventRow* Row = AudioEvents.Find(EventID);
-	if (!Row || !Row->bEnabled)
+	const int32* EventHandle = EventHandleByID.Find(EventID);
+	if (!EventHandle)
+	{
+		return false;
+	}
+
+	FResolvedAudioEvent& Event = Events[*EventHandle];
+	const FT66AudioEventRow& Row = Event.Row;
+	if (!Row.bEnabled)
 	{
 		return false;
 	}
 
 	UWorld* World = ResolveWorld(WorldContextObject, OwningActor);
-	if (!World || IsThrottled(EventID, *Row))
+	if (!World || IsThrottled(Event))
 	{
 		return false;
 	}
 
-	USoundBase* Sound = SelectSoundForRow(EventID, *Row);
+	USoundBase* Sound = SelectSoundForEvent(Event);
 	if (!Sound)
 	{
 		return false;
 	}
 
-	const float Volume = ResolveVolumeMultiplier(*Row);
+	const float Volume = ResolveVolumeMultiplier(Row);
 	if (Volume <= KINDA_SMALL_NUMBER)
 	{
 		return false;
 	}
 
-	const float Pitch = ResolvePitchMultiplier(*Row);
-	USoundConcurrency* Concurrency = ResolveConcurrency(Row->ConcurrencyAssetPath);
+	// Attenuation/concurrency still streaming: drop this play rather than fire with the wrong settings.
+	bool bConcurrencyPending = false;
+	bool bAttenuationPending = false;
+	USoundConcurrency* Concurrency = static_cast<USoundConcurrency*>(ResolveResidentAsset(Event.ConcurrencyHandle, bConcurrencyPending));
+	USoundAttenuation* Attenuation = Row.bPlay2D ? nullptr : static_cast<USoundAttenuation*>(ResolveResidentAsset(Event.AttenuationHandle, bAttenuationPending));
+	if (bConcurrencyPending || bAttenuationPending)
+	{
+		return false;
+	}
 
-	if (Row->bPlay2D)
+	const float Pitch = ResolvePitchMultiplier(Row);
+	if (Row.bPlay2D)
 	{
-		UGameplayStatics::PlaySound2D(World, Sound, Volume, Pitch, Row->StartTime, Concurrency, OwningActor, Row->bIsUISound);
+		UGameplayStatics::PlaySound2D(World, Sound, Volume, Pitch, Row.StartTime, Concurrency, OwningActor, Row.bIsUISound);
 		return true;
 	}
 
 	const FVector PlayLocation = OwningActor ? OwningActor->GetActorLocation() : Location;
-	USoundAttenuation* Attenuation = ResolveAttenuation(Row->AttenuationAssetPath);
 	UGameplayStatics::PlaySoundAtLocation(
 		World,
 		Sound,
@@ -146,7 +323,7 @@ bool UT66AudioSubsystem::PlayEvent(FName EventID, UObject* WorldContextObject, c
 		FRotator::ZeroRotator,
 		Volume,
 		Pitch,
-		Row->StartTime,
+		Row.StartTime,
 		Attenuation,
 		Concurrency,
 		OwningActor);
@@ -211,95 +388,55 @@ bool UT66AudioSubsystem::PlayUIEventFromAnyWorld(const FName EventID)
 	return false;
 }
 
-USoundBase* UT66AudioSubsystem::ResolveSound(const FSoftObjectPath& AssetPath, const bool bWarnOnFailure)
+UObject* UT66AudioSubsystem::ResolveResidentAsset(const int32 AssetHandle, bool& bOutPending)
 {
-	if (AssetPath.IsNull())
+	bOutPending = false;
+	if (!AssetSlots.IsValidIndex(AssetHandle))
 	{
 		return nullptr;
 	}
 
-	const FString AssetPathString = AssetPath.ToString();
-	if (TObjectPtr<USoundBase>* Cached = CachedSounds.Find(AssetPathString))
-	{
-		return Cached->Get();
-	}
-
-	USoundBase* Sound = Cast<USoundBase>(AssetPath.TryLoad());
-	if (!Sound)
+	switch (AssetSlots[AssetHandle].State)
 	{
-		if (bWarnOnFailure && !WarnedMissingSoundPaths.Contains(AssetPathString))
-		{
-			WarnedMissingSoundPaths.Add(AssetPathString);
-			UE_LOG(LogT66Audio, Warning, TEXT("Audio sound asset missing or not a USoundBase: %s"), *AssetPathString);
-		}
+	case EAssetState::Loaded:
+		return ResidentAssets[AssetHandle].Get();
+	case EAssetState::Unrequested:
+		RequestAssetLoad({ AssetHandle }, FStreamableManager::AsyncLoadHighPriority);
+		bOutPending = AssetSlots[AssetHandle].State != EAssetState::Loaded;
+		return bOutPending ? nullptr : ResidentAssets[AssetHandle].Get();
+	case EAssetState::Loading:
+		bOutPending = true;
 		return nullptr;
-	}
-
-	CachedSounds.Add(AssetPathString, Sound);
-	return Sound;
-}
-
-USoundAttenuation* UT66AudioSubsystem::ResolveAttenuation(const FSoftObjectPath& AssetPath)
-{
-	if (AssetPath.IsNull())
-	{
+	default:
 		return nullptr;
 	}
-
-	const FString AssetPathString = AssetPath.ToString();
-	if (TObjectPtr<USoundAttenuation>* Cached = CachedAttenuations.Find(AssetPathString))
-	{
-		return Cached->Get();
-	}
-
-	USoundAttenuation* Attenuation = Cast<USoundAttenuation>(AssetPath.TryLoad());
-	if (Attenuation)
-	{
-		CachedAttenuations.Add(AssetPathString, Attenuation);
-	}
-	return Attenuation;
-}
-
-USoundConcurrency* UT66AudioSubsystem::ResolveConcurrency(const FSoftObjectPath& AssetPath)
-{
-	if (AssetPath.IsNull())
-	{
-		return nullptr;
-	}
-
-	const FString AssetPathString = AssetPath.ToString();
-	if (TObjectPtr<USoundConcurrency>* Cached = CachedConcurrencies.Find(AssetPathString))
-	{
-		return Cached->Get();
-	}
-
-	USoundConcurrency* Concurrency = Cast<USoundConcurrency>(AssetPath.TryLoad());
-	if (Concurrency)
-	{
-		CachedConcurrencies.Add(AssetPathString, Concurrency);
-	}
-	return Concurrency;
 }
 
-USoundBase* UT66AudioSubsystem::SelectSoundForRow(const FName EventID, const FT66AudioEventRow& Row)
+USoundBase* UT66AudioSubsystem::SelectSoundForEvent(FResolvedAudioEvent& Event)
 {
-	const int32 NumSounds = Row.SoundAssetPaths.Num();
+	const int32 NumSounds = Event.SoundHandles.Num();
 	if (NumSounds <= 0)
 	{
 		return nullptr;
 	}
 
+	bool bAnyPending = false;
 	const int32 StartIndex = NumSounds > 1 ? FMath::RandRange(0, NumSounds - 1) : 0;
 	for (int32 Offset = 0; Offset < NumSounds; ++Offset)
 	{
 		const int32 Index = (StartIndex + Offset) % NumSounds;
-		if (USoundBase* Sound = ResolveSound(Row.SoundAssetPaths[Index], true))
+		bool bPending = false;
+		if (UObject* Sound = ResolveResidentAsset(Event.SoundHandles[Index], bPending))
 		{
-			return Sound;
+			return static_cast<USoundBase*>(Sound);
 		}
+		bAnyPending |= bPending;
 	}
 
-	UE_LOG(LogT66Audio, Warning, TEXT("Audio event %s has no loadable sound assets."), *EventID.ToString());
+	if (!bAnyPending)
+	{
+		UE_LOG(LogT66Audio, Warning, TEXT("Audio event %s has no loadable sound assets."), *Event.EventID.ToString());
+	}
 	return nullptr;
 }
 
@@ -330,23 +467,20 @@ float UT66AudioSubsystem::ResolvePitchMultiplier(const FT66AudioEventRow& Row) c
 	return FMath::Max(0.01f, Row.PitchMultiplier + RandomOffset);
 }
 
-bool UT66AudioSubsystem::IsThrottled(const FName EventID, const FT66AudioEventRow& Row)
+bool UT66AudioSubsystem::IsThrottled(FResolvedAudioEvent& Event)
 {
-	if (Row.MinReplayIntervalSeconds <= 0.f)
+	if (Event.Row.MinReplayIntervalSeconds <= 0.f)
 	{
 		return false;
 	}
 
 	const double Now = FPlatformTime::Seconds();
-	if (const double* LastTime = LastPlayTimeByEvent.Find(EventID))
+	if (Event.LastPlayTime >= 0.0 && (Now - Event.LastPlayTime) < static_cast<double>(Event.Row.MinReplayIntervalSeconds))
 	{
-		if ((Now - *LastTime) < static_cast<double>(Row.MinReplayIntervalSeconds))
-		{
-			return true;
-		}
+		return true;
 	}
 
-	LastPlayTimeByEvent.Add(EventID, Now);
+	Event.LastPlayTime = Now;
 	return false;
 }
 
@@ -364,3 +498,19 @@ UWorld* UT66AudioSubsystem::ResolveWorld(UObject* WorldContextObject, AActor* Ow
 
 	return nullptr;
 }
+
+ET66AudioPreloadGroup UT66AudioSubsystem::ResolvePreloadGroup(const FName EventID, const FT66AudioEventRow& Row)
+{
+	const FString EventIDString = EventID.ToString();
+	if (Row.bIsUISound || EventIDString.StartsWith(TEXT("UI.")))
+	{
+		return ET66AudioPreloadGroup::UI;
+	}
+
+	if (EventIDString.StartsWith(TEXT("Boss.")) || EventIDString.Contains(TEXT(".Boss")))
+	{
+		return ET66AudioPreloadGroup::Boss;
+	}
+
+	return ET66AudioPreloadGroup::Combat;
+}
@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "Core/T66AudioTypes.h"
+#include "Engine/StreamableManager.h"
 #include "Subsystems/GameInstanceSubsystem.h"
 #include "T66AudioSubsystem.generated.h"
 
@@ -11,11 +12,16 @@ class USoundAttenuation;
 class USoundBase;
 class USoundConcurrency;
 class UDataTable;
+struct FStreamableHandle;
 
 DECLARE_LOG_CATEGORY_EXTERN(LogT66Audio, Log, All);
 
 /**
  * Central data-driven audio router for gameplay and Slate-triggered UI sounds.
+ *
+ * Event rows are resolved once at init into a dense handle table; sound, attenuation and concurrency
+ * assets are streamed asynchronously by preload group. Play requests never load synchronously: an
+ * event whose assets are not resident yet is dropped and its load is queued instead.
  */
 UCLASS()
 class T66_API UT66AudioSubsystem : public UGameInstanceSubsystem
@@ -32,39 +38,77 @@ public:
 	bool PlayEventAtActor(FName EventID, AActor* Actor);
 	bool IsEventConfigured(FName EventID) const;
 
+	/** Streams every asset referenced by events in the group, including rows that opted out of boot priming. */
+	void PreloadEventGroup(ET66AudioPreloadGroup Group);
+
+	/** Called at gameplay stage load so combat and boss cues are resident before the first hit. */
+	void PreloadStageAudio();
+
 	static bool PlayEventFromWorldContext(UObject* WorldContextObject, FName EventID, const FVector& Location = FVector::ZeroVector, AActor* OwningActor = nullptr);
 	static bool PlayEventAtActorFromWorldContext(UObject* WorldContextObject, FName EventID, AActor* Actor);
 	static bool PlayUIEventFromAnyWorld(FName EventID = FName(TEXT("UI.Click")));
 
 private:
+	enum class EAssetState : uint8
+	{
+		Unrequested,
+		Loading,
+		Loaded,
+		Missing
+	};
+
+	enum class EAssetKind : uint8
+	{
+		Sound,
+		Attenuation,
+		Concurrency
+	};
+
+	struct FAudioAssetSlot
+	{
+		FSoftObjectPath Path;
+		EAssetKind Kind = EAssetKind::Sound;
+		EAssetState State = EAssetState::Unrequested;
+	};
+
+	struct FResolvedAudioEvent
+	{
+		FName EventID;
+		FT66AudioEventRow Row;
+		TArray<int32, TInlineAllocator<4>> SoundHandles;
+		int32 AttenuationHandle = INDEX_NONE;
+		int32 ConcurrencyHandle = INDEX_NONE;
+		ET66AudioPreloadGroup Group = ET66AudioPreloadGroup::Combat;
+		double LastPlayTime = -1.0;
+	};
+
 	void LoadAudioEvents();
 	void PrimeConfiguredAssets();
 
-	USoundBase* ResolveSound(const FSoftObjectPath& AssetPath, bool bWarnOnFailure);
-	USoundAttenuation* ResolveAttenuation(const FSoftObjectPath& AssetPath);
-	USoundConcurrency* ResolveConcurrency(const FSoftObjectPath& AssetPath);
-	USoundBase* SelectSoundForRow(FName EventID, const FT66AudioEventRow& Row);
+	int32 RegisterAsset(const FSoftObjectPath& AssetPath, EAssetKind Kind, TMap<FSoftObjectPath, int32>& HandleByPath);
+	void AppendEventAssetHandles(const FResolvedAudioEvent& Event, TArray<int32>& OutHandles) const;
+	void RequestAssetLoad(TArray<int32> AssetHandles, TAsyncLoadPriority Priority);
+	void HandleAssetsLoaded(TArray<int32> AssetHandles);
+
+	/** Returns the resident asset for the handle, queueing an async load when it is not resident yet. */
+	UObject* ResolveResidentAsset(int32 AssetHandle, bool& bOutPending);
+	USoundBase* SelectSoundForEvent(FResolvedAudioEvent& Event);
 
 	float ResolveVolumeMultiplier(const FT66AudioEventRow& Row) const;
 	float ResolvePitchMultiplier(const FT66AudioEventRow& Row) const;
-	bool IsThrottled(FName EventID, const FT66AudioEventRow& Row);
+	bool IsThrottled(FResolvedAudioEvent& Event);
 	UWorld* ResolveWorld(UObject* WorldContextObject, AActor* OwningActor) const;
+	static ET66AudioPreloadGroup ResolvePreloadGroup(FName EventID, const FT66AudioEventRow& Row);
 
 	UPROPERTY(Transient)
 	TObjectPtr<UDataTable> AudioEventTable = nullptr;
 
+	/** Resident asset per slot; parallel to AssetSlots so the GC keeps streamed assets alive. */
 	UPROPERTY(Transient)
-	TMap<FName, FT66AudioEventRow> AudioEvents;
-
-	UPROPERTY(Transient)
-	TMap<FString, TObjectPtr<USoundBase>> CachedSounds;
-
-	UPROPERTY(Transient)
-	TMap<FString, TObjectPtr<USoundAttenuation>> CachedAttenuations;
-
-	UPROPERTY(Transient)
-	TMap<FString, TObjectPtr<USoundConcurrency>> CachedConcurrencies;
+	TArray<TObjectPtr<UObject>> ResidentAssets;
 
-	TMap<FName, double> LastPlayTimeByEvent;
-	TSet<FString> WarnedMissingSoundPaths;
+	TArray<FAudioAssetSlot> AssetSlots;
+	TArray<FResolvedAudioEvent> Events;
+	TMap<FName, int32> EventHandleByID;
+	TArray<TSharedPtr<FStreamableHandle>> ActiveLoadHandles;
 };
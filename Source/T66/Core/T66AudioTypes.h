@@ -7,6 +7,18 @@
 #include "UObject/SoftObjectPath.h"
 #include "T66AudioTypes.generated.h"
 
+/**
+ * Streaming priority group for audio event assets.
+ * UI is requested first at boot; Combat and Boss are re-requested in full when a gameplay stage loads.
+ */
+UENUM(BlueprintType)
+enum class ET66AudioPreloadGroup : uint8
+{
+	UI UMETA(DisplayName = "UI"),
+	Combat UMETA(DisplayName = "Combat"),
+	Boss UMETA(DisplayName = "Boss"),
+};
+
 /**
  * Data-authored gameplay/UI audio event.
  *
@@ -5,10 +5,10 @@
 #include "CoreMinimal.h"
 #include "Subsystems/GameInstanceSubsystem.h"
 #include "Core/T66DailyClimbTypes.h"
+#include "Core/Backend/T66BackendRunOutbox.h"
+#include "Core/Backend/T66BackendTransport.h"
 #include "Data/T66DataTypes.h"
 #include "Containers/Ticker.h"
-#include "Interfaces/IHttpRequest.h"
-#include "Interfaces/IHttpResponse.h"
 #include "T66BackendSubsystem.generated.h"
 
 class UT66LeaderboardRunSummarySaveGame;
@@ -127,6 +127,15 @@ struct T66_API FT66PartyInviteEntry
 	FString ExpiresAtIso;
 };
 
+/** One parsed leaderboard response. Built on a worker and shared read-only with every UI reader. */
+struct FT66LeaderboardSnapshot
+{
+	TArray<FLeaderboardEntry> Entries;
+	int32 TotalEntries = 0;
+};
+
+using FT66LeaderboardSnapshotPtr = TSharedPtr<const FT66LeaderboardSnapshot, ESPMode::ThreadSafe>;
+
 DECLARE_MULTICAST_DELEGATE(FOnT66PendingPartyInvitesChanged);
 DECLARE_MULTICAST_DELEGATE_FourParams(
 	FOnT66PartyInviteActionComplete,
@@ -160,6 +169,16 @@ public:
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Backend")
 	FString GetBackendBaseUrl() const { return BackendBaseUrl; }
 
+	/**
+	 * Replaces the transport under every backend call (e.g. FT66FakeBackendTransport for offline tests).
+	 * Pass null to restore HTTP. Requests in flight on the old transport are dropped without callbacks.
+	 */
+	void SetBackendTransport(TSharedPtr<IT66BackendTransport> Transport);
+
+	/** GETs that joined an identical in-flight request / GETs answered 304 from the validator cache. */
+	int32 GetCoalescedRequestCount() const { return RequestScheduler->GetCoalescedRequestCount(); }
+	int32 GetNotModifiedResponseCount() const { return RequestScheduler->GetNotModifiedCount(); }
+
 	// ── Steam Ticket ─────────────────────────────────────────
 
 	/**
@@ -199,7 +218,9 @@ public:
 	/**
 	 * Submit the current run to the backend.
 	 * If Snapshot is provided, full run summary data (stats, inventory, idols, damage) is included.
-	 * Fires OnSubmitRunComplete when done.
+	 * The payload is built, compressed and written to the on-disk outbox on a worker; delivery is
+	 * retried with backoff and any runs still queued at shutdown are sent on the next launch.
+	 * Fires OnSubmitRunComplete when done (or on the first failed attempt while retries continue).
 	 */
 	void SubmitRunToBackend(
 		const FString& DisplayName,
@@ -221,6 +242,8 @@ public:
 	const FString& GetLastSubmitRunStatus() const { return LastSubmitRunStatus; }
 	const FString& GetLastSubmitRunReason() const { return LastSubmitRunReason; }
 
+	int32 GetQueuedRunSubmissionCount() const { return RunOutbox.Num(); }
+
 	// ── API: My Rank ─────────────────────────────────────────
 
 	UFUNCTION(BlueprintCallable, Category = "Backend")
@@ -349,8 +372,8 @@ public:
 	/** Check if cached entries exist for a leaderboard key. */
 	bool HasCachedLeaderboard(const FString& Key) const;
 
-	/** Get cached entries for a leaderboard key (empty if not cached). */
-	TArray<FLeaderboardEntry> GetCachedLeaderboard(const FString& Key) const;
+	/** Shared cached snapshot for a leaderboard key (null if not cached). Replaced, never mutated, on refetch. */
+	FT66LeaderboardSnapshotPtr GetCachedLeaderboard(const FString& Key) const;
 
 	/** Total entries count from the last fetch for this key. */
 	int32 GetCachedTotalEntries(const FString& Key) const;
@@ -392,12 +415,6 @@ private:
 	FOnT66PartyInviteActionComplete PartyInviteActionComplete;
 	FOnT66ClientLaunchPolicyResponse ClientLaunchPolicyResponse;
 
-	struct FCachedLeaderboard
-	{
-		TArray<FLeaderboardEntry> Entries;
-		int32 TotalEntries = 0;
-	};
-
 	struct FCachedMyRank
 	{
 		bool bSuccess = false;
@@ -420,7 +437,7 @@ private:
 		int32 RetryCount = 0;
 	};
 
-	TMap<FString, FCachedLeaderboard> LeaderboardCache;
+	TMap<FString, FT66LeaderboardSnapshotPtr> LeaderboardCache;
 	TSet<FString> PendingLeaderboardFetches;
 	TMap<FString, FCachedMyRank> MyRankCache;
 	TSet<FString> PendingMyRankFetches;
@@ -435,19 +452,33 @@ private:
 	TSet<FString> PendingRunSummaryFetches;
 	FTSTicker::FDelegateHandle PartyInvitePollTickerHandle;
 	FTSTicker::FDelegateHandle PendingCoopSubmitTickerHandle;
-	TWeakPtr<IHttpRequest, ESPMode::ThreadSafe> PendingPartyInvitePollRequest;
+	FTSTicker::FDelegateHandle RunOutboxTickerHandle;
+	TSharedRef<FT66BackendRequestScheduler> RequestScheduler = MakeShared<FT66BackendRequestScheduler>();
 	double LastPartyInvitePollTimeSeconds = 0.0;
+	/** Current non-forced poll spacing; grows while polls come back unchanged, resets on any change. */
+	double PartyInvitePollIntervalSeconds = 0.0;
 	bool bPartyInvitePollInFlight = false;
 	bool bPartyInvitePollRequestedWhileInFlight = false;
 	TMap<FString, FPendingCoopSubmit> PendingCoopSubmitRequests;
+	TArray<FT66RunOutboxEntry> RunOutbox;
+	/** Account whose on-disk outbox has been drained into RunOutbox; set on the first ticket for that account. */
+	FString RunOutboxOwnerSteamId;
+	bool bRunOutboxOwnerLoaded = false;
+	/** A submit came back 401; queued runs wait for SetSteamTicketHex instead of asking Steam again. */
+	bool bRunOutboxTicketRefreshPending = false;
+	bool bGzipSubmitRunBody = false;
 
 	void SeedDevelopmentDummyLeaderboardsIfNeeded();
 	bool TryPopulateDevelopmentDummyLeaderboard(const FString& Key);
 
-	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> CreateRequest(const FString& Verb, const FString& Endpoint) const;
-	void SetAuthHeaders(TSharedRef<IHttpRequest, ESPMode::ThreadSafe>& Request) const;
+	FT66BackendHttpRequest CreateRequest(const FString& Verb, const FString& Endpoint) const;
+	void SetAuthHeaders(FT66BackendHttpRequest& Request) const;
+	/** Hands the request to the scheduler; OnComplete is skipped if the subsystem is gone by then. */
+	void SendRequest(FT66BackendHttpRequest&& Request, IT66BackendTransport::FOnComplete&& OnComplete);
+	void UpdatePartyInvitePollBackoff(bool bActivity);
 	bool HandlePartyInvitePollTicker(float DeltaTime);
 	bool HandlePendingCoopSubmitTicker(float DeltaTime);
+	bool HandleRunOutboxTicker(float DeltaTime);
 	void SetPendingPartyInvites(TArray<FT66PartyInviteEntry>&& NewInvites);
 	void QueuePendingCoopSubmit(
 		const FString& DisplayName,
@@ -471,29 +502,42 @@ private:
 		const FString& CompanionId,
 		const FString& HostRunJson,
 		const FString& RequestKey);
-	void SendSubmitRunRequest(const TSharedPtr<FJsonObject>& Root, const FString& RequestKey);
+	void ContinueCoopSubmitRun(const FPendingCoopSubmit& Submit);
+	void QueueSubmitRunBody(TFunction<TSharedPtr<FJsonObject>()>&& BuildRoot, const FString& RequestKey);
+	FString GetSignedInSteamId() const;
+	void LoadRunOutboxForOwner(const FString& OwnerSteamId);
+	void AddRunOutboxEntries(TArray<FT66RunOutboxEntry>&& Entries);
+	void PumpRunOutbox();
+	void SendRunOutboxEntry(const FT66RunOutboxEntry& Entry);
+	void HandleSubmitRunResult(const FString& OutboxId, bool bConnectedSuccessfully, int32 ResponseCode, const FString& ResponseBody);
+	void ApplySubmitRunResponse(const FString& RequestKey, int32 Code, const FString& Body);
 
 	static FString DifficultyToApiString(ET66Difficulty Diff);
 	static FString PartySizeToApiString(ET66PartySize Party);
 
 	// Response handlers
-	void OnSubmitRunResponseReceived(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bConnectedSuccessfully, FString RequestKey);
-	void OnMyRankResponseReceived(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bConnectedSuccessfully, FString RankKey);
-	void OnAccountStatusResponseReceived(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bConnectedSuccessfully);
-	void OnRunReportResponseReceived(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bConnectedSuccessfully);
-	void OnAppealResponseReceived(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bConnectedSuccessfully);
-	void OnProofOfRunResponseReceived(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bConnectedSuccessfully);
-	void OnBugReportResponseReceived(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bConnectedSuccessfully);
-	void OnHealthResponseReceived(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bConnectedSuccessfully);
-	void OnClientLaunchPolicyResponseReceived(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bConnectedSuccessfully, int32 LocalSteamBuildId);
-	void OnSendPartyInviteResponseReceived(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bConnectedSuccessfully);
-	void OnPendingPartyInvitesResponseReceived(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bConnectedSuccessfully);
-	void OnRespondPartyInviteResponseReceived(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bConnectedSuccessfully, FString InviteId, FString Action);
-	void OnClientDiagnosticsResponseReceived(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bConnectedSuccessfully, FString EventName, FString InviteId);
-	void OnLeaderboardResponseReceived(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bConnectedSuccessfully, FString LeaderboardKey);
-	void OnRunSummaryResponseReceived(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bConnectedSuccessfully, FString EntryId);
-	void OnDailyClimbStatusResponseReceived(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bConnectedSuccessfully, FString RequestTag);
-	void OnDailyClimbSubmitResponseReceived(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bConnectedSuccessfully, FString RequestKey);
+	void OnMyRankResponseReceived(const FT66BackendHttpResponse& Response, FString RankKey);
+	void OnAccountStatusResponseReceived(const FT66BackendHttpResponse& Response);
+	void OnRunReportResponseReceived(const FT66BackendHttpResponse& Response);
+	void OnAppealResponseReceived(const FT66BackendHttpResponse& Response);
+	void OnProofOfRunResponseReceived(const FT66BackendHttpResponse& Response);
+	void OnBugReportResponseReceived(const FT66BackendHttpResponse& Response);
+	void OnHealthResponseReceived(const FT66BackendHttpResponse& Response);
+	void OnClientLaunchPolicyResponseReceived(const FT66BackendHttpResponse& Response, int32 LocalSteamBuildId);
+	void OnSendPartyInviteResponseReceived(const FT66BackendHttpResponse& Response);
+	void OnPendingPartyInvitesResponseReceived(const FT66BackendHttpResponse& Response);
+	void OnRespondPartyInviteResponseReceived(const FT66BackendHttpResponse& Response, FString InviteId, FString Action);
+	void OnClientDiagnosticsResponseReceived(const FT66BackendHttpResponse& Response, FString EventName, FString InviteId);
+	void OnLeaderboardResponseReceived(const FT66BackendHttpResponse& Response, FString LeaderboardKey);
+	void OnRunSummaryResponseReceived(const FT66BackendHttpResponse& Response, FString EntryId);
+	void OnDailyClimbStatusResponseReceived(const FT66BackendHttpResponse& Response, FString RequestTag);
+	void OnDailyClimbSubmitResponseReceived(const FT66BackendHttpResponse& Response, FString RequestKey);
+
+	/** Worker-safe parsers for response bodies; the handlers above only swap the result into the cache. */
+	static FT66LeaderboardSnapshotPtr ParseLeaderboardResponse(const FString& Body, bool bIsSpeedRunLeaderboard);
+	static bool ParseMyRankResponse(const FString& Body, FCachedMyRank& OutRank);
+	void ApplyLeaderboardResponse(const FString& LeaderboardKey, FT66LeaderboardSnapshotPtr Snapshot);
+	void ApplyMyRankResponse(const FString& RankKey, const FCachedMyRank& Cached);
 
 	static ET66Difficulty ApiStringToDifficulty(const FString& S);
 	static ET66PartySize ApiStringToPartySize(const FString& S);
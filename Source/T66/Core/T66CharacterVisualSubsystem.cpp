@@ -2,6 +2,7 @@
 
 #include "Core/T66CharacterVisualSubsystem.h"
 #include "Core/T66GameInstance.h"
+#include "Core/T66RetroFXSubsystem.h"
 #include "Engine/DataTable.h"
 #include "Engine/AssetManager.h"
 #include "Engine/SkeletalMesh.h"
@@ -83,11 +84,83 @@ static void T66AddUniqueCharacterVisualPath(const FSoftObjectPath& Path, TArray<
 	}
 }
 
+/**
+ * Package names registered under /Game/Characters, captured once from the asset registry.
+ * Replaces per-request FPackageName::DoesPackageExist probes when resolving visual rows and their
+ * animation fallback variants. Until the registry finishes its initial scan (editor only), lookups
+ * fall back to the filesystem probe.
+ */
+struct FT66CharacterPackageIndex
+{
+	TSet<FName> RegisteredPackages;
+	bool bBuilt = false;
+};
+
+static FT66CharacterPackageIndex& T66GetCharacterPackageIndex()
+{
+	static FT66CharacterPackageIndex Index;
+	return Index;
+}
+
+static bool T66BuildCharacterPackageIndex()
+{
+	FT66CharacterPackageIndex& Index = T66GetCharacterPackageIndex();
+	if (Index.bBuilt)
+	{
+		return true;
+	}
+
+	IAssetRegistry& Registry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+	if (Registry.IsLoadingAssets())
+	{
+		return false;
+	}
+
+	const double BuildStart = FPlatformTime::Seconds();
+
+	FARFilter Filter;
+	Filter.bRecursivePaths = true;
+	Filter.bIncludeOnlyOnDiskAssets = true;
+	Filter.PackagePaths.Add(T66_CharactersRootPath);
+
+	TArray<FAssetData> Assets;
+	Registry.GetAssets(Filter, Assets);
+
+	Index.RegisteredPackages.Reset();
+	Index.RegisteredPackages.Reserve(Assets.Num());
+	for (const FAssetData& Asset : Assets)
+	{
+		Index.RegisteredPackages.Add(Asset.PackageName);
+	}
+	Index.bBuilt = true;
+
+	UE_LOG(LogT66CharacterVisuals, Log, TEXT("[MESH] Indexed %d character packages from the asset registry in %.1fms"),
+		Index.RegisteredPackages.Num(), (FPlatformTime::Seconds() - BuildStart) * 1000.0);
+	return true;
+}
+
+static bool T66IsCharacterPackageRegistered(const FSoftObjectPath& ObjectPath)
+{
+	const FString PackageName = ObjectPath.GetLongPackageName();
+	if (PackageName.IsEmpty())
+	{
+		return false;
+	}
+
+	const FT66CharacterPackageIndex& Index = T66GetCharacterPackageIndex();
+	if (Index.bBuilt && PackageName.StartsWith(T66_CharactersRootPath.ToString() + TEXT("/")))
+	{
+		return Index.RegisteredPackages.Contains(FName(*PackageName));
+	}
+
+	// Outside the indexed root, or the registry has not finished its initial scan yet.
+	return FPackageName::DoesPackageExist(PackageName);
+}
+
 static void T66AddCharacterVisualPathIfPackageExists(const FString& ObjectPathString, TArray<FSoftObjectPath>& OutPaths)
 {
 	const FSoftObjectPath ObjectPath(ObjectPathString);
-	const FString PackageName = ObjectPath.GetLongPackageName();
-	if (!PackageName.IsEmpty() && FPackageName::DoesPackageExist(PackageName))
+	if (T66IsCharacterPackageRegistered(ObjectPath))
 	{
 		OutPaths.AddUnique(ObjectPath);
 	}
@@ -500,18 +573,19 @@ static void T66ApplySafeCharacterMaterialOverrides(USkeletalMeshComponent* Targe
 	}
 }
 
-/** If the given path points to a non-animation (e.g. SkeletalMesh), try the same path with _Anim suffix (e.g. AM_X.AM_X -> AM_X_Anim.AM_X_Anim). */
+/**
+ * Resolve a soft reference without touching the filesystem. Resident objects are returned directly;
+ * otherwise the package must be in the registered index, and is only loaded when sync loads are allowed.
+ */
 template <typename TObjectType>
-static TObjectType* TryLoadSoftObjectIfPackageExists(const TSoftObjectPtr<TObjectType>& SoftPath)
+static TObjectType* TryLoadSoftObjectIfPackageExists(const TSoftObjectPtr<TObjectType>& SoftPath, bool bAllowSyncLoad)
 {
 	if (TObjectType* LoadedObject = SoftPath.Get())
 	{
 		return LoadedObject;
 	}
 
-	const FSoftObjectPath ObjectPath = SoftPath.ToSoftObjectPath();
-	const FString PackageName = ObjectPath.GetLongPackageName();
-	if (PackageName.IsEmpty() || !FPackageName::DoesPackageExist(PackageName))
+	if (!bAllowSyncLoad || !T66IsCharacterPackageRegistered(SoftPath.ToSoftObjectPath()))
 	{
 		return nullptr;
 	}
@@ -519,7 +593,8 @@ static TObjectType* TryLoadSoftObjectIfPackageExists(const TSoftObjectPtr<TObjec
 	return SoftPath.LoadSynchronous();
 }
 
-static UAnimationAsset* LoadAnimationFallbackWithAnimSuffix(const TSoftObjectPtr<UAnimationAsset>& SoftPath)
+/** If the given path points to a non-animation (e.g. SkeletalMesh), try the same path with _Anim suffix (e.g. AM_X.AM_X -> AM_X_Anim.AM_X_Anim). */
+static UAnimationAsset* LoadAnimationFallbackWithAnimSuffix(const TSoftObjectPtr<UAnimationAsset>& SoftPath, bool bAllowSyncLoad)
 {
 	FString PathStr = SoftPath.ToString();
 	if (PathStr.IsEmpty() || PathStr.Contains(TEXT("_Anim."))) return nullptr;
@@ -528,11 +603,11 @@ static UAnimationAsset* LoadAnimationFallbackWithAnimSuffix(const TSoftObjectPtr
 	FString Base = PathStr.Left(DotIdx);
 	FString ObjName = PathStr.Mid(DotIdx + 1);
 	FString NewPath = Base + TEXT("_Anim.") + ObjName + TEXT("_Anim");
-	return TryLoadSoftObjectIfPackageExists(TSoftObjectPtr<UAnimationAsset>(FSoftObjectPath(NewPath)));
+	return TryLoadSoftObjectIfPackageExists(TSoftObjectPtr<UAnimationAsset>(FSoftObjectPath(NewPath)), bAllowSyncLoad);
 }
 
 /** If path is Package_Anim.Object_Anim and package doesn't exist, try Package.Object_Anim (FBX import creates package without _Anim). */
-static UAnimationAsset* LoadAnimationFallbackStripPackageAnimSuffix(const TSoftObjectPtr<UAnimationAsset>& SoftPath)
+static UAnimationAsset* LoadAnimationFallbackStripPackageAnimSuffix(const TSoftObjectPtr<UAnimationAsset>& SoftPath, bool bAllowSyncLoad)
 {
 	FString PathStr = SoftPath.ToString();
 	int32 DotIdx;
@@ -556,7 +631,7 @@ static UAnimationAsset* LoadAnimationFallbackStripPackageAnimSuffix(const TSoftO
 
 	for (const FString& CandidatePath : CandidatePaths)
 	{
-		if (UAnimationAsset* Animation = TryLoadSoftObjectIfPackageExists(TSoftObjectPtr<UAnimationAsset>(FSoftObjectPath(CandidatePath))))
+		if (UAnimationAsset* Animation = TryLoadSoftObjectIfPackageExists(TSoftObjectPtr<UAnimationAsset>(FSoftObjectPath(CandidatePath)), bAllowSyncLoad))
 		{
 			return Animation;
 		}
@@ -565,6 +640,21 @@ static UAnimationAsset* LoadAnimationFallbackStripPackageAnimSuffix(const TSoftO
 	return nullptr;
 }
 
+static UAnimationAsset* T66ResolveRowAnimation(const TSoftObjectPtr<UAnimationAsset>& SoftPath, bool bAllowSyncLoad)
+{
+	if (SoftPath.IsNull())
+	{
+		return nullptr;
+	}
+
+	UAnimationAsset* Animation = TryLoadSoftObjectIfPackageExists(SoftPath, bAllowSyncLoad);
+	if (!Animation)
+		Animation = LoadAnimationFallbackWithAnimSuffix(SoftPath, bAllowSyncLoad);
+	if (!Animation)
+		Animation = LoadAnimationFallbackStripPackageAnimSuffix(SoftPath, bAllowSyncLoad);
+	return Animation;
+}
+
 FName UT66CharacterVisualSubsystem::GetFallbackVisualID(FName VisualID)
 {
 	if (VisualID.IsNone())
@@ -593,20 +683,58 @@ void UT66CharacterVisualSubsystem::AppendCharacterVisualPreloadPaths(const FT66C
 	T66AppendCharacterVisualAssetPaths(Row, OutPaths);
 }
 
-UAnimationAsset* UT66CharacterVisualSubsystem::FindFallbackLoopingAnim(USkeleton* Skeleton) const
+void UT66CharacterVisualSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	if (!T66BuildCharacterPackageIndex())
+	{
+		IAssetRegistry& Registry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+		Registry.OnFilesLoaded().AddUObject(this, &UT66CharacterVisualSubsystem::HandleAssetRegistryFilesLoaded);
+	}
+}
+
+void UT66CharacterVisualSubsystem::Deinitialize()
+{
+	if (FAssetRegistryModule* AssetRegistryModule = FModuleManager::GetModulePtr<FAssetRegistryModule>("AssetRegistry"))
+	{
+		AssetRegistryModule->Get().OnFilesLoaded().RemoveAll(this);
+	}
+
+	for (TPair<FName, TSharedPtr<FStreamableHandle>>& Pair : PendingPreloadHandles)
+	{
+		if (Pair.Value.IsValid())
+		{
+			Pair.Value->CancelHandle();
+		}
+	}
+	PendingPreloadHandles.Reset();
+	PendingVisualApplies.Reset();
+
+	Super::Deinitialize();
+}
+
+void UT66CharacterVisualSubsystem::HandleAssetRegistryFilesLoaded()
+{
+	if (T66BuildCharacterPackageIndex())
+	{
+		FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get().OnFilesLoaded().RemoveAll(this);
+	}
+}
+
+FSoftObjectPath UT66CharacterVisualSubsystem::FindFallbackLoopingAnimPath(USkeleton* Skeleton) const
 {
 	if (!Skeleton)
 	{
-		return nullptr;
+		return FSoftObjectPath();
 	}
 
 	const FName SkelKey(*Skeleton->GetPathName());
-	if (const TObjectPtr<UAnimationAsset>* Cached = SkeletonAnimCache.Find(SkelKey))
+	if (const FSoftObjectPath* Cached = SkeletonAnimPathCache.Find(SkelKey))
 	{
-		return Cached ? Cached->Get() : nullptr;
+		return *Cached;
 	}
 
-	UAnimationAsset* Chosen = nullptr;
 	FAssetRegistryModule& ARM = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
 	IAssetRegistry& Registry = ARM.Get();
 
@@ -651,14 +779,25 @@ UAnimationAsset* UT66CharacterVisualSubsystem::FindFallbackLoopingAnim(USkeleton
 		}
 	}
 
-	if (BestScore >= 0)
+	const FSoftObjectPath ChosenPath = BestScore >= 0 ? BestAsset.GetSoftObjectPath() : FSoftObjectPath();
+	SkeletonAnimPathCache.Add(SkelKey, ChosenPath);
+	return ChosenPath;
+}
+
+UAnimationAsset* UT66CharacterVisualSubsystem::FindFallbackLoopingAnim(USkeleton* Skeleton, bool bAllowSyncLoad) const
+{
+	const FSoftObjectPath ChosenPath = FindFallbackLoopingAnimPath(Skeleton);
+	if (ChosenPath.IsNull())
+	{
+		return nullptr;
+	}
+
+	if (UAnimationAsset* Resident = Cast<UAnimationAsset>(ChosenPath.ResolveObject()))
 	{
-		UObject* Obj = BestAsset.GetAsset(); // loads
-		Chosen = Cast<UAnimationAsset>(Obj);
+		return Resident;
 	}
 
-	SkeletonAnimCache.Add(SkelKey, Chosen);
-	return Chosen;
+	return bAllowSyncLoad ? Cast<UAnimationAsset>(ChosenPath.TryLoad()) : nullptr;
 }
 
 UDataTable* UT66CharacterVisualSubsystem::GetVisualsDataTable() const
@@ -727,7 +866,7 @@ const FT66CharacterVisualRow* UT66CharacterVisualSubsystem::FindVisualRow(FName
 	return Row;
 }
 
-FT66ResolvedCharacterVisual UT66CharacterVisualSubsystem::ResolveVisual(FName VisualID)
+FT66ResolvedCharacterVisual UT66CharacterVisualSubsystem::ResolveVisual(FName VisualID, bool bAllowSyncLoad)
 {
 	if (VisualID.IsNone())
 	{
@@ -799,7 +938,7 @@ FT66ResolvedCharacterVisual UT66CharacterVisualSubsystem::ResolveVisual(FName Vi
 
 		if (!Res.Row.SkeletalMesh.IsNull())
 		{
-			Res.Mesh = TryLoadSoftObjectIfPackageExists(Res.Row.SkeletalMesh);
+			Res.Mesh = TryLoadSoftObjectIfPackageExists(Res.Row.SkeletalMesh, bAllowSyncLoad);
 			UE_LOG(LogT66CharacterVisuals, Log, TEXT("[MESH] ResolveVisual VisualID=%s ResolvedRow=%s SkeletalMesh path=%s Loaded=%s"),
 				*VisualID.ToString(), *ResolvedVisualID.ToString(), *Res.Row.SkeletalMesh.ToString(), Res.Mesh ? TEXT("YES") : TEXT("NO"));
 		}
@@ -807,21 +946,10 @@ FT66ResolvedCharacterVisual UT66CharacterVisualSubsystem::ResolveVisual(FName Vi
 		{
 			UE_LOG(LogT66CharacterVisuals, Warning, TEXT("[MESH] ResolveVisual VisualID=%s ResolvedRow=%s SkeletalMesh path is NULL in DataTable row!"), *VisualID.ToString(), *ResolvedVisualID.ToString());
 		}
-		if (!Res.Row.LoopingAnimation.IsNull())
-		{
-			Res.LoopingAnim = TryLoadSoftObjectIfPackageExists(Res.Row.LoopingAnimation);
-			if (!Res.LoopingAnim)
-				Res.LoopingAnim = LoadAnimationFallbackWithAnimSuffix(Res.Row.LoopingAnimation);
-			if (!Res.LoopingAnim)
-				Res.LoopingAnim = LoadAnimationFallbackStripPackageAnimSuffix(Res.Row.LoopingAnimation);
-		}
+		Res.LoopingAnim = T66ResolveRowAnimation(Res.Row.LoopingAnimation, bAllowSyncLoad);
 		if (!Res.Row.AlertAnimation.IsNull())
 		{
-			Res.AlertAnim = TryLoadSoftObjectIfPackageExists(Res.Row.AlertAnimation);
-			if (!Res.AlertAnim)
-				Res.AlertAnim = LoadAnimationFallbackWithAnimSuffix(Res.Row.AlertAnimation);
-			if (!Res.AlertAnim)
-				Res.AlertAnim = LoadAnimationFallbackStripPackageAnimSuffix(Res.Row.AlertAnimation);
+			Res.AlertAnim = T66ResolveRowAnimation(Res.Row.AlertAnimation, bAllowSyncLoad);
 			UE_LOG(LogT66CharacterVisuals, Log, TEXT("[ANIM] ResolveVisual VisualID=%s ResolvedRow=%s AlertAnimation path=%s AlertAnim=%s"),
 				*VisualID.ToString(), *ResolvedVisualID.ToString(), *Res.Row.AlertAnimation.ToString(), Res.AlertAnim ? *Res.AlertAnim->GetName() : TEXT("(null)"));
 		}
@@ -829,18 +957,11 @@ FT66ResolvedCharacterVisual UT66CharacterVisualSubsystem::ResolveVisual(FName Vi
 		{
 			UE_LOG(LogT66CharacterVisuals, Log, TEXT("[ANIM] ResolveVisual VisualID=%s ResolvedRow=%s AlertAnimation is null (no alert anim row)"), *VisualID.ToString(), *ResolvedVisualID.ToString());
 		}
-		if (!Res.Row.RunAnimation.IsNull())
-		{
-			Res.RunAnim = TryLoadSoftObjectIfPackageExists(Res.Row.RunAnimation);
-			if (!Res.RunAnim)
-				Res.RunAnim = LoadAnimationFallbackWithAnimSuffix(Res.Row.RunAnimation);
-			if (!Res.RunAnim)
-				Res.RunAnim = LoadAnimationFallbackStripPackageAnimSuffix(Res.Row.RunAnimation);
-		}
+		Res.RunAnim = T66ResolveRowAnimation(Res.Row.RunAnimation, bAllowSyncLoad);
 		// If no explicit animation is set, try to find any AnimSequence for this Skeleton (cached).
 		if (!Res.LoopingAnim && Res.Mesh && Res.Mesh->GetSkeleton())
 		{
-			Res.LoopingAnim = FindFallbackLoopingAnim(Res.Mesh->GetSkeleton());
+			Res.LoopingAnim = FindFallbackLoopingAnim(Res.Mesh->GetSkeleton(), bAllowSyncLoad);
 		}
 	}
 
@@ -884,29 +1005,18 @@ void UT66CharacterVisualSubsystem::PreloadCharacterVisual(FName VisualID)
 	PendingPaths.Reserve(4);
 	T66AppendCharacterVisualAssetPaths(*Row, PendingPaths);
 
-	bool bAllAssetsLoaded = true;
 	for (int32 Index = PendingPaths.Num() - 1; Index >= 0; --Index)
 	{
 		const FSoftObjectPath& AssetPath = PendingPaths[Index];
-		if (AssetPath.IsNull())
+		if (AssetPath.IsNull() || AssetPath.ResolveObject() || !T66IsCharacterPackageRegistered(AssetPath))
 		{
 			PendingPaths.RemoveAtSwap(Index, 1, EAllowShrinking::No);
-			continue;
-		}
-
-		if (AssetPath.ResolveObject())
-		{
-			PendingPaths.RemoveAtSwap(Index, 1, EAllowShrinking::No);
-		}
-		else
-		{
-			bAllAssetsLoaded = false;
 		}
 	}
 
-	if (bAllAssetsLoaded || PendingPaths.Num() <= 0)
+	if (PendingPaths.Num() <= 0)
 	{
-		ResolveVisual(VisualID);
+		HandleCharacterVisualPreloadCompleted(VisualID);
 		return;
 	}
 
@@ -915,13 +1025,21 @@ void UT66CharacterVisualSubsystem::PreloadCharacterVisual(FName VisualID)
 		FStreamableDelegate::CreateUObject(this, &UT66CharacterVisualSubsystem::HandleCharacterVisualPreloadCompleted, VisualID));
 	if (!Handle.IsValid())
 	{
-		ResolveVisual(VisualID);
+		HandleCharacterVisualPreloadCompleted(VisualID);
 		return;
 	}
 
 	PendingPreloadHandles.Add(VisualID, Handle);
 }
 
+void UT66CharacterVisualSubsystem::PreloadCharacterVisuals(TConstArrayView<FName> VisualIDs)
+{
+	for (const FName VisualID : VisualIDs)
+	{
+		PreloadCharacterVisual(VisualID);
+	}
+}
+
 bool UT66CharacterVisualSubsystem::IsCharacterVisualReady(FName VisualID) const
 {
 	if (VisualID.IsNone())
@@ -943,10 +1061,149 @@ bool UT66CharacterVisualSubsystem::IsCharacterVisualReady(FName VisualID) const
 	return FindVisualRow(VisualID, &ResolvedVisualID) == nullptr;
 }
 
+ET66CharacterVisualRequestState UT66CharacterVisualSubsystem::RequestCharacterVisual(
+	FName VisualID,
+	USkeletalMeshComponent* TargetMesh,
+	USceneComponent* PlaceholderToShow,
+	bool bEnableSingleNodeAnimation,
+	FT66OnCharacterVisualApplied OnApplied)
+{
+	if (VisualID.IsNone() || !TargetMesh)
+	{
+		OnApplied.ExecuteIfBound(false);
+		return ET66CharacterVisualRequestState::Unavailable;
+	}
+
+	// A newer request for the same component (pooled actors re-rolling their mob ID) supersedes the old one.
+	CancelCharacterVisualRequest(TargetMesh);
+
+	if (!ResolvedCache.Contains(VisualID))
+	{
+		if (!FindVisualRow(VisualID))
+		{
+			OnApplied.ExecuteIfBound(false);
+			return ET66CharacterVisualRequestState::Unavailable;
+		}
+
+		PreloadCharacterVisual(VisualID);
+	}
+
+	if (ResolvedCache.Contains(VisualID))
+	{
+		const bool bApplied = ApplyCharacterVisual(VisualID, TargetMesh, PlaceholderToShow, bEnableSingleNodeAnimation);
+		OnApplied.ExecuteIfBound(bApplied);
+		return bApplied ? ET66CharacterVisualRequestState::Applied : ET66CharacterVisualRequestState::Unavailable;
+	}
+
+	// Keep the placeholder up until the streamed assets are resident, then swap in place.
+	TargetMesh->SetHiddenInGame(true, true);
+	TargetMesh->SetVisibility(false, true);
+	if (PlaceholderToShow)
+	{
+		PlaceholderToShow->SetHiddenInGame(false, true);
+		PlaceholderToShow->SetVisibility(true, true);
+	}
+
+	FPendingCharacterVisualApply& Pending = PendingVisualApplies.AddDefaulted_GetRef();
+	Pending.VisualID = VisualID;
+	Pending.TargetMesh = TargetMesh;
+	Pending.Placeholder = PlaceholderToShow;
+	Pending.bEnableSingleNodeAnimation = bEnableSingleNodeAnimation;
+	Pending.OnApplied = MoveTemp(OnApplied);
+	return ET66CharacterVisualRequestState::Pending;
+}
+
+void UT66CharacterVisualSubsystem::CancelCharacterVisualRequest(USkeletalMeshComponent* TargetMesh)
+{
+	PendingVisualApplies.RemoveAllSwap([TargetMesh](const FPendingCharacterVisualApply& Pending)
+	{
+		return !Pending.TargetMesh.IsValid() || Pending.TargetMesh.Get() == TargetMesh;
+	}, EAllowShrinking::No);
+}
+
+bool UT66CharacterVisualSubsystem::QueueFallbackLoopingAnimLoad(FName VisualID)
+{
+	if (FallbackAnimLoadVisualIDs.Contains(VisualID))
+	{
+		return false;
+	}
+
+	const FT66CharacterVisualRow* Row = FindVisualRow(VisualID);
+	USkeletalMesh* Mesh = Row ? Row->SkeletalMesh.Get() : nullptr;
+	if (!Mesh || !Mesh->GetSkeleton() || T66ResolveRowAnimation(Row->LoopingAnimation, false))
+	{
+		return false;
+	}
+
+	const FSoftObjectPath FallbackPath = FindFallbackLoopingAnimPath(Mesh->GetSkeleton());
+	if (FallbackPath.IsNull() || FallbackPath.ResolveObject())
+	{
+		return false;
+	}
+
+	FallbackAnimLoadVisualIDs.Add(VisualID);
+	TSharedPtr<FStreamableHandle> Handle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+		FallbackPath,
+		FStreamableDelegate::CreateUObject(this, &UT66CharacterVisualSubsystem::HandleCharacterVisualPreloadCompleted, VisualID));
+	if (!Handle.IsValid())
+	{
+		return false;
+	}
+
+	PendingPreloadHandles.Add(VisualID, Handle);
+	return true;
+}
+
 void UT66CharacterVisualSubsystem::HandleCharacterVisualPreloadCompleted(FName VisualID)
 {
 	PendingPreloadHandles.Remove(VisualID);
-	ResolveVisual(VisualID);
+
+	// Rows without an explicit looping animation borrow one from the mesh skeleton; that pick is
+	// only known once the mesh is resident, so it streams as a second phase.
+	if (QueueFallbackLoopingAnimLoad(VisualID))
+	{
+		return;
+	}
+
+	FallbackAnimLoadVisualIDs.Remove(VisualID);
+	ResolveVisual(VisualID, false);
+	FlushPendingVisualApplies(VisualID);
+}
+
+void UT66CharacterVisualSubsystem::FlushPendingVisualApplies(FName VisualID)
+{
+	TArray<FPendingCharacterVisualApply> ReadyApplies;
+	for (int32 Index = 0; Index < PendingVisualApplies.Num();)
+	{
+		if (PendingVisualApplies[Index].VisualID == VisualID)
+		{
+			ReadyApplies.Add(MoveTemp(PendingVisualApplies[Index]));
+			PendingVisualApplies.RemoveAt(Index, 1, EAllowShrinking::No);
+		}
+		else
+		{
+			++Index;
+		}
+	}
+
+	UGameInstance* GI = GetGameInstance();
+	UT66RetroFXSubsystem* RetroFX = GI ? GI->GetSubsystem<UT66RetroFXSubsystem>() : nullptr;
+	for (FPendingCharacterVisualApply& Pending : ReadyApplies)
+	{
+		USkeletalMeshComponent* TargetMesh = Pending.TargetMesh.Get();
+		if (!TargetMesh)
+		{
+			continue;
+		}
+
+		const bool bApplied = ApplyCharacterVisual(VisualID, TargetMesh, Pending.Placeholder.Get(), Pending.bEnableSingleNodeAnimation);
+		if (bApplied && RetroFX)
+		{
+			// The spawn-time retro geometry pass ran before these materials existed.
+			RetroFX->RefreshMeshComponentGeometry(TargetMesh);
+		}
+		Pending.OnApplied.ExecuteIfBound(bApplied);
+	}
 }
 
 FName UT66CharacterVisualSubsystem::GetHeroVisualID(FName HeroID, ET66BodyType BodyType, FName SkinID)
@@ -15,6 +15,20 @@ class USceneComponent;
 class USkeleton;
 struct FStreamableHandle;
 
+/** Fired once a placeholder-then-swap request settles; bApplied is false if the visual could not be shown. */
+DECLARE_DELEGATE_OneParam(FT66OnCharacterVisualApplied, bool /*bApplied*/);
+
+UENUM()
+enum class ET66CharacterVisualRequestState : uint8
+{
+	/** Visual was resident and has been applied. */
+	Applied,
+	/** Assets are streaming; the placeholder stays up and the mesh swaps in on completion. */
+	Pending,
+	/** No mapping or no usable mesh; the placeholder stays up. */
+	Unavailable,
+};
+
 USTRUCT()
 struct FT66ResolvedCharacterVisual
 {
@@ -47,6 +61,8 @@ struct FT66ResolvedCharacterVisual
  * Goals:
  * - data-driven mapping: ID -> skeletal mesh + optional looping animation + per-character transform
  * - avoid repeated sync loads: load once per ID and cache
+ * - gameplay spawns use RequestCharacterVisual, which never blocks: the placeholder stays visible
+ *   until the streamed assets are resident, then the skeletal mesh is swapped in
  */
 UCLASS()
 class T66_API UT66CharacterVisualSubsystem : public UGameInstanceSubsystem
@@ -54,6 +70,9 @@ class T66_API UT66CharacterVisualSubsystem : public UGameInstanceSubsystem
 	GENERATED_BODY()
 
 public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
 	/** Apply visual mapping to a SkeletalMeshComponent. Returns true if a mapping existed and was applied. */
 	UFUNCTION(BlueprintCallable, Category = "T66|Visuals")
 	bool ApplyCharacterVisual(
@@ -82,6 +101,24 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "T66|Visuals")
 	void PreloadCharacterVisual(FName VisualID);
 
+	/** Batch variant used by loading screens to stream every visual the upcoming stage needs. */
+	void PreloadCharacterVisuals(TConstArrayView<FName> VisualIDs);
+
+	/**
+	 * Non-blocking apply. If the visual is resident it is applied immediately; otherwise the placeholder is
+	 * shown, the assets are streamed, and the mesh is swapped in once they land. OnApplied fires exactly once,
+	 * unless the request is cancelled or superseded by a newer request for the same TargetMesh.
+	 */
+	ET66CharacterVisualRequestState RequestCharacterVisual(
+		FName VisualID,
+		USkeletalMeshComponent* TargetMesh,
+		USceneComponent* PlaceholderToShow,
+		bool bEnableSingleNodeAnimation,
+		FT66OnCharacterVisualApplied OnApplied);
+
+	/** Drop any pending swap targeting this component. */
+	void CancelCharacterVisualRequest(USkeletalMeshComponent* TargetMesh);
+
 	/** Returns true when a visual no longer has pending preload work for the given ID. */
 	UFUNCTION(BlueprintCallable, Category = "T66|Visuals")
 	bool IsCharacterVisualReady(FName VisualID) const;
@@ -91,11 +128,25 @@ public:
 	void GetMovementAnimsForVisual(FName VisualID, UAnimationAsset*& OutWalk, UAnimationAsset*& OutRun, UAnimationAsset*& OutAlert);
 
 private:
-	FT66ResolvedCharacterVisual ResolveVisual(FName VisualID);
+	struct FPendingCharacterVisualApply
+	{
+		FName VisualID;
+		TWeakObjectPtr<USkeletalMeshComponent> TargetMesh;
+		TWeakObjectPtr<USceneComponent> Placeholder;
+		bool bEnableSingleNodeAnimation = true;
+		FT66OnCharacterVisualApplied OnApplied;
+	};
+
+	/** bAllowSyncLoad=false resolves from resident assets only (used once async preloads complete). */
+	FT66ResolvedCharacterVisual ResolveVisual(FName VisualID, bool bAllowSyncLoad = true);
 	UDataTable* GetVisualsDataTable() const;
-	UAnimationAsset* FindFallbackLoopingAnim(USkeleton* Skeleton) const;
+	FSoftObjectPath FindFallbackLoopingAnimPath(USkeleton* Skeleton) const;
+	UAnimationAsset* FindFallbackLoopingAnim(USkeleton* Skeleton, bool bAllowSyncLoad) const;
 	const FT66CharacterVisualRow* FindVisualRow(FName VisualID, FName* OutResolvedVisualID = nullptr) const;
+	bool QueueFallbackLoopingAnimLoad(FName VisualID);
 	void HandleCharacterVisualPreloadCompleted(FName VisualID);
+	void FlushPendingVisualApplies(FName VisualID);
+	void HandleAssetRegistryFilesLoaded();
 
 	UPROPERTY(Transient)
 	mutable TObjectPtr<UDataTable> CachedVisualsDataTable;
@@ -105,8 +156,13 @@ private:
 
 	TMap<FName, TSharedPtr<FStreamableHandle>> PendingPreloadHandles;
 
-	/** Cache: Skeleton asset path -> chosen looping animation */
-	UPROPERTY(Transient)
-	mutable TMap<FName, TObjectPtr<UAnimationAsset>> SkeletonAnimCache;
+	/** Placeholder-then-swap requests waiting on PendingPreloadHandles. */
+	TArray<FPendingCharacterVisualApply> PendingVisualApplies;
+
+	/** Visual IDs whose skeleton fallback animation is streaming as a second preload phase. */
+	TSet<FName> FallbackAnimLoadVisualIDs;
+
+	/** Cache: Skeleton asset path -> chosen looping animation path (registry lookup only, no loads) */
+	mutable TMap<FName, FSoftObjectPath> SkeletonAnimPathCache;
 };
 
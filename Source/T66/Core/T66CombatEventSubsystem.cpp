@@ -0,0 +1,307 @@
+// Copyright Tribulation 66. All Rights Reserved.
+
+#include "Core/T66CombatEventSubsystem.h"
+#include "Core/T66AchievementsSubsystem.h"
+#include "Core/T66AudioSubsystem.h"
+#include "Core/T66DamageLogSubsystem.h"
+#include "Core/T66FloatingCombatTextSubsystem.h"
+#include "Core/T66LagTrackerSubsystem.h"
+#include "Core/T66RunStateSubsystem.h"
+#include "Gameplay/T66CombatComponent.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<int32> CVarT66CombatEventQueue(
+	TEXT("T66.Combat.EventQueue"),
+	1,
+	TEXT("1 = batch enemy hit/kill side effects once per frame, 0 = apply them as each hit lands"),
+	ECVF_Default);
+
+namespace
+{
+	constexpr int32 T66EnemyFamilyCount = static_cast<int32>(ET66EnemyFamily::Special) + 1;
+
+	/** Family-specific audio rows, built once instead of formatting a name on every hit. */
+	struct FT66EnemyFamilyAudioIDs
+	{
+		FName Hit[T66EnemyFamilyCount];
+		FName Death[T66EnemyFamilyCount];
+		FName HitFallback = FName(TEXT("Combat.Hit.Enemy"));
+		FName DeathFallback = FName(TEXT("Combat.Enemy.Death"));
+
+		FT66EnemyFamilyAudioIDs()
+		{
+			static const TCHAR* Suffixes[T66EnemyFamilyCount] = { TEXT("Melee"), TEXT("Flying"), TEXT("Ranged"), TEXT("Rush"), TEXT("Special") };
+			for (int32 Index = 0; Index < T66EnemyFamilyCount; ++Index)
+			{
+				Hit[Index] = FName(*FString::Printf(TEXT("Combat.Hit.Enemy.%s"), Suffixes[Index]));
+				Death[Index] = FName(*FString::Printf(TEXT("Combat.Enemy.Death.%s"), Suffixes[Index]));
+			}
+		}
+	};
+
+	const FT66EnemyFamilyAudioIDs& T66GetEnemyFamilyAudioIDs()
+	{
+		static const FT66EnemyFamilyAudioIDs IDs;
+		return IDs;
+	}
+
+	void T66PlayEnemyFamilyVoice(UT66AudioSubsystem* Audio, UWorld* World, const FName FamilyEventID, const FName FallbackEventID, const FT66CombatHitEvent& Hit)
+	{
+		AActor* Owner = Hit.Target.Get();
+		if (!Audio->PlayEvent(FamilyEventID, World, Hit.Location, Owner))
+		{
+			Audio->PlayEvent(FallbackEventID, World, Hit.Location, Owner);
+		}
+	}
+}
+
+void UT66CombatEventSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+	FrameTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+		FTickerDelegate::CreateUObject(this, &UT66CombatEventSubsystem::TickFrame));
+}
+
+void UT66CombatEventSubsystem::Deinitialize()
+{
+	if (FrameTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(FrameTickerHandle);
+		FrameTickerHandle.Reset();
+	}
+
+	// Kills from the last frame before travel still count toward the run.
+	Flush(false);
+	Super::Deinitialize();
+}
+
+bool UT66CombatEventSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UT66CombatEventSubsystem::PushHit(const FT66CombatHitEvent& Hit)
+{
+	PendingHits.Add(Hit);
+	if (CVarT66CombatEventQueue.GetValueOnGameThread() == 0)
+	{
+		Flush();
+	}
+}
+
+void UT66CombatEventSubsystem::PushKill(const FT66CombatKillEvent& Kill)
+{
+	PendingKills.Add(Kill);
+	if (CVarT66CombatEventQueue.GetValueOnGameThread() == 0)
+	{
+		Flush();
+	}
+}
+
+bool UT66CombatEventSubsystem::TickFrame(float DeltaSeconds)
+{
+	(void)DeltaSeconds;
+	Flush();
+	return true;
+}
+
+void UT66CombatEventSubsystem::Flush(const bool bIncludePresentation)
+{
+	if (bDraining || (PendingHits.Num() == 0 && PendingKills.Num() == 0))
+	{
+		return;
+	}
+
+	UWorld* World = GetWorld();
+	UGameInstance* GI = World ? World->GetGameInstance() : nullptr;
+	FLagScopedScope LagScope(World, TEXT("CombatEvents::Flush"));
+
+	TGuardValue<bool> DrainGuard(bDraining, true);
+	Swap(PendingHits, DrainingHits);
+	Swap(PendingKills, DrainingKills);
+
+	if (GI)
+	{
+		DrainHits(World, GI, bIncludePresentation);
+		DrainKills(GI);
+	}
+
+	DrainingHits.Reset();
+	DrainingKills.Reset();
+}
+
+void UT66CombatEventSubsystem::DrainHits(UWorld* World, UGameInstance* GI, const bool bIncludePresentation)
+{
+	if (DrainingHits.Num() == 0)
+	{
+		return;
+	}
+
+	DamageBySourceScratch.Reset();
+	DamageNumberScratch.Reset();
+	DamageNumberIndexScratch.Reset();
+
+	int32 FirstHitByFamily[T66EnemyFamilyCount];
+	int32 FirstDeathByFamily[T66EnemyFamilyCount];
+	for (int32 Index = 0; Index < T66EnemyFamilyCount; ++Index)
+	{
+		FirstHitByFamily[Index] = INDEX_NONE;
+		FirstDeathByFamily[Index] = INDEX_NONE;
+	}
+
+	int32 HeroKillCount = 0;
+	for (int32 HitIndex = 0; HitIndex < DrainingHits.Num(); ++HitIndex)
+	{
+		const FT66CombatHitEvent& Hit = DrainingHits[HitIndex];
+		if (!Hit.DamageSourceID.IsNone())
+		{
+			TPair<FName, int32>* SourceTotal = DamageBySourceScratch.FindByPredicate([&Hit](const TPair<FName, int32>& Entry) { return Entry.Key == Hit.DamageSourceID; });
+			if (!SourceTotal)
+			{
+				SourceTotal = &DamageBySourceScratch.Emplace_GetRef(Hit.DamageSourceID, 0);
+			}
+			SourceTotal->Value = FMath::Clamp(SourceTotal->Value + Hit.Damage, 0, 2000000000);
+
+			if (Hit.bKilled)
+			{
+				++HeroKillCount;
+			}
+		}
+
+		if (!bIncludePresentation)
+		{
+			continue;
+		}
+
+		const TPair<const AActor*, FName> NumberKey(Hit.Target.Get(), Hit.EventType);
+		if (const int32* BatchIndex = DamageNumberIndexScratch.Find(NumberKey))
+		{
+			FDamageNumberBatch& Batch = DamageNumberScratch[*BatchIndex];
+			Batch.Location = Hit.Location;
+			Batch.Amount = FMath::Clamp(Batch.Amount + Hit.Damage, 0, 2000000000);
+			++Batch.HitCount;
+		}
+		else if (NumberKey.Key)
+		{
+			DamageNumberIndexScratch.Add(NumberKey, DamageNumberScratch.Num());
+			FDamageNumberBatch& Batch = DamageNumberScratch.AddDefaulted_GetRef();
+			Batch.Target = Hit.Target;
+			Batch.Location = Hit.Location;
+			Batch.EventType = Hit.EventType;
+			Batch.Amount = Hit.Damage;
+			Batch.HitCount = 1;
+		}
+
+		const int32 FamilyIndex = FMath::Clamp(static_cast<int32>(Hit.Family), 0, T66EnemyFamilyCount - 1);
+		int32& FirstVoice = Hit.bKilled ? FirstDeathByFamily[FamilyIndex] : FirstHitByFamily[FamilyIndex];
+		if (FirstVoice == INDEX_NONE)
+		{
+			FirstVoice = HitIndex;
+		}
+	}
+
+	if (UT66DamageLogSubsystem* DamageLog = GI->GetSubsystem<UT66DamageLogSubsystem>())
+	{
+		for (const TPair<FName, int32>& SourceTotal : DamageBySourceScratch)
+		{
+			DamageLog->RecordDamageDealt(SourceTotal.Key, SourceTotal.Value);
+		}
+	}
+
+	if (HeroKillCount > 0)
+	{
+		if (UT66RunStateSubsystem* RunState = GI->GetSubsystem<UT66RunStateSubsystem>())
+		{
+			RunState->NotifyEnemyKilledByHero(HeroKillCount);
+		}
+	}
+
+	if (!bIncludePresentation)
+	{
+		return;
+	}
+
+	if (UT66FloatingCombatTextSubsystem* FloatingText = GI->GetSubsystem<UT66FloatingCombatTextSubsystem>())
+	{
+		for (const FDamageNumberBatch& Batch : DamageNumberScratch)
+		{
+			FloatingText->ShowDamageNumberBatch(Batch.Target.Get(), Batch.Location, Batch.Amount, Batch.HitCount, Batch.EventType);
+		}
+	}
+
+	int32 DeathBurstCount = 0;
+	for (const FT66CombatHitEvent& Hit : DrainingHits)
+	{
+		if (!Hit.bKilled)
+		{
+			continue;
+		}
+		if (DeathBurstCount >= MaxDeathBurstsPerDrain)
+		{
+			break;
+		}
+		UT66CombatComponent::SpawnDeathBurstAtLocation(World, Hit.Location, 16, 60.f);
+		++DeathBurstCount;
+	}
+
+	if (UT66AudioSubsystem* Audio = GI->GetSubsystem<UT66AudioSubsystem>())
+	{
+		const FT66EnemyFamilyAudioIDs& AudioIDs = T66GetEnemyFamilyAudioIDs();
+		for (int32 FamilyIndex = 0; FamilyIndex < T66EnemyFamilyCount; ++FamilyIndex)
+		{
+			if (FirstDeathByFamily[FamilyIndex] != INDEX_NONE)
+			{
+				T66PlayEnemyFamilyVoice(Audio, World, AudioIDs.Death[FamilyIndex], AudioIDs.DeathFallback, DrainingHits[FirstDeathByFamily[FamilyIndex]]);
+			}
+			if (FirstHitByFamily[FamilyIndex] != INDEX_NONE)
+			{
+				T66PlayEnemyFamilyVoice(Audio, World, AudioIDs.Hit[FamilyIndex], AudioIDs.HitFallback, DrainingHits[FirstHitByFamily[FamilyIndex]]);
+			}
+		}
+	}
+}
+
+void UT66CombatEventSubsystem::DrainKills(UGameInstance* GI)
+{
+	if (DrainingKills.Num() == 0)
+	{
+		return;
+	}
+
+	if (UT66RunStateSubsystem* RunState = GI->GetSubsystem<UT66RunStateSubsystem>())
+	{
+		int32 TotalScore = 0;
+		int32 TotalXP = 0;
+		for (const FT66CombatKillEvent& Kill : DrainingKills)
+		{
+			TotalScore = FMath::Clamp(TotalScore + FMath::Max(0, Kill.ScorePoints), 0, MAX_int32 / 2);
+			TotalXP = FMath::Clamp(TotalXP + FMath::Max(0, Kill.XP), 0, MAX_int32 / 2);
+		}
+		RunState->AddEnemyKillScore(TotalScore);
+		RunState->AddHeroXP(TotalXP);
+
+		// One run-log line per drain, so a mass kill does not format a line per enemy.
+		RunState->AddStructuredEvent(ET66RunEventType::EnemyKilled, FString::Printf(TEXT("Count=%d,Score=%d,XP=%d"), DrainingKills.Num(), TotalScore, TotalXP));
+	}
+
+	if (UT66AchievementsSubsystem* Achievements = GI->GetSubsystem<UT66AchievementsSubsystem>())
+	{
+		Achievements->NotifyEnemyKilled(DrainingKills.Num());
+
+		// Lab unlock: mark each enemy type killed this frame as unlocked for The Lab.
+		LabUnlockScratch.Reset();
+		for (const FT66CombatKillEvent& Kill : DrainingKills)
+		{
+			if (!Kill.CharacterVisualID.IsNone())
+			{
+				LabUnlockScratch.AddUnique(Kill.CharacterVisualID);
+			}
+		}
+		for (const FName EnemyID : LabUnlockScratch)
+		{
+			Achievements->AddLabUnlockedEnemy(EnemyID);
+		}
+	}
+}
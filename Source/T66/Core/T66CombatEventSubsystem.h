@@ -0,0 +1,99 @@
+// Copyright Tribulation 66. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Gameplay/Enemies/T66EnemyFamilyTypes.h"
+#include "T66CombatEventSubsystem.generated.h"
+
+class AActor;
+class UGameInstance;
+class FSubsystemCollectionBase;
+
+/** One resolved hit on an enemy. Location is taken at the hit so it survives the enemy being pooled. */
+struct FT66CombatHitEvent
+{
+	TWeakObjectPtr<AActor> Target;
+	FVector Location = FVector::ZeroVector;
+	FName EventType = NAME_None;
+	/** Damage-log source; None when the hit is not credited to the hero. */
+	FName DamageSourceID = NAME_None;
+	int32 Damage = 0;
+	ET66EnemyFamily Family = ET66EnemyFamily::Melee;
+	bool bKilled = false;
+};
+
+/** Run progression owed for one enemy death. */
+struct FT66CombatKillEvent
+{
+	FName CharacterVisualID = NAME_None;
+	int32 ScorePoints = 0;
+	int32 XP = 0;
+};
+
+/**
+ * Frame-local queue for the side effects of enemy hits and kills.
+ *
+ * Enemies apply HP, loot and pooling immediately and push compact records here. The queue drains
+ * once per frame: damage is summed per log source, damage numbers per target and event type, one
+ * hit and one death voice play per enemy family, and run counters and achievements update once,
+ * so an AoE that hits dozens of enemies resolves each consumer a single time.
+ *
+ * Console: T66.Combat.EventQueue 0 drains every push immediately.
+ */
+UCLASS()
+class T66_API UT66CombatEventSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	void PushHit(const FT66CombatHitEvent& Hit);
+	void PushKill(const FT66CombatKillEvent& Kill);
+
+	/** Applies everything queued so far. Presentation is skipped when the world is going away. */
+	void Flush(bool bIncludePresentation = true);
+
+	int32 GetPendingHitCount() const { return PendingHits.Num(); }
+	int32 GetPendingKillCount() const { return PendingKills.Num(); }
+
+	/** At most this many death bursts spawn per drain; the rest of a mass kill shares them. */
+	static constexpr int32 MaxDeathBurstsPerDrain = 12;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	struct FDamageNumberBatch
+	{
+		TWeakObjectPtr<AActor> Target;
+		FVector Location = FVector::ZeroVector;
+		FName EventType = NAME_None;
+		int32 Amount = 0;
+		int32 HitCount = 0;
+	};
+
+	bool TickFrame(float DeltaSeconds);
+	void DrainHits(UWorld* World, UGameInstance* GI, bool bIncludePresentation);
+	void DrainKills(UGameInstance* GI);
+
+	TArray<FT66CombatHitEvent> PendingHits;
+	TArray<FT66CombatKillEvent> PendingKills;
+
+	/** Swapped with the pending arrays on drain so pushes made by consumers land in the next frame. */
+	TArray<FT66CombatHitEvent> DrainingHits;
+	TArray<FT66CombatKillEvent> DrainingKills;
+
+	/** Per-drain scratch, kept to avoid reallocating every frame. */
+	TArray<TPair<FName, int32>> DamageBySourceScratch;
+	TArray<FDamageNumberBatch> DamageNumberScratch;
+	TMap<TPair<const AActor*, FName>, int32> DamageNumberIndexScratch;
+	TArray<FName> LabUnlockScratch;
+
+	FTSTicker::FDelegateHandle FrameTickerHandle;
+	bool bDraining = false;
+};
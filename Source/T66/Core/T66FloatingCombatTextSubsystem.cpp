@@ -1,8 +1,6 @@
 // Copyright Tribulation 66. All Rights Reserved.
 
 #include "Core/T66FloatingCombatTextSubsystem.h"
-#include "Core/T66FloatingCombatTextPoolSubsystem.h"
-#include "Gameplay/T66FloatingCombatTextActor.h"
 #include "Engine/World.h"
 #include "GameFramework/Actor.h"
 
@@ -27,46 +25,111 @@ const FName UT66FloatingCombatTextSubsystem::EventType_DamageTaken(TEXT("DamageT
 
 void UT66FloatingCombatTextSubsystem::ShowDamageNumber(AActor* Target, int32 Amount, FName EventType)
 {
-	if (!Target || Amount <= 0) return;
+	if (!Target) return;
+	PushDamageNumber(Target, Target->GetActorLocation(), Amount, 1, EventType);
+}
 
-	UWorld* World = GetWorld();
-	if (!World) return;
+void UT66FloatingCombatTextSubsystem::ShowDamageNumberBatch(AActor* Target, const FVector& AnchorLocation, int32 Amount, int32 HitCount, FName EventType)
+{
+	PushDamageNumber(Target, AnchorLocation, Amount, FMath::Max(1, HitCount), EventType);
+}
 
-	UT66FloatingCombatTextPoolSubsystem* Pool = World->GetSubsystem<UT66FloatingCombatTextPoolSubsystem>();
-	if (!Pool) return;
+void UT66FloatingCombatTextSubsystem::ShowDamageTaken(AActor* Target, int32 Amount)
+{
+	if (!Target) return;
+	PushDamageNumber(Target, Target->GetActorLocation(), Amount, 1, EventType_DamageTaken);
+}
 
-	++DamageNumberSequence;
-	const float Side = (((GetTypeHash(Target) + DamageNumberSequence) & 1u) == 0u) ? DamageNumberOffsetSide : -DamageNumberOffsetSide;
-	AT66FloatingCombatTextActor* Actor = Pool->AcquireActor(Target, FVector(Side, 0.f, OffsetAboveHead), TextLifetimeSeconds);
-	if (Actor)
-	{
-		Actor->SetDamageNumber(Amount, EventType);
-	}
+void UT66FloatingCombatTextSubsystem::ShowStatusEvent(AActor* Target, FName EventType)
+{
+	// Per current UX direction, only numeric damage text should be visible.
+	// Keep callers intact, but suppress standalone status-word popups globally.
+	(void)Target;
+	(void)EventType;
 }
 
-void UT66FloatingCombatTextSubsystem::ShowDamageTaken(AActor* Target, int32 Amount)
+bool UT66FloatingCombatTextSubsystem::IsEntryLive(const FT66FloatingCombatTextEntry& Entry, const UWorld* World, const double NowSeconds) const
+{
+	return Entry.bActive
+		&& World
+		&& EntriesWorld.Get() == World
+		&& (NowSeconds - Entry.LastHitTimeSeconds) <= TextLifetimeSeconds;
+}
+
+void UT66FloatingCombatTextSubsystem::PushDamageNumber(AActor* Target, const FVector& AnchorLocation, int32 Amount, int32 HitCount, FName EventType)
 {
 	if (!Target || Amount <= 0) return;
 
 	UWorld* World = GetWorld();
 	if (!World) return;
 
-	UT66FloatingCombatTextPoolSubsystem* Pool = World->GetSubsystem<UT66FloatingCombatTextPoolSubsystem>();
-	if (!Pool) return;
+	if (EntriesWorld.Get() != World || Entries.Num() != MaxEntries)
+	{
+		Entries.Reset();
+		Entries.SetNum(MaxEntries);
+		EntriesWorld = World;
+		NextEntryIndex = 0;
+	}
 
-	++DamageNumberSequence;
-	const float Side = (((GetTypeHash(Target) + DamageNumberSequence) & 1u) == 0u) ? DamageNumberOffsetSide : -DamageNumberOffsetSide;
-	AT66FloatingCombatTextActor* Actor = Pool->AcquireActor(Target, FVector(Side, 0.f, OffsetAboveHead), TextLifetimeSeconds);
-	if (Actor)
+	const double NowSeconds = World->GetTimeSeconds();
+	for (FT66FloatingCombatTextEntry& Entry : Entries)
 	{
-		Actor->SetDamageNumber(Amount, EventType_DamageTaken);
+		if (Entry.bActive
+			&& Entry.EventType == EventType
+			&& Entry.Target.Get() == Target
+			&& (NowSeconds - Entry.LastHitTimeSeconds) <= MergeWindowSeconds
+			&& (NowSeconds - Entry.FirstHitTimeSeconds) <= MaxMergeSpanSeconds)
+		{
+			Entry.Amount += Amount;
+			Entry.HitCount += HitCount;
+			Entry.DisplayText = FText::AsNumber(Entry.Amount).ToString();
+			Entry.LastAnchorLocation = AnchorLocation;
+			Entry.LastHitTimeSeconds = NowSeconds;
+			return;
+		}
 	}
+
+	// Once saturated the ring overwrites the least recently created number.
+	FT66FloatingCombatTextEntry& Entry = Entries[NextEntryIndex];
+	NextEntryIndex = (NextEntryIndex + 1) % MaxEntries;
+
+	++DamageNumberSequence;
+	const float Side = (((GetTypeHash(Target) + DamageNumberSequence) & 1u) == 0u) ? DamageNumberOffsetSide : -DamageNumberOffsetSide;
+	Entry.Target = Target;
+	Entry.LastAnchorLocation = AnchorLocation;
+	Entry.Offset = FVector(Side, 0.f, OffsetAboveHead);
+	Entry.EventType = EventType;
+	Entry.Amount = Amount;
+	Entry.HitCount = HitCount;
+	Entry.DisplayText = FText::AsNumber(Amount).ToString();
+	Entry.FirstHitTimeSeconds = NowSeconds;
+	Entry.LastHitTimeSeconds = NowSeconds;
+	Entry.bActive = true;
+	ResolveDamageNumberStyle(EventType, Entry.FontSize, Entry.Color);
 }
 
-void UT66FloatingCombatTextSubsystem::ShowStatusEvent(AActor* Target, FName EventType)
+void UT66FloatingCombatTextSubsystem::ResolveDamageNumberStyle(FName EventType, int32& OutFontSize, FLinearColor& OutColor)
 {
-	// Per current UX direction, only numeric damage text should be visible.
-	// Keep callers intact, but suppress standalone status-word popups globally.
-	(void)Target;
-	(void)EventType;
+	OutFontSize = 18;
+	OutColor = FLinearColor(1.f, 0.95f, 0.7f, 1.f); // default: light yellow
+
+	if (EventType == EventType_Crit)
+	{
+		OutFontSize = 24;
+		OutColor = FLinearColor(1.f, 0.4f, 0.2f, 1.f); // orange-red for crit
+	}
+	else if (EventType == EventType_Headshot)
+	{
+		OutFontSize = 22;
+		OutColor = FLinearColor(1.f, 0.7f, 0.25f, 1.f); // warm gold for headshot
+	}
+	else if (EventType == EventType_DoT)
+	{
+		OutFontSize = 16;
+		OutColor = FLinearColor(0.85f, 0.5f, 1.f, 1.f); // purple for DoT
+	}
+	else if (EventType == EventType_DamageTaken)
+	{
+		OutColor = FLinearColor(1.f, 0.2f, 0.2f, 1.f); // red for damage taken by hero
+	}
 }
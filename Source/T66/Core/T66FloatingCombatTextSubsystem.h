@@ -6,10 +6,32 @@
 #include "Subsystems/GameInstanceSubsystem.h"
 #include "T66FloatingCombatTextSubsystem.generated.h"
 
+class AActor;
+class UWorld;
+
+/** One rolling damage number; rapid hits on the same target and event type accumulate into Amount. */
+struct FT66FloatingCombatTextEntry
+{
+	TWeakObjectPtr<AActor> Target;
+	FVector LastAnchorLocation = FVector::ZeroVector;
+	FVector Offset = FVector::ZeroVector;
+	FName EventType = NAME_None;
+	FString DisplayText;
+	FLinearColor Color = FLinearColor::White;
+	int32 FontSize = 18;
+	int32 Amount = 0;
+	int32 HitCount = 0;
+	double FirstHitTimeSeconds = 0.0;
+	double LastHitTimeSeconds = 0.0;
+	bool bActive = false;
+};
+
 /**
  * Displays floating combat text: damage numbers on the sides of enemies and
  * status/event labels (Crit, DoT, etc.) above the head with different fonts.
  * One subsystem for both; call from TakeDamageFromHero / TakeDamageFromHeroHit.
+ * Numbers live in a fixed ring buffer and are painted by the gameplay HUD's combat text layer,
+ * so there are no per-number actors, widgets or timers.
  */
 UCLASS()
 class T66_API UT66FloatingCombatTextSubsystem : public UGameInstanceSubsystem
@@ -47,6 +69,9 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "FloatingCombatText")
 	void ShowDamageNumber(AActor* Target, int32 Amount, FName EventType = NAME_None);
 
+	/** Several same-frame hits on one target, already summed. AnchorLocation is where the last of them landed. */
+	void ShowDamageNumberBatch(AActor* Target, const FVector& AnchorLocation, int32 Amount, int32 HitCount, FName EventType = NAME_None);
+
 	/** Show a damage-taken number at the target (red, same layout as damage dealt). Use when the hero takes damage. */
 	UFUNCTION(BlueprintCallable, Category = "FloatingCombatText")
 	void ShowDamageTaken(AActor* Target, int32 Amount);
@@ -55,13 +80,29 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "FloatingCombatText")
 	void ShowStatusEvent(AActor* Target, FName EventType);
 
+	/** Ring buffer read by the HUD each frame. Entries from another world or past their lifetime are stale. */
+	const TArray<FT66FloatingCombatTextEntry>& GetEntries() const { return Entries; }
+	bool IsEntryLive(const FT66FloatingCombatTextEntry& Entry, const UWorld* World, double NowSeconds) const;
+
+	/** Lifetime of each number after its most recent merged hit. */
+	static constexpr float TextLifetimeSeconds = 1.2f;
+
 private:
+	void PushDamageNumber(AActor* Target, const FVector& AnchorLocation, int32 Amount, int32 HitCount, FName EventType);
+	static void ResolveDamageNumberStyle(FName EventType, int32& OutFontSize, FLinearColor& OutColor);
+
 	/** Horizontal offset from target center for damage numbers (so they appear on the side). */
 	static constexpr float DamageNumberOffsetSide = 80.f;
 	/** Height above target for damage number and status label. */
 	static constexpr float OffsetAboveHead = 180.f;
-	/** Lifetime of each floating text actor (seconds) before it destroys itself. */
-	static constexpr float TextLifetimeSeconds = 1.2f;
+	/** Hits on the same target and event type this close together roll into one number. */
+	static constexpr float MergeWindowSeconds = 0.25f;
+	/** A rolling number stops absorbing hits after this long so sustained fire still reads as separate bursts. */
+	static constexpr float MaxMergeSpanSeconds = 0.75f;
+	static constexpr int32 MaxEntries = 96;
 
+	TArray<FT66FloatingCombatTextEntry> Entries;
+	TWeakObjectPtr<UWorld> EntriesWorld;
+	int32 NextEntryIndex = 0;
 	uint32 DamageNumberSequence = 0;
 };
@@ -3,11 +3,13 @@
 #include "Core/T66GameInstance.h"
 #include "Core/T66AchievementsSubsystem.h"
 #include "Core/T66CharacterVisualSubsystem.h"
+#include "Core/T66MusicSubsystem.h"
 #include "Core/T66PlayerSettingsSubsystem.h"
 #include "Core/T66RetroFXSubsystem.h"
 #include "Core/T66RngSubsystem.h"
 #include "Core/T66RunStateSubsystem.h"
 #include "Core/T66UITexturePoolSubsystem.h"
+#include "Gameplay/T66BossBase.h"
 #include "UI/T66LoadingScreenWidget.h"
 #include "UI/Style/T66Style.h"
 #include "Engine/DataTable.h"
@@ -1070,6 +1072,34 @@ bool UT66GameInstance::GetStageData(int32 StageNumber, FStageData& OutStageData)
 	return false;
 }
 
+void UT66GameInstance::GetStageMobIDs(int32 StageNumber, TArray<FName>& OutMobIDs)
+{
+	FName MobA = FName(*FString::Printf(TEXT("Mob_Stage%02d_A"), StageNumber));
+	FName MobB = FName(*FString::Printf(TEXT("Mob_Stage%02d_B"), StageNumber));
+	FName MobC = FName(*FString::Printf(TEXT("Mob_Stage%02d_C"), StageNumber));
+	FStageData StageData;
+	if (GetStageData(StageNumber, StageData))
+	{
+		if (!StageData.EnemyA.IsNone()) MobA = StageData.EnemyA;
+		if (!StageData.EnemyB.IsNone()) MobB = StageData.EnemyB;
+		if (!StageData.EnemyC.IsNone()) MobC = StageData.EnemyC;
+	}
+
+	OutMobIDs = { MobA, MobB, MobC };
+}
+
+void UT66GameInstance::GetStageCharacterVisualIDs(int32 StageNumber, TArray<FName>& OutVisualIDs)
+{
+	TArray<FName> MobIDs;
+	GetStageMobIDs(StageNumber, MobIDs);
+	for (const FName MobID : MobIDs)
+	{
+		OutVisualIDs.AddUnique(MobID);
+	}
+	OutVisualIDs.AddUnique(FName(TEXT("Boss")));
+	OutVisualIDs.AddUnique(AT66BossBase::StageBossCharacterVisualID);
+}
+
 bool UT66GameInstance::GetHouseNPCData(FName NPCID, FHouseNPCData& OutNPCData)
 {
 	if (NPCID.IsNone()) return false;
@@ -1394,6 +1424,14 @@ void UT66GameInstance::PreloadGameplayAssets(TFunction<void()> OnComplete)
 		}
 	}
 
+	// The run state already points at the stage being loaded.
+	UT66MusicSubsystem* Music = GetSubsystem<UT66MusicSubsystem>();
+	const UT66RunStateSubsystem* RunState = GetSubsystem<UT66RunStateSubsystem>();
+	if (Music && RunState)
+	{
+		Music->PrefetchUpcomingStageMusic(RunState->GetCurrentStage());
+	}
+
 	TArray<FSoftObjectPath> Paths;
 	Paths.Reserve(128);
 	GameplayPreloadVisualIDs.Reset();
@@ -1583,6 +1621,18 @@ void UT66GameInstance::PreloadGameplayAssets(TFunction<void()> OnComplete)
 
 	AddVisualAssets(UT66CharacterVisualSubsystem::GetCompanionVisualID(SelectedCompanionID, FName(TEXT("Default"))));
 
+	// Stream the upcoming stage's mob families and boss behind the loading screen so the first
+	// director spawns find their visuals resident instead of swapping in from placeholders.
+	if (const UT66RunStateSubsystem* RunState = GetSubsystem<UT66RunStateSubsystem>())
+	{
+		TArray<FName> StageVisualIDs;
+		GetStageCharacterVisualIDs(RunState->GetCurrentStage(), StageVisualIDs);
+		for (const FName StageVisualID : StageVisualIDs)
+		{
+			AddVisualAssets(StageVisualID);
+		}
+	}
+
 	if (Paths.Num() <= 0)
 	{
 		if (OnComplete) OnComplete();
@@ -1692,9 +1742,9 @@ void UT66GameInstance::HandleGameplayAssetsPreloaded()
 	bool bWaitingOnVisualResolves = false;
 	if (UT66CharacterVisualSubsystem* Visuals = GetSubsystem<UT66CharacterVisualSubsystem>())
 	{
+		Visuals->PreloadCharacterVisuals(GameplayPreloadVisualIDs);
 		for (const FName VisualID : GameplayPreloadVisualIDs)
 		{
-			Visuals->PreloadCharacterVisual(VisualID);
 			if (!Visuals->IsCharacterVisualReady(VisualID))
 			{
 				bWaitingOnVisualResolves = true;
@@ -362,6 +362,12 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Data")
 	bool GetStageData(int32 StageNumber, FStageData& OutStageData);
 
+	/** Mob roster (A, B, C) a stage spawns: DT_Stages EnemyA/B/C, falling back to Mob_StageNN_A/B/C. */
+	void GetStageMobIDs(int32 StageNumber, TArray<FName>& OutMobIDs);
+
+	/** Visual IDs for the mob families and boss a stage spawns. */
+	void GetStageCharacterVisualIDs(int32 StageNumber, TArray<FName>& OutVisualIDs);
+
 	/** Get house NPC data by ID (row name). Returns false if not found. */
 	UFUNCTION(BlueprintCallable, Category = "Data")
 	bool GetHouseNPCData(FName NPCID, FHouseNPCData& OutNPCData);
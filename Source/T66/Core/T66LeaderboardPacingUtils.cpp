@@ -2,6 +2,7 @@
 
 #include "Core/T66LeaderboardPacingUtils.h"
 
+#include "Algo/BinarySearch.h"
 #include "Containers/UnrealString.h"
 #include "Misc/DefaultValueHelper.h"
 
@@ -111,4 +112,39 @@ namespace T66LeaderboardPacing
 			return A.Stage < B.Stage;
 		});
 	}
+
+	void BuildStageCurve(const TConstArrayView<FT66StagePacingPoint> Points, TArray<FT66StagePacingPoint>& OutCurve)
+	{
+		OutCurve.Reset(Points.Num());
+		OutCurve.Append(Points.GetData(), Points.Num());
+		OutCurve.StableSort([](const FT66StagePacingPoint& A, const FT66StagePacingPoint& B)
+		{
+			return A.Stage < B.Stage;
+		});
+
+		int32 WriteIndex = 0;
+		for (int32 ReadIndex = 0; ReadIndex < OutCurve.Num(); ++ReadIndex)
+		{
+			if (WriteIndex > 0 && OutCurve[WriteIndex - 1].Stage == OutCurve[ReadIndex].Stage)
+			{
+				OutCurve[WriteIndex - 1] = OutCurve[ReadIndex];
+				continue;
+			}
+
+			OutCurve[WriteIndex++] = OutCurve[ReadIndex];
+		}
+		OutCurve.SetNum(WriteIndex, EAllowShrinking::Yes);
+	}
+
+	bool FindStagePoint(const TConstArrayView<FT66StagePacingPoint> Curve, const int32 Stage, FT66StagePacingPoint& OutPoint)
+	{
+		const int32 Index = Algo::LowerBoundBy(Curve, Stage, &FT66StagePacingPoint::Stage);
+		if (!Curve.IsValidIndex(Index) || Curve[Index].Stage != Stage)
+		{
+			return false;
+		}
+
+		OutPoint = Curve[Index];
+		return true;
+	}
 }
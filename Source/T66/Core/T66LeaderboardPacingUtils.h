@@ -13,4 +13,9 @@ namespace T66LeaderboardPacing
 	bool ParseStageMarker(const FString& Entry, FT66StagePacingPoint& OutPoint);
 	void ExtractStageMarkers(const TArray<FString>& EventLog, TArray<FT66StagePacingPoint>& OutPoints);
 	bool IsStageMarker(const FString& Entry);
+
+	/** Copies pacing points into a stage-sorted curve with one point per stage (last write wins). */
+	void BuildStageCurve(TConstArrayView<FT66StagePacingPoint> Points, TArray<FT66StagePacingPoint>& OutCurve);
+	/** Binary search into a curve produced by BuildStageCurve. */
+	bool FindStagePoint(TConstArrayView<FT66StagePacingPoint> Curve, int32 Stage, FT66StagePacingPoint& OutPoint);
 }
@@ -48,6 +48,59 @@ static FAutoConsoleCommand T66AccountStatusSus2Command(
 	})
 );
 
+static FT66RunSummaryHeader T66MakeRunSummaryHeader(const UT66LeaderboardRunSummarySaveGame& Snapshot)
+{
+	FT66RunSummaryHeader Header;
+	Header.EndedAtUtc = Snapshot.RunEndedAtUtc;
+	Header.Difficulty = Snapshot.Difficulty;
+	Header.PartySize = Snapshot.PartySize;
+	Header.HeroID = Snapshot.HeroID;
+	Header.CompanionID = Snapshot.CompanionID;
+	Header.Score = Snapshot.Score;
+	Header.StageReached = Snapshot.StageReached;
+	Header.DurationSeconds = Snapshot.RunDurationSeconds;
+	Header.bWasFullClear = Snapshot.bWasFullClear;
+	Header.bWasSpeedRunMode = Snapshot.bWasSpeedRunMode;
+	Header.bIsFrontendPlaceholder =
+		Snapshot.EntryId.IsEmpty()
+		&& Snapshot.Score <= 0
+		&& Snapshot.StageReached <= 1
+		&& Snapshot.RunDurationSeconds <= KINDA_SMALL_NUMBER
+		&& !Snapshot.bWasFullClear
+		&& Snapshot.EventLog.Num() == 0
+		&& Snapshot.DamageBySource.Num() == 0;
+	return Header;
+}
+
+static bool T66ApplyRunSummaryHeader(const FT66RunSummaryHeader& Header, FT66RecentRunRecord& Record)
+{
+	bool bRecordChanged = false;
+	auto SyncField = [&bRecordChanged](auto& Target, const auto& Source)
+	{
+		if (!(Target == Source))
+		{
+			Target = Source;
+			bRecordChanged = true;
+		}
+	};
+
+	if (Header.EndedAtUtc > FDateTime::MinValue())
+	{
+		SyncField(Record.EndedAtUtc, Header.EndedAtUtc);
+	}
+
+	SyncField(Record.Difficulty, Header.Difficulty);
+	SyncField(Record.PartySize, Header.PartySize);
+	SyncField(Record.HeroID, Header.HeroID);
+	SyncField(Record.CompanionID, Header.CompanionID);
+	SyncField(Record.Score, Header.Score);
+	SyncField(Record.StageReached, Header.StageReached);
+	SyncField(Record.DurationSeconds, Header.DurationSeconds);
+	SyncField(Record.bWasFullClear, Header.bWasFullClear);
+	SyncField(Record.bWasSpeedRunMode, Header.bWasSpeedRunMode);
+	return bRecordChanged;
+}
+
 static void T66_ClearLead(const TArray<FString>& Args, UWorld* World)
 {
 	(void)Args;
@@ -450,6 +503,7 @@ void UT66LeaderboardSubsystem::LoadOrCreateLocalSave()
 	if (LocalSave && !ActiveLocalSaveSlotName.IsEmpty())
 	{
 		SaveLocalSave();
+		CancelRunSummaryHeaderMaintenance();
 		LocalSave = nullptr;
 		bLastScoreWasNewBest = false;
 		bLastSpeedRunWasNewBest = false;
@@ -518,6 +572,8 @@ void UT66LeaderboardSubsystem::LoadOrCreateLocalSave()
 	{
 		SaveLocalSave();
 	}
+
+	StartRunSummaryHeaderMaintenance();
 }
 
 void UT66LeaderboardSubsystem::SaveLocalSave() const
@@ -613,6 +669,7 @@ void UT66LeaderboardSubsystem::DebugClearLocalLeaderboard()
 	}
 
 	// Reset transient state and recreate the save so UI can immediately read a valid object.
+	CancelRunSummaryHeaderMaintenance();
 	LocalSave = nullptr;
 	ActiveLocalSaveSlotName.Reset();
 	PendingRunSummarySlotName.Reset();
@@ -712,34 +769,16 @@ bool UT66LeaderboardSubsystem::PruneInvalidRecentRunRecords()
 	bool bChanged = false;
 	for (int32 Index = LocalSave->RecentRuns.Num() - 1; Index >= 0; --Index)
 	{
-		const FT66RecentRunRecord& Record = LocalSave->RecentRuns[Index];
-		if (Record.RunSummarySlotName.IsEmpty() || !UGameplayStatics::DoesSaveGameExist(Record.RunSummarySlotName, 0))
-		{
-			continue;
-		}
-
-		USaveGame* Loaded = UGameplayStatics::LoadGameFromSlot(Record.RunSummarySlotName, 0);
-		const UT66LeaderboardRunSummarySaveGame* Snapshot = Cast<UT66LeaderboardRunSummarySaveGame>(Loaded);
-		if (!Snapshot)
+		const FString SlotName = LocalSave->RecentRuns[Index].RunSummarySlotName;
+		const FT66RunSummaryHeader* Header = SlotName.IsEmpty() ? nullptr : LocalSave->RunSummaryHeaders.Find(SlotName);
+		if (!Header || !Header->bIsFrontendPlaceholder)
 		{
 			continue;
 		}
 
-		const bool bLooksLikeFrontendPlaceholder =
-			Snapshot->EntryId.IsEmpty()
-			&& Snapshot->Score <= 0
-			&& Snapshot->StageReached <= 1
-			&& Snapshot->RunDurationSeconds <= KINDA_SMALL_NUMBER
-			&& !Snapshot->bWasFullClear
-			&& Snapshot->EventLog.Num() == 0
-			&& Snapshot->DamageBySource.Num() == 0;
-		if (!bLooksLikeFrontendPlaceholder)
-		{
-			continue;
-		}
-
-		UE_LOG(LogT66Leaderboard, Log, TEXT("Leaderboard: pruning invalid recent-run placeholder snapshot %s."), *Record.RunSummarySlotName);
-		UGameplayStatics::DeleteGameInSlot(Record.RunSummarySlotName, 0);
+		UE_LOG(LogT66Leaderboard, Log, TEXT("Leaderboard: pruning invalid recent-run placeholder snapshot %s."), *SlotName);
+		UGameplayStatics::DeleteGameInSlot(SlotName, 0);
+		LocalSave->RunSummaryHeaders.Remove(SlotName);
 		LocalSave->RecentRuns.RemoveAt(Index);
 		bChanged = true;
 	}
@@ -757,47 +796,137 @@ bool UT66LeaderboardSubsystem::SyncRecentRunRecordsFromSnapshots()
 	bool bChanged = false;
 	for (FT66RecentRunRecord& Record : LocalSave->RecentRuns)
 	{
-		if (Record.RunSummarySlotName.IsEmpty() || !UGameplayStatics::DoesSaveGameExist(Record.RunSummarySlotName, 0))
+		const FT66RunSummaryHeader* Header = Record.RunSummarySlotName.IsEmpty() ? nullptr : LocalSave->RunSummaryHeaders.Find(Record.RunSummarySlotName);
+		if (Header && T66ApplyRunSummaryHeader(*Header, Record))
 		{
-			continue;
+			bChanged = true;
 		}
+	}
 
-		USaveGame* Loaded = UGameplayStatics::LoadGameFromSlot(Record.RunSummarySlotName, 0);
-		const UT66LeaderboardRunSummarySaveGame* Snapshot = Cast<UT66LeaderboardRunSummarySaveGame>(Loaded);
-		if (!Snapshot)
-		{
-			continue;
-		}
+	return bChanged;
+}
 
-		bool bRecordChanged = false;
-		auto SyncField = [&bRecordChanged](auto& Target, const auto& Source)
-		{
-			if (!(Target == Source))
-			{
-				Target = Source;
-				bRecordChanged = true;
-			}
-		};
+void UT66LeaderboardSubsystem::IndexRunSummaryHeader(const FString& SlotName, const UT66LeaderboardRunSummarySaveGame& Snapshot) const
+{
+	if (LocalSave && !SlotName.IsEmpty())
+	{
+		LocalSave->RunSummaryHeaders.Add(SlotName, T66MakeRunSummaryHeader(Snapshot));
+	}
+}
+
+void UT66LeaderboardSubsystem::StartRunSummaryHeaderMaintenance()
+{
+	if (!LocalSave || bRunSummaryHeaderMaintenanceInFlight)
+	{
+		return;
+	}
 
-		if (Snapshot->RunEndedAtUtc > FDateTime::MinValue())
+	// Saves written before the header index existed are backfilled in the background; readers
+	// keep using the fields already stored on the records until the index catches up.
+	PendingHeaderMaintenanceSlots.Reset();
+	auto QueueSlot = [this](const FString& SlotName)
+	{
+		if (!SlotName.IsEmpty() && !LocalSave->RunSummaryHeaders.Contains(SlotName))
 		{
-			SyncField(Record.EndedAtUtc, Snapshot->RunEndedAtUtc);
+			PendingHeaderMaintenanceSlots.AddUnique(SlotName);
 		}
+	};
 
-		SyncField(Record.Difficulty, Snapshot->Difficulty);
-		SyncField(Record.PartySize, Snapshot->PartySize);
-		SyncField(Record.HeroID, Snapshot->HeroID);
-		SyncField(Record.CompanionID, Snapshot->CompanionID);
-		SyncField(Record.Score, Snapshot->Score);
-		SyncField(Record.StageReached, Snapshot->StageReached);
-		SyncField(Record.DurationSeconds, Snapshot->RunDurationSeconds);
-		SyncField(Record.bWasFullClear, Snapshot->bWasFullClear);
-		SyncField(Record.bWasSpeedRunMode, Snapshot->bWasSpeedRunMode);
+	for (const FT66RecentRunRecord& Record : LocalSave->RecentRuns)
+	{
+		QueueSlot(Record.RunSummarySlotName);
+	}
+	for (const FT66LocalScoreRecord& Record : LocalSave->ScoreRecords)
+	{
+		QueueSlot(Record.RunSummarySlotName);
+		QueueSlot(Record.BestRankRunSummarySlotName);
+	}
+	for (const FT66LocalCompletedRunTimeRecord& Record : LocalSave->CompletedRunTimeRecords)
+	{
+		QueueSlot(Record.RunSummarySlotName);
+		QueueSlot(Record.BestRankRunSummarySlotName);
+	}
 
-		bChanged = bChanged || bRecordChanged;
+	if (PendingHeaderMaintenanceSlots.Num() > 0)
+	{
+		UE_LOG(LogT66Leaderboard, Log, TEXT("Leaderboard: backfilling %d run summary headers in the background."), PendingHeaderMaintenanceSlots.Num());
+		bRunSummaryHeaderMaintenanceInFlight = true;
+		ContinueRunSummaryHeaderMaintenance();
 	}
+}
 
-	return bChanged;
+void UT66LeaderboardSubsystem::ContinueRunSummaryHeaderMaintenance()
+{
+	if (!LocalSave || PendingHeaderMaintenanceSlots.Num() == 0)
+	{
+		FinishRunSummaryHeaderMaintenance();
+		return;
+	}
+
+	const FString SlotName = PendingHeaderMaintenanceSlots.Pop(EAllowShrinking::No);
+	UGameplayStatics::AsyncLoadGameFromSlot(
+		SlotName,
+		0,
+		FAsyncLoadGameFromSlotDelegate::CreateUObject(this, &UT66LeaderboardSubsystem::HandleRunSummaryHeaderSlotLoaded, RunSummaryHeaderMaintenanceGeneration));
+}
+
+void UT66LeaderboardSubsystem::HandleRunSummaryHeaderSlotLoaded(const FString& SlotName, const int32 UserIndex, USaveGame* LoadedGame, const int32 Generation)
+{
+	static_cast<void>(UserIndex);
+	if (!bRunSummaryHeaderMaintenanceInFlight || Generation != RunSummaryHeaderMaintenanceGeneration)
+	{
+		return;
+	}
+
+	if (const UT66LeaderboardRunSummarySaveGame* Snapshot = Cast<UT66LeaderboardRunSummarySaveGame>(LoadedGame))
+	{
+		IndexRunSummaryHeader(SlotName, *Snapshot);
+	}
+
+	ContinueRunSummaryHeaderMaintenance();
+}
+
+void UT66LeaderboardSubsystem::CancelRunSummaryHeaderMaintenance()
+{
+	++RunSummaryHeaderMaintenanceGeneration;
+	bRunSummaryHeaderMaintenanceInFlight = false;
+	PendingHeaderMaintenanceSlots.Reset();
+}
+
+void UT66LeaderboardSubsystem::FinishRunSummaryHeaderMaintenance()
+{
+	if (!bRunSummaryHeaderMaintenanceInFlight)
+	{
+		return;
+	}
+
+	bRunSummaryHeaderMaintenanceInFlight = false;
+	PendingHeaderMaintenanceSlots.Reset();
+	if (!LocalSave)
+	{
+		return;
+	}
+
+	PruneInvalidRecentRunRecords();
+	SyncRecentRunRecordsFromSnapshots();
+	SaveLocalSave();
+}
+
+bool UT66LeaderboardSubsystem::GetRunSummaryHeader(const FString& SlotName, FT66RunSummaryHeader& OutHeader) const
+{
+	if (!LocalSave)
+	{
+		const_cast<UT66LeaderboardSubsystem*>(this)->LoadOrCreateLocalSave();
+	}
+
+	const FT66RunSummaryHeader* Header = (LocalSave && !SlotName.IsEmpty()) ? LocalSave->RunSummaryHeaders.Find(SlotName) : nullptr;
+	if (!Header)
+	{
+		return false;
+	}
+
+	OutHeader = *Header;
+	return true;
 }
 
 bool UT66LeaderboardSubsystem::HasLocalBestScoreRunSummary(ET66Difficulty Difficulty, ET66PartySize PartySize) const
@@ -948,7 +1077,13 @@ UT66LeaderboardRunSummarySaveGame* UT66LeaderboardSubsystem::CreateCurrentRunSum
 
 bool UT66LeaderboardSubsystem::SaveRunSummarySnapshotToSlot(UT66LeaderboardRunSummarySaveGame* Snapshot, const FString& SlotName) const
 {
-	return Snapshot && !SlotName.IsEmpty() && UGameplayStatics::SaveGameToSlot(Snapshot, SlotName, 0);
+	if (!Snapshot || SlotName.IsEmpty() || !UGameplayStatics::SaveGameToSlot(Snapshot, SlotName, 0))
+	{
+		return false;
+	}
+
+	IndexRunSummaryHeader(SlotName, *Snapshot);
+	return true;
 }
 
 bool UT66LeaderboardSubsystem::UpdateSavedRunSummaryRanks(
@@ -975,7 +1110,7 @@ bool UT66LeaderboardSubsystem::UpdateSavedRunSummaryRanks(
 	Snapshot->ScoreRankWeekly = FMath::Max(0, ScoreRankWeekly);
 	Snapshot->SpeedRunRankAllTime = FMath::Max(0, SpeedRunRankAlltime);
 	Snapshot->SpeedRunRankWeekly = FMath::Max(0, SpeedRunRankWeekly);
-	return UGameplayStatics::SaveGameToSlot(Snapshot, SlotName, 0);
+	return SaveRunSummarySnapshotToSlot(Snapshot, SlotName);
 }
 
 void UT66LeaderboardSubsystem::PopulateSnapshotLeaderboardRanks(
@@ -1738,25 +1873,9 @@ void UT66LeaderboardSubsystem::AppendRecentRunRecord(const FString& RunSummarySl
 	Record.bWasFullClear = RunState->DidRunEndInVictory() || RunState->HasPendingDifficultyClearSummary();
 	Record.bWasSpeedRunMode = PS ? PS->GetSpeedRunMode() : false;
 
-	if (UGameplayStatics::DoesSaveGameExist(RunSummarySlotName, 0))
+	if (const FT66RunSummaryHeader* Header = LocalSave->RunSummaryHeaders.Find(RunSummarySlotName))
 	{
-		USaveGame* Loaded = UGameplayStatics::LoadGameFromSlot(RunSummarySlotName, 0);
-		if (const UT66LeaderboardRunSummarySaveGame* Snapshot = Cast<UT66LeaderboardRunSummarySaveGame>(Loaded))
-		{
-			if (Snapshot->RunEndedAtUtc > FDateTime::MinValue())
-			{
-				Record.EndedAtUtc = Snapshot->RunEndedAtUtc;
-			}
-			Record.Difficulty = Snapshot->Difficulty;
-			Record.PartySize = Snapshot->PartySize;
-			Record.HeroID = Snapshot->HeroID;
-			Record.CompanionID = Snapshot->CompanionID;
-			Record.Score = Snapshot->Score;
-			Record.StageReached = Snapshot->StageReached;
-			Record.DurationSeconds = Snapshot->RunDurationSeconds;
-			Record.bWasFullClear = Snapshot->bWasFullClear;
-			Record.bWasSpeedRunMode = Snapshot->bWasSpeedRunMode;
-		}
+		T66ApplyRunSummaryHeader(*Header, Record);
 	}
 
 	LocalSave->RecentRuns.Insert(Record, 0);
@@ -1803,6 +1922,10 @@ bool UT66LeaderboardSubsystem::DeleteRunSummarySlotIfUnreferenced(const FString&
 		return false;
 	}
 
+	if (LocalSave)
+	{
+		LocalSave->RunSummaryHeaders.Remove(SlotName);
+	}
 	return UGameplayStatics::DeleteGameInSlot(SlotName, 0);
 }
 
@@ -16,6 +16,7 @@ struct FLeaderboardEntry;
 class UT66LocalLeaderboardSaveGame;
 class UT66LeaderboardRunSummarySaveGame;
 class UDataTable;
+class USaveGame;
 
 /**
  * Handles local leaderboard persistence plus online backend sync for the
@@ -96,6 +97,9 @@ public:
 	/** Completed runs, newest first, with no hard history cap. */
 	TArray<FT66RecentRunRecord> GetRecentRuns() const;
 
+	/** Header fields for a local run summary slot, read from the index instead of the slot itself. */
+	bool GetRunSummaryHeader(const FString& SlotName, FT66RunSummaryHeader& OutHeader) const;
+
 	/** Best score record for the requested difficulty + party size. */
 	bool GetLocalBestScoreRecord(ET66Difficulty Difficulty, ET66PartySize PartySize, FT66LocalScoreRecord& OutRecord) const;
 
@@ -204,6 +208,11 @@ private:
 
 	FString ActiveLocalSaveSlotName;
 
+	/** Referenced summary slots with no index header yet; loaded asynchronously one at a time. */
+	TArray<FString> PendingHeaderMaintenanceSlots;
+	bool bRunSummaryHeaderMaintenanceInFlight = false;
+	int32 RunSummaryHeaderMaintenanceGeneration = 0;
+
 	// Legacy runtime targets. Cleanup keeps the current CSV-first behavior visible and
 	// explicit until the packaged-parity pass moves these to cooked ownership.
 	TMap<uint64, int64> ScoreTarget10ByKey;
@@ -225,6 +234,12 @@ private:
 	FString MakeRecentRunSummarySlotName(const FGuid& RunId) const;
 	bool PruneInvalidRecentRunRecords();
 	bool SyncRecentRunRecordsFromSnapshots();
+	void StartRunSummaryHeaderMaintenance();
+	void ContinueRunSummaryHeaderMaintenance();
+	void HandleRunSummaryHeaderSlotLoaded(const FString& SlotName, int32 UserIndex, USaveGame* LoadedGame, int32 Generation);
+	void CancelRunSummaryHeaderMaintenance();
+	void FinishRunSummaryHeaderMaintenance();
+	void IndexRunSummaryHeader(const FString& SlotName, const UT66LeaderboardRunSummarySaveGame& Snapshot) const;
 
 	bool SaveLocalBestScoreRunSummarySnapshot(ET66Difficulty Difficulty, ET66PartySize PartySize, int32 Score, const FString& ExistingRunSummarySlotName = FString()) const;
 	UT66LeaderboardRunSummarySaveGame* CreateCurrentRunSummarySnapshot(ET66LeaderboardType LeaderboardType, ET66Difficulty Difficulty, ET66PartySize PartySize, int32 Score) const;
@@ -153,6 +153,50 @@ struct T66_API FT66RecentRunRecord
 	bool bWasSpeedRunMode = false;
 };
 
+/**
+ * Header fields copied out of a run summary slot when it is written, so history and PB lists
+ * never need to deserialize the full snapshot (event log, anti-cheat arrays) to render a row.
+ */
+USTRUCT(BlueprintType)
+struct T66_API FT66RunSummaryHeader
+{
+	GENERATED_BODY()
+
+	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadWrite, Category = "Leaderboard")
+	FDateTime EndedAtUtc = FDateTime::MinValue();
+
+	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadWrite, Category = "Leaderboard")
+	ET66Difficulty Difficulty = ET66Difficulty::Easy;
+
+	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadWrite, Category = "Leaderboard")
+	ET66PartySize PartySize = ET66PartySize::Solo;
+
+	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadWrite, Category = "Leaderboard")
+	FName HeroID = NAME_None;
+
+	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadWrite, Category = "Leaderboard")
+	FName CompanionID = NAME_None;
+
+	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadWrite, Category = "Leaderboard")
+	int32 Score = 0;
+
+	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadWrite, Category = "Leaderboard")
+	int32 StageReached = 1;
+
+	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadWrite, Category = "Leaderboard")
+	float DurationSeconds = 0.f;
+
+	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadWrite, Category = "Leaderboard")
+	bool bWasFullClear = false;
+
+	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadWrite, Category = "Leaderboard")
+	bool bWasSpeedRunMode = false;
+
+	/** Empty snapshot written by the frontend before a run started; pruned from recent runs. */
+	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadWrite, Category = "Leaderboard")
+	bool bIsFrontendPlaceholder = false;
+};
+
 UENUM(BlueprintType)
 enum class ET66AccountRestrictionKind : uint8
 {
@@ -235,6 +279,10 @@ public:
 	UPROPERTY(SaveGame)
 	TArray<FT66RecentRunRecord> RecentRuns;
 
+	/** Run summary headers keyed by slot name; refreshed whenever a summary slot is written. */
+	UPROPERTY(SaveGame)
+	TMap<FString, FT66RunSummaryHeader> RunSummaryHeaders;
+
 	/** Placeholder local account restriction state (for the Main Menu Account Status panel). */
 	UPROPERTY(SaveGame)
 	FT66AccountRestrictionRecord AccountRestriction;
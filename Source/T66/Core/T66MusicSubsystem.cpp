@@ -7,6 +7,8 @@
 #include "Core/T66GameInstance.h"
 #include "Core/T66RunStateSubsystem.h"
 #include "Components/AudioComponent.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
 #include "Kismet/GameplayStatics.h"
 #include "Sound/SoundBase.h"
 #include "UObject/SoftObjectPath.h"
@@ -16,56 +18,69 @@ DEFINE_LOG_CATEGORY_STATIC(LogT66Music, Log, All);
 
 // NOTE: This file must remain in the runtime module so the UHT-generated glue links correctly.
 
-static USoundBase* TryLoadFirstSoundAsset(const TArray<FSoftObjectPath>& Candidates, TSoftObjectPtr<USoundBase>& InOutSoftPtr)
+namespace
 {
-	for (const FSoftObjectPath& P : Candidates)
+	IAssetRegistry& T66GetMusicAssetRegistry()
 	{
-		if (!P.IsValid()) continue;
-		if (UObject* Obj = P.TryLoad())
+		return FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+	}
+
+	FSoftObjectPath T66FindFirstRegisteredSound(const TArray<FSoftObjectPath>& Candidates)
+	{
+		IAssetRegistry& AssetRegistry = T66GetMusicAssetRegistry();
+		for (const FSoftObjectPath& Candidate : Candidates)
 		{
-			if (USoundBase* SB = Cast<USoundBase>(Obj))
+			if (!Candidate.IsValid())
 			{
-				InOutSoftPtr = TSoftObjectPtr<USoundBase>(P);
-				return SB;
+				continue;
+			}
+
+			const FAssetData AssetData = AssetRegistry.GetAssetByObjectPath(Candidate);
+			if (AssetData.IsValid() && AssetData.IsInstanceOf(USoundBase::StaticClass()))
+			{
+				return Candidate;
 			}
 		}
+		return FSoftObjectPath();
 	}
-	return nullptr;
-}
 
-static USoundBase* TryLoadFirstSoundInFolder(const FString& FolderPath)
-{
-	// FolderPath should be like "/Game/Audio/OSTS/Heroes/Hero_Example"
-	if (FolderPath.IsEmpty())
+	FSoftObjectPath T66FindFirstSoundInFolder(const FString& FolderPath)
 	{
-		return nullptr;
-	}
-
-	const FName PathName(*FolderPath);
-	FAssetRegistryModule& ARM = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
+		// FolderPath should be like "/Game/Audio/OSTS/Heroes/Hero_Example"
+		if (FolderPath.IsEmpty())
+		{
+			return FSoftObjectPath();
+		}
 
-	TArray<FAssetData> Assets;
-	ARM.Get().GetAssetsByPath(PathName, Assets, /*bRecursive=*/true);
-	if (Assets.Num() <= 0)
-	{
-		return nullptr;
-	}
+		TArray<FAssetData> Assets;
+		T66GetMusicAssetRegistry().GetAssetsByPath(FName(*FolderPath), Assets, /*bRecursive=*/true);
 
-	// Deterministic selection: alphabetical by asset name.
-	Assets.Sort([](const FAssetData& A, const FAssetData& B)
-	{
-		return A.AssetName.LexicalLess(B.AssetName);
-	});
+		// Deterministic selection: alphabetical by asset name.
+		Assets.Sort([](const FAssetData& A, const FAssetData& B)
+		{
+			return A.AssetName.LexicalLess(B.AssetName);
+		});
 
-	for (const FAssetData& AD : Assets)
-	{
-		UObject* Obj = AD.GetAsset();
-		if (USoundBase* SB = Cast<USoundBase>(Obj))
+		for (const FAssetData& AssetData : Assets)
 		{
-			return SB;
+			if (AssetData.IsInstanceOf(USoundBase::StaticClass()))
+			{
+				return AssetData.GetSoftObjectPath();
+			}
 		}
+		return FSoftObjectPath();
+	}
+
+	bool T66IsSpecialBossID(const FName BossID)
+	{
+		const FString BossIdStr = BossID.ToString();
+		return BossID == FName(TEXT("VendorBoss")) ||
+			BossID == FName(TEXT("GamblerBoss")) ||
+			BossID == FName(TEXT("OuroborosBoss")) ||
+			BossIdStr.Contains(TEXT("Vendor"), ESearchCase::IgnoreCase) ||
+			BossIdStr.Contains(TEXT("Gambler"), ESearchCase::IgnoreCase) ||
+			BossIdStr.Contains(TEXT("Ouroboros"), ESearchCase::IgnoreCase);
 	}
-	return nullptr;
 }
 
 void UT66MusicSubsystem::Initialize(FSubsystemCollectionBase& Collection)
@@ -77,7 +92,7 @@ void UT66MusicSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 	Super::Initialize(Collection);
 
 	// Convention-based soft references (user imports to Content/Audio).
-	// Do NOT eagerly load here; resolve on demand when the game actually begins play.
+	// Do NOT eagerly load here; the manifest is resolved and streamed when a map loads.
 	MainThemeCandidates = {
 		FSoftObjectPath(TEXT("/Game/Audio/OSTS/MainTheme.MainTheme")),
 		FSoftObjectPath(TEXT("/Game/Audio/Music/MainTheme.MainTheme")),
@@ -193,9 +208,205 @@ void UT66MusicSubsystem::HandlePostLoadMap(UWorld* World)
 
 	// Switch base music depending on where we are (mutually exclusive).
 	DesiredBaseTrack = IsFrontendWorld(World) ? ET66BaseTrack::MainTheme : ET66BaseTrack::Theme;
+	ResolveMusicManifest(World);
+	PrefetchMusicForWorld(World);
+	UpdateMusicState();
+}
+
+void UT66MusicSubsystem::PrefetchUpcomingStageMusic(const int32 StageNumber)
+{
+	// The gameplay theme follows the hero and is already resident; what a new stage can add is its boss theme.
+	UT66GameInstance* T66GI = Cast<UT66GameInstance>(GetGameInstance());
+	FStageData StageData;
+	if (!T66GI || StageNumber <= 0 || !T66GI->GetStageData(StageNumber, StageData))
+	{
+		return;
+	}
+
+	RequestTrack(ResolveBossThemePath(StageData.BossID));
+}
+
+void UT66MusicSubsystem::ResolveMusicManifest(UWorld* World)
+{
+	Manifest.MainTheme = T66FindFirstRegisteredSound(MainThemeCandidates);
+	Manifest.Survival = T66FindFirstRegisteredSound(SurvivalCandidates);
+	Manifest.GameplayTheme = ResolveGameplayThemePath(World);
+}
+
+void UT66MusicSubsystem::PrefetchMusicForWorld(UWorld* World)
+{
+	if (DesiredBaseTrack == ET66BaseTrack::MainTheme)
+	{
+		RequestTrack(Manifest.MainTheme);
+		return;
+	}
+
+	// Gameplay: the base theme first, then everything a phase change can switch to mid-stage.
+	RequestTrack(Manifest.GameplayTheme);
+	RequestTrack(Manifest.Survival);
+	static const FName SpecialBossIDs[] = { FName(TEXT("VendorBoss")), FName(TEXT("GamblerBoss")), FName(TEXT("OuroborosBoss")) };
+	for (const FName BossID : SpecialBossIDs)
+	{
+		RequestTrack(ResolveBossThemePath(BossID));
+	}
+}
+
+FSoftObjectPath UT66MusicSubsystem::ResolveGameplayThemePath(UWorld* World) const
+{
+	// Hero-specific theme folder (optional) overrides the default Theme.
+	UGameInstance* GI = World ? World->GetGameInstance() : GetGameInstance();
+	UT66GameInstance* T66GI = GI ? Cast<UT66GameInstance>(GI) : nullptr;
+
+	FName HeroKey = NAME_None;
+	if (T66GI && !T66GI->SelectedHeroID.IsNone())
+	{
+		FHeroData HeroData;
+		if (T66GI->GetHeroData(T66GI->SelectedHeroID, HeroData))
+		{
+			HeroKey = !HeroData.MapTheme.IsNone() ? HeroData.MapTheme : HeroData.HeroID;
+		}
+		else
+		{
+			HeroKey = T66GI->SelectedHeroID;
+		}
+	}
+
+	if (!HeroKey.IsNone())
+	{
+		const FSoftObjectPath HeroTheme = T66FindFirstSoundInFolder(FString::Printf(TEXT("/Game/Audio/OSTS/Heroes/%s"), *HeroKey.ToString()));
+		if (HeroTheme.IsValid())
+		{
+			return HeroTheme;
+		}
+	}
+
+	// Fallback: project-wide Theme.
+	return T66FindFirstRegisteredSound(ThemeCandidates);
+}
+
+FSoftObjectPath UT66MusicSubsystem::ResolveBossThemePath(const FName BossID)
+{
+	if (const FSoftObjectPath* Cached = Manifest.SpecialBossThemes.Find(BossID))
+	{
+		return *Cached;
+	}
+
+	// Only special bosses (Vendor/Gambler/Ouroboros) get automatic folder-based music here.
+	// All other boss music is assigned individually per boss. Misses are cached as null paths.
+	FSoftObjectPath BossTheme;
+	if (!BossID.IsNone() && T66IsSpecialBossID(BossID))
+	{
+		BossTheme = T66FindFirstSoundInFolder(FString::Printf(TEXT("/Game/Audio/OSTS/Bosses/Special/%s"), *BossID.ToString()));
+	}
+
+	return Manifest.SpecialBossThemes.Add(BossID, BossTheme);
+}
+
+void UT66MusicSubsystem::RequestTrack(const FSoftObjectPath& TrackPath)
+{
+	if (!TrackPath.IsValid() || ResidentTracks.Contains(TrackPath) || PendingTrackLoads.Contains(TrackPath) || MissingTracks.Contains(TrackPath))
+	{
+		return;
+	}
+
+	PendingTrackLoads.Add(TrackPath);
+	TSharedPtr<FStreamableHandle> Handle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+		TrackPath,
+		FStreamableDelegate::CreateUObject(this, &UT66MusicSubsystem::HandleTrackLoaded, TrackPath));
+	if (!Handle.IsValid())
+	{
+		HandleTrackLoaded(TrackPath);
+	}
+}
+
+void UT66MusicSubsystem::HandleTrackLoaded(FSoftObjectPath TrackPath)
+{
+	if (!PendingTrackLoads.Remove(TrackPath))
+	{
+		return;
+	}
+
+	if (USoundBase* Sound = Cast<USoundBase>(TrackPath.ResolveObject()))
+	{
+		ResidentTracks.Add(TrackPath, Sound);
+		TouchResidentTrack(TrackPath);
+		TrimResidentTracks();
+	}
+	else
+	{
+		MissingTracks.Add(TrackPath);
+		UE_LOG(LogT66Music, Warning, TEXT("Music track failed to stream: %s"), *TrackPath.ToString());
+	}
+
+	// A switch may have been waiting on this track.
 	UpdateMusicState();
 }
 
+USoundBase* UT66MusicSubsystem::FindResidentTrack(const FSoftObjectPath& TrackPath, bool& bOutPending)
+{
+	bOutPending = false;
+	if (!TrackPath.IsValid())
+	{
+		return nullptr;
+	}
+
+	if (const TObjectPtr<USoundBase>* Resident = ResidentTracks.Find(TrackPath))
+	{
+		TouchResidentTrack(TrackPath);
+		return Resident->Get();
+	}
+
+	RequestTrack(TrackPath);
+	bOutPending = PendingTrackLoads.Contains(TrackPath);
+	if (const TObjectPtr<USoundBase>* Resident = ResidentTracks.Find(TrackPath))
+	{
+		return Resident->Get();
+	}
+	return nullptr;
+}
+
+void UT66MusicSubsystem::TouchResidentTrack(const FSoftObjectPath& TrackPath)
+{
+	ResidentTrackOrder.Remove(TrackPath);
+	ResidentTrackOrder.Add(TrackPath);
+}
+
+void UT66MusicSubsystem::TrimResidentTracks()
+{
+	// Evict least recently used tracks that are neither playing nor part of the current map's manifest.
+	for (int32 Index = 0; Index < ResidentTrackOrder.Num() && ResidentTracks.Num() > MaxResidentTracks;)
+	{
+		const FSoftObjectPath TrackPath = ResidentTrackOrder[Index];
+		const TObjectPtr<USoundBase>* Resident = ResidentTracks.Find(TrackPath);
+		if (Resident && IsTrackInUse(TrackPath, Resident->Get()))
+		{
+			++Index;
+			continue;
+		}
+
+		ResidentTracks.Remove(TrackPath);
+		ResidentTrackOrder.RemoveAt(Index);
+	}
+}
+
+bool UT66MusicSubsystem::IsTrackInUse(const FSoftObjectPath& TrackPath, const USoundBase* Sound) const
+{
+	if (TrackPath == Manifest.MainTheme || TrackPath == Manifest.GameplayTheme || TrackPath == Manifest.Survival)
+	{
+		return true;
+	}
+
+	const UAudioComponent* Components[] = { MainThemeComp, ThemeComp, SurvivalComp, BossComp };
+	for (const UAudioComponent* Component : Components)
+	{
+		if (Component && Sound && Component->Sound == Sound)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
 void UT66MusicSubsystem::HandleSurvivalChanged()
 {
 	UpdateMusicState();
@@ -228,6 +439,14 @@ void UT66MusicSubsystem::UpdateMusicState()
 	{
 		if (!bSurvivalActive)
 		{
+			// Keep the current track until Survival is resident; HandleTrackLoaded re-runs this.
+			bool bSurvivalPending = false;
+			USoundBase* SurvivalTrack = FindResidentTrack(Manifest.Survival, bSurvivalPending);
+			if (bSurvivalPending)
+			{
+				return;
+			}
+
 			bSurvivalActive = true;
 			bBossMusicActive = false;
 			bAllowMainThemeLoop = false;
@@ -237,7 +456,7 @@ void UT66MusicSubsystem::UpdateMusicState()
 			StopMainTheme(0.25f);
 			StopTheme(0.25f);
 			StopBoss(0.15f);
-			EnsureSurvivalPlaying(World);
+			EnsureSurvivalPlaying(World, SurvivalTrack);
 		}
 	}
 	else
@@ -253,7 +472,13 @@ void UT66MusicSubsystem::UpdateMusicState()
 		const bool bShouldBossMusic = bBossActive && !ActiveBossID.IsNone();
 		if (bShouldBossMusic)
 		{
-			USoundBase* BossTrack = ResolveAndLoadBossThemeSound(World);
+			bool bBossTrackPending = false;
+			USoundBase* BossTrack = FindResidentTrack(ResolveBossThemePath(ActiveBossID), bBossTrackPending);
+			if (bBossTrackPending)
+			{
+				return;
+			}
+
 			if (BossTrack)
 			{
 				bBossMusicActive = true;
@@ -262,7 +487,7 @@ void UT66MusicSubsystem::UpdateMusicState()
 				bAllowThemeLoop = false;
 				StopMainTheme(0.25f);
 				StopTheme(0.25f);
-				EnsureBossPlaying(World);
+				EnsureBossPlaying(World, BossTrack);
 				ApplyMusicVolumes();
 				return;
 			}
@@ -327,7 +552,12 @@ void UT66MusicSubsystem::EnsureMainThemePlaying(UWorld* World)
 {
 	if (!World) return;
 
-	USoundBase* Sound = ResolveAndLoadMainThemeSound();
+	bool bPending = false;
+	USoundBase* Sound = FindResidentTrack(Manifest.MainTheme, bPending);
+	if (bPending)
+	{
+		return;
+	}
 	if (!Sound)
 	{
 		if (!bMainThemeStarted)
@@ -365,7 +595,12 @@ void UT66MusicSubsystem::EnsureThemePlaying(UWorld* World)
 {
 	if (!World) return;
 
-	USoundBase* Sound = ResolveAndLoadGameplayThemeSound(World);
+	bool bPending = false;
+	USoundBase* Sound = FindResidentTrack(Manifest.GameplayTheme, bPending);
+	if (bPending)
+	{
+		return;
+	}
 	if (!Sound)
 	{
 		if (!bThemeStarted)
@@ -399,11 +634,10 @@ void UT66MusicSubsystem::EnsureThemePlaying(UWorld* World)
 	ApplyMusicVolumes();
 }
 
-void UT66MusicSubsystem::EnsureSurvivalPlaying(UWorld* World)
+void UT66MusicSubsystem::EnsureSurvivalPlaying(UWorld* World, USoundBase* Sound)
 {
 	if (!World) return;
 
-	USoundBase* Sound = ResolveAndLoadSurvivalSound();
 	if (!Sound)
 	{
 		UE_LOG(LogT66Music, Warning, TEXT("Survival music not found. Import the Survival asset into UE (SoundWave/SoundCue) so one of these exists: /Game/Audio/OSTS/Survival, /Game/Audio/Music/Survival, /Game/Audio/Survival."));
@@ -426,10 +660,9 @@ void UT66MusicSubsystem::EnsureSurvivalPlaying(UWorld* World)
 	}
 }
 
-void UT66MusicSubsystem::EnsureBossPlaying(UWorld* World)
+void UT66MusicSubsystem::EnsureBossPlaying(UWorld* World, USoundBase* Sound)
 {
 	if (!World) return;
-	USoundBase* Sound = ResolveAndLoadBossThemeSound(World);
 	if (!Sound)
 	{
 		return;
@@ -531,112 +764,3 @@ void UT66MusicSubsystem::HandleBossFinished()
 		BossComp->Play(0.0f);
 	}
 }
-
-USoundBase* UT66MusicSubsystem::ResolveAndLoadMainThemeSound()
-{
-	if (USoundBase* Existing = MainThemeSound.Get())
-	{
-		return Existing;
-	}
-	if (USoundBase* Loaded = MainThemeSound.LoadSynchronous())
-	{
-		return Loaded;
-	}
-	return TryLoadFirstSoundAsset(MainThemeCandidates, MainThemeSound);
-}
-
-USoundBase* UT66MusicSubsystem::ResolveAndLoadThemeSound()
-{
-	if (USoundBase* Existing = ThemeSound.Get())
-	{
-		return Existing;
-	}
-	if (USoundBase* Loaded = ThemeSound.LoadSynchronous())
-	{
-		return Loaded;
-	}
-	return TryLoadFirstSoundAsset(ThemeCandidates, ThemeSound);
-}
-
-USoundBase* UT66MusicSubsystem::ResolveAndLoadSurvivalSound()
-{
-	if (USoundBase* Existing = SurvivalSound.Get())
-	{
-		return Existing;
-	}
-	if (USoundBase* Loaded = SurvivalSound.LoadSynchronous())
-	{
-		return Loaded;
-	}
-	return TryLoadFirstSoundAsset(SurvivalCandidates, SurvivalSound);
-}
-
-USoundBase* UT66MusicSubsystem::ResolveAndLoadGameplayThemeSound(UWorld* World)
-{
-	// Hero-specific theme folder (optional) overrides the default Theme.
-	UGameInstance* GI = World ? World->GetGameInstance() : nullptr;
-	UT66GameInstance* T66GI = GI ? Cast<UT66GameInstance>(GI) : nullptr;
-
-	FName HeroKey = NAME_None;
-	if (T66GI && !T66GI->SelectedHeroID.IsNone())
-	{
-		FHeroData HeroData;
-		if (T66GI->GetHeroData(T66GI->SelectedHeroID, HeroData))
-		{
-			HeroKey = !HeroData.MapTheme.IsNone() ? HeroData.MapTheme : HeroData.HeroID;
-		}
-		else
-		{
-			HeroKey = T66GI->SelectedHeroID;
-		}
-	}
-
-	if (!HeroKey.IsNone())
-	{
-		const FString Folder = FString::Printf(TEXT("/Game/Audio/OSTS/Heroes/%s"), *HeroKey.ToString());
-		if (USoundBase* HeroTheme = TryLoadFirstSoundInFolder(Folder))
-		{
-			return HeroTheme;
-		}
-	}
-
-	// Fallback: project-wide Theme.
-	return ResolveAndLoadThemeSound();
-}
-
-USoundBase* UT66MusicSubsystem::ResolveAndLoadBossThemeSound(UWorld* World)
-{
-	UGameInstance* GI = World ? World->GetGameInstance() : nullptr;
-	UT66RunStateSubsystem* RunState = GI ? GI->GetSubsystem<UT66RunStateSubsystem>() : nullptr;
-	if (!RunState) return nullptr;
-
-	const FName BossID = RunState->GetActiveBossID();
-	if (BossID.IsNone()) return nullptr;
-
-	const FString BossIdStr = BossID.ToString();
-	// Only special bosses (Vendor/Gambler/Ouroboros) get automatic folder-based music here.
-	// All other boss music is assigned individually per boss.
-	const bool bSpecial =
-		BossID == FName(TEXT("VendorBoss")) ||
-		BossID == FName(TEXT("GamblerBoss")) ||
-		BossID == FName(TEXT("OuroborosBoss")) ||
-		BossIdStr.Contains(TEXT("Vendor"), ESearchCase::IgnoreCase) ||
-		BossIdStr.Contains(TEXT("Gambler"), ESearchCase::IgnoreCase) ||
-		BossIdStr.Contains(TEXT("Ouroboros"), ESearchCase::IgnoreCase);
-
-	if (!bSpecial)
-	{
-		return nullptr;
-	}
-
-	FString Folder = FString::Printf(TEXT("/Game/Audio/OSTS/Bosses/Special/%s"), *BossID.ToString());
-
-	if (USoundBase* BossTheme = TryLoadFirstSoundInFolder(Folder))
-	{
-		return BossTheme;
-	}
-
-	// If nothing in the folder yet, fall back to base theme (no override).
-	return nullptr;
-}
-
@@ -15,6 +15,8 @@ class UT66PlayerSettingsSubsystem;
  * Simple music state manager.
  * - Plays Theme music immediately (including frontend).
  * - Switches to Survival music during Last Stand (0 hearts but still alive).
+ * - Resolves a music manifest once per map and streams tracks that can play next in the background;
+ *   a track switch only starts once the new track is resident.
  *
  * Note: Unreal must import audio into SoundWave/SoundCue assets.
  * Dropping .ogg files into Content/ is not enough until the editor imports them.
@@ -28,6 +30,9 @@ public:
 	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
 	virtual void Deinitialize() override;
 
+	/** Streams the music that can start on StageNumber beyond the resident base tracks (its special boss theme). */
+	void PrefetchUpcomingStageMusic(int32 StageNumber);
+
 private:
 	enum class ET66BaseTrack : uint8
 	{
@@ -49,15 +54,6 @@ private:
 	//   /Game/Audio/OSTS/Survival
 	//   /Game/Audio/Music/Survival
 	//   /Game/Audio/Survival
-	UPROPERTY()
-	TSoftObjectPtr<USoundBase> MainThemeSound;
-
-	UPROPERTY()
-	TSoftObjectPtr<USoundBase> ThemeSound;
-
-	UPROPERTY()
-	TSoftObjectPtr<USoundBase> SurvivalSound;
-
 	TArray<FSoftObjectPath> MainThemeCandidates;
 	TArray<FSoftObjectPath> ThemeCandidates;
 	TArray<FSoftObjectPath> SurvivalCandidates;
@@ -74,8 +70,29 @@ private:
 	UPROPERTY()
 	TObjectPtr<UAudioComponent> BossComp;
 
+	/** Track paths resolved from the asset registry once per map; nothing here is loaded. */
+	struct FT66MusicManifest
+	{
+		FSoftObjectPath MainTheme;
+		FSoftObjectPath GameplayTheme;
+		FSoftObjectPath Survival;
+		TMap<FName, FSoftObjectPath> SpecialBossThemes;
+	};
+
+	FT66MusicManifest Manifest;
+
+	/** Streamed tracks kept resident across maps so stage transitions never reload them. */
 	UPROPERTY()
-	TSoftObjectPtr<USoundBase> BossSound;
+	TMap<FSoftObjectPath, TObjectPtr<USoundBase>> ResidentTracks;
+
+	/** Resident track paths, least recently used first. */
+	TArray<FSoftObjectPath> ResidentTrackOrder;
+
+	/** Base tracks, the current boss track and one or two prefetched boss themes fit comfortably. */
+	static constexpr int32 MaxResidentTracks = 6;
+
+	TSet<FSoftObjectPath> PendingTrackLoads;
+	TSet<FSoftObjectPath> MissingTracks;
 
 	bool bThemeStarted = false;
 	bool bMainThemeStarted = false;
@@ -111,16 +128,23 @@ private:
 
 	bool IsFrontendWorld(UWorld* World) const;
 
-	USoundBase* ResolveAndLoadMainThemeSound();
-	USoundBase* ResolveAndLoadThemeSound();
-	USoundBase* ResolveAndLoadSurvivalSound();
-	USoundBase* ResolveAndLoadGameplayThemeSound(UWorld* World);
-	USoundBase* ResolveAndLoadBossThemeSound(UWorld* World);
+	void ResolveMusicManifest(UWorld* World);
+	void PrefetchMusicForWorld(UWorld* World);
+	FSoftObjectPath ResolveGameplayThemePath(UWorld* World) const;
+	FSoftObjectPath ResolveBossThemePath(FName BossID);
+	void RequestTrack(const FSoftObjectPath& TrackPath);
+	void HandleTrackLoaded(FSoftObjectPath TrackPath);
+	void TouchResidentTrack(const FSoftObjectPath& TrackPath);
+	void TrimResidentTracks();
+	bool IsTrackInUse(const FSoftObjectPath& TrackPath, const USoundBase* Sound) const;
+
+	/** Returns the resident track, or nullptr and queues an async load (bOutPending) when it is still streaming. */
+	USoundBase* FindResidentTrack(const FSoftObjectPath& TrackPath, bool& bOutPending);
 
 	void EnsureMainThemePlaying(UWorld* World);
 	void EnsureThemePlaying(UWorld* World);
-	void EnsureSurvivalPlaying(UWorld* World);
-	void EnsureBossPlaying(UWorld* World);
+	void EnsureSurvivalPlaying(UWorld* World, USoundBase* Sound);
+	void EnsureBossPlaying(UWorld* World, USoundBase* Sound);
 
 	void StopMainTheme(float FadeSeconds);
 	void StopTheme(float FadeSeconds);
@@ -11,6 +11,7 @@
 #include "Core/T66ActorRegistrySubsystem.h"
 #include "Core/T66GameInstance.h"
 #include "Core/T66GameplayLayout.h"
+#include "Core/T66TerrainBoardSubsystem.h"
 #include "Gameplay/T66MainMapTerrain.h"
 #include "Core/T66GameInstance.h"
 #include "Gameplay/T66ProceduralLandscapeParams.h"
@@ -352,12 +353,14 @@ bool UT66PropSubsystem::SpawnMainMapGroupedProps(
 		T66GI ? T66GI->SelectedDifficulty : ET66Difficulty::Easy,
 		Seed);
 
-	T66MainMapTerrain::FBoard Board;
-	if (!T66MainMapTerrain::Generate(MainMapPreset, Board))
+	const UT66TerrainBoardSubsystem::FBoardHandle BoardHandle = UT66TerrainBoardSubsystem::ResolveBoard(World, MainMapPreset);
+	if (!BoardHandle)
 	{
 		return false;
 	}
 
+	const T66MainMapTerrain::FBoard& Board = *BoardHandle;
+
 	FRandomStream Rng(Seed + 9973);
 	static constexpr float SpawnZ = 220.f;
 	static constexpr float SafeBubbleMargin = 250.f;
@@ -3,6 +3,7 @@
 #include "Core/T66RetroFXSubsystem.h"
 
 #include "Components/MeshComponent.h"
+#include "Components/SkinnedMeshComponent.h"
 #include "Core/T66PixelationSubsystem.h"
 #include "Core/T66PlayerSettingsSubsystem.h"
 #include "Engine/Engine.h"
@@ -274,6 +275,49 @@ namespace
 		BackfillRetroSharedParameters(SourceMaterial, TargetMaterial);
 	}
 
+	static uint32 HashRetroSourceParameters(UMaterialInterface* SourceMaterial)
+	{
+		uint32 Hash = 0;
+		if (!SourceMaterial)
+		{
+			return Hash;
+		}
+
+		TArray<FMaterialParameterInfo> ParameterInfos;
+		TArray<FGuid> ParameterIds;
+		SourceMaterial->GetAllScalarParameterInfo(ParameterInfos, ParameterIds);
+		for (const FMaterialParameterInfo& Info : ParameterInfos)
+		{
+			float Value = 0.0f;
+			if (SourceMaterial->GetScalarParameterValue(FHashedMaterialParameterInfo(Info), Value))
+			{
+				Hash = HashCombine(Hash, HashCombine(GetTypeHash(Info.Name), GetTypeHash(Value)));
+			}
+		}
+
+		SourceMaterial->GetAllVectorParameterInfo(ParameterInfos, ParameterIds);
+		for (const FMaterialParameterInfo& Info : ParameterInfos)
+		{
+			FLinearColor Value = FLinearColor::Black;
+			if (SourceMaterial->GetVectorParameterValue(FHashedMaterialParameterInfo(Info), Value))
+			{
+				Hash = HashCombine(Hash, HashCombine(GetTypeHash(Info.Name), GetTypeHash(Value)));
+			}
+		}
+
+		SourceMaterial->GetAllTextureParameterInfo(ParameterInfos, ParameterIds);
+		for (const FMaterialParameterInfo& Info : ParameterInfos)
+		{
+			UTexture* Value = nullptr;
+			if (SourceMaterial->GetTextureParameterValue(FHashedMaterialParameterInfo(Info), Value))
+			{
+				Hash = HashCombine(Hash, HashCombine(GetTypeHash(Info.Name), GetTypeHash(Value)));
+			}
+		}
+
+		return Hash;
+	}
+
 	static bool HasWorldGeometryEnabled(const FT66RetroFXSettings& Settings)
 	{
 		return Settings.bEnableWorldGeometry
@@ -384,7 +428,11 @@ void UT66RetroFXSubsystem::Deinitialize()
 	UpdateGeometrySpawnBinding(nullptr, false);
 	RestoreManagedMaterials(true, true);
 	RestoreResolutionRuntimeDefaults();
-	ManagedGeometrySlots.Reset();
+	ResetManagedSlots();
+	SharedRetroMaterials.Reset();
+	SharedRetroMaterialsByKey.Reset();
+	ResolvedRetroBaseByBaseMaterial.Reset();
+	ActorClassGeometryEligibility.Reset();
 	ManagedGeometryWorld = nullptr;
 	bWorldGeometryActive = false;
 	bCharacterGeometryActive = false;
@@ -820,6 +868,8 @@ void UT66RetroFXSubsystem::ApplyGeometryMaterials(const FT66RetroFXSettings& Set
 	{
 		RestoreManagedMaterials(true, true);
 		CleanupManagedSlots();
+		SharedRetroMaterials.Reset();
+		SharedRetroMaterialsByKey.Reset();
 		return;
 	}
 
@@ -828,10 +878,11 @@ void UT66RetroFXSubsystem::ApplyGeometryMaterials(const FT66RetroFXSettings& Set
 	CleanupManagedSlots();
 
 	UE_LOG(LogT66RetroFXRuntime, Verbose,
-		TEXT("ApplyGeometryMaterials: runtime swapping enabled World=%s Character=%s ManagedSlots=%d"),
+		TEXT("ApplyGeometryMaterials: runtime swapping enabled World=%s Character=%s ManagedSlots=%d SharedMaterials=%d"),
 		bEnableWorldGeometry ? TEXT("true") : TEXT("false"),
 		bEnableCharacterGeometry ? TEXT("true") : TEXT("false"),
-		ManagedGeometrySlots.Num());
+		ManagedGeometrySlots.Num(),
+		SharedRetroMaterials.Num());
 }
 
 void UT66RetroFXSubsystem::RefreshWorldGeometryMaterials(UWorld* World, bool bEnableWorldGeometry, bool bEnableCharacterGeometry)
@@ -887,6 +938,7 @@ void UT66RetroFXSubsystem::RefreshMeshComponentGeometryMaterials(UMeshComponent*
 
 			Slot.OriginalMaterial = CurrentMaterial;
 			Slot.RetroMaterial = nullptr;
+			Slot.bSharedRetroMaterial = false;
 		}
 
 		ET66RetroGeometryGroup Group = ET66RetroGeometryGroup::World;
@@ -896,32 +948,71 @@ void UT66RetroFXSubsystem::RefreshMeshComponentGeometryMaterials(UMeshComponent*
 			continue;
 		}
 
-		UMaterialInstanceDynamic* RetroMID = UMaterialInstanceDynamic::Create(RetroBaseMaterial, this);
+		bool bShared = false;
+		UMaterialInstanceDynamic* RetroMID = AcquireRetroMaterial(MeshComponent, CurrentMaterial, RetroBaseMaterial, bShared);
 		if (!RetroMID)
 		{
 			continue;
 		}
 
-		CopyRetroSourceParameters(CurrentMaterial, RetroMID);
 		MeshComponent->SetMaterial(MaterialIndex, RetroMID);
 
-		if (ManagedIndex != INDEX_NONE)
-		{
-			FT66RetroManagedMaterialSlot& Slot = ManagedGeometrySlots[ManagedIndex];
-			Slot.Group = Group;
-			Slot.RetroMaterial = RetroMID;
-			Slot.OriginalMaterial = CurrentMaterial;
-		}
-		else
+		FT66RetroManagedMaterialSlot& Slot = ManagedIndex != INDEX_NONE
+			? ManagedGeometrySlots[ManagedIndex]
+			: AddManagedSlot(MeshComponent, MaterialIndex);
+		Slot.Group = Group;
+		Slot.OriginalMaterial = CurrentMaterial;
+		Slot.RetroMaterial = RetroMID;
+		Slot.bSharedRetroMaterial = bShared;
+	}
+}
+
+UMaterialInstanceDynamic* UT66RetroFXSubsystem::AcquireRetroMaterial(UMeshComponent* MeshComponent, UMaterialInterface* SourceMaterial, UMaterialInterface* RetroBaseMaterial, bool& bOutShared)
+{
+	bOutShared = false;
+	if (!MeshComponent || !SourceMaterial || !RetroBaseMaterial)
+	{
+		return nullptr;
+	}
+
+	// Gameplay code re-tints static meshes by reusing whatever MID sits in slot 0, so only slots nothing
+	// writes to after the swap may share: skinned character meshes, and static-mobility world geometry
+	// whose source is a plain material asset rather than a per-actor MID.
+	UMaterialInstanceDynamic* SourceMID = Cast<UMaterialInstanceDynamic>(SourceMaterial);
+	const bool bCanShare = MeshComponent->IsA<USkinnedMeshComponent>()
+		|| (!SourceMID && MeshComponent->Mobility == EComponentMobility::Static);
+	if (!bCanShare)
+	{
+		UMaterialInstanceDynamic* RetroMID = UMaterialInstanceDynamic::Create(RetroBaseMaterial, this);
+		CopyRetroSourceParameters(SourceMaterial, RetroMID);
+		return RetroMID;
+	}
+
+	FSharedRetroMaterialKey Key;
+	Key.RetroBaseMaterial = RetroBaseMaterial;
+	Key.SourceMaterial = SourceMID ? SourceMID->Parent.Get() : SourceMaterial;
+	Key.ParameterHash = SourceMID ? HashRetroSourceParameters(SourceMID) : 0u;
+
+	if (const TWeakObjectPtr<UMaterialInstanceDynamic>* Existing = SharedRetroMaterialsByKey.Find(Key))
+	{
+		if (UMaterialInstanceDynamic* SharedMID = Existing->Get())
 		{
-			FT66RetroManagedMaterialSlot& Slot = ManagedGeometrySlots.AddDefaulted_GetRef();
-			Slot.MeshComponent = MeshComponent;
-			Slot.MaterialIndex = MaterialIndex;
-			Slot.Group = Group;
-			Slot.OriginalMaterial = CurrentMaterial;
-			Slot.RetroMaterial = RetroMID;
+			bOutShared = true;
+			return SharedMID;
 		}
 	}
+
+	UMaterialInstanceDynamic* RetroMID = UMaterialInstanceDynamic::Create(RetroBaseMaterial, this);
+	if (!RetroMID)
+	{
+		return nullptr;
+	}
+
+	CopyRetroSourceParameters(SourceMaterial, RetroMID);
+	SharedRetroMaterials.Add(RetroMID);
+	SharedRetroMaterialsByKey.Add(Key, RetroMID);
+	bOutShared = true;
+	return RetroMID;
 }
 
 void UT66RetroFXSubsystem::RestoreManagedMaterials(bool bRestoreWorldGeometry, bool bRestoreCharacterGeometry)
@@ -961,7 +1052,7 @@ void UT66RetroFXSubsystem::RestoreManagedSlot(int32 SlotIndex)
 		}
 	}
 
-	ManagedGeometrySlots.RemoveAtSwap(SlotIndex);
+	RemoveManagedSlotAt(SlotIndex);
 }
 
 void UT66RetroFXSubsystem::CleanupManagedSlots()
@@ -971,22 +1062,62 @@ void UT66RetroFXSubsystem::CleanupManagedSlots()
 		const FT66RetroManagedMaterialSlot& Slot = ManagedGeometrySlots[Index];
 		if (!Slot.MeshComponent.IsValid() || !Slot.OriginalMaterial || !Slot.RetroMaterial)
 		{
-			ManagedGeometrySlots.RemoveAtSwap(Index);
+			RemoveManagedSlotAt(Index);
 		}
 	}
 }
 
 int32 UT66RetroFXSubsystem::FindManagedSlotIndex(const UMeshComponent* MeshComponent, int32 MaterialIndex) const
 {
-	for (int32 Index = 0; Index < ManagedGeometrySlots.Num(); ++Index)
+	FManagedSlotKey Key;
+	Key.MeshComponent = MeshComponent;
+	Key.MaterialIndex = MaterialIndex;
+	const int32* Index = ManagedSlotIndexByKey.Find(Key);
+	return Index ? *Index : INDEX_NONE;
+}
+
+FT66RetroManagedMaterialSlot& UT66RetroFXSubsystem::AddManagedSlot(UMeshComponent* MeshComponent, int32 MaterialIndex)
+{
+	FManagedSlotKey Key;
+	Key.MeshComponent = MeshComponent;
+	Key.MaterialIndex = MaterialIndex;
+	ManagedSlotIndexByKey.Add(Key, ManagedGeometrySlots.Num());
+
+	FT66RetroManagedMaterialSlot& Slot = ManagedGeometrySlots.AddDefaulted_GetRef();
+	Slot.MeshComponent = MeshComponent;
+	Slot.MeshComponentKey = MeshComponent;
+	Slot.MaterialIndex = MaterialIndex;
+	return Slot;
+}
+
+void UT66RetroFXSubsystem::RemoveManagedSlotAt(int32 SlotIndex)
+{
+	if (!ManagedGeometrySlots.IsValidIndex(SlotIndex))
 	{
-		const FT66RetroManagedMaterialSlot& Slot = ManagedGeometrySlots[Index];
-		if (Slot.MeshComponent.Get() == MeshComponent && Slot.MaterialIndex == MaterialIndex)
-		{
-			return Index;
-		}
+		return;
 	}
-	return INDEX_NONE;
+
+	FManagedSlotKey RemovedKey;
+	RemovedKey.MeshComponent = ManagedGeometrySlots[SlotIndex].MeshComponentKey;
+	RemovedKey.MaterialIndex = ManagedGeometrySlots[SlotIndex].MaterialIndex;
+	ManagedSlotIndexByKey.Remove(RemovedKey);
+
+	const int32 LastIndex = ManagedGeometrySlots.Num() - 1;
+	ManagedGeometrySlots.RemoveAtSwap(SlotIndex, 1, EAllowShrinking::No);
+	if (SlotIndex != LastIndex)
+	{
+		const FT66RetroManagedMaterialSlot& MovedSlot = ManagedGeometrySlots[SlotIndex];
+		FManagedSlotKey MovedKey;
+		MovedKey.MeshComponent = MovedSlot.MeshComponentKey;
+		MovedKey.MaterialIndex = MovedSlot.MaterialIndex;
+		ManagedSlotIndexByKey.Add(MovedKey, SlotIndex);
+	}
+}
+
+void UT66RetroFXSubsystem::ResetManagedSlots()
+{
+	ManagedGeometrySlots.Reset();
+	ManagedSlotIndexByKey.Reset();
 }
 
 void UT66RetroFXSubsystem::UpdateGeometrySpawnBinding(UWorld* World, bool bShouldListen)
@@ -1000,7 +1131,10 @@ void UT66RetroFXSubsystem::UpdateGeometrySpawnBinding(UWorld* World, bool bShoul
 		}
 
 		RestoreManagedMaterials(true, true);
-		ManagedGeometrySlots.Reset();
+		ResetManagedSlots();
+		SharedRetroMaterials.Reset();
+		SharedRetroMaterialsByKey.Reset();
+		ActorClassGeometryEligibility.Reset();
 		ManagedGeometryWorld = nullptr;
 	}
 
@@ -1038,7 +1172,64 @@ void UT66RetroFXSubsystem::HandleActorSpawned(AActor* Actor)
 		return;
 	}
 
-	RefreshActorGeometryMaterials(Actor, bWorldGeometryActive, bCharacterGeometryActive);
+	const TObjectKey<UClass> ClassKey(Actor->GetClass());
+	if (const bool* bCachedEligible = ActorClassGeometryEligibility.Find(ClassKey))
+	{
+		if (*bCachedEligible)
+		{
+			RefreshActorGeometryMaterials(Actor, bWorldGeometryActive, bCharacterGeometryActive);
+		}
+		return;
+	}
+
+	// First spawn of this class: skinned meshes always qualify because character visuals stream in
+	// after spawn. Classes whose meshes have no materials yet stay unclassified until a later spawn.
+	TArray<UMeshComponent*> MeshComponents;
+	Actor->GetComponents<UMeshComponent>(MeshComponents);
+	bool bEligible = false;
+	bool bConclusive = true;
+	for (UMeshComponent* MeshComponent : MeshComponents)
+	{
+		if (MeshComponent->IsA<USkinnedMeshComponent>())
+		{
+			bEligible = true;
+			break;
+		}
+
+		const int32 NumMaterials = MeshComponent->GetNumMaterials();
+		bConclusive &= NumMaterials > 0;
+		for (int32 MaterialIndex = 0; MaterialIndex < NumMaterials && !bEligible; ++MaterialIndex)
+		{
+			ET66RetroGeometryGroup Group = ET66RetroGeometryGroup::World;
+			bEligible = ResolveRetroGeometryMaterial(MeshComponent->GetMaterial(MaterialIndex), Group) != nullptr;
+		}
+		if (bEligible)
+		{
+			break;
+		}
+	}
+
+	if (bEligible || bConclusive)
+	{
+		ActorClassGeometryEligibility.Add(ClassKey, bEligible);
+	}
+	if (bEligible)
+	{
+		RefreshActorGeometryMaterials(Actor, bWorldGeometryActive, bCharacterGeometryActive);
+	}
+}
+
+void UT66RetroFXSubsystem::RefreshMeshComponentGeometry(UMeshComponent* MeshComponent)
+{
+	if (!MeshComponent
+		|| (!bWorldGeometryActive && !bCharacterGeometryActive)
+		|| !ManagedGeometryWorld
+		|| MeshComponent->GetWorld() != ManagedGeometryWorld)
+	{
+		return;
+	}
+
+	RefreshMeshComponentGeometryMaterials(MeshComponent, bWorldGeometryActive, bCharacterGeometryActive);
 }
 
 UMaterialInterface* UT66RetroFXSubsystem::LoadPs1PostProcessMaterial()
@@ -1130,29 +1321,39 @@ UMaterialInterface* UT66RetroFXSubsystem::ResolveRetroGeometryMaterial(UMaterial
 		return nullptr;
 	}
 
+	const UMaterialInterface* BaseMaterial = SourceMaterial->GetBaseMaterial();
+	const TObjectKey<UMaterialInterface> BaseKey(BaseMaterial ? BaseMaterial : SourceMaterial);
+	if (const FResolvedRetroBase* Cached = ResolvedRetroBaseByBaseMaterial.Find(BaseKey))
+	{
+		OutGroup = Cached->Group;
+		return Cached->RetroBaseMaterial.Get();
+	}
+
+	FResolvedRetroBase& Resolved = ResolvedRetroBaseByBaseMaterial.Add(BaseKey);
 	const FString BasePath = GetMaterialBasePath(SourceMaterial);
 	if (BasePath.Equals(CharacterBaseMaterialPath))
 	{
-		OutGroup = ET66RetroGeometryGroup::Character;
-		return LoadCharacterRetroGeometryMaterial();
+		Resolved.Group = ET66RetroGeometryGroup::Character;
+		Resolved.RetroBaseMaterial = LoadCharacterRetroGeometryMaterial();
 	}
-	if (BasePath.Equals(FbxBaseMaterialPath))
+	else if (BasePath.Equals(FbxBaseMaterialPath))
 	{
-		OutGroup = ET66RetroGeometryGroup::Character;
-		return LoadFbxRetroGeometryMaterial();
+		Resolved.Group = ET66RetroGeometryGroup::Character;
+		Resolved.RetroBaseMaterial = LoadFbxRetroGeometryMaterial();
 	}
-	if (BasePath.Equals(EnvironmentBaseMaterialPath))
+	else if (BasePath.Equals(EnvironmentBaseMaterialPath))
 	{
-		OutGroup = ET66RetroGeometryGroup::World;
-		return LoadEnvironmentRetroGeometryMaterial();
+		Resolved.Group = ET66RetroGeometryGroup::World;
+		Resolved.RetroBaseMaterial = LoadEnvironmentRetroGeometryMaterial();
 	}
-	if (BasePath.Equals(GlbBaseMaterialPath))
+	else if (BasePath.Equals(GlbBaseMaterialPath))
 	{
-		OutGroup = ET66RetroGeometryGroup::World;
-		return LoadGlbRetroGeometryMaterial();
+		Resolved.Group = ET66RetroGeometryGroup::World;
+		Resolved.RetroBaseMaterial = LoadGlbRetroGeometryMaterial();
 	}
 
-	return nullptr;
+	OutGroup = Resolved.Group;
+	return Resolved.RetroBaseMaterial.Get();
 }
 
 UMaterialInstanceDynamic* UT66RetroFXSubsystem::GetOrCreateDMI(UMaterialInterface* BaseMaterial, TObjectPtr<UMaterialInstanceDynamic>& CachedDMI)
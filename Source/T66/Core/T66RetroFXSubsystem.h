@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "Subsystems/GameInstanceSubsystem.h"
 #include "Core/T66RetroFXSettings.h"
+#include "UObject/ObjectKey.h"
 #include "T66RetroFXSubsystem.generated.h"
 
 class AActor;
@@ -40,6 +41,13 @@ struct FT66RetroManagedMaterialSlot
 
 	UPROPERTY()
 	ET66RetroGeometryGroup Group = ET66RetroGeometryGroup::World;
+
+	/** True when RetroMaterial is owned by the shared cache rather than this slot. */
+	UPROPERTY()
+	bool bSharedRetroMaterial = false;
+
+	/** Stable registry key; still valid after MeshComponent has been destroyed. */
+	TObjectKey<UMeshComponent> MeshComponentKey;
 };
 
 /**
@@ -62,7 +70,51 @@ public:
 	/** Apply a specific settings snapshot to the target world. */
 	void ApplySettings(const FT66RetroFXSettings& Settings, UWorld* World = nullptr);
 
+	/** Re-evaluate one component whose materials changed after spawn (e.g. a streamed character visual). */
+	void RefreshMeshComponentGeometry(UMeshComponent* MeshComponent);
+
 private:
+	struct FManagedSlotKey
+	{
+		TObjectKey<UMeshComponent> MeshComponent;
+		int32 MaterialIndex = INDEX_NONE;
+
+		bool operator==(const FManagedSlotKey& Other) const
+		{
+			return MeshComponent == Other.MeshComponent && MaterialIndex == Other.MaterialIndex;
+		}
+
+		friend uint32 GetTypeHash(const FManagedSlotKey& Key)
+		{
+			return HashCombine(GetTypeHash(Key.MeshComponent), ::GetTypeHash(Key.MaterialIndex));
+		}
+	};
+
+	struct FSharedRetroMaterialKey
+	{
+		TObjectKey<UMaterialInterface> RetroBaseMaterial;
+		TObjectKey<UMaterialInterface> SourceMaterial;
+		uint32 ParameterHash = 0;
+
+		bool operator==(const FSharedRetroMaterialKey& Other) const
+		{
+			return RetroBaseMaterial == Other.RetroBaseMaterial
+				&& SourceMaterial == Other.SourceMaterial
+				&& ParameterHash == Other.ParameterHash;
+		}
+
+		friend uint32 GetTypeHash(const FSharedRetroMaterialKey& Key)
+		{
+			return HashCombine(HashCombine(GetTypeHash(Key.RetroBaseMaterial), GetTypeHash(Key.SourceMaterial)), Key.ParameterHash);
+		}
+	};
+
+	struct FResolvedRetroBase
+	{
+		TWeakObjectPtr<UMaterialInterface> RetroBaseMaterial;
+		ET66RetroGeometryGroup Group = ET66RetroGeometryGroup::World;
+	};
+
 	void EnsureBlendablesInWorld(UWorld* World);
 	void EnsurePs1PostProcessDMI(const FT66RetroFXSettings& Settings);
 	void ApplyBlendableWeights(const FT66RetroFXSettings& Settings);
@@ -80,6 +132,10 @@ private:
 	void RestoreManagedSlot(int32 SlotIndex);
 	void CleanupManagedSlots();
 	int32 FindManagedSlotIndex(const UMeshComponent* MeshComponent, int32 MaterialIndex) const;
+	FT66RetroManagedMaterialSlot& AddManagedSlot(UMeshComponent* MeshComponent, int32 MaterialIndex);
+	void RemoveManagedSlotAt(int32 SlotIndex);
+	void ResetManagedSlots();
+	UMaterialInstanceDynamic* AcquireRetroMaterial(UMeshComponent* MeshComponent, UMaterialInterface* SourceMaterial, UMaterialInterface* RetroBaseMaterial, bool& bOutShared);
 	void UpdateGeometrySpawnBinding(UWorld* World, bool bShouldListen);
 	void HandleActorSpawned(AActor* Actor);
 
@@ -147,6 +203,15 @@ private:
 	UPROPERTY()
 	TArray<FT66RetroManagedMaterialSlot> ManagedGeometrySlots;
 
+	/** Keeps shared retro MIDs alive; SharedRetroMaterialsByKey only indexes into this set. */
+	UPROPERTY()
+	TArray<TObjectPtr<UMaterialInstanceDynamic>> SharedRetroMaterials;
+
+	TMap<FManagedSlotKey, int32> ManagedSlotIndexByKey;
+	TMap<FSharedRetroMaterialKey, TWeakObjectPtr<UMaterialInstanceDynamic>> SharedRetroMaterialsByKey;
+	TMap<TObjectKey<UMaterialInterface>, FResolvedRetroBase> ResolvedRetroBaseByBaseMaterial;
+	TMap<TObjectKey<UClass>, bool> ActorClassGeometryEligibility;
+
 	FDelegateHandle GeometrySpawnHandle;
 	bool bWorldGeometryActive = false;
 	bool bCharacterGeometryActive = false;
@@ -2,6 +2,7 @@
 
 #include "Core/T66RunIntegritySubsystem.h"
 
+#include "Async/Async.h"
 #include "Core/T66SteamHelper.h"
 #include "HAL/FileManager.h"
 #include "HAL/PlatformProcess.h"
@@ -26,7 +27,7 @@ namespace
 		return BuildVersion;
 	}
 
-	void T66AppendSuspiciousPathReasons(const TArray<FString>& CandidateRoots, FT66RunIntegrityContext& Context)
+	void T66AppendSuspiciousPathReasons(const TArray<FString>& CandidateRoots, TArray<FString>& OutReasons)
 	{
 		IFileManager& FileManager = IFileManager::Get();
 		static const TCHAR* SuspiciousDirectories[] =
@@ -54,7 +55,7 @@ namespace
 				const FString SuspiciousDir = FPaths::ConvertRelativePathToFull(FPaths::Combine(Root, DirName));
 				if (FileManager.DirectoryExists(*SuspiciousDir))
 				{
-					Context.PromoteToVerdict(TEXT("modded"), FString::Printf(TEXT("suspicious_dir:%s"), DirName));
+					OutReasons.AddUnique(FString::Printf(TEXT("suspicious_dir:%s"), DirName));
 				}
 			}
 
@@ -63,17 +64,85 @@ namespace
 				const FString SuspiciousFile = FPaths::ConvertRelativePathToFull(FPaths::Combine(Root, FileName));
 				if (FileManager.FileExists(*SuspiciousFile))
 				{
-					Context.PromoteToVerdict(TEXT("modded"), FString::Printf(TEXT("suspicious_file:%s"), FileName));
+					OutReasons.AddUnique(FString::Printf(TEXT("suspicious_file:%s"), FileName));
 				}
 			}
 		}
 	}
+
+	bool T66HasAnyExtension(const FString& Path, std::initializer_list<const TCHAR*> Extensions)
+	{
+		const FString Extension = FPaths::GetExtension(Path);
+		for (const TCHAR* Candidate : Extensions)
+		{
+			if (Extension.Equals(Candidate, ESearchCase::IgnoreCase))
+			{
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	bool T66StatPath(const FString& Path, FT66RunEnvironmentManifest::FPathStamp& OutStamp)
+	{
+		const FFileStatData StatData = IFileManager::Get().GetStatData(*Path);
+		if (!StatData.bIsValid)
+		{
+			return false;
+		}
+
+		OutStamp.Path = Path;
+		OutStamp.Size = StatData.bIsDirectory ? 0 : StatData.FileSize;
+		OutStamp.UnixTimestamp = StatData.ModificationTime.ToUnixTimestamp();
+		return true;
+	}
+
+	/** Hashes the sorted entries exactly like joining them with newlines, without building the joined string. */
+	FString T66HashSortedEntries(TArray<FString>& Entries)
+	{
+		Entries.Sort();
+
+		FMD5 Md5;
+		for (int32 Index = 0; Index < Entries.Num(); ++Index)
+		{
+			if (Index > 0)
+			{
+				Md5.Update(reinterpret_cast<const uint8*>("\n"), 1);
+			}
+
+			const auto AnsiEntry = StringCast<ANSICHAR>(*Entries[Index]);
+			Md5.Update(reinterpret_cast<const uint8*>(AnsiEntry.Get()), AnsiEntry.Length());
+		}
+
+		uint8 Digest[16];
+		Md5.Final(Digest);
+		return BytesToHex(Digest, UE_ARRAY_COUNT(Digest)).ToLower();
+	}
 }
 
 void UT66RunIntegritySubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
 	Super::Initialize(Collection);
 	ResetActiveRunContext();
+
+	// Crawl the install once at boot on a worker so the first run start only has to pick up the result.
+	EnvironmentRoots = GatherEnvironmentRoots();
+	PendingEnvironmentManifest = Async(EAsyncExecution::ThreadPool, [Roots = EnvironmentRoots]()
+	{
+		return BuildEnvironmentManifest(Roots);
+	});
+}
+
+void UT66RunIntegritySubsystem::Deinitialize()
+{
+	if (PendingEnvironmentManifest.IsValid())
+	{
+		PendingEnvironmentManifest.Wait();
+		PendingEnvironmentManifest.Reset();
+	}
+
+	Super::Deinitialize();
 }
 
 void UT66RunIntegritySubsystem::ResetActiveRunContext()
@@ -187,13 +256,6 @@ void UT66RunIntegritySubsystem::CopyCurrentContextTo(FT66RunIntegrityContext& Ou
 
 void UT66RunIntegritySubsystem::MergeCurrentEnvironmentInto(FT66RunIntegrityContext& Context) const
 {
-	const FString BaseDir = FPaths::ConvertRelativePathToFull(FPlatformProcess::BaseDir());
-	const FString ProjectDir = FPaths::ConvertRelativePathToFull(FPaths::ProjectDir());
-	const FString ExecutablePath = FPaths::ConvertRelativePathToFull(FPlatformProcess::ExecutablePath());
-	const FString PaksDir = FPaths::ConvertRelativePathToFull(FPaths::Combine(ProjectDir, TEXT("Content"), TEXT("Paks")));
-	const FString PluginsDir = FPaths::ConvertRelativePathToFull(FPaths::Combine(ProjectDir, TEXT("Plugins")));
-	const FString BinariesDir = FPaths::ConvertRelativePathToFull(FPaths::Combine(ProjectDir, TEXT("Binaries")));
-
 	if (const UGameInstance* GI = GetGameInstance())
 	{
 		if (const UT66SteamHelper* SteamHelper = GI->GetSubsystem<UT66SteamHelper>())
@@ -210,41 +272,174 @@ void UT66RunIntegritySubsystem::MergeCurrentEnvironmentInto(FT66RunIntegrityCont
 		Context.ManifestId = FString::Printf(TEXT("steam_build_%d"), Context.SteamBuildId);
 	}
 
-	TArray<FString> ManifestEntries;
-	AppendFileStamp(ExecutablePath, ManifestEntries);
-	AppendDirectoryFileStamps(BaseDir, { TEXT("*.exe"), TEXT("*.dll") }, ManifestEntries);
-	AppendDirectoryFileStamps(BinariesDir, { TEXT("*.exe"), TEXT("*.dll") }, ManifestEntries);
-	AppendDirectoryFileStamps(PaksDir, { TEXT("*.pak"), TEXT("*.utoc"), TEXT("*.ucas") }, ManifestEntries);
-	Context.ManifestRootHash = ComputeStableHash(ManifestEntries);
-
-	TArray<FString> ModuleEntries;
-	AppendDirectoryFileStamps(BaseDir, { TEXT("*.dll"), TEXT("*.exe") }, ModuleEntries);
-	AppendDirectoryFileStamps(BinariesDir, { TEXT("*.dll"), TEXT("*.exe") }, ModuleEntries);
-	Context.ModuleListHash = ComputeStableHash(ModuleEntries);
-
-	TArray<FString> MountedEntries;
-	AppendDirectoryFileStamps(PaksDir, { TEXT("*.pak"), TEXT("*.utoc"), TEXT("*.ucas") }, MountedEntries);
-	AppendDirectoryFileStamps(PluginsDir, { TEXT("*.uplugin"), TEXT("*.pak"), TEXT("*.utoc"), TEXT("*.ucas") }, MountedEntries);
+	const FT66RunEnvironmentManifest& Manifest = ResolveEnvironmentManifest();
+	Context.ManifestRootHash = Manifest.ManifestRootHash;
+	Context.ModuleListHash = Manifest.ModuleListHash;
+	Context.MountedContentHash = Manifest.MountedContentHash;
+	for (const FString& Reason : Manifest.SuspiciousReasons)
+	{
+		Context.PromoteToVerdict(TEXT("modded"), Reason);
+	}
+
+	Context.MarkPristineIfUnset();
+}
+
+const FT66RunEnvironmentManifest& UT66RunIntegritySubsystem::ResolveEnvironmentManifest() const
+{
+	if (PendingEnvironmentManifest.IsValid())
+	{
+		// Only blocks when a run starts before the boot scan has finished.
+		EnvironmentManifest = PendingEnvironmentManifest.Get();
+		PendingEnvironmentManifest.Reset();
+	}
+
+	if (!EnvironmentManifest.bValid)
+	{
+		EnvironmentManifest = BuildEnvironmentManifest(EnvironmentRoots);
+		return EnvironmentManifest;
+	}
+
+	// Re-stat the cached manifest on every use so run start and finalize see the disk as it is now.
+	// This only falls back to a full walk when something under the roots actually changed.
+	EnvironmentManifest = RevalidateEnvironmentManifest(EnvironmentRoots, MoveTemp(EnvironmentManifest));
+	return EnvironmentManifest;
+}
+
+FT66RunEnvironmentRoots UT66RunIntegritySubsystem::GatherEnvironmentRoots()
+{
+	FT66RunEnvironmentRoots Roots;
+	Roots.BaseDir = FPaths::ConvertRelativePathToFull(FPlatformProcess::BaseDir());
+	const FString ProjectDir = FPaths::ConvertRelativePathToFull(FPaths::ProjectDir());
+	Roots.ExecutablePath = FPaths::ConvertRelativePathToFull(FPlatformProcess::ExecutablePath());
+	Roots.PaksDir = FPaths::ConvertRelativePathToFull(FPaths::Combine(ProjectDir, TEXT("Content"), TEXT("Paks")));
+	Roots.PluginsDir = FPaths::ConvertRelativePathToFull(FPaths::Combine(ProjectDir, TEXT("Plugins")));
+	Roots.BinariesDir = FPaths::ConvertRelativePathToFull(FPaths::Combine(ProjectDir, TEXT("Binaries")));
+	Roots.SuspiciousRoots =
+	{
+		Roots.BaseDir,
+		ProjectDir,
+		FPaths::ConvertRelativePathToFull(FPaths::Combine(Roots.BaseDir, TEXT(".."))),
+		FPaths::ConvertRelativePathToFull(FPaths::Combine(Roots.BaseDir, TEXT(".."), TEXT("..")))
+	};
+
+	// The plugin list is fixed for the life of the process and IPluginManager is not safe to walk off the game thread.
 	for (const TSharedRef<IPlugin>& Plugin : IPluginManager::Get().GetEnabledPlugins())
 	{
-		MountedEntries.Add(FString::Printf(
+		Roots.PluginEntries.Add(FString::Printf(
 			TEXT("plugin|%s|%s|%s"),
 			*Plugin->GetName(),
 			*NormalizeForHash(Plugin->GetBaseDir()),
 			Plugin->IsEnabled() ? TEXT("enabled") : TEXT("disabled")));
 	}
-	Context.MountedContentHash = ComputeStableHash(MountedEntries);
 
-	T66AppendSuspiciousPathReasons(
+	return Roots;
+}
+
+FT66RunEnvironmentManifest UT66RunIntegritySubsystem::BuildEnvironmentManifest(const FT66RunEnvironmentRoots& Roots)
+{
+	FT66RunEnvironmentManifest Manifest;
+	IFileManager& FileManager = IFileManager::Get();
+	TSet<FString> SeenFiles;
+
+	// One stat walk per root; each file is classified by extension instead of re-walking the tree per pattern.
+	const auto WalkRoot = [&](const FString& Directory, std::initializer_list<const TCHAR*> Extensions, TArray<FString>& OutEntries)
+	{
+		FT66RunEnvironmentManifest::FPathStamp RootStamp;
+		if (!T66StatPath(Directory, RootStamp))
 		{
-			BaseDir,
-			ProjectDir,
-			FPaths::ConvertRelativePathToFull(FPaths::Combine(BaseDir, TEXT(".."))),
-			FPaths::ConvertRelativePathToFull(FPaths::Combine(BaseDir, TEXT(".."), TEXT("..")))
-		},
-		Context);
+			return;
+		}
 
-	Context.MarkPristineIfUnset();
+		Manifest.Directories.Add(MoveTemp(RootStamp));
+		FileManager.IterateDirectoryStatRecursively(*Directory, [&](const TCHAR* Path, const FFileStatData& StatData)
+		{
+			FT66RunEnvironmentManifest::FPathStamp Stamp;
+			Stamp.Path = Path;
+			Stamp.UnixTimestamp = StatData.ModificationTime.ToUnixTimestamp();
+			if (StatData.bIsDirectory)
+			{
+				Manifest.Directories.Add(MoveTemp(Stamp));
+				return true;
+			}
+
+			if (!T66HasAnyExtension(Stamp.Path, Extensions))
+			{
+				return true;
+			}
+
+			Stamp.Size = StatData.FileSize;
+			OutEntries.Add(FormatFileStamp(Stamp));
+			bool bAlreadySeen = false;
+			SeenFiles.Add(Stamp.Path, &bAlreadySeen);
+			if (!bAlreadySeen)
+			{
+				Manifest.Files.Add(MoveTemp(Stamp));
+			}
+			return true;
+		});
+	};
+
+	TArray<FString> BaseEntries;
+	TArray<FString> BinariesEntries;
+	TArray<FString> PakEntries;
+	TArray<FString> PluginFileEntries;
+	WalkRoot(Roots.BaseDir, { TEXT("exe"), TEXT("dll") }, BaseEntries);
+	WalkRoot(Roots.BinariesDir, { TEXT("exe"), TEXT("dll") }, BinariesEntries);
+	WalkRoot(Roots.PaksDir, { TEXT("pak"), TEXT("utoc"), TEXT("ucas") }, PakEntries);
+	WalkRoot(Roots.PluginsDir, { TEXT("uplugin"), TEXT("pak"), TEXT("utoc"), TEXT("ucas") }, PluginFileEntries);
+
+	TArray<FString> ManifestEntries;
+	FT66RunEnvironmentManifest::FPathStamp ExecutableStamp;
+	if (T66StatPath(Roots.ExecutablePath, ExecutableStamp) && FileManager.FileExists(*Roots.ExecutablePath))
+	{
+		ManifestEntries.Add(FormatFileStamp(ExecutableStamp));
+		Manifest.Files.Add(MoveTemp(ExecutableStamp));
+	}
+	ManifestEntries.Append(BaseEntries);
+	ManifestEntries.Append(BinariesEntries);
+	ManifestEntries.Append(PakEntries);
+	Manifest.ManifestRootHash = T66HashSortedEntries(ManifestEntries);
+
+	TArray<FString> ModuleEntries = MoveTemp(BaseEntries);
+	ModuleEntries.Append(BinariesEntries);
+	Manifest.ModuleListHash = T66HashSortedEntries(ModuleEntries);
+
+	TArray<FString> MountedEntries = MoveTemp(PakEntries);
+	MountedEntries.Append(PluginFileEntries);
+	MountedEntries.Append(Roots.PluginEntries);
+	Manifest.MountedContentHash = T66HashSortedEntries(MountedEntries);
+
+	T66AppendSuspiciousPathReasons(Roots.SuspiciousRoots, Manifest.SuspiciousReasons);
+	Manifest.bValid = true;
+	return Manifest;
+}
+
+FT66RunEnvironmentManifest UT66RunIntegritySubsystem::RevalidateEnvironmentManifest(const FT66RunEnvironmentRoots& Roots, FT66RunEnvironmentManifest Previous)
+{
+	// A directory's timestamp moves when entries are added, removed or renamed, so an unchanged set of
+	// directory and file stamps means a full walk would produce the same hashes.
+	const auto IsUnchanged = [](const TArray<FT66RunEnvironmentManifest::FPathStamp>& Stamps)
+	{
+		FT66RunEnvironmentManifest::FPathStamp Current;
+		for (const FT66RunEnvironmentManifest::FPathStamp& Stamp : Stamps)
+		{
+			if (!T66StatPath(Stamp.Path, Current) || Current.Size != Stamp.Size || Current.UnixTimestamp != Stamp.UnixTimestamp)
+			{
+				return false;
+			}
+		}
+
+		return true;
+	};
+
+	if (Previous.bValid && IsUnchanged(Previous.Directories) && IsUnchanged(Previous.Files))
+	{
+		Previous.SuspiciousReasons.Reset();
+		T66AppendSuspiciousPathReasons(Roots.SuspiciousRoots, Previous.SuspiciousReasons);
+		return Previous;
+	}
+
+	return BuildEnvironmentManifest(Roots);
 }
 
 FString UT66RunIntegritySubsystem::ComputeStableHash(const TArray<FString>& Parts)
@@ -276,36 +471,9 @@ FString UT66RunIntegritySubsystem::ComputeCombinedHash(
 		});
 }
 
-void UT66RunIntegritySubsystem::AppendDirectoryFileStamps(const FString& Directory, const TArray<FString>& Patterns, TArray<FString>& OutEntries)
-{
-	IFileManager& FileManager = IFileManager::Get();
-	if (!FileManager.DirectoryExists(*Directory))
-	{
-		return;
-	}
-
-	for (const FString& Pattern : Patterns)
-	{
-		TArray<FString> Files;
-		FileManager.FindFilesRecursive(Files, *Directory, *Pattern, true, false, true);
-		for (const FString& FilePath : Files)
-		{
-			AppendFileStamp(FilePath, OutEntries);
-		}
-	}
-}
-
-void UT66RunIntegritySubsystem::AppendFileStamp(const FString& FilePath, TArray<FString>& OutEntries)
+FString UT66RunIntegritySubsystem::FormatFileStamp(const FT66RunEnvironmentManifest::FPathStamp& Stamp)
 {
-	IFileManager& FileManager = IFileManager::Get();
-	if (!FileManager.FileExists(*FilePath))
-	{
-		return;
-	}
-
-	const int64 Size = FileManager.FileSize(*FilePath);
-	const FDateTime Timestamp = FileManager.GetTimeStamp(*FilePath);
-	OutEntries.Add(FString::Printf(TEXT("%s|%lld|%lld"), *NormalizeForHash(FilePath), Size, Timestamp.ToUnixTimestamp()));
+	return FString::Printf(TEXT("%s|%lld|%lld"), *NormalizeForHash(Stamp.Path), Stamp.Size, Stamp.UnixTimestamp);
 }
 
 FString UT66RunIntegritySubsystem::NormalizeForHash(const FString& Path)
@@ -5,8 +5,41 @@
 #include "CoreMinimal.h"
 #include "Subsystems/GameInstanceSubsystem.h"
 #include "Core/T66RunIntegrityTypes.h"
+#include "Async/Future.h"
 #include "T66RunIntegritySubsystem.generated.h"
 
+/** Directories and game-thread-only inputs that feed the environment manifest. */
+struct FT66RunEnvironmentRoots
+{
+	FString ExecutablePath;
+	FString BaseDir;
+	FString BinariesDir;
+	FString PaksDir;
+	FString PluginsDir;
+	TArray<FString> SuspiciousRoots;
+	TArray<FString> PluginEntries;
+};
+
+/** Stat-level snapshot of the shipped files behind the integrity hashes, built on a worker thread. */
+struct FT66RunEnvironmentManifest
+{
+	struct FPathStamp
+	{
+		FString Path;
+		int64 Size = 0;
+		int64 UnixTimestamp = 0;
+	};
+
+	/** Every hashed file and every walked directory, so a refresh can stat them instead of crawling again. */
+	TArray<FPathStamp> Files;
+	TArray<FPathStamp> Directories;
+	TArray<FString> SuspiciousReasons;
+	FString ManifestRootHash;
+	FString ModuleListHash;
+	FString MountedContentHash;
+	bool bValid = false;
+};
+
 UCLASS()
 class T66_API UT66RunIntegritySubsystem : public UGameInstanceSubsystem
 {
@@ -14,6 +47,7 @@ class T66_API UT66RunIntegritySubsystem : public UGameInstanceSubsystem
 
 public:
 	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
 
 	void ResetActiveRunContext();
 	void CaptureFreshRunBaseline();
@@ -28,12 +62,20 @@ public:
 
 private:
 	void MergeCurrentEnvironmentInto(FT66RunIntegrityContext& Context) const;
+	const FT66RunEnvironmentManifest& ResolveEnvironmentManifest() const;
+	static FT66RunEnvironmentRoots GatherEnvironmentRoots();
+	static FT66RunEnvironmentManifest BuildEnvironmentManifest(const FT66RunEnvironmentRoots& Roots);
+	static FT66RunEnvironmentManifest RevalidateEnvironmentManifest(const FT66RunEnvironmentRoots& Roots, FT66RunEnvironmentManifest Previous);
 	static FString ComputeStableHash(const TArray<FString>& Parts);
 	static FString ComputeCombinedHash(const FString& SteamAppId, int32 SteamBuildId, const FString& SteamBetaName, const FString& ManifestId, const FString& ManifestRootHash, const FString& ModuleListHash, const FString& MountedContentHash);
-	static void AppendDirectoryFileStamps(const FString& Directory, const TArray<FString>& Patterns, TArray<FString>& OutEntries);
-	static void AppendFileStamp(const FString& FilePath, TArray<FString>& OutEntries);
+	static FString FormatFileStamp(const FT66RunEnvironmentManifest::FPathStamp& Stamp);
 	static FString NormalizeForHash(const FString& Path);
 	static void AddUniqueReason(FT66RunIntegrityContext& Context, const FString& Reason);
 
 	FT66RunIntegrityContext ActiveContext;
+
+	/** Manifest cache: filled by the boot scan, then revalidated by stat on each run start and finalize. */
+	FT66RunEnvironmentRoots EnvironmentRoots;
+	mutable FT66RunEnvironmentManifest EnvironmentManifest;
+	mutable TFuture<FT66RunEnvironmentManifest> PendingEnvironmentManifest;
 };
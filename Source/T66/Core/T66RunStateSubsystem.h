@@ -1221,8 +1221,8 @@ public:
 
 	ET66PassiveType GetPassiveType() const { return PassiveType; }
 
-	/** Call when an enemy is killed by hero damage (for Rallying Blow / ChaosTheory). */
-	void NotifyEnemyKilledByHero();
+	/** Call when enemies are killed by hero damage (for Rallying Blow / ChaosTheory). */
+	void NotifyEnemyKilledByHero(int32 KillCount = 1);
 
 	/** Rallying Blow: multiplier for attack speed (1.0 + 0.15 * stacks, max 3 stacks, 3s duration). */
 	float GetRallyAttackSpeedMultiplier() const;
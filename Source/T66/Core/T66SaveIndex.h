@@ -3,9 +3,32 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Data/T66DataTypes.h"
 #include "GameFramework/SaveGame.h"
 #include "T66SaveIndex.generated.h"
 
+/** One party member as shown on a save slot card (used in index only) */
+USTRUCT(BlueprintType)
+struct T66_API FT66SaveSlotPartyMemberMeta
+{
+	GENERATED_BODY()
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Save")
+	FString PlayerId;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Save")
+	FString DisplayName;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Save")
+	FName HeroID = NAME_None;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Save")
+	ET66BodyType HeroBodyType = ET66BodyType::TypeA;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Save")
+	bool bIsPartyHost = false;
+};
+
 /** Metadata for one save slot (used in index only) */
 USTRUCT(BlueprintType)
 struct T66_API FT66SaveSlotMeta
@@ -23,11 +46,42 @@ struct T66_API FT66SaveSlotMeta
 
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Save")
 	FString MapName;
+
+	/** Entries older than UT66SaveIndex::CurrentMetaVersion are refilled from the slot file once. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Save")
+	int32 MetaVersion = 0;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Save")
+	ET66Difficulty Difficulty = ET66Difficulty::Easy;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Save")
+	ET66PartySize PartySize = ET66PartySize::Solo;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Save")
+	int32 StageReached = 1;
+
+	/** Host first; mirrors UT66RunSaveGame::SavedPartyPlayers. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Save")
+	TArray<FT66SaveSlotPartyMemberMeta> PartyMembers;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Save")
+	bool bIsDailyClimbRun = false;
+
+	/** Empty unless the run carries a valid daily climb challenge. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Save")
+	FString DailyClimbChallengeId;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Save")
+	bool bDailyClimbAttemptCompleted = false;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Save")
+	bool bHasValidRunSnapshot = false;
 };
 
 /**
  * Index of all save slots (metadata only).
  * Stored as T66_SaveIndex. Slot files: T66_Slot_00 .. T66_Slot_08.
+ * Carries everything the save-slot and daily climb screens display or filter on, so browsing never loads a run.
  */
 UCLASS(BlueprintType)
 class T66_API UT66SaveIndex : public USaveGame
@@ -36,6 +90,7 @@ class T66_API UT66SaveIndex : public USaveGame
 
 public:
 	static constexpr int32 MaxSlots = 9;
+	static constexpr int32 CurrentMetaVersion = 1;
 
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Save")
 	TArray<FT66SaveSlotMeta> SlotMeta;
@@ -110,7 +110,7 @@ bool UT66SaveSubsystem::SaveToSlot(int32 SlotIndex, UT66RunSaveGame* SaveGameObj
 		}));
 
 	// Update the index in memory immediately (metadata is tiny; write async too).
-	UpdateIndexOnSave(SlotIndex, SaveGameObject->HeroID.ToString(), SaveGameObject->MapName, SaveGameObject->LastPlayedUtc);
+	UpdateIndexOnSave(SlotIndex, *SaveGameObject);
 	return true;
 }
 
@@ -190,10 +190,49 @@ UT66RunSaveGame* UT66SaveSubsystem::LoadFromSlot(int32 SlotIndex)
 	return RunSave;
 }
 
-void UT66SaveSubsystem::UpdateIndexOnSave(int32 SlotIndex, const FString& HeroDisplayName, const FString& MapName, const FString& LastPlayedUtc)
+void UT66SaveSubsystem::FillSlotMeta(FT66SaveSlotMeta& Meta, const UT66RunSaveGame& SaveGameObject)
+{
+	Meta.bOccupied = true;
+	Meta.LastPlayedUtc = SaveGameObject.LastPlayedUtc;
+	Meta.HeroDisplayName = SaveGameObject.HeroID.ToString();
+	Meta.MapName = SaveGameObject.MapName;
+	Meta.MetaVersion = UT66SaveIndex::CurrentMetaVersion;
+	Meta.Difficulty = SaveGameObject.Difficulty;
+	Meta.PartySize = SaveGameObject.PartySize;
+	Meta.StageReached = SaveGameObject.StageReached;
+
+	Meta.PartyMembers.Reset();
+	for (const FT66SavedPartyPlayerState& SavedPlayer : SaveGameObject.SavedPartyPlayers)
+	{
+		FT66SaveSlotPartyMemberMeta& Member = Meta.PartyMembers.AddDefaulted_GetRef();
+		Member.PlayerId = SavedPlayer.PlayerId;
+		Member.DisplayName = SavedPlayer.DisplayName;
+		Member.HeroID = SavedPlayer.HeroID;
+		Member.HeroBodyType = SavedPlayer.HeroBodyType;
+		Member.bIsPartyHost = SavedPlayer.bIsPartyHost;
+	}
+	if (Meta.PartyMembers.Num() == 0)
+	{
+		// Same legacy host fallback LoadFromSlot applies.
+		FT66SaveSlotPartyMemberMeta& Host = Meta.PartyMembers.AddDefaulted_GetRef();
+		Host.PlayerId = SaveGameObject.OwnerPlayerId;
+		Host.DisplayName = SaveGameObject.OwnerDisplayName;
+		Host.HeroID = SaveGameObject.HeroID;
+		Host.HeroBodyType = SaveGameObject.HeroBodyType;
+		Host.bIsPartyHost = true;
+	}
+
+	const bool bHasChallenge = SaveGameObject.bIsDailyClimbRun && SaveGameObject.DailyClimbChallenge.IsValid();
+	Meta.bIsDailyClimbRun = SaveGameObject.bIsDailyClimbRun;
+	Meta.DailyClimbChallengeId = bHasChallenge ? SaveGameObject.DailyClimbChallenge.ChallengeId : FString();
+	Meta.bDailyClimbAttemptCompleted = bHasChallenge && SaveGameObject.DailyClimbChallenge.HasCompletedAttempt();
+	Meta.bHasValidRunSnapshot = SaveGameObject.RunSnapshot.bValid;
+}
+
+void UT66SaveSubsystem::UpdateIndexOnSave(int32 SlotIndex, const UT66RunSaveGame& SaveGameObject)
 {
 	UT66SaveIndex* Index = LoadOrCreateIndex();
-	if (!Index) return;
+	if (!Index || SlotIndex < 0 || SlotIndex >= MaxSlots) return;
 
 	while (Index->SlotMeta.Num() <= SlotIndex)
 	{
@@ -201,15 +240,35 @@ void UT66SaveSubsystem::UpdateIndexOnSave(int32 SlotIndex, const FString& HeroDi
 		Index->SlotMeta.Add(Meta);
 	}
 
-	Index->SlotMeta[SlotIndex].bOccupied = true;
-	Index->SlotMeta[SlotIndex].LastPlayedUtc = LastPlayedUtc;
-	Index->SlotMeta[SlotIndex].HeroDisplayName = HeroDisplayName;
-	Index->SlotMeta[SlotIndex].MapName = MapName;
+	FillSlotMeta(Index->SlotMeta[SlotIndex], SaveGameObject);
 
 	// Async index save (metadata is small, no need to block the game thread).
 	SaveIndex(Index);
 }
 
+const FT66SaveSlotMeta* UT66SaveSubsystem::GetOccupiedSlotMeta(int32 SlotIndex)
+{
+	if (SlotIndex < 0 || SlotIndex >= MaxSlots) return nullptr;
+
+	UT66SaveIndex* Index = LoadOrCreateIndex();
+	if (!Index || Index->SlotMeta.Num() <= SlotIndex || !Index->SlotMeta[SlotIndex].bOccupied) return nullptr;
+	if (!UGameplayStatics::DoesSaveGameExist(GetSlotName(SlotIndex), 0)) return nullptr;
+
+	FT66SaveSlotMeta& Meta = Index->SlotMeta[SlotIndex];
+	if (Meta.MetaVersion < UT66SaveIndex::CurrentMetaVersion)
+	{
+		// Index written by an older build: read the run once and keep the refreshed entry.
+		const UT66RunSaveGame* Loaded = LoadFromSlot(SlotIndex);
+		if (!Loaded) return nullptr;
+
+		UE_LOG(LogT66Save, Log, TEXT("SaveIndex: backfilled slot %d metadata from v%d"), SlotIndex, Meta.MetaVersion);
+		FillSlotMeta(Meta, *Loaded);
+		SaveIndex(Index);
+	}
+
+	return &Meta;
+}
+
 bool UT66SaveSubsystem::GetSlotMeta(int32 SlotIndex, bool& bOutOccupied, FString& OutLastPlayedUtc, FString& OutHeroDisplayName, FString& OutMapName) const
 {
 	bOutOccupied = false;
@@ -35,13 +35,20 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Save")
 	UT66RunSaveGame* LoadFromSlot(int32 SlotIndex);
 
-	void UpdateIndexOnSave(int32 SlotIndex, const FString& HeroDisplayName, const FString& MapName, const FString& LastPlayedUtc);
+	void UpdateIndexOnSave(int32 SlotIndex, const UT66RunSaveGame& SaveGameObject);
+
+	/**
+	 * Index metadata for an occupied slot, or null when the slot is empty. Never deserializes the run
+	 * except once for entries written before the current metadata version.
+	 */
+	const FT66SaveSlotMeta* GetOccupiedSlotMeta(int32 SlotIndex);
 
 	UFUNCTION(BlueprintCallable, Category = "Save")
 	bool GetSlotMeta(int32 SlotIndex, bool& bOutOccupied, FString& OutLastPlayedUtc, FString& OutHeroDisplayName, FString& OutMapName) const;
 
 private:
 	FString GetSlotName(int32 SlotIndex) const;
+	static void FillSlotMeta(FT66SaveSlotMeta& Meta, const UT66RunSaveGame& SaveGameObject);
 	UT66SaveIndex* LoadOrCreateIndex();
 	UT66SaveIndex* LoadOrCreateIndex() const;
 	bool SaveIndex(UT66SaveIndex* Index) const;
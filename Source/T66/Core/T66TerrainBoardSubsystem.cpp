@@ -0,0 +1,170 @@
+// Copyright Tribulation 66. All Rights Reserved.
+
+#include "Core/T66TerrainBoardSubsystem.h"
+
+#include "Async/Async.h"
+#include "Engine/World.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogT66TerrainBoards, Log, All);
+
+UT66TerrainBoardSubsystem* UT66TerrainBoardSubsystem::Get(const UWorld* World)
+{
+	return World ? World->GetSubsystem<UT66TerrainBoardSubsystem>() : nullptr;
+}
+
+UT66TerrainBoardSubsystem::FBoardHandle UT66TerrainBoardSubsystem::ResolveBoard(const UWorld* World, const FT66MapPreset& Preset)
+{
+	if (UT66TerrainBoardSubsystem* TerrainBoards = Get(World))
+	{
+		return TerrainBoards->GetBoard(Preset);
+	}
+
+	return GenerateBoard(Preset);
+}
+
+UT66TerrainBoardSubsystem::FLayoutHandle UT66TerrainBoardSubsystem::ResolveTowerLayout(const UWorld* World, const FT66MapPreset& Preset, const bool bBossRushFinaleStage)
+{
+	if (UT66TerrainBoardSubsystem* TerrainBoards = Get(World))
+	{
+		return TerrainBoards->GetTowerLayout(Preset, bBossRushFinaleStage);
+	}
+
+	return GenerateTowerLayout(Preset, bBossRushFinaleStage);
+}
+
+void UT66TerrainBoardSubsystem::Deinitialize()
+{
+	// Workers only touch their own copies of the preset, but joining keeps shutdown deterministic.
+	for (FBoardEntry& Entry : Boards)
+	{
+		if (Entry.Pending.IsValid())
+		{
+			Entry.Pending.Wait();
+		}
+	}
+	for (FLayoutEntry& Entry : TowerLayouts)
+	{
+		if (Entry.Pending.IsValid())
+		{
+			Entry.Pending.Wait();
+		}
+	}
+
+	Boards.Reset();
+	TowerLayouts.Reset();
+	ActiveTowerLayout.Reset();
+	Super::Deinitialize();
+}
+
+bool UT66TerrainBoardSubsystem::DoesSupportWorldType(EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UT66TerrainBoardSubsystem::PrefetchBoard(const FT66MapPreset& Preset)
+{
+	FindOrStartBoard(Preset);
+}
+
+void UT66TerrainBoardSubsystem::PrefetchTowerLayout(const FT66MapPreset& Preset, const bool bBossRushFinaleStage)
+{
+	FindOrStartTowerLayout(Preset, bBossRushFinaleStage);
+}
+
+UT66TerrainBoardSubsystem::FBoardHandle UT66TerrainBoardSubsystem::GetBoard(const FT66MapPreset& Preset)
+{
+	FBoardEntry& Entry = FindOrStartBoard(Preset);
+	if (Entry.Pending.IsValid())
+	{
+		Entry.Board = Entry.Pending.Get();
+		Entry.Pending.Reset();
+	}
+
+	return Entry.Board;
+}
+
+UT66TerrainBoardSubsystem::FLayoutHandle UT66TerrainBoardSubsystem::GetTowerLayout(const FT66MapPreset& Preset, const bool bBossRushFinaleStage)
+{
+	FLayoutEntry& Entry = FindOrStartTowerLayout(Preset, bBossRushFinaleStage);
+	if (Entry.Pending.IsValid())
+	{
+		Entry.Layout = Entry.Pending.Get();
+		Entry.Pending.Reset();
+	}
+
+	return Entry.Layout;
+}
+
+bool UT66TerrainBoardSubsystem::PresetsMatch(const FT66MapPreset& A, const FT66MapPreset& B)
+{
+	return A.Seed == B.Seed
+		&& A.Theme == B.Theme
+		&& A.LayoutVariant == B.LayoutVariant
+		&& FT66MapPreset::StaticStruct()->CompareScriptStruct(&A, &B, PPF_None);
+}
+
+UT66TerrainBoardSubsystem::FBoardHandle UT66TerrainBoardSubsystem::GenerateBoard(const FT66MapPreset& Preset)
+{
+	TSharedRef<T66MainMapTerrain::FBoard, ESPMode::ThreadSafe> Board = MakeShared<T66MainMapTerrain::FBoard, ESPMode::ThreadSafe>();
+	if (!T66MainMapTerrain::Generate(Preset, *Board))
+	{
+		UE_LOG(LogT66TerrainBoards, Error, TEXT("[MAP] Main map terrain generation failed to fill the board (seed=%d, occupied=%d/%d)"),
+			Preset.Seed,
+			Board->OccupiedCount,
+			Board->Cells.Num());
+		return nullptr;
+	}
+
+	return Board;
+}
+
+UT66TerrainBoardSubsystem::FLayoutHandle UT66TerrainBoardSubsystem::GenerateTowerLayout(const FT66MapPreset& Preset, const bool bBossRushFinaleStage)
+{
+	TSharedRef<T66TowerMapTerrain::FLayout, ESPMode::ThreadSafe> Layout = MakeShared<T66TowerMapTerrain::FLayout, ESPMode::ThreadSafe>();
+	if (!T66TowerMapTerrain::BuildLayout(Preset, *Layout, bBossRushFinaleStage))
+	{
+		UE_LOG(LogT66TerrainBoards, Error, TEXT("[MAP] Tower main map layout generation failed (seed=%d)"), Preset.Seed);
+		return nullptr;
+	}
+
+	return Layout;
+}
+
+UT66TerrainBoardSubsystem::FBoardEntry& UT66TerrainBoardSubsystem::FindOrStartBoard(const FT66MapPreset& Preset)
+{
+	for (FBoardEntry& Entry : Boards)
+	{
+		if (PresetsMatch(Entry.Preset, Preset))
+		{
+			return Entry;
+		}
+	}
+
+	FBoardEntry& Entry = Boards.AddDefaulted_GetRef();
+	Entry.Preset = Preset;
+	Entry.Pending = Async(EAsyncExecution::ThreadPool, [Preset]()
+	{
+		return GenerateBoard(Preset);
+	});
+	return Entry;
+}
+
+UT66TerrainBoardSubsystem::FLayoutEntry& UT66TerrainBoardSubsystem::FindOrStartTowerLayout(const FT66MapPreset& Preset, const bool bBossRushFinaleStage)
+{
+	for (FLayoutEntry& Entry : TowerLayouts)
+	{
+		if (Entry.bBossRushFinaleStage == bBossRushFinaleStage && PresetsMatch(Entry.Preset, Preset))
+		{
+			return Entry;
+		}
+	}
+
+	FLayoutEntry& Entry = TowerLayouts.AddDefaulted_GetRef();
+	Entry.Preset = Preset;
+	Entry.bBossRushFinaleStage = bBossRushFinaleStage;
+	Entry.Pending = Async(EAsyncExecution::ThreadPool, [Preset, bBossRushFinaleStage]()
+	{
+		return GenerateTowerLayout(Preset, bBossRushFinaleStage);
+	});
+	return Entry;
+}
@@ -0,0 +1,75 @@
+// Copyright Tribulation 66. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/Future.h"
+#include "Gameplay/T66MainMapTerrain.h"
+#include "Gameplay/T66ProceduralLandscapeParams.h"
+#include "Gameplay/T66TowerMapTerrain.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "T66TerrainBoardSubsystem.generated.h"
+
+/**
+ * World-scoped owner of the procedural main-map board and tower layout for the current stage.
+ * Generation runs on a worker as soon as the game mode (or a client receiving run settings) knows
+ * the seed; the game mode, miasma, boundary and prop spawners then share one immutable result
+ * instead of each regenerating the same board on the game thread.
+ */
+UCLASS()
+class T66_API UT66TerrainBoardSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	using FBoardHandle = TSharedPtr<const T66MainMapTerrain::FBoard, ESPMode::ThreadSafe>;
+	using FLayoutHandle = TSharedPtr<const T66TowerMapTerrain::FLayout, ESPMode::ThreadSafe>;
+
+	static UT66TerrainBoardSubsystem* Get(const UWorld* World);
+
+	/** Shared board for the preset; generates inline when the world has no subsystem. Null if generation failed. */
+	static FBoardHandle ResolveBoard(const UWorld* World, const FT66MapPreset& Preset);
+	static FLayoutHandle ResolveTowerLayout(const UWorld* World, const FT66MapPreset& Preset, bool bBossRushFinaleStage = false);
+
+	virtual void Deinitialize() override;
+	virtual bool DoesSupportWorldType(EWorldType::Type WorldType) const override;
+
+	/** Starts worker generation unless the result is already cached or in flight. */
+	void PrefetchBoard(const FT66MapPreset& Preset);
+	void PrefetchTowerLayout(const FT66MapPreset& Preset, bool bBossRushFinaleStage = false);
+
+	/** Returns the shared result, joining the worker if it has not finished yet. */
+	FBoardHandle GetBoard(const FT66MapPreset& Preset);
+	FLayoutHandle GetTowerLayout(const FT66MapPreset& Preset, bool bBossRushFinaleStage = false);
+
+	/** Tower layout whose actors are currently spawned in this world; set by whoever spawned them. */
+	void SetActiveTowerLayout(FLayoutHandle Layout) { ActiveTowerLayout = MoveTemp(Layout); }
+	const FLayoutHandle& GetActiveTowerLayout() const { return ActiveTowerLayout; }
+
+private:
+	struct FBoardEntry
+	{
+		FT66MapPreset Preset;
+		TFuture<FBoardHandle> Pending;
+		FBoardHandle Board;
+	};
+
+	struct FLayoutEntry
+	{
+		FT66MapPreset Preset;
+		bool bBossRushFinaleStage = false;
+		TFuture<FLayoutHandle> Pending;
+		FLayoutHandle Layout;
+	};
+
+	static bool PresetsMatch(const FT66MapPreset& A, const FT66MapPreset& B);
+	static FBoardHandle GenerateBoard(const FT66MapPreset& Preset);
+	static FLayoutHandle GenerateTowerLayout(const FT66MapPreset& Preset, bool bBossRushFinaleStage);
+
+	FBoardEntry& FindOrStartBoard(const FT66MapPreset& Preset);
+	FLayoutEntry& FindOrStartTowerLayout(const FT66MapPreset& Preset, bool bBossRushFinaleStage);
+
+	TArray<FBoardEntry> Boards;
+	TArray<FLayoutEntry> TowerLayouts;
+	FLayoutHandle ActiveTowerLayout;
+};
@@ -50,6 +50,7 @@
 #include "Gameplay/T66TutorialManager.h"
 #include "Core/T66GameInstance.h"
 #include "Core/T66AchievementsSubsystem.h"
+#include "Core/T66AudioSubsystem.h"
 #include "Core/T66RetroFXSubsystem.h"
 #include "Core/T66PlayerSettingsSubsystem.h"
 #include "Core/T66CompanionUnlockSubsystem.h"
@@ -68,6 +69,7 @@
 #include "Core/T66GameplayLayout.h"
 #include "Core/T66PropSubsystem.h"
 #include "Core/T66SessionSubsystem.h"
+#include "Core/T66TerrainBoardSubsystem.h"
 #include "Gameplay/T66RecruitableCompanion.h"
 #include "Gameplay/T66PlayerController.h"
 #include "Gameplay/T66SessionPlayerState.h"
@@ -144,6 +146,7 @@ namespace T66GameModePrivate
 	void T66DestroyCachedPlayerStarts(UWorld* World);
 	AActor* T66FindMainMapTerrainVisualActor(UWorld* World);
 	AActor* T66FindTaggedActor(UWorld* World, FName Tag);
+	AActor* T66FindRememberedTaggedActor(UWorld* World, FName Tag);
 	void T66RememberTaggedActor(AActor* Actor, FName Tag);
 	void T66ForgetTaggedActor(UWorld* World, FName Tag);
 	bool T66HasRegisteredCasino(UWorld* World);
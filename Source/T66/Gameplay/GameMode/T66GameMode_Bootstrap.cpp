@@ -32,6 +32,7 @@ void AT66GameMode::EnsureGameplayStartupInitialized(const TCHAR* TriggerContext)
 	}
 
 	bGameplayStartupInitialized = true;
+	RegisterHousekeepingTasks();
 
 	// Main flat floor is spawned in SpawnLevelContentAfterLandscapeReady (no external asset packs).
 	InitializeRunStateForBeginPlay();
@@ -48,6 +49,12 @@ void AT66GameMode::EnsureGameplayStartupInitialized(const TCHAR* TriggerContext)
 			PS->OnSettingsChanged.RemoveDynamic(this, &AT66GameMode::HandleSettingsChanged);
 			PS->OnSettingsChanged.AddDynamic(this, &AT66GameMode::HandleSettingsChanged);
 		}
+
+		// Stream combat and boss cues during stage load so the first hit never waits on disk.
+		if (UT66AudioSubsystem* Audio = GIP->GetSubsystem<UT66AudioSubsystem>())
+		{
+			Audio->PreloadStageAudio();
+		}
 	}
 	HandleSettingsChanged();
 
@@ -58,6 +65,19 @@ void AT66GameMode::EnsureGameplayStartupInitialized(const TCHAR* TriggerContext)
 	}
 
 	ConsumePendingStageCatchUp();
+
+	// The seed is settled now; generate the shared board off-thread while the level spawn waits a tick.
+	UWorld* World = GetWorld();
+	if (UT66TerrainBoardSubsystem* TerrainBoards = UT66TerrainBoardSubsystem::Get(World); TerrainBoards && T66UsesMainMapTerrainStage(World))
+	{
+		const FT66MapPreset Preset = T66BuildMainMapPreset(GetT66GameInstance());
+		TerrainBoards->PrefetchBoard(Preset);
+		if (Preset.LayoutVariant == ET66MainMapLayoutVariant::Tower)
+		{
+			TerrainBoards->PrefetchTowerLayout(Preset, IsBossRushFinaleStage());
+		}
+	}
+
 	ScheduleDeferredGameplayLevelSpawn();
 	UE_LOG(LogT66GameMode, Log, TEXT("T66GameMode %s - level setup scheduled; content will spawn after landscape is ready."), TriggerContext);
 }
@@ -599,29 +619,17 @@ void AT66GameMode::PreloadStageCharacterVisuals()
 
 	if (T66GI && RunState && Visuals)
 	{
+		// Usually already resident from the loading-screen batch; anything still streaming swaps in
+		// from placeholders when the director spawns it, so nothing here blocks.
 		const int32 StageNum = RunState->GetCurrentStage();
-		FStageData StageData;
-		if (T66GI->GetStageData(StageNum, StageData))
-		{
-			// Preload mob visuals before the first enemy spawn to avoid sync-load hitches.
-			if (!StageData.EnemyA.IsNone()) Visuals->PreloadCharacterVisual(StageData.EnemyA);
-			if (!StageData.EnemyB.IsNone()) Visuals->PreloadCharacterVisual(StageData.EnemyB);
-			if (!StageData.EnemyC.IsNone()) Visuals->PreloadCharacterVisual(StageData.EnemyC);
-			Visuals->PreloadCharacterVisual(FName(TEXT("Boss")));
-
-			UE_LOG(LogT66GameMode, Log, TEXT("[GOLD] Phase2-Preload: pre-resolved visuals for stage %d (EnemyA=%s, EnemyB=%s, EnemyC=%s, Boss=%s) in %.1fms"),
-				StageNum,
-				*StageData.EnemyA.ToString(), *StageData.EnemyB.ToString(), *StageData.EnemyC.ToString(),
-				*StageData.BossID.ToString(),
-				(FPlatformTime::Seconds() - PreloadStart) * 1000.0);
-		}
-
-		const FName FallbackA = FName(*FString::Printf(TEXT("Mob_Stage%02d_A"), RunState->GetCurrentStage()));
-		const FName FallbackB = FName(*FString::Printf(TEXT("Mob_Stage%02d_B"), RunState->GetCurrentStage()));
-		const FName FallbackC = FName(*FString::Printf(TEXT("Mob_Stage%02d_C"), RunState->GetCurrentStage()));
-		Visuals->PreloadCharacterVisual(FallbackA);
-		Visuals->PreloadCharacterVisual(FallbackB);
-		Visuals->PreloadCharacterVisual(FallbackC);
+		TArray<FName> StageVisualIDs;
+		T66GI->GetStageCharacterVisualIDs(StageNum, StageVisualIDs);
+		Visuals->PreloadCharacterVisuals(StageVisualIDs);
+
+		UE_LOG(LogT66GameMode, Log, TEXT("[GOLD] Phase2-Preload: requested %d visuals for stage %d in %.1fms"),
+			StageVisualIDs.Num(),
+			StageNum,
+			(FPlatformTime::Seconds() - PreloadStart) * 1000.0);
 	}
 
 	UE_LOG(LogT66GameMode, Log, TEXT("[GOLD] Phase2-Preload: total preload time %.1fms"), (FPlatformTime::Seconds() - PreloadStart) * 1000.0);
@@ -787,6 +787,11 @@ void AT66GameMode::SpawnMainMapTerrain()
 		}
 	}
 
+	if (UT66TerrainBoardSubsystem* TerrainBoards = UT66TerrainBoardSubsystem::Get(World))
+	{
+		TerrainBoards->SetActiveTowerLayout(nullptr);
+	}
+
 	bTerrainCollisionReady = false;
 	bMainMapCombatStarted = false;
 	bWorldInteractablesSpawnedForStage = false;
@@ -795,8 +800,6 @@ void AT66GameMode::SpawnMainMapTerrain()
 	CachedTowerMainMapLayout = T66TowerMapTerrain::FLayout{};
 	bTowerBossEntryTriggered = false;
 	bTowerBossEntryApplied = false;
-	TowerTerrainSafetyAccumulator = 0.f;
-	TowerTrapActivationAccumulator = 0.f;
 	ActiveTowerTrapFloorNumber = INDEX_NONE;
 	MainMapSpawnSurfaceLocation = FVector::ZeroVector;
 	MainMapStartAnchorSurfaceLocation = FVector::ZeroVector;
@@ -834,13 +837,16 @@ void AT66GameMode::SpawnMainMapTerrain()
 
 	if (Preset.LayoutVariant == ET66MainMapLayoutVariant::Tower)
 	{
-		if (!T66TowerMapTerrain::BuildLayout(Preset, CachedTowerMainMapLayout, IsBossRushFinaleStage()))
+		const UT66TerrainBoardSubsystem::FLayoutHandle TowerLayout = UT66TerrainBoardSubsystem::ResolveTowerLayout(World, Preset, IsBossRushFinaleStage());
+		if (!TowerLayout)
 		{
 			UE_LOG(LogT66GameMode, Error, TEXT("[MAP] Tower main map layout generation failed (seed=%d)"), Preset.Seed);
 			CachedTowerMainMapLayout = T66TowerMapTerrain::FLayout{};
 			return;
 		}
 
+		CachedTowerMainMapLayout = *TowerLayout;
+
 		bUsingTowerMainMapLayout = true;
 		MainMapSpawnSurfaceLocation = CachedTowerMainMapLayout.SpawnSurfaceLocation;
 		bHasMainMapSpawnSurfaceLocation = !MainMapSpawnSurfaceLocation.IsNearlyZero();
@@ -868,6 +874,11 @@ void AT66GameMode::SpawnMainMapTerrain()
 			return;
 		}
 
+		if (UT66TerrainBoardSubsystem* TerrainBoards = UT66TerrainBoardSubsystem::Get(World))
+		{
+			TerrainBoards->SetActiveTowerLayout(TowerLayout);
+		}
+
 		bTerrainCollisionReady = bTowerCollisionReady;
 		if (bTerrainCollisionReady)
 		{
@@ -876,16 +887,15 @@ void AT66GameMode::SpawnMainMapTerrain()
 		return;
 	}
 
-	T66MainMapTerrain::FBoard Board;
-	if (!T66MainMapTerrain::Generate(Preset, Board))
+	const UT66TerrainBoardSubsystem::FBoardHandle BoardHandle = UT66TerrainBoardSubsystem::ResolveBoard(World, Preset);
+	if (!BoardHandle)
 	{
-		UE_LOG(LogT66GameMode, Error, TEXT("[MAP] Main map terrain generation failed to fill the board (seed=%d, occupied=%d/%d)"),
-			Preset.Seed,
-			Board.OccupiedCount,
-			Board.Cells.Num());
+		UE_LOG(LogT66GameMode, Error, TEXT("[MAP] Main map terrain generation failed (seed=%d)"), Preset.Seed);
 		return;
 	}
 
+	const T66MainMapTerrain::FBoard& Board = *BoardHandle;
+
 	MainMapSpawnSurfaceLocation = T66MainMapTerrain::GetPreferredSpawnLocation(Board, 0.f);
 	bHasMainMapSpawnSurfaceLocation = true;
 	MainMapRescueAnchorLocations.Add(MainMapSpawnSurfaceLocation);
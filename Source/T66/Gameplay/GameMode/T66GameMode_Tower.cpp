@@ -8,7 +8,6 @@ void AT66GameMode::ResetTowerMiasmaState()
 {
 	bTowerMiasmaActive = false;
 	TowerMiasmaStartWorldSeconds = 0.f;
-	TowerMiasmaUpdateAccumulator = 0.f;
 	TowerIdolSelectionsAtStageStart = 0;
 
 	if (MiasmaManager)
@@ -19,21 +18,13 @@ void AT66GameMode::ResetTowerMiasmaState()
 	}
 }
 
-void AT66GameMode::UpdateTowerMiasma(float DeltaTime)
+void AT66GameMode::UpdateTowerMiasma()
 {
 	if (!IsUsingTowerMainMapLayout() || !bTowerMiasmaActive || !MiasmaManager)
 	{
-		TowerMiasmaUpdateAccumulator = 0.f;
 		return;
 	}
 
-	TowerMiasmaUpdateAccumulator += DeltaTime;
-	if (TowerMiasmaUpdateAccumulator < 0.20f)
-	{
-		return;
-	}
-
-	TowerMiasmaUpdateAccumulator = 0.f;
 	MiasmaManager->UpdateFromRunState();
 }
 
@@ -54,7 +45,7 @@ void AT66GameMode::TryStartTowerMiasma(const FVector* SourceAnchor, const int32
 	}
 
 	bTowerMiasmaActive = true;
-	TowerMiasmaUpdateAccumulator = 0.20f;
+	HousekeepingScheduler.RequestRun(TEXT("TowerMiasma"));
 
 	if (SourceAnchor && SourceFloorNumber != INDEX_NONE)
 	{
@@ -364,7 +355,6 @@ void AT66GameMode::SyncTowerTrapActivation(const bool bForce)
 
 	if (!IsUsingTowerMainMapLayout())
 	{
-		TowerTrapActivationAccumulator = 0.f;
 		if (bForce || ActiveTowerTrapFloorNumber != INDEX_NONE)
 		{
 			ActiveTowerTrapFloorNumber = INDEX_NONE;
@@ -373,18 +363,8 @@ void AT66GameMode::SyncTowerTrapActivation(const bool bForce)
 		return;
 	}
 
+	// Unforced calls come from the housekeeping scheduler at a fixed period, so re-applying is cheap.
 	const int32 CurrentFloorNumber = GetCurrentTowerFloorIndex();
-	const bool bFloorChanged = CurrentFloorNumber != ActiveTowerTrapFloorNumber;
-	if (!bForce && !bFloorChanged)
-	{
-		TowerTrapActivationAccumulator += World->GetDeltaSeconds();
-		if (TowerTrapActivationAccumulator < 0.10f)
-		{
-			return;
-		}
-	}
-
-	TowerTrapActivationAccumulator = 0.f;
 	ActiveTowerTrapFloorNumber = CurrentFloorNumber;
 	TrapSubsystem->SetActiveTowerFloor(CurrentFloorNumber);
 }
@@ -1243,18 +1243,128 @@ void AT66GameMode::SpawnWorldInteractablesForStage()
 		FRandomStream TowerFloorRng(RunSeed + StageNum * 1901 + 77);
 		TArray<int32> GameplayFloorNumbers = TowerGameplayFloorNumbers;
 		const int32 QuickReviveFloorNumber = CachedTowerMainMapLayout.FirstGameplayFloorNumber;
-		TSet<FName> ExistingTowerOccupantTags;
-		for (TActorIterator<AActor> It(World); It; ++It)
+
+		// Tower occupants are always remembered when spawned, so the tag registry answers without a world scan.
+		auto HasTowerOccupant = [&](const FName Tag) -> bool
 		{
-			if (AActor* ExistingActor = *It)
+			return T66FindRememberedTaggedActor(World, Tag) != nullptr;
+		};
+
+		// Spacing checks only need the 3x3 neighbourhood of a MinDistBetweenInteractables-sized cell on the same floor.
+		struct FTowerOccupancyGrid
+		{
+			TMap<FIntVector, TArray<FVector, TInlineAllocator<2>>> Cells;
+			float CellSize = 1.f;
+
+			FIntVector ToCell(const FVector& L, const int32 FloorNumber) const
 			{
-				for (const FName& ExistingTag : ExistingActor->Tags)
+				return FIntVector(FMath::FloorToInt(L.X / CellSize), FMath::FloorToInt(L.Y / CellSize), FloorNumber);
+			}
+
+			void Add(const FVector& L, const int32 FloorNumber)
+			{
+				if (FloorNumber != INDEX_NONE)
 				{
-					ExistingTowerOccupantTags.Add(ExistingTag);
+					Cells.FindOrAdd(ToCell(L, FloorNumber)).Add(L);
 				}
 			}
+
+			bool HasOccupantWithin(const FVector& L, const int32 FloorNumber, const float Radius) const
+			{
+				const FIntVector Center = ToCell(L, FloorNumber);
+				for (int32 DY = -1; DY <= 1; ++DY)
+				{
+					for (int32 DX = -1; DX <= 1; ++DX)
+					{
+						const TArray<FVector, TInlineAllocator<2>>* Occupants = Cells.Find(FIntVector(Center.X + DX, Center.Y + DY, FloorNumber));
+						if (!Occupants)
+						{
+							continue;
+						}
+
+						for (const FVector& Occupant : *Occupants)
+						{
+							if (FVector::DistSquared2D(L, Occupant) < FMath::Square(Radius))
+							{
+								return true;
+							}
+						}
+					}
+				}
+
+				return false;
+			}
+		};
+
+		FTowerOccupancyGrid TowerOccupancy;
+		TowerOccupancy.CellSize = MinDistBetweenInteractables;
+		for (const FVector& Used : UsedLocs)
+		{
+			TowerOccupancy.Add(Used, GetTowerFloorIndexForLocation(Used));
 		}
 
+		auto MarkTowerLocationUsed = [&](const FVector& L, const int32 FloorNumber)
+		{
+			UsedLocs.Add(L);
+			TowerOccupancy.Add(L, FloorNumber);
+		};
+
+		auto IsClearOfTowerSafeZones = [&](const FVector& L, const int32 FloorNumber) -> bool
+		{
+			UT66ActorRegistrySubsystem* Registry = World ? World->GetSubsystem<UT66ActorRegistrySubsystem>() : nullptr;
+			if (!Registry)
+			{
+				return true;
+			}
+
+			for (const TWeakObjectPtr<AT66HouseNPCBase>& WeakNPC : Registry->GetNPCs())
+			{
+				const AT66HouseNPCBase* NPC = WeakNPC.Get();
+				if (!NPC || ResolveTowerFloorForActor(NPC) != FloorNumber)
+				{
+					continue;
+				}
+
+				const float R = NPC->GetSafeZoneRadius() + SafeBubbleMargin;
+				if (FVector::DistSquared2D(L, NPC->GetActorLocation()) < (R * R))
+				{
+					return false;
+				}
+			}
+
+			for (const TWeakObjectPtr<AT66CasinoInteractable>& WeakCasino : Registry->GetCasinos())
+			{
+				const AT66CasinoInteractable* Casino = WeakCasino.Get();
+				if (!Casino || ResolveTowerFloorForActor(Casino) != FloorNumber)
+				{
+					continue;
+				}
+
+				const float R = Casino->GetSafeZoneRadius() + SafeBubbleMargin;
+				if (FVector::DistSquared2D(L, Casino->GetActorLocation()) < (R * R))
+				{
+					return false;
+				}
+			}
+
+			return true;
+		};
+
+		// Candidates are handed out once per stage so a failed resnap moves on to the next slot instead of retrying it.
+		TMap<int32, TBitArray<>> TowerCandidatesTakenByFloor;
+		auto FindTowerFloor = [&](const int32 FloorNumber) -> const T66TowerMapTerrain::FFloor*
+		{
+			for (const T66TowerMapTerrain::FFloor& Floor : CachedTowerMainMapLayout.Floors)
+			{
+				if (Floor.FloorNumber == FloorNumber)
+				{
+					return &Floor;
+				}
+			}
+
+			return nullptr;
+		};
+
 		auto ResnapTowerActorToFloor = [&](AActor* Actor, const int32 FloorNumber) -> bool
 		{
 			if (!Actor)
@@ -1270,6 +1380,32 @@ void AT66GameMode::SpawnWorldInteractablesForStage()
 
 		auto TryFindTowerFloorLocation = [&](const int32 FloorNumber, const int32 SeedOffset, const float EdgePadding, const float HolePadding, FVector& OutLocation) -> bool
 		{
+			const T66TowerMapTerrain::FFloor* Floor = FindTowerFloor(FloorNumber);
+			if (Floor && Floor->PlacementCandidates.Num() > 0)
+			{
+				TBitArray<>& Taken = TowerCandidatesTakenByFloor.FindOrAdd(FloorNumber);
+				if (Taken.Num() != Floor->PlacementCandidates.Num())
+				{
+					Taken.Init(false, Floor->PlacementCandidates.Num());
+				}
+
+				for (int32 CandidateIndex = 0; CandidateIndex < Floor->PlacementCandidates.Num(); ++CandidateIndex)
+				{
+					const T66TowerMapTerrain::FPlacementCandidate& Candidate = Floor->PlacementCandidates[CandidateIndex];
+					if (Taken[CandidateIndex]
+						|| !Candidate.HasClearance(EdgePadding, HolePadding, EdgePadding)
+						|| TowerOccupancy.HasOccupantWithin(Candidate.Location, FloorNumber, MinDistBetweenInteractables)
+						|| !IsClearOfTowerSafeZones(Candidate.Location, FloorNumber))
+					{
+						continue;
+					}
+
+					Taken[CandidateIndex] = true;
+					OutLocation = Candidate.Location;
+					return true;
+				}
+			}
+
 			FRandomStream FloorRng(RunSeed + StageNum * 1901 + SeedOffset + FloorNumber * 53);
 			for (int32 Attempt = 0; Attempt < 24; ++Attempt)
 			{
@@ -1323,7 +1459,7 @@ void AT66GameMode::SpawnWorldInteractablesForStage()
 					continue;
 				}
 
-				UsedLocs.Add(SpawnedActor->GetActorLocation());
+				MarkTowerLocationUsed(SpawnedActor->GetActorLocation(), FloorNumber);
 				return SpawnedActor;
 			}
 
@@ -1397,7 +1533,7 @@ void AT66GameMode::SpawnWorldInteractablesForStage()
 		for (const int32 FloorNumber : GameplayFloorNumbers)
 		{
 			const FName CasinoTag(*FString::Printf(TEXT("T66_Tower_Casino_%02d"), FloorNumber));
-			if (!ExistingTowerOccupantTags.Contains(CasinoTag))
+			if (!HasTowerOccupant(CasinoTag))
 			{
 				if (RunState)
 				{
@@ -1418,9 +1554,8 @@ void AT66GameMode::SpawnWorldInteractablesForStage()
 						T66AssignTowerFloorTag(Casino, FloorNumber);
 						Casino->ConfigureCompactTowerVariant();
 						Casino->Tags.AddUnique(CasinoTag);
-						ExistingTowerOccupantTags.Add(CasinoTag);
 						T66RememberTaggedActor(Casino, CasinoTag);
-						UsedLocs.Add(CasinoLoc);
+						MarkTowerLocationUsed(CasinoLoc, FloorNumber);
 					}
 				}
 			}
@@ -1429,7 +1564,7 @@ void AT66GameMode::SpawnWorldInteractablesForStage()
 		if (QuickReviveFloorNumber != INDEX_NONE)
 		{
 			const FName QuickReviveTag(*FString::Printf(TEXT("T66_Tower_QuickRevive_%02d"), QuickReviveFloorNumber));
-			if (!ExistingTowerOccupantTags.Contains(QuickReviveTag))
+			if (!HasTowerOccupant(QuickReviveTag))
 			{
 				if (RunState)
 				{
@@ -1450,16 +1585,15 @@ void AT66GameMode::SpawnWorldInteractablesForStage()
 						T66TrySnapActorToTowerFloor(World, QuickReviveMachine, CachedTowerMainMapLayout, QuickReviveFloorNumber, QuickReviveLoc);
 						T66AssignTowerFloorTag(QuickReviveMachine, QuickReviveFloorNumber);
 						QuickReviveMachine->Tags.AddUnique(QuickReviveTag);
-						ExistingTowerOccupantTags.Add(QuickReviveTag);
 						T66RememberTaggedActor(QuickReviveMachine, QuickReviveTag);
-						UsedLocs.Add(QuickReviveLoc);
+						MarkTowerLocationUsed(QuickReviveLoc, QuickReviveFloorNumber);
 					}
 				}
 			}
 		}
 
 		const FName SaintTag(TEXT("T66_Tower_Saint"));
-		if (!ExistingTowerOccupantTags.Contains(SaintTag))
+		if (!HasTowerOccupant(SaintTag))
 		{
 			for (int32 Index = GameplayFloorNumbers.Num() - 1; Index > 0; --Index)
 			{
@@ -1486,11 +1620,9 @@ void AT66GameMode::SpawnWorldInteractablesForStage()
 					T66AssignTowerFloorTag(Saint, FloorNumber);
 					Saint->Tags.AddUnique(SaintTag);
 					Saint->Tags.AddUnique(SaintFloorTag);
-					ExistingTowerOccupantTags.Add(SaintTag);
-					ExistingTowerOccupantTags.Add(SaintFloorTag);
 					T66RememberTaggedActor(Saint, SaintTag);
 					T66RememberTaggedActor(Saint, SaintFloorTag);
-					UsedLocs.Add(SaintLoc);
+					MarkTowerLocationUsed(SaintLoc, FloorNumber);
 				}
 				break;
 			}
@@ -1967,7 +2099,6 @@ void AT66GameMode::SpawnIdolVFXTestTargets()
 		}
 
 		TargetEnemy->CurrentHP = TargetEnemy->MaxHP;
-		TargetEnemy->UpdateHealthBar();
 		TargetEnemy->Tags.AddUnique(FName(TEXT("IdolVFXTestTarget")));
 		UE_LOG(LogT66GameMode, Log, TEXT("Spawned idol VFX test target %s at %s"), *TargetIds[Index].ToString(), *TargetEnemy->GetActorLocation().ToCompactString());
 		IdolVFXTestTargets.Add(TargetEnemy);
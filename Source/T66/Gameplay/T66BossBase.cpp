@@ -8,6 +8,7 @@
 #include "Gameplay/T66GameMode.h"
 #include "Core/T66AudioSubsystem.h"
 #include "Core/T66CharacterVisualSubsystem.h"
+#include "Core/T66RngSubsystem.h"
 #include "Core/T66RunStateSubsystem.h"
 #include "Core/T66DamageLogSubsystem.h"
 #include "Core/T66FloatingCombatTextSubsystem.h"
@@ -22,6 +23,7 @@
 #include "Kismet/GameplayStatics.h"
 #include "Gameplay/T66VisualUtil.h"
 #include "Engine/World.h"
+#include "Algo/BinarySearch.h"
 
 namespace
 {
@@ -217,6 +219,8 @@ namespace
 	}
 }
 
+const FName AT66BossBase::StageBossCharacterVisualID(TEXT("Cow"));
+
 AT66BossBase::AT66BossBase()
 {
 	PrimaryActorTick.bCanEverTick = true;
@@ -731,24 +735,7 @@ void AT66BossBase::InitializeBoss(const FBossData& BossData)
 
 	// Use the same live mob visual as the in-game Cow enemy so boss testing matches
 	// the actual enemy asset path rather than a static showcase prop.
-	if (UGameInstance* GI = GetWorld() ? GetWorld()->GetGameInstance() : nullptr)
-	{
-		if (UT66CharacterVisualSubsystem* Visuals = GI->GetSubsystem<UT66CharacterVisualSubsystem>())
-		{
-			const bool bApplied = Visuals->ApplyCharacterVisual(FName(TEXT("Cow")), GetMesh(), VisualMesh, true);
-			if (USkeletalMeshComponent* SkelMesh = GetMesh())
-			{
-				if (bApplied)
-				{
-					SkelMesh->SetRelativeScale3D(SkelMesh->GetRelativeScale3D() * 3.0f);
-				}
-				else
-				{
-					SkelMesh->SetVisibility(false, true);
-				}
-			}
-		}
-	}
+	RequestBossCharacterVisual(StageBossCharacterVisualID, 3.0f);
 
 	// Apply current run difficulty (boss is usually dormant until awaken).
 	if (UGameInstance* GI = GetWorld() ? GetWorld()->GetGameInstance() : nullptr)
@@ -837,34 +824,77 @@ FVector AT66BossBase::ResolveGroundLocation(const FVector& PreferredLocation) co
 	return TargetLoc;
 }
 
-void AT66BossBase::ClearPendingAttackTimers()
+void AT66BossBase::ClearAttackTimeline()
 {
-	if (UWorld* World = GetWorld())
+	AttackTimeline.Reset();
+	AttackTimelineSeconds = 0.f;
+}
+
+void AT66BossBase::SeedAttackStream()
+{
+	int32 Seed = static_cast<int32>(GetTypeHash(BossID));
+	if (UGameInstance* GI = GetWorld() ? GetWorld()->GetGameInstance() : nullptr)
 	{
-		for (FTimerHandle& Handle : PendingAttackTimerHandles)
+		if (const UT66RunStateSubsystem* RunState = GI->GetSubsystem<UT66RunStateSubsystem>())
+		{
+			Seed = static_cast<int32>(HashCombine(static_cast<uint32>(Seed), static_cast<uint32>(RunState->GetCurrentStage())));
+		}
+		if (const UT66RngSubsystem* RngSub = GI->GetSubsystem<UT66RngSubsystem>())
 		{
-			World->GetTimerManager().ClearTimer(Handle);
+			Seed ^= RngSub->GetRunSeed();
 		}
 	}
 
-	PendingAttackTimerHandles.Reset();
+	AttackStream.Initialize(Seed);
 }
 
-void AT66BossBase::QueueTimedAttackLambda(FTimerDelegate&& Delegate, const float DelaySeconds)
+void AT66BossBase::QueueAttackPattern(const FT66BossAttackPattern& Pattern)
 {
-	UWorld* World = GetWorld();
-	if (!World)
+	if (Pattern.ShotCount <= 0 || Pattern.BaseDirection.IsNearlyZero())
+	{
+		return;
+	}
+
+	const int32 InsertIndex = Algo::UpperBoundBy(AttackTimeline, Pattern.StartSeconds, &FT66BossAttackPattern::StartSeconds);
+	AttackTimeline.Insert(Pattern, InsertIndex);
+}
+
+void AT66BossBase::AdvanceAttackTimeline(const float DeltaSeconds)
+{
+	if (AttackTimeline.Num() == 0)
 	{
+		AttackTimelineSeconds = 0.f;
 		return;
 	}
 
-	PendingAttackTimerHandles.RemoveAllSwap([World](const FTimerHandle& Handle)
+	AttackTimelineSeconds += DeltaSeconds;
+	for (int32 PatternIndex = 0; PatternIndex < AttackTimeline.Num(); ++PatternIndex)
 	{
-		return !Handle.IsValid() || !World->GetTimerManager().TimerExists(Handle);
-	});
+		FT66BossAttackPattern& Pattern = AttackTimeline[PatternIndex];
+		if (Pattern.StartSeconds > AttackTimelineSeconds)
+		{
+			// Sorted by start time, so nothing further along has started yet.
+			break;
+		}
+
+		while (Pattern.NextShotIndex < Pattern.ShotCount && Pattern.GetNextShotSeconds() <= AttackTimelineSeconds)
+		{
+			const int32 ShotIndex = Pattern.NextShotIndex++;
+			const float NormalizedIndex = (Pattern.ShotCount > 1)
+				? (static_cast<float>(ShotIndex) / static_cast<float>(Pattern.ShotCount - 1) - 0.5f) * 2.f
+				: 0.f;
+			SpawnProjectileInDirection(
+				T66RotatePlanarVector(Pattern.BaseDirection, Pattern.StartYawDegrees + Pattern.StepYawDegrees * static_cast<float>(ShotIndex)),
+				Pattern.SpeedScale,
+				Pattern.SpawnOffset + Pattern.SideAxis * (Pattern.SideOffsetDistance * NormalizedIndex),
+				Pattern.bUseSecondaryTint && (!Pattern.bAlternateTint || (ShotIndex % 2) == 1));
+		}
+	}
 
-	FTimerHandle& Handle = PendingAttackTimerHandles.AddDefaulted_GetRef();
-	World->GetTimerManager().SetTimer(Handle, MoveTemp(Delegate), FMath::Max(0.001f, DelaySeconds), false);
+	AttackTimeline.RemoveAll([](const FT66BossAttackPattern& Pattern)
+	{
+		return Pattern.NextShotIndex >= Pattern.ShotCount;
+	});
 }
 
 void AT66BossBase::SpawnProjectileInDirection(const FVector& Direction, const float SpeedScale, const FVector& SpawnOffset, const bool bUseSecondaryTint)
@@ -902,24 +932,13 @@ void AT66BossBase::SpawnProjectileInDirection(const FVector& Direction, const fl
 
 void AT66BossBase::QueueProjectileShotDirection(const FVector& Direction, const float DelaySeconds, const float SpeedScale, const FVector& SpawnOffset, const bool bUseSecondaryTint)
 {
-	const FVector ShotDirection = Direction.GetSafeNormal();
-	if (ShotDirection.IsNearlyZero())
-	{
-		return;
-	}
-
-	TWeakObjectPtr<AT66BossBase> WeakThis(this);
-	QueueTimedAttackLambda(
-		FTimerDelegate::CreateLambda([WeakThis, ShotDirection, SpeedScale, SpawnOffset, bUseSecondaryTint]()
-		{
-			if (!WeakThis.IsValid())
-			{
-				return;
-			}
-
-			WeakThis->SpawnProjectileInDirection(ShotDirection, SpeedScale, SpawnOffset, bUseSecondaryTint);
-		}),
-		DelaySeconds);
+	FT66BossAttackPattern Pattern;
+	Pattern.StartSeconds = AttackTimelineSeconds + FMath::Max(0.f, DelaySeconds);
+	Pattern.BaseDirection = Direction.GetSafeNormal();
+	Pattern.SpawnOffset = SpawnOffset;
+	Pattern.SpeedScale = SpeedScale;
+	Pattern.bUseSecondaryTint = bUseSecondaryTint;
+	QueueAttackPattern(Pattern);
 }
 
 void AT66BossBase::QueueProjectileShotTowards(const FVector& TargetLocation, const float DelaySeconds, const float YawOffsetDegrees, const float SpeedScale, const FVector& SpawnOffset, const bool bUseSecondaryTint)
@@ -950,25 +969,27 @@ void AT66BossBase::QueueProjectileFanBurst(
 		return;
 	}
 
-	const FVector BaseDirection = (TargetLocation - GetActorLocation()).GetSafeNormal();
-	const FVector Right = T66ResolvePlanarRightVector(BaseDirection);
-	const float StartYaw = (ShotCount > 1) ? (-SpreadDegrees * 0.5f) : 0.f;
-	const float StepYaw = (ShotCount > 1) ? (SpreadDegrees / static_cast<float>(ShotCount - 1)) : 0.f;
-
-	for (int32 Index = 0; Index < ShotCount; ++Index)
+	FVector AimDirection = TargetLocation - (GetActorLocation() + FVector(0.f, 0.f, 84.f));
+	AimDirection.Z = 0.f;
+	AimDirection = AimDirection.GetSafeNormal();
+	if (AimDirection.IsNearlyZero())
 	{
-		const float NormalizedIndex = (ShotCount > 1)
-			? (static_cast<float>(Index) / static_cast<float>(ShotCount - 1) - 0.5f) * 2.f
-			: 0.f;
-		const FVector SpawnOffset = Right * (SideOffsetDistance * NormalizedIndex);
-		QueueProjectileShotTowards(
-			TargetLocation,
-			InitialDelaySeconds + DelayStepSeconds * static_cast<float>(Index),
-			StartYaw + StepYaw * static_cast<float>(Index),
-			SpeedScale,
-			SpawnOffset,
-			bUseSecondaryTint && ((Index % 2) == 1));
+		AimDirection = GetActorForwardVector();
 	}
+
+	FT66BossAttackPattern Pattern;
+	Pattern.StartSeconds = AttackTimelineSeconds + FMath::Max(0.f, InitialDelaySeconds);
+	Pattern.StepSeconds = DelayStepSeconds;
+	Pattern.ShotCount = ShotCount;
+	Pattern.BaseDirection = AimDirection;
+	Pattern.StartYawDegrees = (ShotCount > 1) ? (-SpreadDegrees * 0.5f) : 0.f;
+	Pattern.StepYawDegrees = (ShotCount > 1) ? (SpreadDegrees / static_cast<float>(ShotCount - 1)) : 0.f;
+	Pattern.SideAxis = T66ResolvePlanarRightVector((TargetLocation - GetActorLocation()).GetSafeNormal());
+	Pattern.SideOffsetDistance = SideOffsetDistance;
+	Pattern.SpeedScale = SpeedScale;
+	Pattern.bUseSecondaryTint = bUseSecondaryTint;
+	Pattern.bAlternateTint = true;
+	QueueAttackPattern(Pattern);
 }
 
 void AT66BossBase::QueueRadialBurst(
@@ -984,18 +1005,17 @@ void AT66BossBase::QueueRadialBurst(
 		return;
 	}
 
-	const float StepDegrees = 360.f / static_cast<float>(ShotCount);
-	for (int32 Index = 0; Index < ShotCount; ++Index)
-	{
-		const float AngleDegrees = StartAngleDegrees + StepDegrees * static_cast<float>(Index);
-		const FVector Direction = FRotator(0.f, AngleDegrees, 0.f).Vector();
-		QueueProjectileShotDirection(
-			Direction,
-			InitialDelaySeconds + DelayStepSeconds * static_cast<float>(Index),
-			SpeedScale,
-			FVector::ZeroVector,
-			bUseSecondaryTint && ((Index % 2) == 1));
-	}
+	FT66BossAttackPattern Pattern;
+	Pattern.StartSeconds = AttackTimelineSeconds + FMath::Max(0.f, InitialDelaySeconds);
+	Pattern.StepSeconds = DelayStepSeconds;
+	Pattern.ShotCount = ShotCount;
+	Pattern.BaseDirection = FVector::ForwardVector;
+	Pattern.StartYawDegrees = StartAngleDegrees;
+	Pattern.StepYawDegrees = 360.f / static_cast<float>(ShotCount);
+	Pattern.SpeedScale = SpeedScale;
+	Pattern.bUseSecondaryTint = bUseSecondaryTint;
+	Pattern.bAlternateTint = true;
+	QueueAttackPattern(Pattern);
 }
 
 void AT66BossBase::SpawnGroundAOEAtLocation(const FVector& WorldLocation, const float RadiusScale, const float WarningScale, const bool bUseSecondaryTint)
@@ -1057,9 +1077,54 @@ void AT66BossBase::BeginPlay()
 	RebuildBossPartState(false);
 }
 
+void AT66BossBase::RequestBossCharacterVisual(const FName VisualID, const float AppliedMeshScale)
+{
+	UGameInstance* GI = GetWorld() ? GetWorld()->GetGameInstance() : nullptr;
+	UT66CharacterVisualSubsystem* Visuals = GI ? GI->GetSubsystem<UT66CharacterVisualSubsystem>() : nullptr;
+	if (!Visuals)
+	{
+		return;
+	}
+
+	Visuals->RequestCharacterVisual(
+		VisualID,
+		GetMesh(),
+		VisualMesh,
+		true,
+		FT66OnCharacterVisualApplied::CreateUObject(this, &AT66BossBase::HandleBossCharacterVisualApplied, AppliedMeshScale));
+}
+
+void AT66BossBase::HandleBossCharacterVisualApplied(const bool bApplied, const float AppliedMeshScale)
+{
+	USkeletalMeshComponent* SkelMesh = GetMesh();
+	if (!SkelMesh)
+	{
+		return;
+	}
+
+	if (!bApplied)
+	{
+		SkelMesh->SetVisibility(false, true);
+		return;
+	}
+
+	if (!FMath::IsNearlyEqual(AppliedMeshScale, 1.f))
+	{
+		SkelMesh->SetRelativeScale3D(SkelMesh->GetRelativeScale3D() * AppliedMeshScale);
+	}
+}
+
 void AT66BossBase::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-	ClearPendingAttackTimers();
+	ClearAttackTimeline();
+
+	if (UGameInstance* GI = GetGameInstance())
+	{
+		if (UT66CharacterVisualSubsystem* Visuals = GI->GetSubsystem<UT66CharacterVisualSubsystem>())
+		{
+			Visuals->CancelCharacterVisualRequest(GetMesh());
+		}
+	}
 
 	if (UWorld* World = GetWorld())
 	{
@@ -1076,6 +1141,8 @@ void AT66BossBase::Tick(float DeltaSeconds)
 {
 	Super::Tick(DeltaSeconds);
 
+	AdvanceAttackTimeline(DeltaSeconds);
+
 	APawn* PlayerPawn = ResolvePlayerPawn();
 	if (!PlayerPawn) return;
 
@@ -1321,7 +1388,8 @@ void AT66BossBase::Awaken()
 	UWorld* World = GetWorld();
 	if (World)
 	{
-		ClearPendingAttackTimers();
+		ClearAttackTimeline();
+		SeedAttackStream();
 		World->GetTimerManager().SetTimer(FireTimerHandle, this, &AT66BossBase::FireAtPlayer, FireIntervalSeconds, true, 0.25f);
 
 		if (GroundAOEIntervalSeconds > 0.f)
@@ -1341,7 +1409,7 @@ void AT66BossBase::FireAtPlayer()
 	APawn* PlayerPawn = ResolvePlayerPawn();
 	if (!PlayerPawn) return;
 
-	ClearPendingAttackTimers();
+	ClearAttackTimeline();
 
 	const FVector TargetLocation = PlayerPawn->GetActorLocation();
 	const FVector PlanarToTarget = (TargetLocation - GetActorLocation()).GetSafeNormal2D();
@@ -1363,7 +1431,7 @@ void AT66BossBase::FireAtPlayer()
 
 	case ET66BossAttackProfile::Juggernaut:
 		QueueProjectileFanBurst(TargetLocation, Phase == 0 ? 5 : 7, 30.f + 4.f * static_cast<float>(Phase), 0.05f, 0.94f + 0.05f * static_cast<float>(Phase), 0.f, 46.f, false);
-		QueueRadialBurst(Phase == 0 ? 6 : (Phase == 1 ? 8 : 10), 0.025f, FMath::FRandRange(0.f, 360.f), 0.76f + 0.05f * static_cast<float>(Phase), 0.18f, true);
+		QueueRadialBurst(Phase == 0 ? 6 : (Phase == 1 ? 8 : 10), 0.025f, AttackStream.FRandRange(0.f, 360.f), 0.76f + 0.05f * static_cast<float>(Phase), 0.18f, true);
 		break;
 
 	case ET66BossAttackProfile::Duelist:
@@ -1390,11 +1458,11 @@ void AT66BossBase::FireAtPlayer()
 		break;
 
 	case ET66BossAttackProfile::Gambler:
-		QueueRadialBurst(6 + Phase * 2, 0.02f, FMath::FRandRange(0.f, 360.f), 0.86f + 0.04f * static_cast<float>(Phase), 0.f, true);
+		QueueRadialBurst(6 + Phase * 2, 0.02f, AttackStream.FRandRange(0.f, 360.f), 0.86f + 0.04f * static_cast<float>(Phase), 0.f, true);
 		QueueProjectileFanBurst(TargetLocation, 3 + Phase, 16.f + 2.f * static_cast<float>(Phase), 0.05f, 1.10f + 0.05f * static_cast<float>(Phase), 0.16f, 20.f, false);
 		if (Phase >= 2)
 		{
-			QueueProjectileShotTowards(TargetLocation, 0.32f, FMath::FRandRange(-12.f, 12.f), 1.35f, FVector::ZeroVector, true);
+			QueueProjectileShotTowards(TargetLocation, 0.32f, AttackStream.FRandRange(-12.f, 12.f), 1.35f, FVector::ZeroVector, true);
 		}
 		break;
 
@@ -1556,7 +1624,7 @@ void AT66BossBase::SpawnGroundAOE()
 	case ET66BossAttackProfile::Gambler:
 	{
 		const int32 SpotCount = Phase == 0 ? 3 : (Phase == 1 ? 5 : 6);
-		const float RandomStart = FMath::FRandRange(0.f, 360.f);
+		const float RandomStart = AttackStream.FRandRange(0.f, 360.f);
 		for (int32 Index = 0; Index < SpotCount; ++Index)
 		{
 			const float Angle = RandomStart + (360.f / static_cast<float>(SpotCount)) * static_cast<float>(Index);
@@ -1598,7 +1666,7 @@ void AT66BossBase::Die()
 	UWorld* World = GetWorld();
 	if (World)
 	{
-		ClearPendingAttackTimers();
+		ClearAttackTimeline();
 		World->GetTimerManager().ClearTimer(FireTimerHandle);
 		World->GetTimerManager().ClearTimer(AOETimerHandle);
 		UT66CombatComponent::SpawnDeathBurstAtLocation(World, GetActorLocation(), 32, 120.f);
@@ -38,6 +38,30 @@ struct FT66BossPartRuntimeState
 	TObjectPtr<UT66CombatHitZoneComponent> ZoneComponent = nullptr;
 };
 
+/**
+ * One queued volley on a boss attack timeline: ShotCount projectiles fired StepSeconds apart,
+ * each rotated by StepYawDegrees and offset along SideAxis across the pattern.
+ */
+struct FT66BossAttackPattern
+{
+	float StartSeconds = 0.f;
+	float StepSeconds = 0.f;
+	int32 ShotCount = 1;
+	int32 NextShotIndex = 0;
+	FVector BaseDirection = FVector::ForwardVector;
+	float StartYawDegrees = 0.f;
+	float StepYawDegrees = 0.f;
+	FVector SideAxis = FVector::ZeroVector;
+	float SideOffsetDistance = 0.f;
+	FVector SpawnOffset = FVector::ZeroVector;
+	float SpeedScale = 1.f;
+	bool bUseSecondaryTint = false;
+	/** When set, only odd shots use the secondary tint. */
+	bool bAlternateTint = false;
+
+	float GetNextShotSeconds() const { return StartSeconds + StepSeconds * static_cast<float>(NextShotIndex); }
+};
+
 /** Boss: dormant until player proximity, then awakens, chases, and fires projectiles. */
 UCLASS(Blueprintable)
 class T66_API AT66BossBase : public ACharacter
@@ -156,6 +180,9 @@ public:
 
 	int32 GetPointValue() const { return PointValue; }
 
+	/** Imported visual worn by stage bosses (the live Cow mob asset). */
+	static const FName StageBossCharacterVisualID;
+
 protected:
 	virtual void BeginPlay() override;
 	virtual void Tick(float DeltaSeconds) override;
@@ -166,6 +193,10 @@ protected:
 	void SpawnGroundAOE();
 	virtual void Die();
 
+	/** Streams the boss's imported mesh without blocking; the placeholder stays up until it lands. AppliedMeshScale multiplies the swapped-in mesh. */
+	void RequestBossCharacterVisual(FName VisualID, float AppliedMeshScale = 1.f);
+	void HandleBossCharacterVisualApplied(bool bApplied, float AppliedMeshScale);
+
 	FTimerHandle FireTimerHandle;
 	FTimerHandle AOETimerHandle;
 
@@ -187,12 +218,14 @@ private:
 	FVector ResolveGroundLocation(const FVector& PreferredLocation) const;
 	void SpawnGroundAOEAtLocation(const FVector& WorldLocation, float RadiusScale = 1.f, float WarningScale = 1.f, bool bUseSecondaryTint = false);
 	void SpawnProjectileInDirection(const FVector& Direction, float SpeedScale = 1.f, const FVector& SpawnOffset = FVector::ZeroVector, bool bUseSecondaryTint = false);
-	void QueueTimedAttackLambda(FTimerDelegate&& Delegate, float DelaySeconds);
+	void SeedAttackStream();
+	void QueueAttackPattern(const FT66BossAttackPattern& Pattern);
+	void AdvanceAttackTimeline(float DeltaSeconds);
 	void QueueProjectileShotTowards(const FVector& TargetLocation, float DelaySeconds, float YawOffsetDegrees = 0.f, float SpeedScale = 1.f, const FVector& SpawnOffset = FVector::ZeroVector, bool bUseSecondaryTint = false);
 	void QueueProjectileShotDirection(const FVector& Direction, float DelaySeconds, float SpeedScale = 1.f, const FVector& SpawnOffset = FVector::ZeroVector, bool bUseSecondaryTint = false);
 	void QueueProjectileFanBurst(const FVector& TargetLocation, int32 ShotCount, float SpreadDegrees, float DelayStepSeconds, float SpeedScale = 1.f, float InitialDelaySeconds = 0.f, float SideOffsetDistance = 0.f, bool bUseSecondaryTint = false);
 	void QueueRadialBurst(int32 ShotCount, float DelayStepSeconds, float StartAngleDegrees, float SpeedScale = 1.f, float InitialDelaySeconds = 0.f, bool bUseSecondaryTint = false);
-	void ClearPendingAttackTimers();
+	void ClearAttackTimeline();
 
 	bool bBaseTuningInitialized = false;
 	int32 BaseMaxHP = 0;
@@ -215,7 +248,11 @@ private:
 	UPROPERTY(Transient)
 	TArray<FT66BossPartRuntimeState> BossPartStates;
 
-	UPROPERTY(Transient)
-	TArray<FTimerHandle> PendingAttackTimerHandles;
+	/** Pending volley patterns sorted by start time; due shots are emitted once per Tick. */
+	TArray<FT66BossAttackPattern> AttackTimeline;
+	float AttackTimelineSeconds = 0.f;
+
+	/** Seeded from the run seed, boss and stage on awaken so volleys replay identically. */
+	FRandomStream AttackStream;
 };
 
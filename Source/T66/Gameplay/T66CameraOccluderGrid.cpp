@@ -0,0 +1,173 @@
+// Copyright Tribulation 66. All Rights Reserved.
+
+#include "Gameplay/T66CameraOccluderGrid.h"
+
+#include "Gameplay/T66TowerMapTerrain.h"
+#include "GameFramework/Actor.h"
+
+void FT66CameraOccluderGrid::Rebuild(const T66TowerMapTerrain::FLayout& Layout, const TConstArrayView<AActor*> WallActors)
+{
+	Reset();
+
+	// Wall actors are spawned centred on their layout box, so a rounded XY key finds the actor for each box.
+	TMap<FIntPoint, TArray<AActor*, TInlineAllocator<8>>> ActorsByCenter;
+	for (AActor* Actor : WallActors)
+	{
+		if (Actor)
+		{
+			const FVector Location = Actor->GetActorLocation();
+			ActorsByCenter.FindOrAdd(FIntPoint(FMath::RoundToInt(Location.X), FMath::RoundToInt(Location.Y))).Add(Actor);
+		}
+	}
+
+	const auto AddWallBox = [&](const FBox2D& WallBox, const T66TowerMapTerrain::FFloor& Floor)
+	{
+		const FVector2D Center = WallBox.GetCenter();
+		const TArray<AActor*, TInlineAllocator<8>>* Candidates = ActorsByCenter.Find(FIntPoint(FMath::RoundToInt(Center.X), FMath::RoundToInt(Center.Y)));
+		if (!Candidates)
+		{
+			return;
+		}
+
+		for (AActor* Actor : *Candidates)
+		{
+			const float ActorZ = Actor->GetActorLocation().Z;
+			if (ActorZ < Floor.SurfaceZ || ActorZ > Floor.SurfaceZ + Layout.FloorSpacing)
+			{
+				continue;
+			}
+
+			const FBox ActorBounds = Actor->GetComponentsBoundingBox();
+			FEntry& Entry = Entries.AddDefaulted_GetRef();
+			Entry.Actor = Actor;
+			Entry.Bounds = FBox(FVector(WallBox.Min, ActorBounds.Min.Z), FVector(WallBox.Max, ActorBounds.Max.Z));
+			return;
+		}
+	};
+
+	const float WallHalfDepth = Layout.WallThickness * 0.5f;
+	const float WallHalfSpan = Layout.ShellRadius + WallHalfDepth;
+	const FBox2D ShellWallBoxes[] =
+	{
+		FBox2D(FVector2D(Layout.ShellRadius - WallHalfDepth, -WallHalfSpan), FVector2D(Layout.ShellRadius + WallHalfDepth, WallHalfSpan)),
+		FBox2D(FVector2D(-Layout.ShellRadius - WallHalfDepth, -WallHalfSpan), FVector2D(-Layout.ShellRadius + WallHalfDepth, WallHalfSpan)),
+		FBox2D(FVector2D(-WallHalfSpan, Layout.ShellRadius - WallHalfDepth), FVector2D(WallHalfSpan, Layout.ShellRadius + WallHalfDepth)),
+		FBox2D(FVector2D(-WallHalfSpan, -Layout.ShellRadius - WallHalfDepth), FVector2D(WallHalfSpan, -Layout.ShellRadius + WallHalfDepth)),
+	};
+
+	for (const T66TowerMapTerrain::FFloor& Floor : Layout.Floors)
+	{
+		for (const FBox2D& ShellWallBox : ShellWallBoxes)
+		{
+			AddWallBox(ShellWallBox, Floor);
+		}
+		for (const FBox2D& WallBox : Floor.MazeWallBoxes)
+		{
+			AddWallBox(WallBox, Floor);
+		}
+	}
+
+	if (Entries.Num() == 0)
+	{
+		return;
+	}
+
+	CellsPerAxis = FMath::Max(1, FMath::CeilToInt((WallHalfSpan * 2.f) / CellSize));
+	GridMin = FVector2D(-WallHalfSpan, -WallHalfSpan);
+	const int32 CellCount = CellsPerAxis * CellsPerAxis;
+
+	const auto ForEachOverlappedCell = [this](const FBox& Bounds, auto&& Visitor)
+	{
+		const FIntPoint MinCell = ToCell(FVector2D(Bounds.Min.X, Bounds.Min.Y));
+		const FIntPoint MaxCell = ToCell(FVector2D(Bounds.Max.X, Bounds.Max.Y));
+		for (int32 CellY = MinCell.Y; CellY <= MaxCell.Y; ++CellY)
+		{
+			for (int32 CellX = MinCell.X; CellX <= MaxCell.X; ++CellX)
+			{
+				Visitor(ToCellIndex(FIntPoint(CellX, CellY)));
+			}
+		}
+	};
+
+	CellStarts.Init(0, CellCount + 1);
+	for (const FEntry& Entry : Entries)
+	{
+		ForEachOverlappedCell(Entry.Bounds, [this](const int32 CellIndex) { ++CellStarts[CellIndex + 1]; });
+	}
+	for (int32 CellIndex = 1; CellIndex <= CellCount; ++CellIndex)
+	{
+		CellStarts[CellIndex] += CellStarts[CellIndex - 1];
+	}
+
+	CellEntries.SetNumUninitialized(CellStarts[CellCount]);
+	TArray<int32> CellCursors(CellStarts.GetData(), CellCount);
+	for (int32 EntryIndex = 0; EntryIndex < Entries.Num(); ++EntryIndex)
+	{
+		ForEachOverlappedCell(Entries[EntryIndex].Bounds, [this, &CellCursors, EntryIndex](const int32 CellIndex)
+		{
+			CellEntries[CellCursors[CellIndex]++] = EntryIndex;
+		});
+	}
+
+	EntryQueryStamps.Init(0, Entries.Num());
+}
+
+void FT66CameraOccluderGrid::Reset()
+{
+	CellsPerAxis = 0;
+	CellStarts.Reset();
+	CellEntries.Reset();
+	Entries.Reset();
+	EntryQueryStamps.Reset();
+	QueryStamp = 0;
+}
+
+void FT66CameraOccluderGrid::FindAlongSegment(const FVector& Start, const FVector& End, const float Radius, TArray<AActor*>& InOutActors) const
+{
+	if (CellsPerAxis <= 0 || Entries.Num() == 0)
+	{
+		return;
+	}
+
+	if (++QueryStamp == 0)
+	{
+		EntryQueryStamps.Init(0, Entries.Num());
+		QueryStamp = 1;
+	}
+
+	const FIntPoint MinCell = ToCell(FVector2D(FMath::Min(Start.X, End.X) - Radius, FMath::Min(Start.Y, End.Y) - Radius));
+	const FIntPoint MaxCell = ToCell(FVector2D(FMath::Max(Start.X, End.X) + Radius, FMath::Max(Start.Y, End.Y) + Radius));
+	const FVector StartToEnd = End - Start;
+	const FVector Padding(Radius);
+
+	for (int32 CellY = MinCell.Y; CellY <= MaxCell.Y; ++CellY)
+	{
+		for (int32 CellX = MinCell.X; CellX <= MaxCell.X; ++CellX)
+		{
+			const int32 CellIndex = ToCellIndex(FIntPoint(CellX, CellY));
+			for (int32 Slot = CellStarts[CellIndex]; Slot < CellStarts[CellIndex + 1]; ++Slot)
+			{
+				const int32 EntryIndex = CellEntries[Slot];
+				if (EntryQueryStamps[EntryIndex] == QueryStamp)
+				{
+					continue;
+				}
+
+				EntryQueryStamps[EntryIndex] = QueryStamp;
+				const FEntry& Entry = Entries[EntryIndex];
+				AActor* Actor = Entry.Actor.Get();
+				if (Actor && FMath::LineBoxIntersection(Entry.Bounds.ExpandBy(Padding), Start, End, StartToEnd))
+				{
+					InOutActors.AddUnique(Actor);
+				}
+			}
+		}
+	}
+}
+
+FIntPoint FT66CameraOccluderGrid::ToCell(const FVector2D& Location) const
+{
+	return FIntPoint(
+		FMath::Clamp(FMath::FloorToInt((Location.X - GridMin.X) / CellSize), 0, CellsPerAxis - 1),
+		FMath::Clamp(FMath::FloorToInt((Location.Y - GridMin.Y) / CellSize), 0, CellsPerAxis - 1));
+}
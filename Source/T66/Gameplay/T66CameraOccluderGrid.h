@@ -0,0 +1,51 @@
+// Copyright Tribulation 66. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class AActor;
+
+namespace T66TowerMapTerrain
+{
+	struct FLayout;
+}
+
+/**
+ * Uniform 2D grid over the tower's maze and shell wall boxes, used to find the walls between the
+ * gameplay camera and the hero without per-frame physics sweeps. Owned by AT66PlayerController and
+ * rebuilt whenever the active tower layout changes; each entry binds a layout wall box to the actor
+ * spawned for it.
+ */
+class T66_API FT66CameraOccluderGrid
+{
+public:
+	void Rebuild(const T66TowerMapTerrain::FLayout& Layout, TConstArrayView<AActor*> WallActors);
+	void Reset();
+
+	int32 Num() const { return Entries.Num(); }
+
+	/** Adds every indexed wall whose bounds, padded by Radius, the segment passes through. */
+	void FindAlongSegment(const FVector& Start, const FVector& End, float Radius, TArray<AActor*>& InOutActors) const;
+
+private:
+	struct FEntry
+	{
+		TWeakObjectPtr<AActor> Actor;
+		FBox Bounds;
+	};
+
+	FIntPoint ToCell(const FVector2D& Location) const;
+	int32 ToCellIndex(const FIntPoint& Cell) const { return (Cell.Y * CellsPerAxis) + Cell.X; }
+
+	static constexpr float CellSize = 1000.f;
+
+	FVector2D GridMin = FVector2D::ZeroVector;
+	int32 CellsPerAxis = 0;
+	/** Cell lists in compressed form: entries for cell N are CellEntries[CellStarts[N] .. CellStarts[N + 1]). */
+	TArray<int32> CellStarts;
+	TArray<int32> CellEntries;
+	TArray<FEntry> Entries;
+	mutable TArray<uint32> EntryQueryStamps;
+	mutable uint32 QueryStamp = 0;
+};
@@ -26,7 +26,6 @@
 #include "CollisionQueryParams.h"
 #include "Components/CapsuleComponent.h"
 #include "HAL/IConsoleManager.h"
-#include "TimerManager.h"
 #include "UObject/SoftObjectPath.h"
 
 DEFINE_LOG_CATEGORY(LogT66Combat);
@@ -160,7 +159,8 @@ namespace
 
 UT66CombatComponent::UT66CombatComponent()
 {
-	PrimaryComponentTick.bCanEverTick = false;
+	PrimaryComponentTick.bCanEverTick = true;
+	PrimaryComponentTick.bStartWithTickEnabled = true;
 
 	SlashVFXNiagara = TSoftObjectPtr<UNiagaraSystem>(FSoftObjectPath(TEXT("/Game/VFX/VFX_Attack1.VFX_Attack1")));
 	PixelVFXNiagara = TSoftObjectPtr<UNiagaraSystem>(FSoftObjectPath(TEXT("/Game/VFX/NS_PixelParticle.NS_PixelParticle")));
@@ -344,19 +344,14 @@ void UT66CombatComponent::BeginPlay()
 		}
 	}
 
-	GetWorld()->GetTimerManager().SetTimer(FireTimerHandle, this, &UT66CombatComponent::TryFire, EffectiveFireIntervalSeconds, true, EffectiveFireIntervalSeconds);
+	FireAccumulatorSeconds = 0.f;
 
-	UE_LOG(LogT66Combat, Log, TEXT("[GOLD] CombatComponent: initialized — overlap sphere (radius=%.0f), VFX pooling (AutoRelease), timer-based fire (%.2fs)"),
+	UE_LOG(LogT66Combat, Log, TEXT("[GOLD] CombatComponent: initialized — overlap sphere (radius=%.0f), VFX pooling (AutoRelease), tick-batched fire (%.2fs)"),
 		AttackRange, EffectiveFireIntervalSeconds);
 }
 
 void UT66CombatComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-	if (UWorld* World = GetWorld())
-	{
-		World->GetTimerManager().ClearTimer(FireTimerHandle);
-	}
-
 	if (CachedRunState)
 	{
 		CachedRunState->InventoryChanged.RemoveDynamic(this, &UT66CombatComponent::HandleInventoryChanged);
@@ -381,6 +376,31 @@ void UT66CombatComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 	Super::EndPlay(EndPlayReason);
 }
 
+// ---------------------------------------------------------------------------
+// TickComponent — banks frame time and fires every shot that came due as one
+// volley. A looping timer would instead call TryFire once per elapsed
+// interval, repeating the whole resolution several times in a slow frame.
+// ---------------------------------------------------------------------------
+void UT66CombatComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	if (EffectiveFireIntervalSeconds <= 0.f)
+	{
+		return;
+	}
+
+	FireAccumulatorSeconds += DeltaTime;
+	if (FireAccumulatorSeconds < EffectiveFireIntervalSeconds)
+	{
+		return;
+	}
+
+	const int32 DueShots = FMath::FloorToInt(FireAccumulatorSeconds / EffectiveFireIntervalSeconds);
+	FireAccumulatorSeconds -= static_cast<float>(DueShots) * EffectiveFireIntervalSeconds;
+	TryFire(FMath::Min(DueShots, MaxShotsPerVolley));
+}
+
 // ---------------------------------------------------------------------------
 // Overlap callbacks — maintain EnemiesInRange.
 // ---------------------------------------------------------------------------
@@ -664,16 +684,9 @@ FT66CombatTargetHandle UT66CombatComponent::FindClosestTargetHandleInRange(const
 void UT66CombatComponent::HandleInventoryChanged()
 {
 	UE_LOG(LogT66Combat, Verbose, TEXT("[IDOL CACHE] HandleInventoryChanged owner=%s"), GetOwner() ? *GetOwner()->GetName() : TEXT("None"));
-	const float OldInterval = EffectiveFireIntervalSeconds;
 	RecomputeFromRunState();
-	if (!FMath::IsNearlyEqual(OldInterval, EffectiveFireIntervalSeconds, 0.001f))
-	{
-		if (UWorld* World = GetWorld())
-		{
-			World->GetTimerManager().ClearTimer(FireTimerHandle);
-			World->GetTimerManager().SetTimer(FireTimerHandle, this, &UT66CombatComponent::TryFire, EffectiveFireIntervalSeconds, true, EffectiveFireIntervalSeconds);
-		}
-	}
+	// A new interval takes effect on the next shot; banked time never exceeds one interval.
+	FireAccumulatorSeconds = FMath::Min(FireAccumulatorSeconds, EffectiveFireIntervalSeconds);
 
 	// Keep the hero's range ring in sync (attack range changes with Scale).
 	if (AT66HeroBase* Hero = Cast<AT66HeroBase>(GetOwner()))
@@ -829,11 +842,13 @@ float UT66CombatComponent::GetAutoAttackCooldownProgress() const
 // TryFire — the hero auto-attack heartbeat.
 // Target finding now walks the small EnemiesInRange list (maintained by sphere
 // overlap events) instead of doing 3x TActorIterator over the entire world.
+// ShotCount > 1 only when several intervals elapsed in one frame: the shots
+// share one stat snapshot and target, and their VFX/SFX are emitted together.
 // ---------------------------------------------------------------------------
-void UT66CombatComponent::TryFire()
+void UT66CombatComponent::TryFire(const int32 ShotCount)
 {
 	AActor* OwnerActor = GetOwner();
-	if (!OwnerActor) return;
+	if (!OwnerActor || ShotCount <= 0) return;
 
 	UWorld* World = GetWorld();
 	if (!World) return;
@@ -857,16 +872,35 @@ void UT66CombatComponent::TryFire()
 
 	LastFireTime = static_cast<float>(World->GetTimeSeconds());
 
+	// Stat snapshot shared by every shot in the volley.
+	const bool bHasRunState = CachedRunState != nullptr;
+	const float CritChance = bHasRunState ? CachedRunState->GetCritChance01() : 0.f;
+	const float CritDamageMult = bHasRunState ? CachedRunState->GetCritDamageMultiplier() : 1.f;
+	const float CloseRangeThreshold = bHasRunState ? CachedRunState->GetCloseRangeThreshold() : 0.f;
+	const float LongRangeThreshold = bHasRunState ? CachedRunState->GetLongRangeThreshold() : 0.f;
+	const float CloseRangeDamageMult = bHasRunState ? CachedRunState->GetCloseRangeDamageMultiplier() : 1.f;
+	const float LongRangeDamageMult = bHasRunState ? CachedRunState->GetLongRangeDamageMultiplier() : 1.f;
+	const ET66PassiveType PassiveType = bHasRunState ? CachedRunState->GetPassiveType() : ET66PassiveType::None;
+
+	// Every shot's presentation is collected here and emitted once per effect type after the volley resolves.
+	VolleyPresentation.Reset();
+	auto AddVolleyChain = [this](const TArray<FVector>& ChainPositions)
+	{
+		FVolleyChain Chain;
+		Chain.FirstPoint = VolleyPresentation.ChainPoints.Num();
+		Chain.NumPoints = ChainPositions.Num();
+		VolleyPresentation.ChainPoints.Append(ChainPositions);
+		return Chain;
+	};
+
 	// Crit: roll per hit; multiply damage and pass EventType_Crit for floating text.
-	auto ResolveCrit = [this, RngSub](int32 BaseDamage) -> TPair<int32, FName>
+	auto ResolveCrit = [bHasRunState, CritChance, CritDamageMult, RngSub](int32 BaseDamage) -> TPair<int32, FName>
 	{
-		if (!CachedRunState) return { BaseDamage, NAME_None };
-		const float CritChance = CachedRunState->GetCritChance01();
+		if (!bHasRunState) return { BaseDamage, NAME_None };
 		const bool bCrit = RollTierChance(CritChance, RngSub);
 		if (bCrit)
 		{
-			const float Mult = CachedRunState->GetCritDamageMultiplier();
-			return { FMath::Max(1, FMath::RoundToInt(static_cast<float>(BaseDamage) * Mult)), UT66FloatingCombatTextSubsystem::EventType_Crit };
+			return { FMath::Max(1, FMath::RoundToInt(static_cast<float>(BaseDamage) * CritDamageMult)), UT66FloatingCombatTextSubsystem::EventType_Crit };
 		}
 		return { BaseDamage, NAME_None };
 	};
@@ -875,23 +909,19 @@ void UT66CombatComponent::TryFire()
 
 	// Close/Long range damage: multiply base damage by range-based multiplier (close = 0–10% of range, long = 90–100%).
 	// OutRangeEvent set when in close/long zone and multiplier != 1 (for floating text on hero).
-	auto GetRangeMultipliedDamage = [this, MyLoc](int32 BaseDamage, AActor* Target, FName* OutRangeEvent = nullptr) -> int32
+	auto GetRangeMultipliedDamage = [&](int32 BaseDamage, AActor* Target, FName* OutRangeEvent = nullptr) -> int32
 	{
-		if (!CachedRunState || !Target) return BaseDamage;
+		if (!bHasRunState || !Target) return BaseDamage;
 		const float Dist = FVector::Dist(MyLoc, Target->GetActorLocation());
-		const float CloseThresh = CachedRunState->GetCloseRangeThreshold();
-		const float LongThresh = CachedRunState->GetLongRangeThreshold();
-		if (Dist <= CloseThresh)
+		if (Dist <= CloseRangeThreshold)
 		{
-			const float Mult = CachedRunState->GetCloseRangeDamageMultiplier();
-			if (OutRangeEvent && Mult != 1.f) *OutRangeEvent = UT66FloatingCombatTextSubsystem::EventType_CloseRange;
-			return FMath::Max(1, FMath::RoundToInt(static_cast<float>(BaseDamage) * Mult));
+			if (OutRangeEvent && CloseRangeDamageMult != 1.f) *OutRangeEvent = UT66FloatingCombatTextSubsystem::EventType_CloseRange;
+			return FMath::Max(1, FMath::RoundToInt(static_cast<float>(BaseDamage) * CloseRangeDamageMult));
 		}
-		if (Dist >= LongThresh)
+		if (Dist >= LongRangeThreshold)
 		{
-			const float Mult = CachedRunState->GetLongRangeDamageMultiplier();
-			if (OutRangeEvent && Mult != 1.f) *OutRangeEvent = UT66FloatingCombatTextSubsystem::EventType_LongRange;
-			return FMath::Max(1, FMath::RoundToInt(static_cast<float>(BaseDamage) * Mult));
+			if (OutRangeEvent && LongRangeDamageMult != 1.f) *OutRangeEvent = UT66FloatingCombatTextSubsystem::EventType_LongRange;
+			return FMath::Max(1, FMath::RoundToInt(static_cast<float>(BaseDamage) * LongRangeDamageMult));
 		}
 		return BaseDamage;
 	};
@@ -927,6 +957,7 @@ void UT66CombatComponent::TryFire()
 			&& FMath::IsNearlyEqual(CachedPierceRadius, PierceRadius))
 		{
 			OutTargets = CachedPierceTargets;
+			OutTargets.RemoveAll([](AActor* Target) { return !IsValidAutoTarget(Target); });
 			OutDir = CachedPierceDirection;
 			return;
 		}
@@ -996,6 +1027,7 @@ void UT66CombatComponent::TryFire()
 			&& FMath::IsNearlyEqual(CachedSlashRadius, Radius))
 		{
 			OutTargets = CachedSlashTargets;
+			OutTargets.RemoveAll([](AActor* Target) { return !IsValidAutoTarget(Target); });
 			return;
 		}
 
@@ -1051,6 +1083,7 @@ void UT66CombatComponent::TryFire()
 			HeroDataForPrimary = CachedHeroData;
 		}
 	}
+	const FLinearColor HeroTint = bHaveHeroData ? HeroDataForPrimary.PlaceholderColor : FLinearColor::White;
 	FT66CombatTargetHandle PrimaryTargetHandle;
 
 	// --- Pierce (straight line): full range so enemies behind the first are hit; 10% damage reduction per pierced target. ---
@@ -1082,28 +1115,14 @@ void UT66CombatComponent::TryFire()
 			ApplyDamageToTargetHandle(HitHandle, Resolved.Key, Resolved.Value, NAME_None, RangeEvent);
 		}
 
-		if (CurrentHeroID == FName(TEXT("Hero_1")))
-		{
-			const float FurthestDistance = InLine.Num() > 0
-				? FVector::Dist2D(MyLoc, InLine.Last()->GetActorLocation())
-				: FVector::Dist2D(MyLoc, TargetLoc);
-			const FVector VFXStart = MyLoc + FVector(0.f, 0.f, 8.f);
-			const FVector VFXEnd = MyLoc + Dir * FMath::Min(LineLength, FurthestDistance + 80.f) + FVector(0.f, 0.f, 8.f);
-			const FVector ImpactLoc = TargetLoc + FVector(0.f, 0.f, 10.f);
-			SpawnHeroOnePierceVFX(VFXStart, VFXEnd, ImpactLoc);
-		}
-		else
-		{
-			const float FurthestDistance = InLine.Num() > 0
-				? FVector::Dist2D(MyLoc, InLine.Last()->GetActorLocation())
-				: FVector::Dist2D(MyLoc, TargetLoc);
-			const FVector VFXStart = MyLoc + FVector(0.f, 0.f, 8.f);
-			const FVector VFXEnd = MyLoc + Dir * FMath::Min(LineLength, FurthestDistance + 80.f) + FVector(0.f, 0.f, 8.f);
-			const FVector ImpactLoc = TargetLoc + FVector(0.f, 0.f, 10.f);
-			const FLinearColor HeroTint = bHaveHeroData ? HeroDataForPrimary.PlaceholderColor : FLinearColor::White;
-			SpawnHeroPierceVFX(VFXStart, VFXEnd, ImpactLoc, HeroTint, CurrentHeroID);
-		}
-		PlayHeroAttackSfx(CurrentHeroID, AttackCategory, TargetLoc);
+		const float FurthestDistance = InLine.Num() > 0
+			? FVector::Dist2D(MyLoc, InLine.Last()->GetActorLocation())
+			: FVector::Dist2D(MyLoc, TargetLoc);
+		const FVector VFXStart = MyLoc + FVector(0.f, 0.f, 8.f);
+		const FVector VFXEnd = MyLoc + Dir * FMath::Min(LineLength, FurthestDistance + 80.f) + FVector(0.f, 0.f, 8.f);
+		const FVector ImpactLoc = TargetLoc + FVector(0.f, 0.f, 10.f);
+		VolleyPresentation.HeroBeams.Add({ VFXStart, VFXEnd, ImpactLoc });
+		VolleyPresentation.SfxLocations.Add(TargetLoc);
 		return true;
 	};
 
@@ -1123,7 +1142,7 @@ void UT66CombatComponent::TryFire()
 
 		const int32 HitCount = SlashTargets.Num();
 		float ArcaneMult = 1.f;
-		if (CachedRunState && CachedRunState->GetPassiveType() == ET66PassiveType::ArcaneAmplification)
+		if (PassiveType == ET66PassiveType::ArcaneAmplification)
 		{
 			if (HitCount >= 5) ArcaneMult = 1.35f;
 			else if (HitCount >= 3) ArcaneMult = 1.2f;
@@ -1151,9 +1170,10 @@ void UT66CombatComponent::TryFire()
 			}
 		}
 
-		const FLinearColor HeroTint = bHaveHeroData ? HeroDataForPrimary.PlaceholderColor : FLinearColor::White;
-		SpawnHeroSlashVFX(SlashCenter, EffectiveSlashRadius, HeroTint, CurrentHeroID);
-		PlayHeroAttackSfx(CurrentHeroID, AttackCategory, SlashCenter);
+		FVolleyPoint& Slash = VolleyPresentation.HeroSlashes.AddDefaulted_GetRef();
+		Slash.Location = SlashCenter;
+		Slash.Radius = EffectiveSlashRadius;
+		VolleyPresentation.SfxLocations.Add(SlashCenter);
 		return true;
 	};
 
@@ -1200,7 +1220,7 @@ void UT66CombatComponent::TryFire()
 			const TPair<int32, FName> Resolved = ResolveCrit(RangeDmg);
 			ApplyDamageToTargetHandle(NextHandle, Resolved.Key, Resolved.Value, NAME_None, RangeEvent);
 			// StaticCharge: 20% chance to confuse bounced targets.
-			if (CachedRunState && CachedRunState->GetPassiveType() == ET66PassiveType::StaticCharge)
+			if (PassiveType == ET66PassiveType::StaticCharge)
 			{
 				if (RollTierChance(0.2f, RngSub))
 				{
@@ -1212,9 +1232,8 @@ void UT66CombatComponent::TryFire()
 			DamageMult *= (1.f - Falloff);
 			--BouncesLeft;
 		}
-		const FLinearColor HeroTint = bHaveHeroData ? HeroDataForPrimary.PlaceholderColor : FLinearColor::White;
-		SpawnHeroBounceVFX(ChainPositions, HeroTint, CurrentHeroID);
-		PlayHeroAttackSfx(CurrentHeroID, AttackCategory, PrimaryLoc);
+		VolleyPresentation.HeroChains.Add(AddVolleyChain(ChainPositions));
+		VolleyPresentation.SfxLocations.Add(PrimaryLoc);
 		return true;
 	};
 
@@ -1245,9 +1264,13 @@ void UT66CombatComponent::TryFire()
 			if (AT66EnemyBase* DotEnemy = Cast<AT66EnemyBase>(PrimaryTarget))
 				DotEnemy->ApplyMoveSlow(0.7f, Duration);
 		}
-		const FLinearColor HeroTint = bHaveHeroData ? HeroDataForPrimary.PlaceholderColor : FLinearColor::White;
-		SpawnHeroDOTVFX(PrimaryTarget, GetTargetAimPoint(PrimaryHandle), Duration, 80.f, HeroTint, CurrentHeroID);
-		PlayHeroAttackSfx(CurrentHeroID, AttackCategory, GetTargetAimPoint(PrimaryHandle));
+		const FVector DotLoc = GetTargetAimPoint(PrimaryHandle);
+		FVolleyPoint& Dot = VolleyPresentation.HeroDots.AddDefaulted_GetRef();
+		Dot.FollowTarget = PrimaryTarget;
+		Dot.Location = DotLoc;
+		Dot.Radius = 80.f;
+		Dot.Duration = Duration;
+		VolleyPresentation.SfxLocations.Add(DotLoc);
 		return true;
 	};
 
@@ -1685,10 +1708,13 @@ void UT66CombatComponent::TryFire()
 	};
 
 	// ---------------------------------------------------------------------------
-	// Resolve primary target: locked > closest in EnemiesInRange.
-	// No TActorIterator — just walk the small overlap list.
+	// Resolve the volley target: locked > closest in EnemiesInRange.
+	// No TActorIterator — just walk the small overlap list. Extra shots in a
+	// volley take the next-closest enemies instead of overkilling one target;
+	// Marksman's Focus keeps the volley on one target so its stacks build as
+	// they would across separate frames.
 	// ---------------------------------------------------------------------------
-	AActor* PrimaryTarget = nullptr;
+	AActor* LockedPrimaryTarget = nullptr;
 	if (AActor* Locked = LockedTarget.Actor.Get())
 	{
 		if (IsValidTargetHandle(LockedTarget))
@@ -1696,7 +1722,7 @@ void UT66CombatComponent::TryFire()
 			const float DistSq = FVector::DistSquared(MyLoc, Locked->GetActorLocation());
 			if (DistSq <= RangeSq)
 			{
-				PrimaryTarget = Locked;
+				LockedPrimaryTarget = Locked;
 			}
 		}
 		else
@@ -1704,258 +1730,324 @@ void UT66CombatComponent::TryFire()
 			ClearLockedTarget();
 		}
 	}
-	if (!PrimaryTarget)
-	{
-		PrimaryTarget = FindClosestEnemyInRange(MyLoc, RangeSq);
-	}
-
-	PrimaryTargetHandle = PrimaryTarget
-		? ResolveAutoAttackTargetHandle(PrimaryTarget, LockedTarget.Actor.Get() == PrimaryTarget, RngSub)
-		: FT66CombatTargetHandle{};
 
-	// Marksman's Focus: consecutive hits on same target stack +8% damage (max 5).
-	float PrimaryDamageMultiplier = 1.f;
-	if (CachedRunState && CachedRunState->GetPassiveType() == ET66PassiveType::MarksmanFocus && PrimaryTarget)
+	TArray<AActor*, TInlineAllocator<MaxShotsPerVolley>> VolleyTargets;
+	if (LockedPrimaryTarget)
 	{
-		if (PrimaryTarget == LastMarksmanTarget.Get())
-			MarksmanStacks = FMath::Min(5, MarksmanStacks + 1);
-		else
-			MarksmanStacks = 1;
-		LastMarksmanTarget = PrimaryTarget;
-		PrimaryDamageMultiplier = 1.f + 0.08f * static_cast<float>(MarksmanStacks);
+		VolleyTargets.Add(LockedPrimaryTarget);
 	}
-
-	// QuickDraw: first attack after 2s idle = 2× damage.
-	if (CachedRunState)
-		PrimaryDamageMultiplier *= CachedRunState->GetQuickDrawDamageMultiplier();
-
-	// Deadeye ultimate buff: 2× damage while active.
-	const float Now = static_cast<float>(World->GetTimeSeconds());
-	if (DeadeyeEndTime > Now)
-		PrimaryDamageMultiplier *= 2.f;
-
-	// Notify RunState that an attack was fired (for Overclock counter, QuickDraw timer).
-	if (CachedRunState)
-		CachedRunState->NotifyAttackFired();
-
-	// Hero primary attack (Pierce / Bounce / AOE / DOT; VFX white).
-	if (PrimaryTarget)
+	else if (PassiveType == ET66PassiveType::MarksmanFocus)
 	{
-		const FVector PrimaryTargetImpactLocation = GetTargetAimPoint(PrimaryTargetHandle);
-		switch (AttackCategory)
+		if (AActor* FocusTarget = FindClosestEnemyInRange(MyLoc, RangeSq))
 		{
-		case ET66AttackCategory::Pierce: (void)PerformPierce(PrimaryTarget, PrimaryDamageMultiplier); break;
-		case ET66AttackCategory::Bounce: (void)PerformBounce(PrimaryTarget, PrimaryDamageMultiplier); break;
-		case ET66AttackCategory::AOE:   (void)PerformSlash(PrimaryTarget, PrimaryDamageMultiplier); break;
-		case ET66AttackCategory::DOT:   (void)PerformDOT(PrimaryTarget, PrimaryDamageMultiplier); break;
-		default: (void)PerformSlash(PrimaryTarget, PrimaryDamageMultiplier); break;
+			VolleyTargets.Add(FocusTarget);
 		}
-
-		// Overclock: every 8th attack fires a second time immediately.
-		if (CachedRunState && CachedRunState->ShouldOverclockDouble())
+	}
+	else
+	{
+		TSet<AActor*> ClaimedTargets;
+		while (VolleyTargets.Num() < ShotCount)
 		{
-			switch (AttackCategory)
+			AActor* NextTarget = FindClosestEnemyInRange(MyLoc, RangeSq, ClaimedTargets.Num() > 0 ? &ClaimedTargets : nullptr);
+			if (!NextTarget)
 			{
-			case ET66AttackCategory::Pierce: (void)PerformPierce(PrimaryTarget, 1.f); break;
-			case ET66AttackCategory::Bounce: (void)PerformBounce(PrimaryTarget, 1.f); break;
-			case ET66AttackCategory::AOE:   (void)PerformSlash(PrimaryTarget, 1.f); break;
-			case ET66AttackCategory::DOT:   (void)PerformDOT(PrimaryTarget, 1.f); break;
-			default: break;
+				break;
 			}
+			VolleyTargets.Add(NextTarget);
+			ClaimedTargets.Add(NextTarget);
 		}
+	}
 
-		// Evasive: if flagged, apply bonus 3s DOT to the primary target (50% of hit damage).
-		if (CachedRunState && CachedRunState->ConsumeEvasiveBonusDOT() && PrimaryTarget)
+	const float Now = static_cast<float>(World->GetTimeSeconds());
+
+	for (int32 ShotIndex = 0; ShotIndex < ShotCount; ++ShotIndex)
+	{
+		AActor* PrimaryTarget = nullptr;
+		if (VolleyTargets.Num() > 0)
 		{
-			static const FName EvasiveDotSource(TEXT("Passive_EvasiveDOT"));
-			const float BonusDotDamage = static_cast<float>(EffectiveDamagePerShot) * 0.5f;
-			const float EvasiveTicks = 6.f;
-			CachedRunState->ApplyDOT(PrimaryTarget, 3.f, 0.5f, BonusDotDamage / EvasiveTicks, EvasiveDotSource);
-			SpawnDOTVFX(PrimaryTarget->GetActorLocation(), 3.f, 60.f, FLinearColor(0.6f, 0.2f, 0.8f));
+			AActor*& VolleyTarget = VolleyTargets[ShotIndex % VolleyTargets.Num()];
+			if (VolleyTarget && !IsValidAutoTarget(VolleyTarget))
+			{
+				// Killed by an earlier shot of this volley.
+				VolleyTarget = FindClosestEnemyInRange(MyLoc, RangeSq);
+			}
+			PrimaryTarget = VolleyTarget;
 		}
 
-		// RabidFrenzy ultimate buff: every hit applies a short DOT.
-		if (RabidFrenzyEndTime > Now && CachedRunState && PrimaryTarget)
+		PrimaryTargetHandle = PrimaryTarget
+			? ResolveAutoAttackTargetHandle(PrimaryTarget, LockedTarget.Actor.Get() == PrimaryTarget, RngSub)
+			: FT66CombatTargetHandle{};
+
+		// Marksman's Focus: consecutive hits on same target stack +8% damage (max 5).
+		float PrimaryDamageMultiplier = 1.f;
+		if (PassiveType == ET66PassiveType::MarksmanFocus && PrimaryTarget)
 		{
-			static const FName RabidFrenzyDotSource(TEXT("Ultimate_RabidFrenzyDOT"));
-			const float FrenzyDotDmg = static_cast<float>(EffectiveDamagePerShot) * 0.3f;
-			const float FrenzyTicks = 4.f;
-			CachedRunState->ApplyDOT(PrimaryTarget, 2.f, 0.5f, FrenzyDotDmg / FrenzyTicks, RabidFrenzyDotSource);
-			SpawnDOTVFX(PrimaryTarget->GetActorLocation(), 2.f, 50.f, FLinearColor(0.9f, 0.3f, 0.1f));
+			if (PrimaryTarget == LastMarksmanTarget.Get())
+				MarksmanStacks = FMath::Min(5, MarksmanStacks + 1);
+			else
+				MarksmanStacks = 1;
+			LastMarksmanTarget = PrimaryTarget;
+			PrimaryDamageMultiplier = 1.f + 0.08f * static_cast<float>(MarksmanStacks);
 		}
 
-		// Idol attacks: one per equipped idol, each with unique color.
+		// QuickDraw: first attack after 2s idle = 2× damage.
+		if (CachedRunState)
+			PrimaryDamageMultiplier *= CachedRunState->GetQuickDrawDamageMultiplier();
+
+		// Deadeye ultimate buff: 2× damage while active.
+		if (DeadeyeEndTime > Now)
+			PrimaryDamageMultiplier *= 2.f;
+
+		// Notify RunState that an attack was fired (for Overclock counter, QuickDraw timer).
 		if (CachedRunState)
+			CachedRunState->NotifyAttackFired();
+
+		// Hero primary attack (Pierce / Bounce / AOE / DOT; VFX white).
+		if (PrimaryTarget)
 		{
-			const float IdolRange = AttackRange;
-			// Bounce search radius = hero attack range, centered on the last hit enemy each step.
-			const float BounceSearchRadius = IdolRange;
-			UE_LOG(
-				LogT66Combat,
-				Verbose,
-				TEXT("[IDOL PROC] owner=%s target=%s cachedIdolSlots=%d"),
-				GetOwner() ? *GetOwner()->GetName() : TEXT("None"),
-				*PrimaryTarget->GetName(),
-				CachedIdolSlots.Num());
-
-			int32 IdolVisualIndex = 0;
-			for (const FCachedIdolSlot& CachedIdolSlot : CachedIdolSlots)
+			const FVector PrimaryTargetImpactLocation = GetTargetAimPoint(PrimaryTargetHandle);
+			switch (AttackCategory)
+			{
+			case ET66AttackCategory::Pierce: (void)PerformPierce(PrimaryTarget, PrimaryDamageMultiplier); break;
+			case ET66AttackCategory::Bounce: (void)PerformBounce(PrimaryTarget, PrimaryDamageMultiplier); break;
+			case ET66AttackCategory::AOE:   (void)PerformSlash(PrimaryTarget, PrimaryDamageMultiplier); break;
+			case ET66AttackCategory::DOT:   (void)PerformDOT(PrimaryTarget, PrimaryDamageMultiplier); break;
+			default: (void)PerformSlash(PrimaryTarget, PrimaryDamageMultiplier); break;
+			}
+
+			// Overclock: every 8th attack fires a second time immediately.
+			if (CachedRunState && CachedRunState->ShouldOverclockDouble())
+			{
+				switch (AttackCategory)
+				{
+				case ET66AttackCategory::Pierce: (void)PerformPierce(PrimaryTarget, 1.f); break;
+				case ET66AttackCategory::Bounce: (void)PerformBounce(PrimaryTarget, 1.f); break;
+				case ET66AttackCategory::AOE:   (void)PerformSlash(PrimaryTarget, 1.f); break;
+				case ET66AttackCategory::DOT:   (void)PerformDOT(PrimaryTarget, 1.f); break;
+				default: break;
+				}
+			}
+
+			// Evasive: if flagged, apply bonus 3s DOT to the primary target (50% of hit damage).
+			if (CachedRunState && CachedRunState->ConsumeEvasiveBonusDOT() && PrimaryTarget)
 			{
-				if (!CachedIdolSlot.bValid || CachedIdolSlot.IdolID.IsNone()) continue;
-				const FName IdolID = CachedIdolSlot.IdolID;
-				const ET66ItemRarity IdolRarity = CachedIdolSlot.Rarity;
-				const FIdolData& IdolData = CachedIdolSlot.IdolData;
-				const float IdolVisualDelay = static_cast<float>(IdolVisualIndex) * 0.035f;
-				const float IdolGlobalScale = FMath::Max(0.1f, ProjectileScaleMultiplier);
-				const float IdolCategorySubScale = T66CombatShared::GetCategorySubScaleMultiplier(CachedRunState, IdolData.Category);
-				const float IdolBehaviorScale = IdolGlobalScale * IdolCategorySubScale;
-
-				const int32 IdolDamage = FMath::Max(1, FMath::RoundToInt(IdolData.GetDamageAtRarity(IdolRarity)));
-				const FVector PrimaryLoc = PrimaryTargetImpactLocation;
-				const FVector PrimaryVFXLoc = T66CombatShared::ResolveGroundAnchor(World, PrimaryLoc, PrimaryTarget);
+				static const FName EvasiveDotSource(TEXT("Passive_EvasiveDOT"));
+				const float BonusDotDamage = static_cast<float>(EffectiveDamagePerShot) * 0.5f;
+				const float EvasiveTicks = 6.f;
+				CachedRunState->ApplyDOT(PrimaryTarget, 3.f, 0.5f, BonusDotDamage / EvasiveTicks, EvasiveDotSource);
+				FVolleyPoint& EvasiveDot = VolleyPresentation.PassiveDots.AddDefaulted_GetRef();
+				EvasiveDot.Location = PrimaryTarget->GetActorLocation();
+				EvasiveDot.Radius = 60.f;
+				EvasiveDot.Duration = 3.f;
+				EvasiveDot.Color = FLinearColor(0.6f, 0.2f, 0.8f);
+			}
+
+			// RabidFrenzy ultimate buff: every hit applies a short DOT.
+			if (RabidFrenzyEndTime > Now && CachedRunState && PrimaryTarget)
+			{
+				static const FName RabidFrenzyDotSource(TEXT("Ultimate_RabidFrenzyDOT"));
+				const float FrenzyDotDmg = static_cast<float>(EffectiveDamagePerShot) * 0.3f;
+				const float FrenzyTicks = 4.f;
+				CachedRunState->ApplyDOT(PrimaryTarget, 2.f, 0.5f, FrenzyDotDmg / FrenzyTicks, RabidFrenzyDotSource);
+				FVolleyPoint& FrenzyDot = VolleyPresentation.PassiveDots.AddDefaulted_GetRef();
+				FrenzyDot.Location = PrimaryTarget->GetActorLocation();
+				FrenzyDot.Radius = 50.f;
+				FrenzyDot.Duration = 2.f;
+				FrenzyDot.Color = FLinearColor(0.9f, 0.3f, 0.1f);
+			}
+
+			// Idol attacks: one per equipped idol, each with unique color.
+			if (CachedRunState)
+			{
+				const float IdolRange = AttackRange;
+				// Bounce search radius = hero attack range, centered on the last hit enemy each step.
+				const float BounceSearchRadius = IdolRange;
 				UE_LOG(
 					LogT66Combat,
 					Verbose,
-					TEXT("[IDOL PROC] Index=%d Idol=%s Rarity=%s Category=%s Damage=%d Delay=%.3f targetLoc=%s vfxLoc=%s"),
-					IdolVisualIndex,
-					*IdolID.ToString(),
-					T66CombatShared::GetItemRarityName(IdolRarity),
-					GetT66AttackCategoryName(IdolData.Category),
-					IdolDamage,
-					IdolVisualDelay,
-					*PrimaryLoc.ToCompactString(),
-					*PrimaryVFXLoc.ToCompactString());
-
-				switch (IdolData.Category)
-				{
-				case ET66AttackCategory::Pierce:
+					TEXT("[IDOL PROC] owner=%s target=%s cachedIdolSlots=%d"),
+					GetOwner() ? *GetOwner()->GetName() : TEXT("None"),
+					*PrimaryTarget->GetName(),
+					CachedIdolSlots.Num());
+
+				int32 IdolVisualIndex = 0;
+				for (const FCachedIdolSlot& CachedIdolSlot : CachedIdolSlots)
 				{
-					const float LineLength = IdolRange * IdolCategorySubScale;
-					const float PierceRadius = 60.f * IdolBehaviorScale;
-					const int32 PierceCount = FMath::Max(0, FMath::RoundToInt(IdolData.GetPropertyAtRarity(IdolRarity)));
-					FVector Dir = FVector::ForwardVector;
-					TArray<AActor*> InLine;
-					BuildPierceTargets(PrimaryTarget, LineLength, PierceRadius, InLine, Dir, &PrimaryLoc);
-					const int32 MaxTargets = FMath::Max(1, PierceCount + 1);
-					if (InLine.Num() > MaxTargets)
+					if (!CachedIdolSlot.bValid || CachedIdolSlot.IdolID.IsNone()) continue;
+					const FName IdolID = CachedIdolSlot.IdolID;
+					const ET66ItemRarity IdolRarity = CachedIdolSlot.Rarity;
+					const FIdolData& IdolData = CachedIdolSlot.IdolData;
+					const float IdolVisualDelay = static_cast<float>(IdolVisualIndex) * 0.035f;
+					const float IdolGlobalScale = FMath::Max(0.1f, ProjectileScaleMultiplier);
+					const float IdolCategorySubScale = T66CombatShared::GetCategorySubScaleMultiplier(CachedRunState, IdolData.Category);
+					const float IdolBehaviorScale = IdolGlobalScale * IdolCategorySubScale;
+
+					const int32 IdolDamage = FMath::Max(1, FMath::RoundToInt(IdolData.GetDamageAtRarity(IdolRarity)));
+					const FVector PrimaryLoc = PrimaryTargetImpactLocation;
+					const FVector PrimaryVFXLoc = T66CombatShared::ResolveGroundAnchor(World, PrimaryLoc, PrimaryTarget);
+					UE_LOG(
+						LogT66Combat,
+						Verbose,
+						TEXT("[IDOL PROC] Index=%d Idol=%s Rarity=%s Category=%s Damage=%d Delay=%.3f targetLoc=%s vfxLoc=%s"),
+						IdolVisualIndex,
+						*IdolID.ToString(),
+						T66CombatShared::GetItemRarityName(IdolRarity),
+						GetT66AttackCategoryName(IdolData.Category),
+						IdolDamage,
+						IdolVisualDelay,
+						*PrimaryLoc.ToCompactString(),
+						*PrimaryVFXLoc.ToCompactString());
+
+					auto AddIdolEffect = [&]() -> FVolleyIdolEffect&
 					{
-						InLine.SetNum(MaxTargets, EAllowShrinking::No);
-					}
-					for (int32 i = 0; i < InLine.Num(); ++i)
+						FVolleyIdolEffect& Effect = VolleyPresentation.IdolEffects.AddDefaulted_GetRef();
+						Effect.IdolID = IdolID;
+						Effect.Rarity = IdolRarity;
+						Effect.Category = IdolData.Category;
+						Effect.StartDelaySeconds = IdolVisualDelay;
+						return Effect;
+					};
+
+					switch (IdolData.Category)
 					{
-						const float Mult = FMath::Max(0.1f, 1.f - 0.1f * static_cast<float>(i));
-						const int32 Dmg = FMath::Max(1, FMath::RoundToInt(IdolDamage * Mult));
-						FName RangeEvent;
-						const int32 RangeDmg = GetRangeMultipliedDamage(Dmg, InLine[i], &RangeEvent);
-						const TPair<int32, FName> Resolved = ResolveCrit(RangeDmg);
-						ApplyDamageToActor(InLine[i], Resolved.Key, Resolved.Value, IdolID, RangeEvent);
-						ApplyIdolSpecialBehavior(InLine[i], IdolID, IdolRarity, Dmg, PrimaryLoc);
-					}
-					SpawnIdolPierceVFX(IdolID, IdolRarity, PrimaryVFXLoc, PrimaryVFXLoc + Dir * (LineLength * 0.5f), PrimaryVFXLoc, IdolVisualDelay);
-					break;
-				}
-				case ET66AttackCategory::AOE:
-				{
-					const float Radius = FMath::Max(50.f, IdolData.GetPropertyAtRarity(IdolRarity) * IdolBehaviorScale);
-					if (IsValidAutoTarget(PrimaryTarget))
+					case ET66AttackCategory::Pierce:
 					{
-						FName RangeEvent;
-						const int32 RangeDmg = GetRangeMultipliedDamage(IdolDamage, PrimaryTarget, &RangeEvent);
-						const TPair<int32, FName> Resolved = ResolveCrit(RangeDmg);
-						ApplyDamageToActor(PrimaryTarget, Resolved.Key, Resolved.Value, IdolID, RangeEvent);
-						ApplyIdolSpecialBehavior(PrimaryTarget, IdolID, IdolRarity, IdolDamage, PrimaryLoc);
+						const float LineLength = IdolRange * IdolCategorySubScale;
+						const float PierceRadius = 60.f * IdolBehaviorScale;
+						const int32 PierceCount = FMath::Max(0, FMath::RoundToInt(IdolData.GetPropertyAtRarity(IdolRarity)));
+						FVector Dir = FVector::ForwardVector;
+						TArray<AActor*> InLine;
+						BuildPierceTargets(PrimaryTarget, LineLength, PierceRadius, InLine, Dir, &PrimaryLoc);
+						const int32 MaxTargets = FMath::Max(1, PierceCount + 1);
+						if (InLine.Num() > MaxTargets)
+						{
+							InLine.SetNum(MaxTargets, EAllowShrinking::No);
+						}
+						for (int32 i = 0; i < InLine.Num(); ++i)
+						{
+							const float Mult = FMath::Max(0.1f, 1.f - 0.1f * static_cast<float>(i));
+							const int32 Dmg = FMath::Max(1, FMath::RoundToInt(IdolDamage * Mult));
+							FName RangeEvent;
+							const int32 RangeDmg = GetRangeMultipliedDamage(Dmg, InLine[i], &RangeEvent);
+							const TPair<int32, FName> Resolved = ResolveCrit(RangeDmg);
+							ApplyDamageToActor(InLine[i], Resolved.Key, Resolved.Value, IdolID, RangeEvent);
+							ApplyIdolSpecialBehavior(InLine[i], IdolID, IdolRarity, Dmg, PrimaryLoc);
+						}
+						const FVector IdolPierceEnd = PrimaryVFXLoc + Dir * (LineLength * 0.5f);
+						AddIdolEffect().Beam = { PrimaryVFXLoc, IdolPierceEnd, PrimaryVFXLoc };
+						break;
 					}
-					TArray<AActor*> SlashTargets;
-					BuildSlashTargets(PrimaryTarget, Radius, SlashTargets, &PrimaryLoc);
-					for (int32 TargetIndex = 0; TargetIndex < SlashTargets.Num(); ++TargetIndex)
+					case ET66AttackCategory::AOE:
 					{
-						if (AActor* Hit = SlashTargets[TargetIndex])
+						const float Radius = FMath::Max(50.f, IdolData.GetPropertyAtRarity(IdolRarity) * IdolBehaviorScale);
+						if (IsValidAutoTarget(PrimaryTarget))
 						{
-							if (Hit == PrimaryTarget)
-							{
-								continue;
-							}
 							FName RangeEvent;
-							const int32 RangeDmg = GetRangeMultipliedDamage(IdolDamage, Hit, &RangeEvent);
+							const int32 RangeDmg = GetRangeMultipliedDamage(IdolDamage, PrimaryTarget, &RangeEvent);
 							const TPair<int32, FName> Resolved = ResolveCrit(RangeDmg);
-							ApplyDamageToActor(Hit, Resolved.Key, Resolved.Value, IdolID, RangeEvent);
-							ApplyIdolSpecialBehavior(Hit, IdolID, IdolRarity, IdolDamage, PrimaryLoc);
+							ApplyDamageToActor(PrimaryTarget, Resolved.Key, Resolved.Value, IdolID, RangeEvent);
+							ApplyIdolSpecialBehavior(PrimaryTarget, IdolID, IdolRarity, IdolDamage, PrimaryLoc);
 						}
+						TArray<AActor*> SlashTargets;
+						BuildSlashTargets(PrimaryTarget, Radius, SlashTargets, &PrimaryLoc);
+						for (int32 TargetIndex = 0; TargetIndex < SlashTargets.Num(); ++TargetIndex)
+						{
+							if (AActor* Hit = SlashTargets[TargetIndex])
+							{
+								if (Hit == PrimaryTarget)
+								{
+									continue;
+								}
+								FName RangeEvent;
+								const int32 RangeDmg = GetRangeMultipliedDamage(IdolDamage, Hit, &RangeEvent);
+								const TPair<int32, FName> Resolved = ResolveCrit(RangeDmg);
+								ApplyDamageToActor(Hit, Resolved.Key, Resolved.Value, IdolID, RangeEvent);
+								ApplyIdolSpecialBehavior(Hit, IdolID, IdolRarity, IdolDamage, PrimaryLoc);
+							}
+						}
+						FVolleyIdolEffect& AOEEffect = AddIdolEffect();
+						AOEEffect.Point.Location = PrimaryVFXLoc;
+						AOEEffect.Point.Radius = Radius;
+						break;
 					}
-					SpawnIdolAOEVFX(IdolID, IdolRarity, PrimaryVFXLoc, Radius, IdolVisualDelay);
-					break;
-				}
-				case ET66AttackCategory::Bounce:
-				{
-					// BounceCount = number of jumps FROM the primary target to other enemies.
-					// At Black rarity (BaseProperty=1) the bolt bounces once (hits 1 extra enemy).
-					const int32 BounceCount = FMath::Max(1, FMath::RoundToInt(IdolData.GetPropertyAtRarity(IdolRarity) * IdolBehaviorScale));
-					const float IdolFalloff = FMath::Clamp(IdolData.FalloffPerHit, 0.f, 0.95f);
-					const float BounceRangeSq = BounceSearchRadius * BounceSearchRadius;
-
-					// Damage the primary target (auto-attack already hit it; idol adds extra damage).
-					if (IsValidAutoTarget(PrimaryTarget))
+					case ET66AttackCategory::Bounce:
 					{
-						FName RangeEvent;
-						const int32 RangeDmg = GetRangeMultipliedDamage(IdolDamage, PrimaryTarget, &RangeEvent);
-						const TPair<int32, FName> Resolved = ResolveCrit(RangeDmg);
-						ApplyDamageToActor(PrimaryTarget, Resolved.Key, Resolved.Value, IdolID, RangeEvent);
-						ApplyIdolSpecialBehavior(PrimaryTarget, IdolID, IdolRarity, IdolDamage, PrimaryLoc);
-					}
+						// BounceCount = number of jumps FROM the primary target to other enemies.
+						// At Black rarity (BaseProperty=1) the bolt bounces once (hits 1 extra enemy).
+						const int32 BounceCount = FMath::Max(1, FMath::RoundToInt(IdolData.GetPropertyAtRarity(IdolRarity) * IdolBehaviorScale));
+						const float IdolFalloff = FMath::Clamp(IdolData.FalloffPerHit, 0.f, 0.95f);
+						const float BounceRangeSq = BounceSearchRadius * BounceSearchRadius;
+
+						// Damage the primary target (auto-attack already hit it; idol adds extra damage).
+						if (IsValidAutoTarget(PrimaryTarget))
+						{
+							FName RangeEvent;
+							const int32 RangeDmg = GetRangeMultipliedDamage(IdolDamage, PrimaryTarget, &RangeEvent);
+							const TPair<int32, FName> Resolved = ResolveCrit(RangeDmg);
+							ApplyDamageToActor(PrimaryTarget, Resolved.Key, Resolved.Value, IdolID, RangeEvent);
+							ApplyIdolSpecialBehavior(PrimaryTarget, IdolID, IdolRarity, IdolDamage, PrimaryLoc);
+						}
 
-					// Chain starts FROM the primary target (not from the hero).
-					// VFX will only show enemy->enemy segments so it looks like a bolt bouncing off.
-					TArray<FVector> ChainPositions;
-					ChainPositions.Add(PrimaryVFXLoc);
+						// Chain starts FROM the primary target (not from the hero).
+						// VFX will only show enemy->enemy segments so it looks like a bolt bouncing off.
+						TArray<FVector> ChainPositions;
+						ChainPositions.Add(PrimaryVFXLoc);
 
-					FVector CurrentLoc = PrimaryLoc;
-					TSet<FString> HitKeys;
-					HitKeys.Add(MakeTargetHandleKey(MakeActorTargetHandle(PrimaryTarget)));
-					int32 BouncesLeft = BounceCount;
-					float IdolDamageMult = 1.f - IdolFalloff;
+						FVector CurrentLoc = PrimaryLoc;
+						TSet<FString> HitKeys;
+						HitKeys.Add(MakeTargetHandleKey(MakeActorTargetHandle(PrimaryTarget)));
+						int32 BouncesLeft = BounceCount;
+						float IdolDamageMult = 1.f - IdolFalloff;
 
-					while (BouncesLeft > 0)
-					{
-						const FT66CombatTargetHandle NextHandle = FindClosestTargetHandleInRange(CurrentLoc, BounceRangeSq, &HitKeys);
-						AActor* Next = NextHandle.Actor.Get();
-						if (!Next) break;
-						ChainPositions.Add(GetTargetAimPoint(NextHandle));
-						HitKeys.Add(MakeTargetHandleKey(NextHandle));
-						const int32 BounceDmg = FMath::Max(1, FMath::RoundToInt(IdolDamage * IdolDamageMult));
-						FName RangeEvent;
-						const int32 RangeDmg = GetRangeMultipliedDamage(BounceDmg, Next, &RangeEvent);
-						const TPair<int32, FName> Resolved = ResolveCrit(RangeDmg);
-						ApplyDamageToTargetHandle(NextHandle, Resolved.Key, Resolved.Value, IdolID, RangeEvent);
-						ApplyIdolSpecialBehavior(Next, IdolID, IdolRarity, BounceDmg, CurrentLoc);
-						CurrentLoc = GetTargetAimPoint(NextHandle);
-						IdolDamageMult *= (1.f - IdolFalloff);
-						--BouncesLeft;
+						while (BouncesLeft > 0)
+						{
+							const FT66CombatTargetHandle NextHandle = FindClosestTargetHandleInRange(CurrentLoc, BounceRangeSq, &HitKeys);
+							AActor* Next = NextHandle.Actor.Get();
+							if (!Next) break;
+							ChainPositions.Add(GetTargetAimPoint(NextHandle));
+							HitKeys.Add(MakeTargetHandleKey(NextHandle));
+							const int32 BounceDmg = FMath::Max(1, FMath::RoundToInt(IdolDamage * IdolDamageMult));
+							FName RangeEvent;
+							const int32 RangeDmg = GetRangeMultipliedDamage(BounceDmg, Next, &RangeEvent);
+							const TPair<int32, FName> Resolved = ResolveCrit(RangeDmg);
+							ApplyDamageToTargetHandle(NextHandle, Resolved.Key, Resolved.Value, IdolID, RangeEvent);
+							ApplyIdolSpecialBehavior(Next, IdolID, IdolRarity, BounceDmg, CurrentLoc);
+							CurrentLoc = GetTargetAimPoint(NextHandle);
+							IdolDamageMult *= (1.f - IdolFalloff);
+							--BouncesLeft;
+						}
+						AddIdolEffect().Chain = AddVolleyChain(ChainPositions);
+						break;
 					}
-					SpawnIdolBounceVFX(IdolID, IdolRarity, ChainPositions, IdolVisualDelay);
-					break;
-				}
-				case ET66AttackCategory::DOT:
-				{
-					const float Duration = FMath::Max(0.5f, IdolData.GetPropertyAtRarity(IdolRarity) * IdolBehaviorScale);
-					const float TickInterval = FMath::Max(0.1f, IdolData.DotTickInterval);
-					const int32 Ticks = FMath::Max(1, FMath::RoundToInt(Duration / TickInterval));
-					const float DamagePerTick = static_cast<float>(IdolDamage) / static_cast<float>(Ticks);
-					if (IsValidAutoTarget(PrimaryTarget))
+					case ET66AttackCategory::DOT:
 					{
-						CachedRunState->ApplyDOT(PrimaryTarget, Duration, TickInterval, DamagePerTick, IdolID);
-						ApplyIdolSpecialBehavior(PrimaryTarget, IdolID, IdolRarity, IdolDamage, PrimaryLoc);
+						const float Duration = FMath::Max(0.5f, IdolData.GetPropertyAtRarity(IdolRarity) * IdolBehaviorScale);
+						const float TickInterval = FMath::Max(0.1f, IdolData.DotTickInterval);
+						const int32 Ticks = FMath::Max(1, FMath::RoundToInt(Duration / TickInterval));
+						const float DamagePerTick = static_cast<float>(IdolDamage) / static_cast<float>(Ticks);
+						if (IsValidAutoTarget(PrimaryTarget))
+						{
+							CachedRunState->ApplyDOT(PrimaryTarget, Duration, TickInterval, DamagePerTick, IdolID);
+							ApplyIdolSpecialBehavior(PrimaryTarget, IdolID, IdolRarity, IdolDamage, PrimaryLoc);
+						}
+						FVolleyIdolEffect& DOTEffect = AddIdolEffect();
+						DOTEffect.Point.FollowTarget = IsValidAutoTarget(PrimaryTarget) ? PrimaryTarget : nullptr;
+						DOTEffect.Point.Location = PrimaryVFXLoc;
+						DOTEffect.Point.Radius = 80.f;
+						DOTEffect.Point.Duration = Duration;
+						break;
+					}
+					default:
+						break;
 					}
-					SpawnIdolDOTVFX(IdolID, IdolRarity, IsValidAutoTarget(PrimaryTarget) ? PrimaryTarget : nullptr, PrimaryVFXLoc, Duration, 80.f, IdolVisualDelay);
-					break;
-				}
-				default:
-					break;
-				}
 
-				++IdolVisualIndex;
+					++IdolVisualIndex;
+				}
 			}
 		}
 	}
+
+	EmitVolleyPresentation(CurrentHeroID, AttackCategory, HeroTint);
 }
 
 // ---------------------------------------------------------------------------
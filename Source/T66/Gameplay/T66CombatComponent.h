@@ -79,14 +79,20 @@ public:
 protected:
 	virtual void BeginPlay() override;
 	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
 	UFUNCTION()
 	void HandleInventoryChanged();
 
-	void TryFire();
+	/** Resolves every auto-attack shot that came due this frame in one pass (shared stats, targets spread over the closest enemies, VFX batched per effect type). */
+	void TryFire(int32 ShotCount);
 	void RecomputeFromRunState();
 
-	FTimerHandle FireTimerHandle;
+	/** Seconds banked toward the next auto-attack; whole intervals are spent as shots each tick. */
+	float FireAccumulatorSeconds = 0.f;
+
+	/** Shots resolved in one frame at most; time past that after a hitch is dropped rather than replayed. */
+	static constexpr int32 MaxShotsPerVolley = 8;
 
 	FT66CombatTargetHandle LockedTarget;
 
@@ -176,23 +182,82 @@ protected:
 	void ApplyDamageToTargetHandle(const FT66CombatTargetHandle& TargetHandle, int32 DamageAmount, FName EventType = NAME_None, FName SourceID = NAME_None, FName RangeEventForHero = NAME_None);
 	void ApplyDamageToActor(AActor* Target, int32 DamageAmount, FName EventType = NAME_None, FName SourceID = NAME_None, FName RangeEventForHero = NAME_None);
 
-	void SpawnSlashVFX(const FVector& Location, float Radius, const FLinearColor& Color);
-	void SpawnPierceVFX(const FVector& Start, const FVector& End, const FLinearColor& Color);
+	void SpawnSlashVFX(const FVector& Location, float Radius, const FLinearColor& Color, float Density = 1.f);
+	void SpawnPierceVFX(const FVector& Start, const FVector& End, const FLinearColor& Color, float Density = 1.f);
 	void SpawnHeroOnePierceVFX(const FVector& Start, const FVector& End, const FVector& ImpactLocation);
 	void SpawnArthurUltimateSwordVFX(const FVector& Start, const FVector& End);
-	void SpawnBounceVFX(const TArray<FVector>& ChainPositions, const FLinearColor& Color);
+	void SpawnBounceVFX(const TArray<FVector>& ChainPositions, const FLinearColor& Color, float Density = 1.f);
 	void SpawnDOTVFX(const FVector& Location, float Duration, float Radius, const FLinearColor& Color);
-	void SpawnIdolPierceVFX(const FName& IdolID, ET66ItemRarity Rarity, const FVector& Start, const FVector& End, const FVector& ImpactLocation, float StartDelaySeconds);
+	void SpawnIdolPierceVFX(const FName& IdolID, ET66ItemRarity Rarity, const FVector& Start, const FVector& End, const FVector& ImpactLocation, float StartDelaySeconds, float Density = 1.f);
 	void SpawnIdolAOEVFX(const FName& IdolID, ET66ItemRarity Rarity, const FVector& Location, float Radius, float StartDelaySeconds);
-	void SpawnIdolBounceVFX(const FName& IdolID, ET66ItemRarity Rarity, const TArray<FVector>& ChainPositions, float StartDelaySeconds);
+	void SpawnIdolBounceVFX(const FName& IdolID, ET66ItemRarity Rarity, const TArray<FVector>& ChainPositions, float StartDelaySeconds, float Density = 1.f);
 	void SpawnIdolDOTVFX(const FName& IdolID, ET66ItemRarity Rarity, AActor* FollowTarget, const FVector& Location, float Duration, float Radius, float StartDelaySeconds);
 
-	/** Hero-specific VFX variants: spawn unique pixel patterns based on HeroID. */
-	void SpawnHeroSlashVFX(const FVector& Location, float Radius, const FLinearColor& Color, const FName& HeroID);
-	void SpawnHeroPierceVFX(const FVector& Start, const FVector& End, const FVector& ImpactLocation, const FLinearColor& Color, const FName& HeroID);
-	void SpawnHeroBounceVFX(const TArray<FVector>& ChainPositions, const FLinearColor& Color, const FName& HeroID);
+	/** Hero-specific VFX variants: spawn unique pixel patterns based on HeroID. Density < 1 thins the pattern for batched volleys. */
+	void SpawnHeroSlashVFX(const FVector& Location, float Radius, const FLinearColor& Color, const FName& HeroID, float Density = 1.f);
+	void SpawnHeroPierceVFX(const FVector& Start, const FVector& End, const FVector& ImpactLocation, const FLinearColor& Color, const FName& HeroID, float Density = 1.f);
+	void SpawnHeroBounceVFX(const TArray<FVector>& ChainPositions, const FLinearColor& Color, const FName& HeroID, float Density = 1.f);
 	void SpawnHeroDOTVFX(AActor* FollowTarget, const FVector& Location, float Duration, float Radius, const FLinearColor& Color, const FName& HeroID);
 
+	/** Presentation gathered from every shot of a TryFire volley; emitted once per effect type after the volley resolves. */
+	struct FVolleyBeam
+	{
+		FVector Start = FVector::ZeroVector;
+		FVector End = FVector::ZeroVector;
+		FVector Impact = FVector::ZeroVector;
+	};
+
+	struct FVolleyPoint
+	{
+		TWeakObjectPtr<AActor> FollowTarget;
+		FVector Location = FVector::ZeroVector;
+		float Radius = 0.f;
+		float Duration = 0.f;
+		FLinearColor Color = FLinearColor::White;
+	};
+
+	/** Slice of FVolleyPresentation::ChainPoints. */
+	struct FVolleyChain
+	{
+		int32 FirstPoint = 0;
+		int32 NumPoints = 0;
+	};
+
+	struct FVolleyIdolEffect
+	{
+		FName IdolID = NAME_None;
+		ET66ItemRarity Rarity = ET66ItemRarity::Black;
+		ET66AttackCategory Category = ET66AttackCategory::AOE;
+		float StartDelaySeconds = 0.f;
+		FVolleyBeam Beam;
+		FVolleyPoint Point;
+		FVolleyChain Chain;
+	};
+
+	struct FVolleyPresentation
+	{
+		TArray<FVolleyBeam> HeroBeams;
+		TArray<FVolleyPoint> HeroSlashes;
+		TArray<FVolleyChain> HeroChains;
+		TArray<FVolleyPoint> HeroDots;
+		TArray<FVolleyPoint> PassiveDots;
+		TArray<FVolleyIdolEffect> IdolEffects;
+		TArray<FVector> ChainPoints;
+		TArray<FVector> SfxLocations;
+
+		void Reset();
+	};
+
+	/**
+	 * Spawns a volley's VFX with one emission per effect type: shots landing on the same spot merge, and
+	 * the rest share a single shot's particle budget. Plays the attack sound once at the shots' centroid.
+	 */
+	void EmitVolleyPresentation(const FName& HeroID, ET66AttackCategory AttackCategory, const FLinearColor& HeroTint);
+
+	/** Reused across volleys so batching presentation does not allocate per frame. */
+	FVolleyPresentation VolleyPresentation;
+	TArray<FVector> VolleyChainScratch;
+
 	float BaseAttackRange = 0.f;
 	float BaseFireIntervalSeconds = 0.f;
 	int32 BaseDamagePerShot = 0;
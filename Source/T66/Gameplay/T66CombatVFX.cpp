@@ -76,6 +76,12 @@ namespace
 	int32 GIdolBounceStage8RequestSerial = 0;
 	int32 GIdolDOTStage9RequestSerial = 0;
 
+	/** Scales a pattern's sprite count for batched volleys, keeping at least MinCount so lines still read. */
+	int32 T66ScaleVFXCount(const int32 Count, const float Density, const int32 MinCount = 2)
+	{
+		return Density >= 1.f ? Count : FMath::Max(MinCount, FMath::RoundToInt(static_cast<float>(Count) * Density));
+	}
+
 	UNiagaraSystem* LoadNiagaraSystemCached(const TCHAR* AssetPath)
 	{
 		static TMap<FString, TWeakObjectPtr<UNiagaraSystem>> Cache;
@@ -258,7 +264,8 @@ namespace
 		const FVector& Start,
 		const FVector& End,
 		const float VisualScale,
-		const float QuantityMultiplier)
+		const float QuantityMultiplier,
+		const float Density = 1.f)
 	{
 		UNiagaraSystem* System = LoadNiagaraSystemCached(AssetPath);
 		if (!World || !System)
@@ -275,7 +282,7 @@ namespace
 		}
 
 		const FRotator Rotation = Delta.Rotation();
-		const int32 SpawnCount = FMath::Clamp(FMath::RoundToInt((Distance / 150.f) * FMath::Max(0.5f, QuantityMultiplier)), 1, 18);
+		const int32 SpawnCount = T66ScaleVFXCount(FMath::Clamp(FMath::RoundToInt((Distance / 150.f) * FMath::Max(0.5f, QuantityMultiplier)), 1, 18), Density, 1);
 		for (int32 Index = 0; Index < SpawnCount; ++Index)
 		{
 			const float T = (SpawnCount > 1) ? static_cast<float>(Index) / static_cast<float>(SpawnCount - 1) : 0.5f;
@@ -289,7 +296,8 @@ namespace
 		const TCHAR* AssetPath,
 		const TArray<FVector>& Points,
 		const float VisualScale,
-		const float QuantityMultiplier)
+		const float QuantityMultiplier,
+		const float Density = 1.f)
 	{
 		if (!World || Points.Num() < 2)
 		{
@@ -298,7 +306,7 @@ namespace
 
 		for (int32 Index = 0; Index < Points.Num() - 1; ++Index)
 		{
-			SpawnImportedEffectAlongLine(World, AssetPath, Points[Index], Points[Index + 1], VisualScale, QuantityMultiplier);
+			SpawnImportedEffectAlongLine(World, AssetPath, Points[Index], Points[Index + 1], VisualScale, QuantityMultiplier, Density);
 		}
 	}
 
@@ -504,14 +512,15 @@ namespace
 		const FVector& Start,
 		const FVector& End,
 		const FVector4& ColorVec,
-		const FName HeroID)
+		const FName HeroID,
+		const float Density)
 	{
 		const FVector Dir = (End - Start).GetSafeNormal();
 		const float Length = FVector::Dist(Start, End);
 
 		if (HeroID == FName(TEXT("Hero_5")))
 		{
-			constexpr int32 N = 48;
+			const int32 N = T66ScaleVFXCount(48, Density);
 			for (int32 i = 0; i < N; ++i)
 			{
 				const float T = static_cast<float>(i) / static_cast<float>(N - 1);
@@ -522,7 +531,7 @@ namespace
 
 		if (HeroID == FName(TEXT("Hero_8")))
 		{
-			constexpr int32 N = 16;
+			const int32 N = T66ScaleVFXCount(16, Density);
 			constexpr float ConeDeg = 45.f;
 			for (int32 i = 0; i < N; ++i)
 			{
@@ -538,7 +547,7 @@ namespace
 		if (HeroID == FName(TEXT("Hero_11")))
 		{
 			const FVector Right = FVector::CrossProduct(FVector::UpVector, Dir).GetSafeNormal() * 30.f;
-			constexpr int32 N = 8;
+			const int32 N = T66ScaleVFXCount(8, Density);
 			for (int32 Line = 0; Line < 2; ++Line)
 			{
 				const FVector Offset = (Line == 0) ? Right : -Right;
@@ -560,11 +569,12 @@ namespace
 		const FVector& Location,
 		const float Radius,
 		const FVector4& ColorVec,
-		const FName HeroID)
+		const FName HeroID,
+		const float Density)
 	{
 		if (HeroID == FName(TEXT("Hero_3")))
 		{
-			constexpr int32 N = 28;
+			const int32 N = T66ScaleVFXCount(28, Density);
 			constexpr float ArcDeg = 180.f;
 			for (int32 i = 0; i < N; ++i)
 			{
@@ -578,7 +588,7 @@ namespace
 
 		if (HeroID == FName(TEXT("Hero_4")))
 		{
-			constexpr int32 N = 16;
+			const int32 N = T66ScaleVFXCount(16, Density);
 			constexpr float ArcDeg = 90.f;
 			for (int32 i = 0; i < N; ++i)
 			{
@@ -593,7 +603,7 @@ namespace
 
 		if (HeroID == FName(TEXT("Hero_10")))
 		{
-			constexpr int32 N = 32;
+			const int32 N = T66ScaleVFXCount(32, Density);
 			for (int32 i = 0; i < N; ++i)
 			{
 				const float Angle = (2.f * PI * static_cast<float>(i)) / static_cast<float>(N);
@@ -605,7 +615,7 @@ namespace
 
 		if (HeroID == FName(TEXT("Hero_15")))
 		{
-			constexpr int32 N = 12;
+			const int32 N = T66ScaleVFXCount(12, Density);
 			for (int32 i = 0; i < N; ++i)
 			{
 				const float T = static_cast<float>(i) / static_cast<float>(N - 1);
@@ -628,7 +638,8 @@ namespace
 		UNiagaraSystem* VFX,
 		const TArray<FVector>& ChainPositions,
 		const FVector4& ColorVec,
-		const FName HeroID)
+		const FName HeroID,
+		const float Density)
 	{
 		if (HeroID == FName(TEXT("Hero_6")))
 		{
@@ -637,7 +648,7 @@ namespace
 				const FVector A = ChainPositions[i];
 				const FVector B = ChainPositions[i + 1];
 				const float Dist = FVector::Dist(A, B);
-				const int32 N = FMath::Max(4, FMath::RoundToInt(Dist / 15.f));
+				const int32 N = T66ScaleVFXCount(FMath::Max(4, FMath::RoundToInt(Dist / 15.f)), Density);
 				for (int32 j = 0; j < N; ++j)
 				{
 					const float T = static_cast<float>(j) / static_cast<float>(N - 1);
@@ -654,7 +665,7 @@ namespace
 				const FVector A = ChainPositions[i];
 				const FVector B = ChainPositions[i + 1];
 				const float Dist = FVector::Dist(A, B);
-				const int32 N = FMath::Max(3, FMath::RoundToInt(Dist / 60.f));
+				const int32 N = T66ScaleVFXCount(FMath::Max(3, FMath::RoundToInt(Dist / 60.f)), Density);
 				for (int32 j = 0; j < N; ++j)
 				{
 					const float T = static_cast<float>(j) / static_cast<float>(N - 1);
@@ -671,7 +682,7 @@ namespace
 				const FVector A = ChainPositions[i];
 				const FVector B = ChainPositions[i + 1];
 				const float Dist = FVector::Dist(A, B);
-				const int32 N = FMath::Max(6, FMath::RoundToInt(Dist / 15.f));
+				const int32 N = T66ScaleVFXCount(FMath::Max(6, FMath::RoundToInt(Dist / 15.f)), Density);
 				for (int32 j = 0; j < N; ++j)
 				{
 					const float T = static_cast<float>(j) / static_cast<float>(N - 1);
@@ -689,7 +700,7 @@ namespace
 				const FVector A = ChainPositions[i];
 				const FVector B = ChainPositions[i + 1];
 				const float Dist = FVector::Dist(A, B);
-				const int32 N = FMath::Max(4, FMath::RoundToInt(Dist / 25.f));
+				const int32 N = T66ScaleVFXCount(FMath::Max(4, FMath::RoundToInt(Dist / 25.f)), Density);
 				for (int32 j = 0; j < N; ++j)
 				{
 					const float T = static_cast<float>(j) / static_cast<float>(N - 1);
@@ -837,7 +848,7 @@ void UT66CombatComponent::SpawnDeathVFX(const FVector& Location)
 	T66SpawnBloodSpray(World, VFX, Location, 84, 150.f, 0.09f);
 }
 
-void UT66CombatComponent::SpawnSlashVFX(const FVector& Location, float Radius, const FLinearColor& Color)
+void UT66CombatComponent::SpawnSlashVFX(const FVector& Location, float Radius, const FLinearColor& Color, const float Density)
 {
 	UWorld* World = GetWorld();
 	UNiagaraSystem* VFX = GetActiveVFXSystem();
@@ -846,7 +857,7 @@ void UT66CombatComponent::SpawnSlashVFX(const FVector& Location, float Radius, c
 		return;
 	}
 
-	constexpr int32 NumParticles = 24;
+	const int32 NumParticles = T66ScaleVFXCount(24, Density);
 	constexpr float ArcAngleDeg = 120.f;
 	constexpr float StartAngleDeg = -ArcAngleDeg * 0.5f;
 	constexpr float SpreadScale = 0.35f;
@@ -862,7 +873,7 @@ void UT66CombatComponent::SpawnSlashVFX(const FVector& Location, float Radius, c
 	}
 }
 
-void UT66CombatComponent::SpawnPierceVFX(const FVector& Start, const FVector& End, const FLinearColor& Color)
+void UT66CombatComponent::SpawnPierceVFX(const FVector& Start, const FVector& End, const FLinearColor& Color, const float Density)
 {
 	UWorld* World = GetWorld();
 	UNiagaraSystem* VFX = GetActiveVFXSystem();
@@ -882,7 +893,7 @@ void UT66CombatComponent::SpawnPierceVFX(const FVector& Start, const FVector& En
 		return;
 	}
 
-	constexpr int32 NumParticles = 40;
+	const int32 NumParticles = T66ScaleVFXCount(40, Density);
 	const FVector4 ColorVec(Color.R, Color.G, Color.B, Color.A);
 
 	for (int32 i = 0; i < NumParticles; ++i)
@@ -971,7 +982,7 @@ void UT66CombatComponent::SpawnArthurUltimateSwordVFX(const FVector& Start, cons
 	SpawnPierceVFX(Start, End, FLinearColor(1.f, 0.82f, 0.24f, 1.f));
 }
 
-void UT66CombatComponent::SpawnBounceVFX(const TArray<FVector>& ChainPositions, const FLinearColor& Color)
+void UT66CombatComponent::SpawnBounceVFX(const TArray<FVector>& ChainPositions, const FLinearColor& Color, const float Density)
 {
 	UWorld* World = GetWorld();
 	UNiagaraSystem* VFX = GetActiveVFXSystem();
@@ -994,7 +1005,7 @@ void UT66CombatComponent::SpawnBounceVFX(const TArray<FVector>& ChainPositions,
 		const FRotator Rot = Dir.Rotation();
 		const float Dist = FVector::Dist(ChainStart, ChainEnd);
 
-		const int32 Num = FMath::Max(8, FMath::RoundToInt(Dist / 20.f));
+		const int32 Num = T66ScaleVFXCount(FMath::Max(8, FMath::RoundToInt(Dist / 20.f)), Density);
 		for (int32 j = 0; j < Num; ++j)
 		{
 			const float T = (Num > 1) ? (static_cast<float>(j) / static_cast<float>(Num - 1)) : 0.5f;
@@ -1040,7 +1051,7 @@ void UT66CombatComponent::SpawnDOTVFX(const FVector& Location, float Duration, f
 	}
 }
 
-void UT66CombatComponent::SpawnIdolPierceVFX(const FName& IdolID, const ET66ItemRarity Rarity, const FVector& Start, const FVector& End, const FVector& ImpactLocation, const float StartDelaySeconds)
+void UT66CombatComponent::SpawnIdolPierceVFX(const FName& IdolID, const ET66ItemRarity Rarity, const FVector& Start, const FVector& End, const FVector& ImpactLocation, const float StartDelaySeconds, const float Density)
 {
 	UWorld* World = GetWorld();
 	if (!World)
@@ -1072,11 +1083,11 @@ void UT66CombatComponent::SpawnIdolPierceVFX(const FName& IdolID, const ET66Item
 	const float Quantity = T66CombatShared::GetIdolRarityVisualQuantity(Rarity) * T66CombatShared::GetCategorySubScaleMultiplier(CachedRunState, ET66AttackCategory::Pierce);
 	if (const TCHAR* AssetPath = GetIdolNiagaraEffectPath(IdolID))
 	{
-		SpawnImportedEffectAlongLine(World, AssetPath, Start + FVector(0.f, 0.f, 18.f), End + FVector(0.f, 0.f, 18.f), VisualScale, Quantity);
+		SpawnImportedEffectAlongLine(World, AssetPath, Start + FVector(0.f, 0.f, 18.f), End + FVector(0.f, 0.f, 18.f), VisualScale, Quantity, Density);
 		return;
 	}
 
-	SpawnPierceVFX(Start, End, IdolColor);
+	SpawnPierceVFX(Start, End, IdolColor, Density);
 }
 
 void UT66CombatComponent::SpawnIdolAOEVFX(const FName& IdolID, const ET66ItemRarity Rarity, const FVector& Location, const float Radius, const float StartDelaySeconds)
@@ -1130,7 +1141,7 @@ void UT66CombatComponent::SpawnIdolAOEVFX(const FName& IdolID, const ET66ItemRar
 	SpawnSlashVFX(Location, Radius, IdolColor);
 }
 
-void UT66CombatComponent::SpawnIdolBounceVFX(const FName& IdolID, const ET66ItemRarity Rarity, const TArray<FVector>& ChainPositions, const float StartDelaySeconds)
+void UT66CombatComponent::SpawnIdolBounceVFX(const FName& IdolID, const ET66ItemRarity Rarity, const TArray<FVector>& ChainPositions, const float StartDelaySeconds, const float Density)
 {
 	UWorld* World = GetWorld();
 	if (!World || ChainPositions.Num() < 2)
@@ -1172,7 +1183,7 @@ void UT66CombatComponent::SpawnIdolBounceVFX(const FName& IdolID, const ET66Item
 		{
 			ElevatedPositions.Add(Pos + FVector(0.f, 0.f, 24.f));
 		}
-		SpawnImportedEffectAlongChain(World, AssetPath, ElevatedPositions, VisualScale, Quantity);
+		SpawnImportedEffectAlongChain(World, AssetPath, ElevatedPositions, VisualScale, Quantity, Density);
 		return;
 	}
 
@@ -1182,7 +1193,7 @@ void UT66CombatComponent::SpawnIdolBounceVFX(const FName& IdolID, const ET66Item
 	{
 		ElevatedPositions.Add(Pos + FVector(0.f, 0.f, 24.f));
 	}
-	SpawnBounceVFX(ElevatedPositions, IdolColor);
+	SpawnBounceVFX(ElevatedPositions, IdolColor, Density);
 }
 
 void UT66CombatComponent::SpawnIdolDOTVFX(const FName& IdolID, const ET66ItemRarity Rarity, AActor* FollowTarget, const FVector& Location, const float Duration, const float Radius, const float StartDelaySeconds)
@@ -1242,7 +1253,7 @@ void UT66CombatComponent::SpawnIdolDOTVFX(const FName& IdolID, const ET66ItemRar
 	SpawnDOTVFX(Location + FVector(0.f, 0.f, 28.f), FMath::Min(Duration, 1.6f), Radius, IdolColor);
 }
 
-void UT66CombatComponent::SpawnHeroPierceVFX(const FVector& Start, const FVector& End, const FVector& ImpactLocation, const FLinearColor& Color, const FName& HeroID)
+void UT66CombatComponent::SpawnHeroPierceVFX(const FVector& Start, const FVector& End, const FVector& ImpactLocation, const FLinearColor& Color, const FName& HeroID, const float Density)
 {
 	UWorld* World = GetWorld();
 	UNiagaraSystem* VFX = GetActiveVFXSystem();
@@ -1287,13 +1298,13 @@ void UT66CombatComponent::SpawnHeroPierceVFX(const FVector& Start, const FVector
 		SpawnHeroOnePierceVFX(Start, End, ImpactLocation);
 		return;
 	}
-	if (!TrySpawnHeroPierceVariantPixels(World, VFX, Start, End, ColorVec, HeroID))
+	if (!TrySpawnHeroPierceVariantPixels(World, VFX, Start, End, ColorVec, HeroID, Density))
 	{
-		SpawnPierceVFX(Start, End, Color);
+		SpawnPierceVFX(Start, End, Color, Density);
 	}
 }
 
-void UT66CombatComponent::SpawnHeroSlashVFX(const FVector& Location, float Radius, const FLinearColor& Color, const FName& HeroID)
+void UT66CombatComponent::SpawnHeroSlashVFX(const FVector& Location, float Radius, const FLinearColor& Color, const FName& HeroID, const float Density)
 {
 	UWorld* World = GetWorld();
 	UNiagaraSystem* VFX = GetActiveVFXSystem();
@@ -1330,13 +1341,13 @@ void UT66CombatComponent::SpawnHeroSlashVFX(const FVector& Location, float Radiu
 
 	const FVector4 ColorVec(Color.R, Color.G, Color.B, Color.A);
 
-	if (!TrySpawnHeroAOEVariantPixels(World, VFX, Location, Radius, ColorVec, HeroID))
+	if (!TrySpawnHeroAOEVariantPixels(World, VFX, Location, Radius, ColorVec, HeroID, Density))
 	{
-		SpawnSlashVFX(Location, Radius, Color);
+		SpawnSlashVFX(Location, Radius, Color, Density);
 	}
 }
 
-void UT66CombatComponent::SpawnHeroBounceVFX(const TArray<FVector>& ChainPositions, const FLinearColor& Color, const FName& HeroID)
+void UT66CombatComponent::SpawnHeroBounceVFX(const TArray<FVector>& ChainPositions, const FLinearColor& Color, const FName& HeroID, const float Density)
 {
 	UWorld* World = GetWorld();
 	UNiagaraSystem* VFX = GetActiveVFXSystem();
@@ -1374,9 +1385,9 @@ void UT66CombatComponent::SpawnHeroBounceVFX(const TArray<FVector>& ChainPositio
 
 	const FVector4 ColorVec(Color.R, Color.G, Color.B, Color.A);
 
-	if (!TrySpawnHeroBounceVariantPixels(World, VFX, ChainPositions, ColorVec, HeroID))
+	if (!TrySpawnHeroBounceVariantPixels(World, VFX, ChainPositions, ColorVec, HeroID, Density))
 	{
-		SpawnBounceVFX(ChainPositions, Color);
+		SpawnBounceVFX(ChainPositions, Color, Density);
 	}
 }
 
@@ -1424,3 +1435,232 @@ void UT66CombatComponent::SpawnHeroDOTVFX(AActor* FollowTarget, const FVector& L
 		SpawnDOTVFX(Location, Duration, Radius, Color);
 	}
 }
+
+void UT66CombatComponent::FVolleyPresentation::Reset()
+{
+	HeroBeams.Reset();
+	HeroSlashes.Reset();
+	HeroChains.Reset();
+	HeroDots.Reset();
+	PassiveDots.Reset();
+	IdolEffects.Reset();
+	ChainPoints.Reset();
+	SfxLocations.Reset();
+}
+
+void UT66CombatComponent::EmitVolleyPresentation(const FName& HeroID, const ET66AttackCategory AttackCategory, const FLinearColor& HeroTint)
+{
+	FVolleyPresentation& Volley = VolleyPresentation;
+	static const FName HeroOneID(TEXT("Hero_1"));
+	static constexpr float MinMergeDistance = 40.f;
+
+	// A point effect on the same target (or the same spot) as an earlier one in the volley adds nothing visible.
+	auto IsMergedPoint = [](const auto& Points, const int32 Index)
+	{
+		const FVolleyPoint& Point = Points[Index];
+		const float MergeDistanceSq = FMath::Square(FMath::Max(Point.Radius * 0.25f, MinMergeDistance));
+		for (int32 EarlierIndex = 0; EarlierIndex < Index; ++EarlierIndex)
+		{
+			const FVolleyPoint& Earlier = Points[EarlierIndex];
+			const bool bSameSpot = Point.FollowTarget.IsValid()
+				? Earlier.FollowTarget == Point.FollowTarget
+				: FVector::DistSquared(Earlier.Location, Point.Location) <= MergeDistanceSq;
+			if (bSameSpot && Earlier.Color.Equals(Point.Color))
+			{
+				return true;
+			}
+		}
+		return false;
+	};
+
+	auto IsMergedBeam = [](const auto& Beams, const int32 Index)
+	{
+		for (int32 EarlierIndex = 0; EarlierIndex < Index; ++EarlierIndex)
+		{
+			if (FVector::DistSquared(Beams[EarlierIndex].Impact, Beams[Index].Impact) <= FMath::Square(MinMergeDistance)
+				&& FVector::DistSquared(Beams[EarlierIndex].End, Beams[Index].End) <= FMath::Square(MinMergeDistance))
+			{
+				return true;
+			}
+		}
+		return false;
+	};
+
+	auto CountDistinct = [](const auto& Items, const auto& IsMerged)
+	{
+		int32 Count = 0;
+		for (int32 Index = 0; Index < Items.Num(); ++Index)
+		{
+			Count += IsMerged(Items, Index) ? 0 : 1;
+		}
+		return FMath::Max(1, Count);
+	};
+
+	auto CopyChain = [this, &Volley](const FVolleyChain& Chain) -> const TArray<FVector>&
+	{
+		VolleyChainScratch.Reset();
+		VolleyChainScratch.Append(Volley.ChainPoints.GetData() + Chain.FirstPoint, Chain.NumPoints);
+		return VolleyChainScratch;
+	};
+
+	// Hero primary: each effect type is spawned once, with its particle budget shared by the volley's shots.
+	if (Volley.HeroBeams.Num() > 0)
+	{
+		const float Density = 1.f / static_cast<float>(CountDistinct(Volley.HeroBeams, IsMergedBeam));
+		bool bSpawnedHeroOneStreak = false;
+		for (int32 Index = 0; Index < Volley.HeroBeams.Num(); ++Index)
+		{
+			if (IsMergedBeam(Volley.HeroBeams, Index))
+			{
+				continue;
+			}
+			const FVolleyBeam& Beam = Volley.HeroBeams[Index];
+			if (HeroID != HeroOneID)
+			{
+				SpawnHeroPierceVFX(Beam.Start, Beam.End, Beam.Impact, HeroTint, HeroID, Density);
+			}
+			else if (!bSpawnedHeroOneStreak)
+			{
+				SpawnHeroOnePierceVFX(Beam.Start, Beam.End, Beam.Impact);
+				bSpawnedHeroOneStreak = true;
+			}
+			else
+			{
+				SpawnPierceVFX(Beam.Start, Beam.End, FLinearColor(1.f, 0.97f, 0.88f, 1.f), Density);
+			}
+		}
+	}
+
+	if (Volley.HeroSlashes.Num() > 0)
+	{
+		const float Density = 1.f / static_cast<float>(CountDistinct(Volley.HeroSlashes, IsMergedPoint));
+		for (int32 Index = 0; Index < Volley.HeroSlashes.Num(); ++Index)
+		{
+			if (!IsMergedPoint(Volley.HeroSlashes, Index))
+			{
+				SpawnHeroSlashVFX(Volley.HeroSlashes[Index].Location, Volley.HeroSlashes[Index].Radius, HeroTint, HeroID, Density);
+			}
+		}
+	}
+
+	if (Volley.HeroChains.Num() > 0)
+	{
+		const float Density = 1.f / static_cast<float>(Volley.HeroChains.Num());
+		for (const FVolleyChain& Chain : Volley.HeroChains)
+		{
+			SpawnHeroBounceVFX(CopyChain(Chain), HeroTint, HeroID, Density);
+		}
+	}
+
+	for (int32 Index = 0; Index < Volley.HeroDots.Num(); ++Index)
+	{
+		if (!IsMergedPoint(Volley.HeroDots, Index))
+		{
+			const FVolleyPoint& Dot = Volley.HeroDots[Index];
+			SpawnHeroDOTVFX(Dot.FollowTarget.Get(), Dot.Location, Dot.Duration, Dot.Radius, HeroTint, HeroID);
+		}
+	}
+
+	for (int32 Index = 0; Index < Volley.PassiveDots.Num(); ++Index)
+	{
+		if (!IsMergedPoint(Volley.PassiveDots, Index))
+		{
+			const FVolleyPoint& Dot = Volley.PassiveDots[Index];
+			SpawnDOTVFX(Dot.Location, Dot.Duration, Dot.Radius, Dot.Color);
+		}
+	}
+
+	// Idols: one emission per idol and category, gathered from every shot that procced it.
+	TArray<const FVolleyIdolEffect*, TInlineAllocator<MaxShotsPerVolley * 2>> Group;
+	TArray<FVolleyBeam, TInlineAllocator<MaxShotsPerVolley * 2>> GroupBeams;
+	TArray<FVolleyPoint, TInlineAllocator<MaxShotsPerVolley * 2>> GroupPoints;
+	for (int32 HeadIndex = 0; HeadIndex < Volley.IdolEffects.Num(); ++HeadIndex)
+	{
+		const FVolleyIdolEffect& Head = Volley.IdolEffects[HeadIndex];
+		auto IsSameIdolEffect = [&Head](const FVolleyIdolEffect& Other)
+		{
+			return Other.IdolID == Head.IdolID && Other.Category == Head.Category;
+		};
+
+		bool bGroupHandled = false;
+		for (int32 EarlierIndex = 0; EarlierIndex < HeadIndex && !bGroupHandled; ++EarlierIndex)
+		{
+			bGroupHandled = IsSameIdolEffect(Volley.IdolEffects[EarlierIndex]);
+		}
+		if (bGroupHandled)
+		{
+			continue;
+		}
+
+		Group.Reset();
+		GroupBeams.Reset();
+		GroupPoints.Reset();
+		for (int32 Index = HeadIndex; Index < Volley.IdolEffects.Num(); ++Index)
+		{
+			if (IsSameIdolEffect(Volley.IdolEffects[Index]))
+			{
+				Group.Add(&Volley.IdolEffects[Index]);
+				GroupBeams.Add(Volley.IdolEffects[Index].Beam);
+				GroupPoints.Add(Volley.IdolEffects[Index].Point);
+			}
+		}
+
+		switch (Head.Category)
+		{
+		case ET66AttackCategory::Pierce:
+		{
+			const float Density = 1.f / static_cast<float>(CountDistinct(GroupBeams, IsMergedBeam));
+			for (int32 Index = 0; Index < Group.Num(); ++Index)
+			{
+				if (!IsMergedBeam(GroupBeams, Index))
+				{
+					SpawnIdolPierceVFX(Head.IdolID, Head.Rarity, GroupBeams[Index].Start, GroupBeams[Index].End, GroupBeams[Index].Impact, Group[Index]->StartDelaySeconds, Density);
+				}
+			}
+			break;
+		}
+		case ET66AttackCategory::Bounce:
+		{
+			const float Density = 1.f / static_cast<float>(Group.Num());
+			for (const FVolleyIdolEffect* Effect : Group)
+			{
+				SpawnIdolBounceVFX(Head.IdolID, Head.Rarity, CopyChain(Effect->Chain), Effect->StartDelaySeconds, Density);
+			}
+			break;
+		}
+		case ET66AttackCategory::AOE:
+		case ET66AttackCategory::DOT:
+			for (int32 Index = 0; Index < Group.Num(); ++Index)
+			{
+				if (IsMergedPoint(GroupPoints, Index))
+				{
+					continue;
+				}
+				const FVolleyPoint& Point = GroupPoints[Index];
+				if (Head.Category == ET66AttackCategory::AOE)
+				{
+					SpawnIdolAOEVFX(Head.IdolID, Head.Rarity, Point.Location, Point.Radius, Group[Index]->StartDelaySeconds);
+				}
+				else
+				{
+					SpawnIdolDOTVFX(Head.IdolID, Head.Rarity, Point.FollowTarget.Get(), Point.Location, Point.Duration, Point.Radius, Group[Index]->StartDelaySeconds);
+				}
+			}
+			break;
+		default:
+			break;
+		}
+	}
+
+	if (Volley.SfxLocations.Num() > 0)
+	{
+		FVector SfxLocation = FVector::ZeroVector;
+		for (const FVector& ShotLocation : Volley.SfxLocations)
+		{
+			SfxLocation += ShotLocation;
+		}
+		PlayHeroAttackSfx(HeroID, AttackCategory, SfxLocation / static_cast<float>(Volley.SfxLocations.Num()));
+	}
+
+	Volley.Reset();
+}
@@ -11,8 +11,7 @@
 #include "Gameplay/T66HouseNPCBase.h"
 #include "Gameplay/T66CombatHitZoneComponent.h"
 #include "Core/T66CharacterVisualSubsystem.h"
-#include "Core/T66AudioSubsystem.h"
-#include "Core/T66AchievementsSubsystem.h"
+#include "Core/T66CombatEventSubsystem.h"
 #include "Core/T66RunStateSubsystem.h"
 #include "Core/T66DamageLogSubsystem.h"
 #include "Core/T66LagTrackerSubsystem.h"
@@ -24,11 +23,8 @@
 #include "Core/T66PlayerExperienceSubSystem.h"
 #include "Core/T66Rarity.h"
 #include "Core/T66RngSubsystem.h"
-#include "UI/T66EnemyHealthBarWidget.h"
-#include "UI/T66EnemyLockWidget.h"
 #include "Gameplay/T66VisualUtil.h"
 #include "Components/CapsuleComponent.h"
-#include "Components/WidgetComponent.h"
 #include "Components/StaticMeshComponent.h"
 #include "Components/SkeletalMeshComponent.h"
 #include "GameFramework/CharacterMovementComponent.h"
@@ -42,35 +38,6 @@ DEFINE_LOG_CATEGORY_STATIC(LogT66Enemy, Log, All);
 
 namespace
 {
-	const TCHAR* T66EnemyFamilyAudioSuffix(const ET66EnemyFamily Family)
-	{
-		switch (Family)
-		{
-		case ET66EnemyFamily::Flying:  return TEXT("Flying");
-		case ET66EnemyFamily::Ranged:  return TEXT("Ranged");
-		case ET66EnemyFamily::Rush:    return TEXT("Rush");
-		case ET66EnemyFamily::Special: return TEXT("Special");
-		case ET66EnemyFamily::Melee:
-		default:                       return TEXT("Melee");
-		}
-	}
-
-	bool T66PlayEnemyAudioEvent(AT66EnemyBase* Enemy, const TCHAR* EventPrefix, const FName FallbackEventID)
-	{
-		if (!Enemy || !EventPrefix)
-		{
-			return false;
-		}
-
-		const FName FamilyEventID(*FString::Printf(TEXT("%s.%s"), EventPrefix, T66EnemyFamilyAudioSuffix(Enemy->EnemyFamily)));
-		if (UT66AudioSubsystem::PlayEventAtActorFromWorldContext(Enemy, FamilyEventID, Enemy))
-		{
-			return true;
-		}
-
-		return UT66AudioSubsystem::PlayEventAtActorFromWorldContext(Enemy, FallbackEventID, Enemy);
-	}
-
 	struct FT66SafeZoneHit
 	{
 		bool bInside = false;
@@ -249,25 +216,6 @@ AT66EnemyBase::AT66EnemyBase()
 		FT66VisualUtil::ApplyT66Color(VisualMesh, this, FLinearColor(0.90f, 0.25f, 0.20f, 1.f)); // regular enemy default
 	}
 
-	HealthBarWidget = CreateDefaultSubobject<UWidgetComponent>(TEXT("HealthBarWidget"));
-	HealthBarWidget->SetupAttachment(RootComponent);
-	HealthBarWidget->SetRelativeLocation(FVector(0.f, 0.f, 155.f));
-	HealthBarWidget->SetWidgetSpace(EWidgetSpace::Screen);
-	HealthBarWidget->SetDrawAtDesiredSize(true);
-	// Height includes space for lock indicator above the bar.
-	HealthBarWidget->SetDrawSize(FVector2D(120.f, 28.f));
-	HealthBarWidget->SetWidgetClass(UT66EnemyHealthBarWidget::StaticClass());
-
-	LockIndicatorWidget = CreateDefaultSubobject<UWidgetComponent>(TEXT("LockIndicatorWidget"));
-	LockIndicatorWidget->SetupAttachment(RootComponent);
-	LockIndicatorWidget->SetRelativeLocation(FVector(0.f, 0.f, 225.f));
-	LockIndicatorWidget->SetWidgetSpace(EWidgetSpace::Screen);
-	LockIndicatorWidget->SetDrawAtDesiredSize(true);
-	LockIndicatorWidget->SetDrawSize(FVector2D(52.f, 52.f));
-	LockIndicatorWidget->SetWidgetClass(UT66EnemyLockWidget::StaticClass());
-	LockIndicatorWidget->SetHiddenInGame(true, true);
-	LockIndicatorWidget->SetVisibility(false, true);
-
 	BodyHitZone = CreateDefaultSubobject<UT66CombatHitZoneComponent>(TEXT("BodyHitZone"));
 	BodyHitZone->SetupAttachment(RootComponent);
 	BodyHitZone->HitZoneType = ET66HitZoneType::Body;
@@ -429,28 +377,45 @@ void AT66EnemyBase::ConfigureAsMob(FName InMobID)
 	// Re-apply character visual for pooled (reused) actors whose BeginPlay already ran.
 	if (HasActorBegunPlay() && !CharacterVisualID.IsNone() && CharacterVisualID != FName(TEXT("RegularEnemy")))
 	{
-		if (UWorld* World = GetWorld())
+		RequestImportedCharacterVisual();
+	}
+}
+
+void AT66EnemyBase::RequestImportedCharacterVisual()
+{
+	bUsingCharacterVisual = false;
+	UGameInstance* GI = GetWorld() ? GetWorld()->GetGameInstance() : nullptr;
+	UT66CharacterVisualSubsystem* Visuals = GI ? GI->GetSubsystem<UT66CharacterVisualSubsystem>() : nullptr;
+	if (!Visuals)
+	{
+		HandleImportedCharacterVisualApplied(false);
+		return;
+	}
+
+	// Director spawns never block on asset loads: unresolved visuals keep the placeholder and swap in later.
+	Visuals->RequestCharacterVisual(
+		CharacterVisualID,
+		GetMesh(),
+		VisualMesh,
+		true,
+		FT66OnCharacterVisualApplied::CreateUObject(this, &AT66EnemyBase::HandleImportedCharacterVisualApplied));
+}
+
+void AT66EnemyBase::HandleImportedCharacterVisualApplied(const bool bApplied)
+{
+	bUsingCharacterVisual = bApplied;
+	if (USkeletalMeshComponent* Skel = GetMesh())
+	{
+		// If we didn't apply a skeletal mesh, keep the character mesh hidden and use the placeholder.
+		if (!bUsingCharacterVisual || !Skel->GetSkeletalMeshAsset())
 		{
-			if (UGameInstance* GI = World->GetGameInstance())
+			bUsingCharacterVisual = false;
+			Skel->SetHiddenInGame(true, true);
+			Skel->SetVisibility(false, true);
+			if (VisualMesh)
 			{
-				if (UT66CharacterVisualSubsystem* Visuals = GI->GetSubsystem<UT66CharacterVisualSubsystem>())
-				{
-					bUsingCharacterVisual = Visuals->ApplyCharacterVisual(CharacterVisualID, GetMesh(), VisualMesh, true);
-					if (USkeletalMeshComponent* Skel = GetMesh())
-					{
-						if (!bUsingCharacterVisual || !Skel->GetSkeletalMeshAsset())
-						{
-							bUsingCharacterVisual = false;
-							Skel->SetHiddenInGame(true, true);
-							Skel->SetVisibility(false, true);
-							if (VisualMesh)
-							{
-								VisualMesh->SetHiddenInGame(false, true);
-								VisualMesh->SetVisibility(true, true);
-							}
-						}
-					}
-				}
+				VisualMesh->SetHiddenInGame(false, true);
+				VisualMesh->SetVisibility(true, true);
 			}
 		}
 	}
@@ -496,19 +461,6 @@ void AT66EnemyBase::BeginPlay()
 	CurrentHP = FMath::Clamp(CurrentHP, 1, MaxHP);
 	ResetFamilyState();
 
-	if (HealthBarWidget)
-	{
-		HealthBarWidget->InitWidget();
-		HealthBarWidget->SetHiddenInGame(true, true);
-		HealthBarWidget->SetVisibility(false, true);
-	}
-	if (LockIndicatorWidget)
-	{
-		LockIndicatorWidget->InitWidget();
-		LockIndicatorWidget->SetHiddenInGame(true, true);
-		LockIndicatorWidget->SetVisibility(false, true);
-	}
-
 	UCapsuleComponent* Capsule = GetCapsuleComponent();
 	if (Capsule)
 	{
@@ -545,32 +497,7 @@ void AT66EnemyBase::BeginPlay()
 	}
 
 	// Apply imported character mesh if available (data-driven).
-	bUsingCharacterVisual = false;
-	if (UWorld* World = GetWorld())
-	{
-		if (UGameInstance* GI = World->GetGameInstance())
-		{
-			if (UT66CharacterVisualSubsystem* Visuals = GI->GetSubsystem<UT66CharacterVisualSubsystem>())
-			{
-				bUsingCharacterVisual = Visuals->ApplyCharacterVisual(CharacterVisualID, GetMesh(), VisualMesh, true);
-				if (USkeletalMeshComponent* Skel = GetMesh())
-				{
-					// If we didn't apply a skeletal mesh, keep the character mesh hidden and use the cylinder.
-					if (!bUsingCharacterVisual || !Skel->GetSkeletalMeshAsset())
-					{
-						bUsingCharacterVisual = false;
-						Skel->SetHiddenInGame(true, true);
-						Skel->SetVisibility(false, true);
-						if (VisualMesh)
-						{
-							VisualMesh->SetHiddenInGame(false, true);
-							VisualMesh->SetVisibility(true, true);
-						}
-					}
-				}
-			}
-		}
-	}
+	RequestImportedCharacterVisual();
 
 #if !UE_BUILD_SHIPPING
 	// Lightweight visibility diagnostics (helps track "enemies are invisible" reports).
@@ -604,6 +531,13 @@ void AT66EnemyBase::EndPlay(const EEndPlayReason::Type EndPlayReason)
 			Registry->UnregisterEnemy(this);
 		}
 	}
+	if (UGameInstance* GI = GetGameInstance())
+	{
+		if (UT66CharacterVisualSubsystem* Visuals = GI->GetSubsystem<UT66CharacterVisualSubsystem>())
+		{
+			Visuals->CancelCharacterVisualRequest(GetMesh());
+		}
+	}
 	Super::EndPlay(EndPlayReason);
 }
 
@@ -672,8 +606,6 @@ void AT66EnemyBase::RebuildScaledCombatStats(const bool bResetCurrentHPToMax)
 	{
 		CurrentHP = 0;
 	}
-
-	UpdateHealthBar();
 }
 
 void AT66EnemyBase::ApplyStageScaling(int32 Stage)
@@ -808,7 +740,6 @@ void AT66EnemyBase::ResetForReuse(const FVector& NewLocation, AT66EnemyDirector*
 	}
 
 	ResetFamilyState();
-	UpdateHealthBar();
 }
 
 void AT66EnemyBase::StartRiseFromGround(float TargetGroundZ)
@@ -1160,51 +1091,32 @@ bool AT66EnemyBase::ApplyResolvedDamage(int32 Damage, const bool bCreditHeroKill
 	const int32 ReducedDamage = FMath::Max(1, FMath::RoundToInt(static_cast<float>(Damage) * (1.f - EffectiveArmor)));
 	const FName SourceID = DamageSourceID.IsNone() ? UT66DamageLogSubsystem::SourceID_AutoAttack : DamageSourceID;
 
+	CurrentHP = FMath::Max(0, CurrentHP - ReducedDamage);
+	const bool bKilled = CurrentHP <= 0;
+
+	// Damage log, numbers, audio and death bursts are batched per frame by the combat event queue.
 	if (UWorld* World = GetWorld())
 	{
-		if (UGameInstance* GI = World->GetGameInstance())
+		if (UT66CombatEventSubsystem* CombatEvents = World->GetSubsystem<UT66CombatEventSubsystem>())
 		{
-			if (bCreditHeroKill)
-			{
-				if (UT66DamageLogSubsystem* DamageLog = GI->GetSubsystem<UT66DamageLogSubsystem>())
-				{
-					DamageLog->RecordDamageDealt(SourceID, ReducedDamage);
-				}
-			}
-
-			if (UT66FloatingCombatTextSubsystem* FloatingText = GI->GetSubsystem<UT66FloatingCombatTextSubsystem>())
-			{
-				FloatingText->ShowDamageNumber(this, ReducedDamage, EventType);
-			}
+			FT66CombatHitEvent Hit;
+			Hit.Target = this;
+			Hit.Location = GetActorLocation();
+			Hit.EventType = EventType;
+			Hit.DamageSourceID = bCreditHeroKill ? SourceID : NAME_None;
+			Hit.Damage = ReducedDamage;
+			Hit.Family = EnemyFamily;
+			Hit.bKilled = bKilled;
+			CombatEvents->PushHit(Hit);
 		}
 	}
 
-	CurrentHP = FMath::Max(0, CurrentHP - ReducedDamage);
-	UpdateHealthBar();
-	if (CurrentHP <= 0)
+	if (bKilled)
 	{
-		if (UWorld* World = GetWorld())
-		{
-			if (bCreditHeroKill)
-			{
-				if (UGameInstance* GI = World->GetGameInstance())
-				{
-					if (UT66RunStateSubsystem* RunState = GI->GetSubsystem<UT66RunStateSubsystem>())
-					{
-						RunState->NotifyEnemyKilledByHero();
-					}
-				}
-			}
-
-			UT66CombatComponent::SpawnDeathBurstAtLocation(World, GetActorLocation(), 16, 60.f);
-		}
-
-		T66PlayEnemyAudioEvent(this, TEXT("Combat.Enemy.Death"), FName(TEXT("Combat.Enemy.Death")));
 		OnDeath();
 		return true;
 	}
 
-	T66PlayEnemyAudioEvent(this, TEXT("Combat.Hit.Enemy"), FName(TEXT("Combat.Hit.Enemy")));
 	return false;
 }
 
@@ -1374,31 +1286,14 @@ void AT66EnemyBase::ApplyPushAwayFrom(const FVector& PushOrigin, float Distance)
 	T66ApplyCharacterDisplacement(this, PushOrigin, Distance, false);
 }
 
-void AT66EnemyBase::UpdateHealthBar()
+float AT66EnemyBase::GetHealthPercent() const
 {
-	if (!HealthBarWidget) return;
-	UT66EnemyHealthBarWidget* W = Cast<UT66EnemyHealthBarWidget>(HealthBarWidget->GetUserWidgetObject());
-	if (!W) return;
-	const float Pct = (MaxHP <= 0) ? 0.f : (static_cast<float>(FMath::Clamp(CurrentHP, 0, MaxHP)) / static_cast<float>(MaxHP));
-	W->SetHealthPercent(Pct);
+	return (MaxHP <= 0) ? 0.f : (static_cast<float>(FMath::Clamp(CurrentHP, 0, MaxHP)) / static_cast<float>(MaxHP));
 }
 
 void AT66EnemyBase::SetLockedIndicator(bool bLocked)
 {
-	if (LockIndicatorWidget)
-	{
-		if (bLocked && !LockIndicatorWidget->GetUserWidgetObject())
-		{
-			LockIndicatorWidget->InitWidget();
-		}
-		LockIndicatorWidget->SetHiddenInGame(!bLocked, true);
-		LockIndicatorWidget->SetVisibility(bLocked, true);
-	}
-
-	if (!HealthBarWidget) return;
-	UT66EnemyHealthBarWidget* W = Cast<UT66EnemyHealthBarWidget>(HealthBarWidget->GetUserWidgetObject());
-	if (!W) return;
-	W->SetLocked(bLocked);
+	bLockedIndicatorShown = bLocked;
 }
 
 void AT66EnemyBase::OnDeath()
@@ -1408,30 +1303,20 @@ void AT66EnemyBase::OnDeath()
 	UWorld* World = GetWorld();
 	UGameInstance* GI = World ? World->GetGameInstance() : nullptr;
 	UT66RunStateSubsystem* RunState = GI ? GI->GetSubsystem<UT66RunStateSubsystem>() : nullptr;
-	UT66AchievementsSubsystem* Achievements = GI ? GI->GetSubsystem<UT66AchievementsSubsystem>() : nullptr;
-	if (RunState)
+	if (UT66CombatEventSubsystem* CombatEvents = World ? World->GetSubsystem<UT66CombatEventSubsystem>() : nullptr)
 	{
-		const int32 AwardPoints = FMath::Max(0, ResolvedScoreAward);
-		int32 AwardXP = XPValue;
-		if (AT66GameMode* GameMode = World ? Cast<AT66GameMode>(World->GetAuthGameMode()) : nullptr)
+		FT66CombatKillEvent Kill;
+		Kill.CharacterVisualID = CharacterVisualID;
+		Kill.ScorePoints = FMath::Max(0, ResolvedScoreAward);
+		Kill.XP = XPValue;
+		if (AT66GameMode* GameMode = Cast<AT66GameMode>(World->GetAuthGameMode()))
 		{
 			if (GameMode->IsUsingTowerMainMapLayout())
 			{
-				AwardXP = FMath::Max(1, FMath::RoundToInt(static_cast<float>(XPValue) * 0.5f));
+				Kill.XP = FMath::Max(1, FMath::RoundToInt(static_cast<float>(XPValue) * 0.5f));
 			}
 		}
-		RunState->AddEnemyKillScore(AwardPoints);
-		RunState->AddHeroXP(AwardXP);
-		RunState->AddStructuredEvent(ET66RunEventType::EnemyKilled, FString::Printf(TEXT("Score=%d,XP=%d"), AwardPoints, AwardXP));
-	}
-	if (Achievements)
-	{
-		Achievements->NotifyEnemyKilled(1);
-		// Lab unlock: mark this enemy type as unlocked for The Lab.
-		if (!CharacterVisualID.IsNone())
-		{
-			Achievements->AddLabUnlockedEnemy(CharacterVisualID);
-		}
+		CombatEvents->PushKill(Kill);
 	}
 
 	if (OwningDirector)
@@ -8,7 +8,6 @@
 #include "Gameplay/T66CombatTargetTypes.h"
 #include "T66EnemyBase.generated.h"
 
-class UWidgetComponent;
 class UStaticMeshComponent;
 class AT66EnemyDirector;
 class AT66ItemPickup;
@@ -97,13 +96,9 @@ public:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Visuals")
 	FName CharacterVisualID = FName(TEXT("RegularEnemy"));
 
-	/** Health bar widget above head */
-	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "UI")
-	TObjectPtr<UWidgetComponent> HealthBarWidget;
-
-	/** Dedicated bullseye widget shown when this enemy is manually locked. */
-	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "UI")
-	TObjectPtr<UWidgetComponent> LockIndicatorWidget;
+	/** Height above the actor origin where the HUD enemy indicator layer anchors the manual lock bullseye. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "UI")
+	float LockIndicatorHeightOffset = 225.f;
 
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Combat|HitZones")
 	bool bUsesCombatHitZones = true;
@@ -162,12 +157,13 @@ public:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "AI", meta = (ClampMin = "1.0"))
 	float FarChaseRampDistance = 2000.f;
 
-	/** Refresh health bar display (call when HP changes) */
-	UFUNCTION(BlueprintCallable, Category = "UI")
-	void UpdateHealthBar();
+	/** Current HP as a 0-1 fraction. */
+	UFUNCTION(BlueprintPure, Category = "UI")
+	float GetHealthPercent() const;
 
-	/** Show/hide the lock indicator on this enemy's health bar. */
+	/** Show/hide the HUD lock bullseye for this enemy. */
 	void SetLockedIndicator(bool bLocked);
+	bool IsLockedIndicatorShown() const { return bLockedIndicatorShown; }
 
 	bool SupportsCombatHitZones() const;
 	FT66CombatTargetHandle ResolveCombatTargetHandle(const UPrimitiveComponent* HitComponent = nullptr, ET66HitZoneType PreferredZone = ET66HitZoneType::Body) const;
@@ -250,6 +246,7 @@ private:
 	/** Safe-zone check runs every this many seconds (perf: was 0.25, then 0.5; 1.0 reduces N×M cost). */
 	float SafeZoneCheckIntervalSeconds = 1.0f;
 	bool bCachedInsideSafeZone = false;
+	bool bLockedIndicatorShown = false;
 	FVector CachedSafeZoneEscapeDir = FVector::ZeroVector;
 	FVector CachedSafeZoneCenter = FVector::ZeroVector;
 	float CachedSafeZoneRadius = 0.f;
@@ -315,4 +312,10 @@ protected:
 	/** True if an imported skeletal mesh was applied and placeholders should be hidden. */
 	UPROPERTY(Transient)
 	bool bUsingCharacterVisual = false;
+
+	/** Streams the imported mesh for CharacterVisualID without blocking; the placeholder stays up until it lands. */
+	void RequestImportedCharacterVisual();
+
+	/** Settles placeholder/skeletal visibility once the visual request resolves (immediately or after streaming). */
+	virtual void HandleImportedCharacterVisualApplied(bool bApplied);
 };
@@ -35,25 +35,6 @@ namespace
 	static constexpr float T66TowerTargetRuntimeSpawnIntervalSeconds = 9.0f;
 	static constexpr int32 T66TowerTargetEnemiesPerWave = 1;
 	static constexpr int32 T66TowerTargetMaxAliveEnemies = 12;
-
-	static void T66ResolveStageMobIDs(UGameInstance* GI, const int32 StageNum, TArray<FName>& OutMobIDs)
-	{
-		FName MobA = FName(*FString::Printf(TEXT("Mob_Stage%02d_A"), StageNum));
-		FName MobB = FName(*FString::Printf(TEXT("Mob_Stage%02d_B"), StageNum));
-		FName MobC = FName(*FString::Printf(TEXT("Mob_Stage%02d_C"), StageNum));
-		if (UT66GameInstance* T66GI = Cast<UT66GameInstance>(GI))
-		{
-			FStageData StageData;
-			if (T66GI->GetStageData(StageNum, StageData))
-			{
-				if (!StageData.EnemyA.IsNone()) MobA = StageData.EnemyA;
-				if (!StageData.EnemyB.IsNone()) MobB = StageData.EnemyB;
-				if (!StageData.EnemyC.IsNone()) MobC = StageData.EnemyC;
-			}
-		}
-
-		OutMobIDs = { MobA, MobB, MobC };
-	}
 }
 
 AT66EnemyDirector::AT66EnemyDirector()
@@ -153,7 +134,10 @@ void AT66EnemyDirector::SpawnInitialPopulationForStage()
 	}
 
 	TArray<FName> MobIDs;
-	T66ResolveStageMobIDs(GI, StageNum, MobIDs);
+	if (UT66GameInstance* T66GI = Cast<UT66GameInstance>(GI))
+	{
+		T66GI->GetStageMobIDs(StageNum, MobIDs);
+	}
 	if (MobIDs.Num() <= 0)
 	{
 		return;
@@ -546,7 +530,10 @@ void AT66EnemyDirector::SpawnRuntimeTrickleWave()
 	// Stage mobs: pull exact roster from DT_Stages (EnemyA/B/C). Fallback is deterministic IDs.
 	const int32 StageNum = RunState->GetCurrentStage();
 	TArray<FName> MobIDs;
-	T66ResolveStageMobIDs(GI, StageNum, MobIDs);
+	if (UT66GameInstance* T66GI = Cast<UT66GameInstance>(GI))
+	{
+		T66GI->GetStageMobIDs(StageNum, MobIDs);
+	}
 	const FName MobA = MobIDs.IsValidIndex(0) ? MobIDs[0] : NAME_None;
 	const FName MobB = MobIDs.IsValidIndex(1) ? MobIDs[1] : NAME_None;
 	const FName MobC = MobIDs.IsValidIndex(2) ? MobIDs[2] : NAME_None;
@@ -4,7 +4,6 @@
 #include "Core/T66AchievementsSubsystem.h"
 #include "Core/T66GameInstance.h"
 #include "Gameplay/T66VisualUtil.h"
-#include "Core/T66CharacterVisualSubsystem.h"
 #include "Core/T66RunStateSubsystem.h"
 #include "Gameplay/T66LootBagPickup.h"
 #include "Components/StaticMeshComponent.h"
@@ -78,7 +77,7 @@ void AT66GamblerBoss::BeginPlay()
 {
 	Super::BeginPlay();
 
-	// Placeholder mesh: smaller sphere, casino yellow (overridden by ApplyCharacterVisual if mapped).
+	// Placeholder mesh: smaller sphere, casino yellow (overridden by the requested character visual if mapped).
 	if (UStaticMesh* Sphere = FT66VisualUtil::GetBasicShapeSphere())
 	{
 		VisualMesh->SetStaticMesh(Sphere);
@@ -121,14 +120,7 @@ void AT66GamblerBoss::BeginPlay()
 		}
 		ApplyDifficultyScalar(DifficultyScalar * MetaScalar);
 
-		if (UT66CharacterVisualSubsystem* Visuals = GI->GetSubsystem<UT66CharacterVisualSubsystem>())
-		{
-			const bool bApplied = Visuals->ApplyCharacterVisual(FName(TEXT("GamblerBoss")), GetMesh(), VisualMesh, true);
-			if (!bApplied && GetMesh())
-			{
-				GetMesh()->SetVisibility(false, true);
-			}
-		}
+		RequestBossCharacterVisual(FName(TEXT("GamblerBoss")));
 	}
 
 	ForceAwaken();
@@ -5,6 +5,18 @@
 
 DEFINE_LOG_CATEGORY(LogT66GameMode);
 
+static TAutoConsoleVariable<float> CVarT66HousekeepingBudgetMs(
+	TEXT("T66.GameMode.HousekeepingBudgetMs"),
+	1.0f,
+	TEXT("Per-frame budget for game mode housekeeping jobs. Non-critical jobs past it wait one frame."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarT66HousekeepingOverlay(
+	TEXT("T66.GameMode.HousekeepingOverlay"),
+	0,
+	TEXT("1 = draw per-job housekeeping cost on screen (non-shipping builds)"),
+	ECVF_Default);
+
 namespace T66GameModePrivate
 {
 
@@ -431,6 +443,17 @@ namespace T66GameModePrivate
 		return nullptr;
 	}
 
+	AActor* T66FindRememberedTaggedActor(UWorld* World, const FName Tag)
+	{
+		if (!World || Tag.IsNone() || GT66TaggedActorCache.World.Get() != World)
+		{
+			return nullptr;
+		}
+
+		const TWeakObjectPtr<AActor>* CachedActor = GT66TaggedActorCache.ActorsByTag.Find(Tag);
+		return CachedActor ? CachedActor->Get() : nullptr;
+	}
+
 	void T66RememberTaggedActor(AActor* Actor, const FName Tag)
 	{
 		if (!Actor || Tag.IsNone())
@@ -1112,10 +1135,10 @@ void AT66GameMode::EndPlay(const EEndPlayReason::Type EndPlayReason)
 	TutorialManager = nullptr;
 	IdolAltar = nullptr;
 	BossBeaconActor = nullptr;
-	BossBeaconUpdateAccumulator = 0.f;
 	bTowerMiasmaActive = false;
 	TowerMiasmaStartWorldSeconds = 0.f;
-	TowerMiasmaUpdateAccumulator = 0.f;
+	HousekeepingScheduler.Reset();
+	CachedMainMapPreset = FT66CachedMainMapPreset();
 	TowerIdolSelectionsAtStageStart = 0;
 	T66InvalidatePlayerStartCache(GetWorld());
 	T66ResetTaggedActorCache(GetWorld());
@@ -1125,32 +1148,7 @@ void AT66GameMode::EndPlay(const EEndPlayReason::Type EndPlayReason)
 void AT66GameMode::Tick(float DeltaTime)
 {
 	Super::Tick(DeltaTime);
-	if (IsUsingTowerMainMapLayout())
-	{
-		TowerTerrainSafetyAccumulator += DeltaTime;
-		if (TowerTerrainSafetyAccumulator >= 0.10f)
-		{
-			TowerTerrainSafetyAccumulator = 0.f;
-			MaintainPlayerTerrainSafety();
-		}
-	}
-	else
-	{
-		TowerTerrainSafetyAccumulator = 0.f;
-		MaintainPlayerTerrainSafety();
-	}
-
-	SyncTowerTrapActivation();
-	TryActivateMainMapCombat();
-	UpdateTowerMiasma(DeltaTime);
-	SyncTowerBossEntryState();
-
-	BossBeaconUpdateAccumulator += DeltaTime;
-	if (BossBeaconUpdateAccumulator >= 0.10f)
-	{
-		BossBeaconUpdateAccumulator = 0.f;
-		UpdateBossBeaconTransform(true);
-	}
+	HousekeepingScheduler.Tick(DeltaTime, FMath::Max(0.f, CVarT66HousekeepingBudgetMs.GetValueOnGameThread()));
 
 	// Frame-level lag: log when a frame exceeded budget (e.g. >20ms).
 	if (DeltaTime > 0.02f)
@@ -1167,38 +1165,160 @@ void AT66GameMode::Tick(float DeltaTime)
 		}
 	}
 
-	if (UGameInstance* GI = GetGameInstance())
+#if !UE_BUILD_SHIPPING
+	if (CVarT66HousekeepingOverlay.GetValueOnGameThread() != 0)
 	{
-		if (UT66RunStateSubsystem* RunState = GI->GetSubsystem<UT66RunStateSubsystem>())
+		DrawHousekeepingOverlay();
+	}
+#endif
+}
+
+void AT66GameMode::RegisterHousekeepingTasks()
+{
+	// Timers and rescue keep their exact cadence; everything else is polling world state that only
+	// needs to notice a change within a tenth of a second or so.
+	HousekeepingScheduler.Reset();
+	HousekeepingScheduler.Register(TEXT("RunTimers"), 0.f, ET66PeriodicTaskPriority::Critical, [this](const float Elapsed)
+	{
+		TickRunTimers(Elapsed);
+	});
+	HousekeepingScheduler.Register(TEXT("TerrainSafety"), 0.10f, ET66PeriodicTaskPriority::Critical, [this](float)
+	{
+		MaintainPlayerTerrainSafety();
+		if (!bTerrainCollisionReady)
 		{
-			RunState->TickStageTimer(DeltaTime);
-			RunState->TickSpeedRunTimer(DeltaTime);
-			RunState->TickHeroTimers(DeltaTime);
-			TickFinalDifficultySurvival(DeltaTime);
+			// Pawns are held in MOVE_None until collision exists; re-assert that every frame.
+			HousekeepingScheduler.RequestRun(TEXT("TerrainSafety"));
+		}
+	});
+	HousekeepingScheduler.Register(TEXT("MainMapCombat"), 0.10f, ET66PeriodicTaskPriority::Normal, [this](float)
+	{
+		TryActivateMainMapCombat();
+	});
+	HousekeepingScheduler.Register(TEXT("TowerTraps"), 0.10f, ET66PeriodicTaskPriority::Normal, [this](float)
+	{
+		SyncTowerTrapActivation();
+	});
+	HousekeepingScheduler.Register(TEXT("TowerBossEntry"), 0.10f, ET66PeriodicTaskPriority::Normal, [this](float)
+	{
+		SyncTowerBossEntryState();
+	});
+	HousekeepingScheduler.Register(TEXT("BossBeacon"), 0.10f, ET66PeriodicTaskPriority::Normal, [this](float)
+	{
+		UpdateBossBeaconTransform(true);
+	});
+	HousekeepingScheduler.Register(TEXT("TowerMiasma"), 0.20f, ET66PeriodicTaskPriority::Normal, [this](float)
+	{
+		UpdateTowerMiasma();
+	});
+	HousekeepingScheduler.Register(TEXT("LoanShark"), 0.25f, ET66PeriodicTaskPriority::Low, [this](float)
+	{
+		SyncLoanShark();
+	});
+}
 
-			// Skill Rating: time is driven here; damage is an input event from RunState.
-			if (UT66SkillRatingSubsystem* Skill = GI->GetSubsystem<UT66SkillRatingSubsystem>())
-			{
-				// Track only during combat time (stage timer active) and not during last-stand invulnerability.
-				Skill->SetTrackingActive(RunState->GetStageTimerActive() && !RunState->IsInLastStand());
-				Skill->TickSkillRating(DeltaTime);
-			}
+void AT66GameMode::TickRunTimers(const float DeltaTime)
+{
+	UGameInstance* GI = GetGameInstance();
+	UT66RunStateSubsystem* RunState = GI ? GI->GetSubsystem<UT66RunStateSubsystem>() : nullptr;
+	if (!RunState)
+	{
+		return;
+	}
 
-			// Robust: if the timer is already active (even if we missed the delegate),
-			// try spawning the LoanShark when pending.
-			if (!IsLabLevel() && RunState->GetStageTimerActive())
-			{
-				TrySpawnLoanSharkIfNeeded();
-			}
+	RunState->TickStageTimer(DeltaTime);
+	RunState->TickSpeedRunTimer(DeltaTime);
+	RunState->TickHeroTimers(DeltaTime);
+	TickFinalDifficultySurvival(DeltaTime);
 
-			// Despawn loan shark immediately once debt is paid.
-			if (LoanShark && RunState->GetCurrentDebt() <= 0)
-			{
-				LoanShark->Destroy();
-				LoanShark = nullptr;
-			}
-		}
+	// Skill Rating: time is driven here; damage is an input event from RunState.
+	if (UT66SkillRatingSubsystem* Skill = GI->GetSubsystem<UT66SkillRatingSubsystem>())
+	{
+		// Track only during combat time (stage timer active) and not during last-stand invulnerability.
+		Skill->SetTrackingActive(RunState->GetStageTimerActive() && !RunState->IsInLastStand());
+		Skill->TickSkillRating(DeltaTime);
+	}
+}
+
+void AT66GameMode::SyncLoanShark()
+{
+	UGameInstance* GI = GetGameInstance();
+	UT66RunStateSubsystem* RunState = GI ? GI->GetSubsystem<UT66RunStateSubsystem>() : nullptr;
+	if (!RunState)
+	{
+		return;
+	}
+
+	// Robust: if the timer is already active (even if we missed the delegate),
+	// try spawning the LoanShark when pending.
+	if (!IsLabLevel() && RunState->GetStageTimerActive())
+	{
+		TrySpawnLoanSharkIfNeeded();
+	}
+
+	// Despawn loan shark once debt is paid.
+	if (LoanShark && RunState->GetCurrentDebt() <= 0)
+	{
+		LoanShark->Destroy();
+		LoanShark = nullptr;
+	}
+}
+
+void AT66GameMode::DumpHousekeepingStats(const bool bResetAfterDump)
+{
+	TArray<FString> Lines;
+	HousekeepingScheduler.DescribeStats(Lines);
+	UE_LOG(LogT66GameMode, Log, TEXT("[Housekeeping] budget=%.2fms lastFrame=%.3fms"),
+		CVarT66HousekeepingBudgetMs.GetValueOnGameThread(),
+		HousekeepingScheduler.GetLastFrameMs());
+	for (const FString& Line : Lines)
+	{
+		UE_LOG(LogT66GameMode, Log, TEXT("[Housekeeping] %s"), *Line);
+	}
+
+	if (bResetAfterDump)
+	{
+		HousekeepingScheduler.ResetStats();
+	}
+}
+
+void AT66GameMode::DrawHousekeepingOverlay() const
+{
+#if !UE_BUILD_SHIPPING
+	if (!GEngine)
+	{
+		return;
+	}
+
+	TArray<FString> Lines;
+	HousekeepingScheduler.DescribeStats(Lines);
+	constexpr uint64 KeyBase = 0x7466600;
+	GEngine->AddOnScreenDebugMessage(KeyBase, 0.f, FColor::Cyan,
+		FString::Printf(TEXT("Housekeeping %.3fms / %.2fms budget"), HousekeepingScheduler.GetLastFrameMs(), CVarT66HousekeepingBudgetMs.GetValueOnGameThread()));
+	for (int32 Index = 0; Index < Lines.Num(); ++Index)
+	{
+		GEngine->AddOnScreenDebugMessage(KeyBase + 1 + Index, 0.f, FColor::White, Lines[Index]);
 	}
+#endif
+}
+
+const AT66GameMode::FT66CachedMainMapPreset& AT66GameMode::GetCachedMainMapPreset()
+{
+	UT66GameInstance* GI = GetT66GameInstance();
+	const ET66Difficulty Difficulty = GI ? GI->SelectedDifficulty : ET66Difficulty::Easy;
+	const int32 RunSeed = T66EnsureRunSeed(GI);
+	if (!CachedMainMapPreset.bValid || CachedMainMapPreset.Difficulty != Difficulty || CachedMainMapPreset.RunSeed != RunSeed)
+	{
+		CachedMainMapPreset.bValid = true;
+		CachedMainMapPreset.Difficulty = Difficulty;
+		CachedMainMapPreset.RunSeed = RunSeed;
+		CachedMainMapPreset.Preset = T66BuildMainMapPreset(GI);
+		CachedMainMapPreset.LowestCollisionBottomZ = T66MainMapTerrain::GetLowestCollisionBottomZ(CachedMainMapPreset.Preset);
+		CachedMainMapPreset.TraceZ = T66MainMapTerrain::GetTraceZ(CachedMainMapPreset.Preset);
+		CachedMainMapPreset.BoardSize = T66MainMapTerrain::MakeSettings(CachedMainMapPreset.Preset).BoardSize;
+	}
+
+	return CachedMainMapPreset;
 }
 
 void AT66GameMode::Logout(AController* Exiting)
@@ -1591,11 +1711,12 @@ void AT66GameMode::MaintainPlayerTerrainSafety()
 
 	UT66GameInstance* GI = GetT66GameInstance();
 	UT66RunStateSubsystem* RunState = GI ? GI->GetSubsystem<UT66RunStateSubsystem>() : nullptr;
-	const FT66MapPreset Preset = T66BuildMainMapPreset(GI);
+	const FT66CachedMainMapPreset& CachedPreset = GetCachedMainMapPreset();
+	const FT66MapPreset& Preset = CachedPreset.Preset;
 	const bool bUsingMainMapTerrain = T66UsesMainMapTerrainStage(World);
 	const bool bTowerLayout = bUsingMainMapTerrain && IsUsingTowerMainMapLayout();
 	float RescueThresholdZ = bUsingMainMapTerrain
-		? (T66MainMapTerrain::GetLowestCollisionBottomZ(Preset) - 100.0f)
+		? (CachedPreset.LowestCollisionBottomZ - 100.0f)
 		: (Preset.ElevationMin - 200.f);
 	if (bTowerLayout && CachedTowerMainMapLayout.Floors.Num() > 0)
 	{
@@ -1603,7 +1724,7 @@ void AT66GameMode::MaintainPlayerTerrainSafety()
 		RescueThresholdZ = LowestFloor.SurfaceZ - FMath::Max(CachedTowerMainMapLayout.FloorThickness + 1400.0f, 1800.0f);
 	}
 	const float AnchorTraceZ = bUsingMainMapTerrain
-		? T66MainMapTerrain::GetTraceZ(Preset)
+		? CachedPreset.TraceZ
 		: (Preset.ElevationMax + 3000.f);
 	const bool bStageTimerActive = RunState && RunState->GetStageTimerActive();
 
@@ -1649,7 +1770,7 @@ void AT66GameMode::MaintainPlayerTerrainSafety()
 			}
 			else
 			{
-				const int32 GridSize = T66MainMapTerrain::MakeSettings(Preset).BoardSize;
+				const int32 GridSize = CachedPreset.BoardSize;
 				RescueAnchors.Reserve(5);
 				RescueAnchors.Add(T66MainMapTerrain::GetSpawnLocation(Preset, AnchorTraceZ));
 				RescueAnchors.Add(T66MainMapTerrain::GetCellCenter(Preset, GridSize / 2, FMath::Max(0, GridSize / 2 - 1), AnchorTraceZ));
@@ -1734,6 +1855,27 @@ void AT66GameMode::SnapPlayersToTerrain()
 		}
 	}
 }
+// Console command: T66.GameMode.HousekeepingStats [reset]
+static FAutoConsoleCommandWithWorldAndArgs T66HousekeepingStatsCmd(
+	TEXT("T66.GameMode.HousekeepingStats"),
+	TEXT("Log per-job cost of the game mode housekeeping scheduler. Pass 'reset' to clear after dumping."),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda(
+		[](const TArray<FString>& Args, UWorld* World)
+		{
+			AT66GameMode* T66GM = World ? Cast<AT66GameMode>(World->GetAuthGameMode()) : nullptr;
+			if (!T66GM)
+			{
+				UE_LOG(LogT66GameMode, Error, TEXT("T66.GameMode.HousekeepingStats: no T66GameMode active"));
+				return;
+			}
+
+			const bool bResetAfterDump = Args.ContainsByPredicate([](const FString& Arg)
+			{
+				return Arg.Equals(TEXT("reset"), ESearchCase::IgnoreCase);
+			});
+			T66GM->DumpHousekeepingStats(bResetAfterDump);
+		})
+);
 // Console command: T66.MainMap [seed]
 static FAutoConsoleCommandWithWorldAndArgs T66MainMapCmd(
 	TEXT("T66.MainMap"),
@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/GameModeBase.h"
+#include "Gameplay/T66PeriodicTaskScheduler.h"
 #include "Gameplay/T66TowerMapTerrain.h"
 #include "T66GameMode.generated.h"
 
@@ -119,6 +120,9 @@ public:
 	bool TryGetTowerEnemySpawnLocation(const FVector& PlayerLocation, float MinDistance, float MaxDistance, FRandomStream& Rng, FVector& OutLocation, FVector& OutWallNormal) const;
 	void HandleTowerDescentHoleTriggered(APawn* Pawn, int32 FromFloorNumber, int32 ToFloorNumber);
 
+	/** Logs per-job cost of the housekeeping scheduler driven from Tick. */
+	void DumpHousekeepingStats(bool bResetAfterDump);
+
 protected:
 	virtual void BeginPlay() override;
 	virtual void StartPlay() override;
@@ -245,7 +249,7 @@ protected:
 	AT66EnemyDirector* EnsureEnemyDirector(UWorld* World);
 	void DestroyEnemyDirectors(UWorld* World);
 	void ResetTowerMiasmaState();
-	void UpdateTowerMiasma(float DeltaTime);
+	void UpdateTowerMiasma();
 	void TryStartTowerMiasma(const FVector* SourceAnchor = nullptr, int32 SourceFloorNumber = INDEX_NONE);
 	void SyncTowerMiasmaSourceAnchor(int32 FloorNumber, const FVector& WorldAnchor) const;
 	float GetTowerMiasmaElapsedSeconds() const;
@@ -327,7 +331,6 @@ private:
 	TWeakObjectPtr<AT66EnemyDirector> EnemyDirector;
 	TWeakObjectPtr<AT66TutorialManager> TutorialManager;
 	TWeakObjectPtr<AActor> BossBeaconActor;
-	float BossBeaconUpdateAccumulator = 0.f;
 
 	UPROPERTY(Transient)
 	TObjectPtr<UStaticMesh> CachedCubeMesh;
@@ -344,6 +347,23 @@ private:
 	void SnapPlayersToTerrain();
 	void MaintainPlayerTerrainSafety();
 	void TryActivateMainMapCombat();
+	void RegisterHousekeepingTasks();
+	void TickRunTimers(float DeltaTime);
+	void SyncLoanShark();
+	void DrawHousekeepingOverlay() const;
+
+	/** Main map preset plus the terrain heights derived from it; rebuilt only when difficulty or run seed changes. */
+	struct FT66CachedMainMapPreset
+	{
+		bool bValid = false;
+		ET66Difficulty Difficulty = static_cast<ET66Difficulty>(0);
+		int32 RunSeed = 0;
+		FT66MapPreset Preset;
+		float LowestCollisionBottomZ = 0.f;
+		float TraceZ = 0.f;
+		int32 BoardSize = 0;
+	};
+	const FT66CachedMainMapPreset& GetCachedMainMapPreset();
 	bool TryGetMainMapStartAxes(FVector& OutCenter, FVector& OutInwardDirection, FVector& OutSideDirection, float& OutCellSize) const;
 	bool TryGetMainMapStartPlacementLocation(float SideCells, float InwardCells, FVector& OutLocation) const;
 	bool TryFindRandomMainMapSurfaceLocation(int32 SeedOffset, FVector& OutLocation, float ExtraSafeBubbleMargin = 0.f) const;
@@ -369,11 +389,8 @@ private:
 	T66TowerMapTerrain::FLayout CachedTowerMainMapLayout;
 	bool bTowerBossEntryTriggered = false;
 	bool bTowerBossEntryApplied = false;
-	float TowerTerrainSafetyAccumulator = 0.f;
-	float TowerTrapActivationAccumulator = 0.f;
 	bool bTowerMiasmaActive = false;
 	float TowerMiasmaStartWorldSeconds = 0.f;
-	float TowerMiasmaUpdateAccumulator = 0.f;
 	int32 TowerIdolSelectionsAtStageStart = 0;
 	int32 ActiveTowerTrapFloorNumber = INDEX_NONE;
 
@@ -383,6 +400,9 @@ private:
 	TWeakObjectPtr<AActor> FinalDifficultyTotemActor;
 	TWeakObjectPtr<AT66SaintNPC> FinalDifficultySaintActor;
 
+	FT66PeriodicTaskScheduler HousekeepingScheduler;
+	FT66CachedMainMapPreset CachedMainMapPreset;
+
 	// The Lab: actors spawned from Lab panels (for Reset Enemies).
 	UPROPERTY()
 	TArray<TObjectPtr<AActor>> LabSpawnedActors;
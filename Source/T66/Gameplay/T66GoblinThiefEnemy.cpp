@@ -2,7 +2,6 @@
 
 #include "Gameplay/T66GoblinThiefEnemy.h"
 #include "Gameplay/T66HeroBase.h"
-#include "Core/T66CharacterVisualSubsystem.h"
 #include "Core/T66RunStateSubsystem.h"
 #include "Core/T66Rarity.h"
 #include "Gameplay/T66VisualUtil.h"
@@ -60,21 +59,18 @@ void AT66GoblinThiefEnemy::SetRarity(ET66Rarity InRarity)
 	CharacterVisualID = T66_GetGoblinThiefVisualIdForRarity(Rarity);
 
 	// Re-apply imported visuals now (SetRarity is typically called AFTER BeginPlay).
-	if (UWorld* World = GetWorld())
-	{
-		if (UGameInstance* GI = World->GetGameInstance())
-		{
-			if (UT66CharacterVisualSubsystem* Visuals = GI->GetSubsystem<UT66CharacterVisualSubsystem>())
-			{
-				bUsingCharacterVisual = Visuals->ApplyCharacterVisual(CharacterVisualID, GetMesh(), VisualMesh, true);
-			}
-		}
-	}
+	RequestImportedCharacterVisual();
 
 	ApplyRarityVisuals();
 	RecomputeGoldFromRarity();
 }
 
+void AT66GoblinThiefEnemy::HandleImportedCharacterVisualApplied(const bool bApplied)
+{
+	Super::HandleImportedCharacterVisualApplied(bApplied);
+	ApplyRarityVisuals();
+}
+
 void AT66GoblinThiefEnemy::ApplyRarityVisuals()
 {
 	// If we have a real imported mesh, do not tint the placeholder cone.
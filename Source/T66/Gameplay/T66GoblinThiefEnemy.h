@@ -30,6 +30,7 @@ public:
 
 protected:
 	virtual void BeginPlay() override;
+	virtual void HandleImportedCharacterVisualApplied(bool bApplied) override;
 
 	UFUNCTION()
 	void OnCapsuleBeginOverlapThief(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor,
@@ -8,6 +8,7 @@
 #include "Core/T66ActorRegistrySubsystem.h"
 #include "Core/T66GameInstance.h"
 #include "Core/T66RunStateSubsystem.h"
+#include "Core/T66TerrainBoardSubsystem.h"
 #include "Engine/StaticMesh.h"
 #include "Engine/Texture.h"
 #include "Engine/World.h"
@@ -215,12 +216,14 @@ void AT66MiasmaBoundary::BuildBoundaryWalls()
 	const int32 RunSeed = T66GI ? T66GI->RunSeed : 0;
 
 	const FT66MapPreset Preset = T66MainMapTerrain::BuildPresetForDifficulty(Difficulty, RunSeed);
-	T66MainMapTerrain::FBoard Board;
-	if (!T66MainMapTerrain::Generate(Preset, Board))
+	const UT66TerrainBoardSubsystem::FBoardHandle BoardHandle = UT66TerrainBoardSubsystem::ResolveBoard(World, Preset);
+	if (!BoardHandle)
 	{
 		return;
 	}
 
+	const T66MainMapTerrain::FBoard& Board = *BoardHandle;
+
 	CachePlayableCells(Board);
 
 	TMap<FIntPoint, FT66BoundaryCellInfo> CellInfoByCoordinate;
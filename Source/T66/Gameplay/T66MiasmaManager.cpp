@@ -8,6 +8,7 @@
 #include "Core/T66GameplayLayout.h"
 #include "Core/T66LagTrackerSubsystem.h"
 #include "Core/T66RunStateSubsystem.h"
+#include "Core/T66TerrainBoardSubsystem.h"
 #include "Data/T66DataTypes.h"
 #include "Engine/StaticMesh.h"
 #include "Engine/Texture.h"
@@ -31,6 +32,7 @@ DEFINE_LOG_CATEGORY_STATIC(LogT66MiasmaManager, Log, All);
 namespace
 {
 	static constexpr bool T66EnableLegacyLavaPatches = false;
+	static constexpr float T66TowerMiasmaFloorHeightTolerance = 1600.0f;
 
 	static bool T66ShouldUseMainBoardCoverage(const UWorld* World)
 	{
@@ -138,12 +140,14 @@ void AT66MiasmaManager::BuildMainMapCellGrid()
 
 	const int32 StageNum = RunState ? RunState->GetCurrentStage() : 1;
 	const FT66MapPreset Preset = T66MainMapTerrain::BuildPresetForDifficulty(T66GI->SelectedDifficulty, T66GI->RunSeed);
-	T66MainMapTerrain::FBoard Board;
-	if (!T66MainMapTerrain::Generate(Preset, Board))
+	const UT66TerrainBoardSubsystem::FBoardHandle BoardHandle = UT66TerrainBoardSubsystem::ResolveBoard(World, Preset);
+	if (!BoardHandle)
 	{
 		return;
 	}
 
+	const T66MainMapTerrain::FBoard& Board = *BoardHandle;
+
 	TileSize = Board.Settings.CellSize;
 
 	auto AddCellCenter = [&](const T66MainMapTerrain::FCell& Cell)
@@ -234,11 +238,23 @@ void AT66MiasmaManager::BuildTowerFloorGrid()
 
 		if (Floor.WalkableFloorBoxes.Num() > 0)
 		{
+			// Boxes share the floor's cell lattice so overlapping boxes land on the same cells.
+			const FVector2D LatticeOrigin(Floor.Center.X - Floor.WalkableHalfExtent, Floor.Center.Y - Floor.WalkableHalfExtent);
+			// Only lattice cells that fit wholly inside a box are used, so no tile overhangs its box edge.
+			const float LatticeTileSize = TileSize;
+			const float HalfTile = LatticeTileSize * 0.5f;
+			const float EdgeTolerance = 1.0f;
+			auto FirstLatticeCenter = [LatticeTileSize, HalfTile, EdgeTolerance](const float BoxMin, const float Origin)
+			{
+				return Origin + (FMath::CeilToFloat((BoxMin + HalfTile - EdgeTolerance - Origin) / LatticeTileSize - 0.5f) + 0.5f) * LatticeTileSize;
+			};
+
 			for (const FBox2D& WalkableBox : Floor.WalkableFloorBoxes)
 			{
-				for (float X = WalkableBox.Min.X + (TileSize * 0.5f); X < WalkableBox.Max.X; X += TileSize)
+				const FVector2D LastCenter = WalkableBox.Max - FVector2D(HalfTile - EdgeTolerance, HalfTile - EdgeTolerance);
+				for (float X = FirstLatticeCenter(WalkableBox.Min.X, LatticeOrigin.X); X <= LastCenter.X; X += TileSize)
 				{
-					for (float Y = WalkableBox.Min.Y + (TileSize * 0.5f); Y < WalkableBox.Max.Y; Y += TileSize)
+					for (float Y = FirstLatticeCenter(WalkableBox.Min.Y, LatticeOrigin.Y); Y <= LastCenter.Y; Y += TileSize)
 					{
 						AddTowerMiasmaCandidate(FVector(X, Y, Floor.SurfaceZ + TileZ));
 					}
@@ -275,18 +291,23 @@ void AT66MiasmaManager::ApplyTowerCoverageOrdering()
 		return;
 	}
 
+	// Spawned tiles keep their place; only the pending tail is re-ordered, so coverage never shrinks.
+	const int32 FirstPendingIndex = FMath::Clamp(SpawnedTileCount, 0, TileCenters.Num());
+	const bool bHasCoverageCells = TileCoverageCells.Num() == TileCenters.Num();
+
 	struct FSortedTowerTile
 	{
 		FVector Center = FVector::ZeroVector;
 		int32 FloorNumber = INDEX_NONE;
+		FIntPoint CoverageCell = FIntPoint(INDEX_NONE, INDEX_NONE);
 		float DistanceSq = 0.0f;
 		float Angle = 0.0f;
 		int32 OriginalIndex = INDEX_NONE;
 	};
 
 	TArray<FSortedTowerTile> OrderedTiles;
-	OrderedTiles.Reserve(TileCenters.Num());
-	for (int32 TileIndex = 0; TileIndex < TileCenters.Num(); ++TileIndex)
+	OrderedTiles.Reserve(TileCenters.Num() - FirstPendingIndex);
+	for (int32 TileIndex = FirstPendingIndex; TileIndex < TileCenters.Num(); ++TileIndex)
 	{
 		const FVector& Center = TileCenters[TileIndex];
 		const int32 FloorNumber = TileFloorNumbers[TileIndex];
@@ -296,6 +317,7 @@ void AT66MiasmaManager::ApplyTowerCoverageOrdering()
 		FSortedTowerTile& OrderedTile = OrderedTiles.AddDefaulted_GetRef();
 		OrderedTile.Center = Center;
 		OrderedTile.FloorNumber = FloorNumber;
+		OrderedTile.CoverageCell = bHasCoverageCells ? TileCoverageCells[TileIndex] : FIntPoint(INDEX_NONE, INDEX_NONE);
 		OrderedTile.DistanceSq = Delta.SizeSquared();
 		OrderedTile.Angle = FMath::Atan2(Delta.Y, Delta.X);
 		OrderedTile.OriginalIndex = TileIndex;
@@ -322,14 +344,27 @@ void AT66MiasmaManager::ApplyTowerCoverageOrdering()
 
 	);
 
-	for (int32 TileIndex = 0; TileIndex < OrderedTiles.Num(); ++TileIndex)
+	for (int32 OrderedIndex = 0; OrderedIndex < OrderedTiles.Num(); ++OrderedIndex)
 	{
-		TileCenters[TileIndex] = OrderedTiles[TileIndex].Center;
-		TileFloorNumbers[TileIndex] = OrderedTiles[TileIndex].FloorNumber;
+		const int32 TileIndex = FirstPendingIndex + OrderedIndex;
+		TileCenters[TileIndex] = OrderedTiles[OrderedIndex].Center;
+		TileFloorNumbers[TileIndex] = OrderedTiles[OrderedIndex].FloorNumber;
+		if (bHasCoverageCells)
+		{
+			TileCoverageCells[TileIndex] = OrderedTiles[OrderedIndex].CoverageCell;
+		}
 	}
 }
 
 void AT66MiasmaManager::BuildGrid()
+{
+	CoverageGrids.Reset();
+	TileCoverageCells.Reset();
+	BuildTileCenters();
+	BuildCoverageGrids();
+}
+
+void AT66MiasmaManager::BuildTileCenters()
 {
 	if (ShouldUseTowerBloodLook())
 	{
@@ -377,6 +412,137 @@ void AT66MiasmaManager::BuildGrid()
 	}
 }
 
+int32 AT66MiasmaManager::FCoverageGrid::GetCellIndex(const FVector2D& Location) const
+{
+	if (CellSize <= KINDA_SMALL_NUMBER)
+	{
+		return INDEX_NONE;
+	}
+
+	const int32 CellX = FMath::FloorToInt((Location.X - Origin.X) / CellSize);
+	const int32 CellY = FMath::FloorToInt((Location.Y - Origin.Y) / CellSize);
+	if (CellX < 0 || CellY < 0 || CellX >= Width || CellY >= Height)
+	{
+		return INDEX_NONE;
+	}
+
+	return CellY * Width + CellX;
+}
+
+void AT66MiasmaManager::BuildCoverageGrids()
+{
+	CoverageGrids.Reset();
+	TileCoverageCells.Reset();
+
+	const int32 TileCount = TileCenters.Num();
+	bCoverageUsesFloorHeight = TileFloorNumbers.Num() == TileCount && TileCount > 0;
+	if (TileCount <= 0 || TileSize <= KINDA_SMALL_NUMBER)
+	{
+		return;
+	}
+
+	// Every builder lays tiles on a TileSize lattice, so each floor's bounds define its grid exactly.
+	TMap<int32, int32> GridIndexByFloor;
+	TArray<FBox2D> GridBounds;
+	TArray<int32> TileGridIndices;
+	TileGridIndices.SetNumUninitialized(TileCount);
+	for (int32 TileIndex = 0; TileIndex < TileCount; ++TileIndex)
+	{
+		const int32 FloorNumber = bCoverageUsesFloorHeight ? TileFloorNumbers[TileIndex] : INDEX_NONE;
+		int32 GridIndex = INDEX_NONE;
+		if (const int32* ExistingGridIndex = GridIndexByFloor.Find(FloorNumber))
+		{
+			GridIndex = *ExistingGridIndex;
+		}
+		else
+		{
+			GridIndex = CoverageGrids.AddDefaulted();
+			GridIndexByFloor.Add(FloorNumber, GridIndex);
+			GridBounds.Add(FBox2D(ForceInit));
+			CoverageGrids[GridIndex].SurfaceZ = TileCenters[TileIndex].Z;
+		}
+
+		GridBounds[GridIndex] += FVector2D(TileCenters[TileIndex]);
+		TileGridIndices[TileIndex] = GridIndex;
+	}
+
+	const float HalfTile = TileSize * 0.5f;
+	TArray<TBitArray<>> ClaimedCells;
+	ClaimedCells.SetNum(CoverageGrids.Num());
+	for (int32 GridIndex = 0; GridIndex < CoverageGrids.Num(); ++GridIndex)
+	{
+		FCoverageGrid& Grid = CoverageGrids[GridIndex];
+		const FBox2D& Bounds = GridBounds[GridIndex];
+		Grid.CellSize = TileSize;
+		Grid.Origin = Bounds.Min - FVector2D(HalfTile, HalfTile);
+		Grid.Width = FMath::RoundToInt((Bounds.Max.X - Bounds.Min.X) / TileSize) + 1;
+		Grid.Height = FMath::RoundToInt((Bounds.Max.Y - Bounds.Min.Y) / TileSize) + 1;
+		Grid.Covered.Init(false, Grid.Width * Grid.Height);
+		ClaimedCells[GridIndex].Init(false, Grid.Width * Grid.Height);
+	}
+
+	// Drop tiles that resolve to an already-claimed cell (overlapping source cells or boxes); keep build order.
+	int32 WriteIndex = 0;
+	TileCoverageCells.Reserve(TileCount);
+	for (int32 TileIndex = 0; TileIndex < TileCount; ++TileIndex)
+	{
+		const int32 GridIndex = TileGridIndices[TileIndex];
+		const int32 CellIndex = CoverageGrids[GridIndex].GetCellIndex(FVector2D(TileCenters[TileIndex]));
+		if (CellIndex == INDEX_NONE || ClaimedCells[GridIndex][CellIndex])
+		{
+			continue;
+		}
+
+		ClaimedCells[GridIndex][CellIndex] = true;
+		TileCenters[WriteIndex] = TileCenters[TileIndex];
+		if (bCoverageUsesFloorHeight)
+		{
+			TileFloorNumbers[WriteIndex] = TileFloorNumbers[TileIndex];
+		}
+		TileCoverageCells.Add(FIntPoint(GridIndex, CellIndex));
+		++WriteIndex;
+	}
+
+	TileCenters.SetNum(WriteIndex);
+	if (bCoverageUsesFloorHeight)
+	{
+		TileFloorNumbers.SetNum(WriteIndex);
+	}
+}
+
+void AT66MiasmaManager::ResetCoverage()
+{
+	for (FCoverageGrid& Grid : CoverageGrids)
+	{
+		Grid.Covered.Init(false, Grid.Width * Grid.Height);
+	}
+}
+
+bool AT66MiasmaManager::IsLocationCovered(const FVector& Location) const
+{
+	if (SpawnedTileCount <= 0)
+	{
+		return false;
+	}
+
+	const FVector2D Location2D(Location);
+	for (const FCoverageGrid& Grid : CoverageGrids)
+	{
+		if (bCoverageUsesFloorHeight && FMath::Abs(Location.Z - Grid.SurfaceZ) > T66TowerMiasmaFloorHeightTolerance)
+		{
+			continue;
+		}
+
+		const int32 CellIndex = Grid.GetCellIndex(Location2D);
+		if (CellIndex != INDEX_NONE && Grid.Covered[CellIndex])
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
 void AT66MiasmaManager::UpdateFromRunState()
 {
 	if (bSpawningPaused)
@@ -431,6 +597,8 @@ void AT66MiasmaManager::RebuildForCurrentStage()
 
 	TileCenters.Reset();
 	TileFloorNumbers.Reset();
+	CoverageGrids.Reset();
+	TileCoverageCells.Reset();
 	SpawnedTileCount = 0;
 	DamageTickAccumulator = 0.f;
 	TowerDefaultSourceAnchors.Reset();
@@ -736,7 +904,6 @@ void AT66MiasmaManager::SetTowerSourceAnchor(const int32 FloorNumber, const FVec
 	if (ShouldUseTowerBloodLook() && TileCenters.Num() > 0)
 	{
 		ApplyTowerCoverageOrdering();
-		RebuildSpawnedInstances();
 	}
 }
 
@@ -751,7 +918,6 @@ void AT66MiasmaManager::ClearTowerSourceAnchors()
 	if (ShouldUseTowerBloodLook() && TileCenters.Num() > 0)
 	{
 		ApplyTowerCoverageOrdering();
-		RebuildSpawnedInstances();
 	}
 }
 
@@ -769,11 +935,17 @@ void AT66MiasmaManager::EnsureSpawnedCount(int32 DesiredCount)
 		return;
 	}
 
+	const bool bHasCoverageCells = TileCoverageCells.Num() == TileCenters.Num();
 	TArray<FTransform> InstanceTransforms;
 	InstanceTransforms.Reserve(TargetCount - SpawnedTileCount);
 	for (int32 TileIndex = SpawnedTileCount; TileIndex < TargetCount; ++TileIndex)
 	{
 		InstanceTransforms.Add(FTransform(FRotator::ZeroRotator, TileCenters[TileIndex], InstanceScale));
+		if (bHasCoverageCells)
+		{
+			const FIntPoint& CoverageCell = TileCoverageCells[TileIndex];
+			CoverageGrids[CoverageCell.X].Covered[CoverageCell.Y] = true;
+		}
 	}
 
 	if (InstanceTransforms.Num() > 0)
@@ -783,19 +955,6 @@ void AT66MiasmaManager::EnsureSpawnedCount(int32 DesiredCount)
 	}
 }
 
-void AT66MiasmaManager::RebuildSpawnedInstances()
-{
-	if (!TileInstances)
-	{
-		return;
-	}
-
-	const int32 DesiredCount = SpawnedTileCount;
-	TileInstances->ClearInstances();
-	SpawnedTileCount = 0;
-	EnsureSpawnedCount(DesiredCount);
-}
-
 void AT66MiasmaManager::TickDamageOverActiveTiles(float DeltaTime)
 {
 	if (bSpawningPaused || SpawnedTileCount <= 0 || DamageIntervalSeconds <= 0.f)
@@ -819,19 +978,9 @@ void AT66MiasmaManager::TickDamageOverActiveTiles(float DeltaTime)
 		return;
 	}
 
-	const FVector HeroLocation = Hero->GetActorLocation();
-	const float HalfExtent = TileSize * 0.5f;
-	const bool bTowerBlood = ShouldUseTowerBloodLook();
-	for (int32 Index = 0; Index < SpawnedTileCount; ++Index)
+	if (IsLocationCovered(Hero->GetActorLocation()))
 	{
-		const FVector& TileCenter = TileCenters[Index];
-		if ((!bTowerBlood || FMath::Abs(HeroLocation.Z - TileCenter.Z) <= 1600.0f)
-			&& FMath::Abs(HeroLocation.X - TileCenter.X) <= HalfExtent
-			&& FMath::Abs(HeroLocation.Y - TileCenter.Y) <= HalfExtent)
-		{
-			RunState->ApplyDamage(20, this);
-			return;
-		}
+		RunState->ApplyDamage(20, this);
 	}
 }
 
@@ -1073,6 +1222,7 @@ void AT66MiasmaManager::ClearAllMiasma()
 	}
 	SpawnedTileCount = 0;
 	DamageTickAccumulator = 0.f;
+	ResetCoverage();
 	ClearLegacyLavaPatches();
 }
 
@@ -125,6 +125,9 @@ public:
 	/** Refreshes active coverage based on the legacy stage timer or an explicitly-driven flood timer. */
 	void UpdateFromRunState();
 
+	/** True when Location stands on a spawned tile. Constant time per floor, independent of coverage. */
+	bool IsLocationCovered(const FVector& Location) const;
+
 protected:
 	virtual void BeginPlay() override;
 	virtual void Tick(float DeltaTime) override;
@@ -144,6 +147,24 @@ private:
 
 	TArray<int32> TileFloorNumbers;
 
+	/** Cell lattice of one tower floor (or of the whole board off-tower); Covered marks spawned tiles. */
+	struct FCoverageGrid
+	{
+		FVector2D Origin = FVector2D::ZeroVector;
+		float CellSize = 0.f;
+		int32 Width = 0;
+		int32 Height = 0;
+		float SurfaceZ = 0.f;
+		TBitArray<> Covered;
+
+		int32 GetCellIndex(const FVector2D& Location) const;
+	};
+
+	TArray<FCoverageGrid> CoverageGrids;
+	/** Per tile: X = index into CoverageGrids, Y = cell index in that grid. */
+	TArray<FIntPoint> TileCoverageCells;
+	bool bCoverageUsesFloorHeight = false;
+
 	UPROPERTY()
 	TArray<TWeakObjectPtr<AT66LavaPatch>> LegacyLavaPatches;
 
@@ -161,11 +182,13 @@ private:
 	float ExplicitExpansionStartTimeSeconds = 0.f;
 
 	void BuildGrid();
+	void BuildTileCenters();
+	void BuildCoverageGrids();
+	void ResetCoverage();
 	void EnsureSpawnedCount(int32 DesiredCount);
 	void BuildMainMapCellGrid();
 	void BuildTowerFloorGrid();
 	void ApplyTowerCoverageOrdering();
-	void RebuildSpawnedInstances();
 	void TickDamageOverActiveTiles(float DeltaTime);
 	void EnsureVisualMaterial();
 	bool ShouldUseTowerBloodLook() const;
@@ -0,0 +1,112 @@
+// Copyright Tribulation 66. All Rights Reserved.
+
+#include "Gameplay/T66PeriodicTaskScheduler.h"
+#include "Algo/Sort.h"
+#include "HAL/PlatformTime.h"
+
+void FT66PeriodicTaskScheduler::Register(const FName Name, const float PeriodSeconds, const ET66PeriodicTaskPriority Priority, FTaskFunction&& Function)
+{
+	Tasks.RemoveAll([Name](const FTask& Task) { return Task.Name == Name; });
+
+	FTask& Task = Tasks.AddDefaulted_GetRef();
+	Task.Name = Name;
+	Task.PeriodSeconds = FMath::Max(0.f, PeriodSeconds);
+	Task.Priority = Priority;
+	Task.Function = MoveTemp(Function);
+
+	Algo::StableSortBy(Tasks, [](const FTask& Entry) { return static_cast<uint8>(Entry.Priority); });
+}
+
+void FT66PeriodicTaskScheduler::RequestRun(const FName Name)
+{
+	if (FTask* Task = Tasks.FindByPredicate([Name](const FTask& Entry) { return Entry.Name == Name; }))
+	{
+		Task->bRunRequested = true;
+	}
+}
+
+void FT66PeriodicTaskScheduler::Tick(const float DeltaTime, const float FrameBudgetMs)
+{
+	const double FrameStartSeconds = FPlatformTime::Seconds();
+	double SpentMs = 0.0;
+
+	// Jobs must not register or reset from inside a callback; the array is walked by index.
+	for (int32 Index = 0; Index < Tasks.Num(); ++Index)
+	{
+		FTask& Task = Tasks[Index];
+		Task.ElapsedSeconds += DeltaTime;
+
+		const bool bDue = Task.bRunRequested || Task.PeriodSeconds <= 0.f || Task.ElapsedSeconds >= Task.PeriodSeconds;
+		if (!bDue)
+		{
+			continue;
+		}
+
+		if (Task.Priority != ET66PeriodicTaskPriority::Critical && !Task.bDeferredLastFrame && SpentMs >= FrameBudgetMs)
+		{
+			Task.bDeferredLastFrame = true;
+			++Task.Stats.DeferredCount;
+			continue;
+		}
+
+		const float Elapsed = Task.ElapsedSeconds;
+		Task.ElapsedSeconds = 0.f;
+		Task.bRunRequested = false;
+		Task.bDeferredLastFrame = false;
+
+		const double TaskStartSeconds = FPlatformTime::Seconds();
+		Task.Function(Elapsed);
+		const double TaskMs = (FPlatformTime::Seconds() - TaskStartSeconds) * 1000.0;
+
+		Task.Stats.RunCount++;
+		Task.Stats.TotalMs += TaskMs;
+		Task.Stats.MaxMs = FMath::Max(Task.Stats.MaxMs, TaskMs);
+		Task.Stats.LastMs = TaskMs;
+		SpentMs += TaskMs;
+	}
+
+	LastFrameMs = (FPlatformTime::Seconds() - FrameStartSeconds) * 1000.0;
+}
+
+void FT66PeriodicTaskScheduler::Reset()
+{
+	Tasks.Reset();
+	LastFrameMs = 0.0;
+}
+
+void FT66PeriodicTaskScheduler::ResetStats()
+{
+	for (FTask& Task : Tasks)
+	{
+		Task.Stats = FTaskStats();
+	}
+	LastFrameMs = 0.0;
+}
+
+void FT66PeriodicTaskScheduler::DescribeStats(TArray<FString>& OutLines) const
+{
+	TArray<const FTask*> Sorted;
+	Sorted.Reserve(Tasks.Num());
+	for (const FTask& Task : Tasks)
+	{
+		Sorted.Add(&Task);
+	}
+	Algo::Sort(Sorted, [](const FTask* A, const FTask* B) { return A->Stats.TotalMs > B->Stats.TotalMs; });
+
+	static const TCHAR* PriorityLabels[] = { TEXT("crit"), TEXT("norm"), TEXT("low") };
+	for (const FTask* Task : Sorted)
+	{
+		const FTaskStats& Stats = Task->Stats;
+		OutLines.Add(FString::Printf(
+			TEXT("%-16s %-4s every %.2fs  runs=%d deferred=%d  avg=%.3fms max=%.3fms last=%.3fms total=%.1fms"),
+			*Task->Name.ToString(),
+			PriorityLabels[static_cast<uint8>(Task->Priority)],
+			Task->PeriodSeconds,
+			Stats.RunCount,
+			Stats.DeferredCount,
+			Stats.RunCount > 0 ? Stats.TotalMs / Stats.RunCount : 0.0,
+			Stats.MaxMs,
+			Stats.LastMs,
+			Stats.TotalMs));
+	}
+}
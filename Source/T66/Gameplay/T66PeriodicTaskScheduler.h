@@ -0,0 +1,71 @@
+// Copyright Tribulation 66. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+enum class ET66PeriodicTaskPriority : uint8
+{
+	/** Always runs when due, even past the frame budget (timers, player rescue). */
+	Critical,
+	Normal,
+	/** First to be pushed to the next frame when the budget is spent. */
+	Low,
+};
+
+/**
+ * Runs named housekeeping jobs at fixed periods inside a per-frame time budget.
+ *
+ * Due jobs run in priority order. Once the frame's budget is spent, non-critical jobs wait for the
+ * next frame, but a job is never deferred twice in a row so its worst-case latency stays one frame
+ * past its period. Each job receives the time elapsed since it last ran.
+ */
+class FT66PeriodicTaskScheduler
+{
+public:
+	using FTaskFunction = TFunction<void(float /*ElapsedSeconds*/)>;
+
+	struct FTaskStats
+	{
+		int32 RunCount = 0;
+		int32 DeferredCount = 0;
+		double TotalMs = 0.0;
+		double MaxMs = 0.0;
+		double LastMs = 0.0;
+	};
+
+	/** PeriodSeconds <= 0 runs the job every frame. Re-registering a name replaces the job. */
+	void Register(FName Name, float PeriodSeconds, ET66PeriodicTaskPriority Priority, FTaskFunction&& Function);
+
+	/** Makes the job due on the next Tick regardless of its period. */
+	void RequestRun(FName Name);
+
+	void Tick(float DeltaTime, float FrameBudgetMs);
+
+	/** Drops every job and its stats. */
+	void Reset();
+	void ResetStats();
+
+	bool IsEmpty() const { return Tasks.Num() == 0; }
+	double GetLastFrameMs() const { return LastFrameMs; }
+
+	/** One line per job, most expensive first. */
+	void DescribeStats(TArray<FString>& OutLines) const;
+
+private:
+	struct FTask
+	{
+		FName Name;
+		float PeriodSeconds = 0.f;
+		ET66PeriodicTaskPriority Priority = ET66PeriodicTaskPriority::Normal;
+		FTaskFunction Function;
+		float ElapsedSeconds = 0.f;
+		bool bRunRequested = false;
+		bool bDeferredLastFrame = false;
+		FTaskStats Stats;
+	};
+
+	/** Kept sorted by priority, then registration order. */
+	TArray<FTask> Tasks;
+	double LastFrameMs = 0.0;
+};
@@ -46,6 +46,7 @@ DEFINE_LOG_CATEGORY_STATIC(LogT66PlayerController, Log, All);
 #include "Core/T66ActorRegistrySubsystem.h"
 #include "Core/T66GameInstance.h"
 #include "Core/T66SessionSubsystem.h"
+#include "Core/T66TerrainBoardSubsystem.h"
 #include "Core/T66RunStateSubsystem.h"
 #include "Core/T66DamageLogSubsystem.h"
 #include "Core/T66PixelVFXSubsystem.h"
@@ -124,7 +125,22 @@ namespace
 	static TAutoConsoleVariable<int32> CVarT66CameraHideHeroOccluders(
 		TEXT("T66.Camera.HideHeroOccluders"),
 		1,
-		TEXT("0 disables runtime wall cutaways, 1 hides tower wall visual actors between the camera and hero."),
+		TEXT("0 disables runtime wall cutaways, 1 fades tower wall visual actors between the camera and hero."),
+		ECVF_Default);
+	static TAutoConsoleVariable<float> CVarT66CameraHeroOccluderFadedOpacity(
+		TEXT("T66.Camera.HeroOccluderFadedOpacity"),
+		0.25f,
+		TEXT("Opacity written to a wall's camera-fade primitive data while it sits between the camera and hero."),
+		ECVF_Default);
+	static TAutoConsoleVariable<float> CVarT66CameraHeroOccluderFadeSpeed(
+		TEXT("T66.Camera.HeroOccluderFadeSpeed"),
+		5.0f,
+		TEXT("Opacity change per second when a wall starts or stops occluding the hero."),
+		ECVF_Default);
+	static TAutoConsoleVariable<int32> CVarT66CameraHeroOccluderHideWhenFaded(
+		TEXT("T66.Camera.HeroOccluderHideWhenFaded"),
+		1,
+		TEXT("1 also hides a wall once it has fully faded, for wall materials that do not dither on the camera-fade primitive data."),
 		ECVF_Default);
 	static TAutoConsoleVariable<float> CVarT66CameraHeroOccluderTraceRadius(
 		TEXT("T66.Camera.HeroOccluderTraceRadius"),
@@ -160,24 +176,6 @@ namespace
 	const FName T66PlayerControllerTraversalBarrierTag(TEXT("T66_Map_TraversalBarrier"));
 	const FName T66PlayerControllerTowerCeilingTag(TEXT("T66_Tower_Ceiling"));
 
-	static bool T66WeakActorListContains(const TArray<TWeakObjectPtr<AActor>>& Actors, const AActor* Actor)
-	{
-		if (!Actor)
-		{
-			return false;
-		}
-
-		for (const TWeakObjectPtr<AActor>& WeakActor : Actors)
-		{
-			if (WeakActor.Get() == Actor)
-			{
-				return true;
-			}
-		}
-
-		return false;
-	}
-
 	static bool T66IsGameplayCameraWallActor(const AActor* Actor)
 	{
 		return Actor
@@ -185,6 +183,14 @@ namespace
 			&& Actor->ActorHasTag(T66PlayerControllerTraversalBarrierTag)
 			&& !Actor->ActorHasTag(T66PlayerControllerTowerCeilingTag);
 	}
+
+	static void T66SetCameraOccluderOpacity(AActor* Actor, const float Opacity)
+	{
+		Actor->ForEachComponent<UPrimitiveComponent>(false, [Opacity](UPrimitiveComponent* Primitive)
+		{
+			Primitive->SetCustomPrimitiveDataFloat(T66TowerMapTerrain::CameraFadePrimitiveDataIndex, Opacity);
+		});
+	}
 }
 
 
@@ -491,15 +497,48 @@ void AT66PlayerController::EndPlay(const EEndPlayReason::Type EndPlayReason)
 
 void AT66PlayerController::RestoreHeroCameraOccluders()
 {
-	for (const TWeakObjectPtr<AActor>& WeakActor : HiddenHeroCameraOccluders)
+	for (const FHeroCameraOccluderFade& Fade : FadingHeroCameraOccluders)
 	{
-		if (AActor* Actor = WeakActor.Get())
+		if (AActor* Actor = Fade.Actor.Get())
 		{
-			Actor->SetActorHiddenInGame(false);
+			T66SetCameraOccluderOpacity(Actor, 1.0f);
+			if (Fade.bHidden)
+			{
+				Actor->SetActorHiddenInGame(false);
+			}
 		}
 	}
 
-	HiddenHeroCameraOccluders.Reset();
+	FadingHeroCameraOccluders.Reset();
+}
+
+void AT66PlayerController::RefreshHeroCameraOccluderGrid(UWorld* World)
+{
+	const UT66TerrainBoardSubsystem* TerrainBoards = UT66TerrainBoardSubsystem::Get(World);
+	const UT66TerrainBoardSubsystem::FLayoutHandle ActiveLayout = TerrainBoards ? TerrainBoards->GetActiveTowerLayout() : nullptr;
+	if (ActiveLayout == HeroCameraOccluderGridLayout)
+	{
+		return;
+	}
+
+	HeroCameraOccluderGridLayout = ActiveLayout;
+	HeroCameraOccluderGrid.Reset();
+	if (!ActiveLayout)
+	{
+		return;
+	}
+
+	// One actor pass per spawned tower; per-frame queries then only walk the grid cells under the camera ray.
+	TArray<AActor*> WallActors;
+	for (TActorIterator<AActor> It(World); It; ++It)
+	{
+		if (T66IsGameplayCameraWallActor(*It))
+		{
+			WallActors.Add(*It);
+		}
+	}
+
+	HeroCameraOccluderGrid.Rebuild(*ActiveLayout, WallActors);
 }
 
 void AT66PlayerController::UpdateGameplayCameraSideWallSpring(const float DeltaTime)
@@ -626,7 +665,7 @@ void AT66PlayerController::UpdateGameplayCameraSideWallSpring(const float DeltaT
 	}
 }
 
-void AT66PlayerController::UpdateHeroCameraOccluders()
+void AT66PlayerController::UpdateHeroCameraOccluders(const float DeltaTime)
 {
 	if (!IsLocalController()
 		|| !IsGameplayLevel()
@@ -654,72 +693,109 @@ void AT66PlayerController::UpdateHeroCameraOccluders()
 		HeroLocation + FVector(0.0f, 0.0f, 165.0f)
 	};
 
-	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(T66HeroCameraOccluderTrace), false);
-	QueryParams.AddIgnoredActor(this);
-	QueryParams.AddIgnoredActor(Hero);
-	QueryParams.bFindInitialOverlaps = true;
-
+	const float TraceRadius = FMath::Max(1.0f, CVarT66CameraHeroOccluderTraceRadius.GetValueOnGameThread());
 	TArray<AActor*> NewOccluders;
-	auto AddOccluderHit = [this, &NewOccluders](const FHitResult& Hit)
+	RefreshHeroCameraOccluderGrid(World);
+	if (HeroCameraOccluderGrid.Num() > 0)
 	{
-		AActor* HitActor = Hit.GetActor();
-		if (!T66IsGameplayCameraWallActor(HitActor))
+		for (const FVector& TargetPoint : TargetPoints)
 		{
-			return;
+			HeroCameraOccluderGrid.FindAlongSegment(CameraLocation, TargetPoint, TraceRadius, NewOccluders);
 		}
-
-		if (HitActor->IsHidden() && !T66WeakActorListContains(HiddenHeroCameraOccluders, HitActor))
-		{
-			return;
-		}
-
-		NewOccluders.AddUnique(HitActor);
-	};
-
-	const float TraceRadius = FMath::Max(1.0f, CVarT66CameraHeroOccluderTraceRadius.GetValueOnGameThread());
-	for (const FVector& TargetPoint : TargetPoints)
+	}
+	else
 	{
-		TArray<FHitResult> Hits;
-		World->SweepMultiByChannel(
-			Hits,
-			CameraLocation,
-			TargetPoint,
-			FQuat::Identity,
-			ECC_Visibility,
-			FCollisionShape::MakeSphere(TraceRadius),
-			QueryParams);
+		// No indexed tower layout in this world: fall back to physics sweeps against tagged wall actors.
+		FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(T66HeroCameraOccluderTrace), false);
+		QueryParams.AddIgnoredActor(this);
+		QueryParams.AddIgnoredActor(Hero);
+		QueryParams.bFindInitialOverlaps = true;
 
-		for (const FHitResult& Hit : Hits)
+		for (const FVector& TargetPoint : TargetPoints)
 		{
-			AddOccluderHit(Hit);
+			TArray<FHitResult> Hits;
+			World->SweepMultiByChannel(
+				Hits,
+				CameraLocation,
+				TargetPoint,
+				FQuat::Identity,
+				ECC_Visibility,
+				FCollisionShape::MakeSphere(TraceRadius),
+				QueryParams);
+
+			for (const FHitResult& Hit : Hits)
+			{
+				AActor* HitActor = Hit.GetActor();
+				if (T66IsGameplayCameraWallActor(HitActor))
+				{
+					NewOccluders.AddUnique(HitActor);
+				}
+			}
 		}
 	}
 
-	for (const TWeakObjectPtr<AActor>& WeakActor : HiddenHeroCameraOccluders)
+	for (FHeroCameraOccluderFade& Fade : FadingHeroCameraOccluders)
+	{
+		Fade.bOccluding = false;
+	}
+	for (AActor* Actor : NewOccluders)
 	{
-		AActor* Actor = WeakActor.Get();
-		if (Actor && !NewOccluders.Contains(Actor))
+		FHeroCameraOccluderFade* Fade = FadingHeroCameraOccluders.FindByPredicate([Actor](const FHeroCameraOccluderFade& Existing)
+		{
+			return Existing.Actor.Get() == Actor;
+		});
+		if (!Fade)
 		{
-			Actor->SetActorHiddenInGame(false);
+			// Walls the level hid for its own reasons are not ours to fade.
+			if (Actor->IsHidden())
+			{
+				continue;
+			}
+
+			Fade = &FadingHeroCameraOccluders.AddDefaulted_GetRef();
+			Fade->Actor = Actor;
 		}
+
+		Fade->bOccluding = true;
 	}
 
-	TArray<TWeakObjectPtr<AActor>> UpdatedHiddenOccluders;
-	for (AActor* Actor : NewOccluders)
+	// Opacity moves toward its target through custom primitive data, so a wall entering or leaving the
+	// camera ray costs one render-data update per frame of fade instead of a render-state rebuild.
+	const float FadedOpacity = FMath::Clamp(CVarT66CameraHeroOccluderFadedOpacity.GetValueOnGameThread(), 0.0f, 1.0f);
+	const float FadeSpeed = CVarT66CameraHeroOccluderFadeSpeed.GetValueOnGameThread();
+	const bool bHideWhenFaded = CVarT66CameraHeroOccluderHideWhenFaded.GetValueOnGameThread() != 0;
+	for (int32 FadeIndex = FadingHeroCameraOccluders.Num() - 1; FadeIndex >= 0; --FadeIndex)
 	{
+		FHeroCameraOccluderFade& Fade = FadingHeroCameraOccluders[FadeIndex];
+		AActor* Actor = Fade.Actor.Get();
 		if (!Actor)
 		{
+			FadingHeroCameraOccluders.RemoveAtSwap(FadeIndex, 1, EAllowShrinking::No);
 			continue;
 		}
 
-		if (!T66WeakActorListContains(HiddenHeroCameraOccluders, Actor))
+		const float TargetOpacity = Fade.bOccluding ? FadedOpacity : 1.0f;
+		const float NewOpacity = FadeSpeed <= 0.0f
+			? TargetOpacity
+			: FMath::FInterpConstantTo(Fade.Opacity, TargetOpacity, DeltaTime, FadeSpeed);
+		if (NewOpacity != Fade.Opacity)
 		{
-			Actor->SetActorHiddenInGame(true);
+			Fade.Opacity = NewOpacity;
+			T66SetCameraOccluderOpacity(Actor, NewOpacity);
+		}
+
+		const bool bShouldHide = bHideWhenFaded && Fade.bOccluding && Fade.Opacity <= FadedOpacity;
+		if (bShouldHide != Fade.bHidden)
+		{
+			Fade.bHidden = bShouldHide;
+			Actor->SetActorHiddenInGame(bShouldHide);
 		}
-		UpdatedHiddenOccluders.Add(Actor);
-	}
 
-	HiddenHeroCameraOccluders = MoveTemp(UpdatedHiddenOccluders);
+		if (!Fade.bOccluding && Fade.Opacity >= 1.0f)
+		{
+			FadingHeroCameraOccluders.RemoveAtSwap(FadeIndex, 1, EAllowShrinking::No);
+		}
+	}
 }
 
 void AT66PlayerController::RefreshGameplayViewTarget(bool bAllowRetry)
@@ -906,8 +982,8 @@ void AT66PlayerController::EnsureClientGameplayWorldSetup(bool bAllowRetry)
 	}
 
 	const FT66MapPreset Preset = T66MainMapTerrain::BuildPresetForDifficulty(T66GI->SelectedDifficulty, T66GI->RunSeed);
-	T66TowerMapTerrain::FLayout Layout;
-	if (!T66TowerMapTerrain::BuildLayout(Preset, Layout))
+	const UT66TerrainBoardSubsystem::FLayoutHandle Layout = UT66TerrainBoardSubsystem::ResolveTowerLayout(World, Preset);
+	if (!Layout)
 	{
 		UE_LOG(LogT66PlayerController, Warning, TEXT("PlayerController: failed to build client tower layout for run seed %d"), T66GI->RunSeed);
 		return;
@@ -917,12 +993,17 @@ void AT66PlayerController::EnsureClientGameplayWorldSetup(bool bAllowRetry)
 	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
 
 	bool bCollisionReady = false;
-	if (!T66TowerMapTerrain::Spawn(World, Layout, T66GI->SelectedDifficulty, SpawnParams, bCollisionReady))
+	if (!T66TowerMapTerrain::Spawn(World, *Layout, T66GI->SelectedDifficulty, SpawnParams, bCollisionReady))
 	{
 		UE_LOG(LogT66PlayerController, Warning, TEXT("PlayerController: failed to spawn client tower terrain for run seed %d"), T66GI->RunSeed);
 		return;
 	}
 
+	if (UT66TerrainBoardSubsystem* TerrainBoards = UT66TerrainBoardSubsystem::Get(World))
+	{
+		TerrainBoards->SetActiveTowerLayout(Layout);
+	}
+
 	UE_LOG(
 		LogT66PlayerController,
 		Log,
@@ -950,6 +1031,15 @@ void AT66PlayerController::ClientApplyGameplayRunSettings_Implementation(int32 I
 
 	if (IsGameplayLevel())
 	{
+		// Start the client's copy of the tower layout on a worker; world setup below joins it.
+		if (InLayoutVariant == ET66MainMapLayoutVariant::Tower)
+		{
+			if (UT66TerrainBoardSubsystem* TerrainBoards = UT66TerrainBoardSubsystem::Get(GetWorld()))
+			{
+				TerrainBoards->PrefetchTowerLayout(T66MainMapTerrain::BuildPresetForDifficulty(InDifficulty, InRunSeed));
+			}
+		}
+
 		bClientGameplayWorldSetupComplete = false;
 		ClientGameplayWorldSetupRetriesRemaining = T66PlayerControllerClientGameplayWorldSetupRetryBudget;
 		EnsureClientGameplayWorldSetup(true);
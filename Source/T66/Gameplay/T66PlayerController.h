@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "Gameplay/T66SessionPlayerState.h"
+#include "Gameplay/T66CameraOccluderGrid.h"
 #include "Gameplay/T66CombatTargetTypes.h"
 #include "GameFramework/PlayerController.h"
 #include "UI/T66UITypes.h"
@@ -38,6 +39,11 @@ class SWidget;
 class SWeakWidget;
 class UInputAction;
 class UInputMappingContext;
+
+namespace T66TowerMapTerrain
+{
+	struct FLayout;
+}
 class ACameraActor;
 class AT66HeroPreviewStage;
 class AT66CompanionPreviewStage;
@@ -299,7 +305,8 @@ private:
 	void UpdateHeroMovementIntent();
 	void ClampGameplayCameraPitch();
 	void UpdateGameplayCameraSideWallSpring(float DeltaTime);
-	void UpdateHeroCameraOccluders();
+	void UpdateHeroCameraOccluders(float DeltaTime);
+	void RefreshHeroCameraOccluderGrid(UWorld* World);
 	void RestoreHeroCameraOccluders();
 
 	TSubclassOf<UT66ScreenBase> ResolveScreenClass(ET66ScreenType ScreenType) const;
@@ -475,7 +482,19 @@ private:
 	ET66HitZoneType LockedCombatHitZoneType = ET66HitZoneType::Body;
 	bool bInventoryInspectOpen = false;
 	bool bInventoryInspectRestoreFreeCursor = false;
-	TArray<TWeakObjectPtr<AActor>> HiddenHeroCameraOccluders;
+
+	/** Wall between the camera and hero (or still fading back in); opacity is pushed as custom primitive data. */
+	struct FHeroCameraOccluderFade
+	{
+		TWeakObjectPtr<AActor> Actor;
+		float Opacity = 1.0f;
+		bool bOccluding = false;
+		bool bHidden = false;
+	};
+
+	TArray<FHeroCameraOccluderFade> FadingHeroCameraOccluders;
+	FT66CameraOccluderGrid HeroCameraOccluderGrid;
+	TSharedPtr<const T66TowerMapTerrain::FLayout, ESPMode::ThreadSafe> HeroCameraOccluderGridLayout;
 	float DesiredGameplayCameraArmLength = 0.0f;
 
 	bool bHeroOneScopedUltActive = false;
@@ -445,7 +445,7 @@ void AT66PlayerController::PlayerTick(float DeltaTime)
 	Super::PlayerTick(DeltaTime);
 	SyncLockedCombatTargetFromCombat();
 	UpdateGameplayCameraSideWallSpring(DeltaTime);
-	UpdateHeroCameraOccluders();
+	UpdateHeroCameraOccluders(DeltaTime);
 }
 
 bool AT66PlayerController::HasAttackLockedEnemy() const
@@ -2,6 +2,7 @@
 
 #include "Gameplay/T66StageGate.h"
 #include "Core/T66AchievementsSubsystem.h"
+#include "Core/T66MusicSubsystem.h"
 #include "Core/T66RunStateSubsystem.h"
 #include "Core/T66GameInstance.h"
 #include "Components/BoxComponent.h"
@@ -51,6 +52,17 @@ void AT66StageGate::BeginPlay()
 		{
 			Registry->RegisterStageGate(this);
 		}
+
+		// The gate appears once the stage is beaten: stream the next stage's music while the player walks over.
+		if (UGameInstance* GI = W->GetGameInstance())
+		{
+			UT66MusicSubsystem* Music = GI->GetSubsystem<UT66MusicSubsystem>();
+			const UT66RunStateSubsystem* RunState = GI->GetSubsystem<UT66RunStateSubsystem>();
+			if (Music && RunState)
+			{
+				Music->PrefetchUpcomingStageMusic(RunState->GetCurrentStage() + 1);
+			}
+		}
 	}
 
 	const AT66GameMode* T66GameMode = GetWorld() ? Cast<AT66GameMode>(GetWorld()->GetAuthGameMode()) : nullptr;
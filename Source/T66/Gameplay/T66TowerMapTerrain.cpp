@@ -154,6 +154,10 @@ namespace
 			}
 
 			MeshComponent->SetMobility(EComponentMobility::Static);
+			if (ExtraTags.Contains(T66TowerMapTraversalBarrierTag))
+			{
+				MeshComponent->SetDefaultCustomPrimitiveDataFloat(T66TowerMapTerrain::CameraFadePrimitiveDataIndex, 1.0f);
+			}
 		}
 
 		Actor->Tags.AddUnique(T66TowerMapTerrainVisualTag);
@@ -794,6 +798,7 @@ namespace
 		Floor.CachedMainPathSpawnSlots.Reset();
 		Floor.CachedOptionalSpawnSlots.Reset();
 		Floor.CachedContentSpawnSlots.Reset();
+		Floor.PlacementCandidates.Reset();
 	}
 
 	static int32 T66GetGridCellIndex(const T66TowerMapTerrain::FLayout& Layout, const FIntPoint& Coord)
@@ -1489,6 +1494,63 @@ namespace
 		}
 	}
 
+	static float T66ComputeBoxClearance(const FBox2D& Box, const FVector& Location)
+	{
+		// Inverse of T66IsLocationInsideMazeWallBox: the largest margin that still leaves Location outside.
+		const float DX = FMath::Max3(0.0f, Box.Min.X - Location.X, Location.X - Box.Max.X);
+		const float DY = FMath::Max3(0.0f, Box.Min.Y - Location.Y, Location.Y - Box.Max.Y);
+		return FMath::Max(DX, DY);
+	}
+
+	static void T66BuildFloorPlacementCandidates(const T66TowerMapTerrain::FLayout& Layout, T66TowerMapTerrain::FFloor& Floor)
+	{
+		static constexpr float MaxClearance = 4096.0f;
+
+		Floor.PlacementCandidates.Reset(Floor.CachedWalkableSpawnSlots.Num());
+		for (const FVector& Slot : Floor.CachedWalkableSpawnSlots)
+		{
+			T66TowerMapTerrain::FPlacementCandidate& Candidate = Floor.PlacementCandidates.AddDefaulted_GetRef();
+			Candidate.Location = Slot;
+
+			// Floor bounds may be a polygon or a box union, so bisect the inset margin instead of solving it.
+			float EdgeLow = 0.0f;
+			float EdgeHigh = MaxClearance;
+			for (int32 Step = 0; Step < 10; ++Step)
+			{
+				const float Mid = (EdgeLow + EdgeHigh) * 0.5f;
+				if (T66IsLocationInsideFloorBounds(Floor, Slot, -Mid))
+				{
+					EdgeLow = Mid;
+				}
+				else
+				{
+					EdgeHigh = Mid;
+				}
+			}
+			Candidate.EdgeClearance = EdgeLow;
+
+			Candidate.HoleClearance = Floor.bHasDropHole
+				? T66ComputeBoxClearance(FBox2D(FVector2D(Floor.HoleCenter) - Floor.HoleHalfExtent, FVector2D(Floor.HoleCenter) + Floor.HoleHalfExtent), Slot)
+				: MaxClearance;
+
+			Candidate.WallClearance = MaxClearance;
+			for (const FBox2D& WallBox : Floor.MazeWallBoxes)
+			{
+				Candidate.WallClearance = FMath::Min(Candidate.WallClearance, T66ComputeBoxClearance(WallBox, Slot));
+			}
+		}
+
+		FRandomStream ShuffleRng(T66BuildTowerFloorSeed(Layout.Preset.Seed ^ 0x2C1B3C6D, Floor.FloorNumber, Floor.GameplayLevelNumber, Floor.Theme));
+		for (int32 Index = Floor.PlacementCandidates.Num() - 1; Index > 0; --Index)
+		{
+			const int32 SwapIndex = ShuffleRng.RandRange(0, Index);
+			if (SwapIndex != Index)
+			{
+				Floor.PlacementCandidates.Swap(Index, SwapIndex);
+			}
+		}
+	}
+
 	static void T66BuildCachedFloorSpawnSlots(const T66TowerMapTerrain::FLayout& Layout, T66TowerMapTerrain::FFloor& Floor)
 	{
 		Floor.CachedWalkableSpawnSlots.Reset();
@@ -1586,6 +1648,7 @@ namespace
 		}
 
 		T66BuildCachedFloorSpawnSlots(Layout, Floor);
+		T66BuildFloorPlacementCandidates(Layout, Floor);
 	}
 
 	static bool T66AreGridIndicesAdjacent(const T66TowerMapTerrain::FLayout& Layout, const int32 A, const int32 B)
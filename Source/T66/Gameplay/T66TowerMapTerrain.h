@@ -11,6 +11,9 @@ struct FActorSpawnParameters;
 
 namespace T66TowerMapTerrain
 {
+	/** Custom primitive data slot on wall meshes holding camera-occlusion opacity (1 = solid); wall materials dither against it. */
+	constexpr int32 CameraFadePrimitiveDataIndex = 0;
+
 	enum class ET66TowerFloorRole : uint8
 	{
 		Start,
@@ -78,6 +81,20 @@ namespace T66TowerMapTerrain
 		TArray<FVector> CachedSpawnSlots;
 	};
 
+	/** Analytically validated placement point with clearances to the floor edge, drop hole and maze walls. */
+	struct FPlacementCandidate
+	{
+		FVector Location = FVector::ZeroVector;
+		float EdgeClearance = 0.0f;
+		float HoleClearance = 0.0f;
+		float WallClearance = 0.0f;
+
+		bool HasClearance(const float EdgePadding, const float HolePadding, const float WallPadding) const
+		{
+			return EdgeClearance >= EdgePadding && HoleClearance > HolePadding && WallClearance > WallPadding;
+		}
+	};
+
 	struct FFloor
 	{
 		int32 FloorNumber = 0;
@@ -108,6 +125,8 @@ namespace T66TowerMapTerrain
 		TArray<FVector> CachedMainPathSpawnSlots;
 		TArray<FVector> CachedOptionalSpawnSlots;
 		TArray<FVector> CachedContentSpawnSlots;
+		/** Walkable spawn slots in a seeded per-floor shuffle, for interactable placement without retry traces. */
+		TArray<FPlacementCandidate> PlacementCandidates;
 		FName FloorTag = NAME_None;
 	};
 
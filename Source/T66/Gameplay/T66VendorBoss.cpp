@@ -3,7 +3,6 @@
 #include "Gameplay/T66VendorBoss.h"
 #include "Gameplay/T66VendorNPC.h"
 #include "Gameplay/T66VisualUtil.h"
-#include "Core/T66CharacterVisualSubsystem.h"
 #include "Core/T66RunStateSubsystem.h"
 #include "Components/StaticMeshComponent.h"
 #include "GameFramework/CharacterMovementComponent.h"
@@ -74,7 +73,7 @@ void AT66VendorBoss::BeginPlay()
 {
 	Super::BeginPlay();
 
-	// Placeholder mesh: cube, dark (overridden by ApplyCharacterVisual if mapped).
+	// Placeholder mesh: cube, dark (overridden by the requested character visual if mapped).
 	if (UStaticMesh* Cube = FT66VisualUtil::GetBasicShapeCube())
 	{
 		VisualMesh->SetStaticMesh(Cube);
@@ -84,17 +83,7 @@ void AT66VendorBoss::BeginPlay()
 	FT66VisualUtil::ApplyT66Color(VisualMesh, this, FLinearColor(0.08f, 0.08f, 0.10f, 1.f));
 
 	// Vendor boss must use the same mesh as Vendor NPC (per rule).
-	if (UGameInstance* GI = GetWorld() ? GetWorld()->GetGameInstance() : nullptr)
-	{
-		if (UT66CharacterVisualSubsystem* Visuals = GI->GetSubsystem<UT66CharacterVisualSubsystem>())
-		{
-			const bool bApplied = Visuals->ApplyCharacterVisual(FName(TEXT("VendorBoss")), GetMesh(), VisualMesh, true);
-			if (!bApplied && GetMesh())
-			{
-				GetMesh()->SetVisibility(false, true);
-			}
-		}
-	}
+	RequestBossCharacterVisual(FName(TEXT("VendorBoss")));
 
 	ForceAwaken();
 }
@@ -2071,9 +2071,10 @@ void ST66LeaderboardPanel::RefreshLeaderboard()
 
 		UGameInstance* GI = LeaderboardSubsystem ? LeaderboardSubsystem->GetGameInstance() : nullptr;
 		UT66BackendSubsystem* Backend = GI ? GI->GetSubsystem<UT66BackendSubsystem>() : nullptr;
-		if (Backend && Backend->HasCachedLeaderboard(CacheKey))
+		const FT66LeaderboardSnapshotPtr Cached = Backend ? Backend->GetCachedLeaderboard(CacheKey) : nullptr;
+		if (Cached.IsValid())
 		{
-			LeaderboardEntries = Backend->GetCachedLeaderboard(CacheKey);
+			LeaderboardEntries = Cached->Entries;
 		}
 		else
 		{
@@ -2144,23 +2145,11 @@ void ST66LeaderboardPanel::RefreshLeaderboard()
 	// Try to get backend data
 	UGameInstance* GI = LeaderboardSubsystem ? LeaderboardSubsystem->GetGameInstance() : nullptr;
 	UT66BackendSubsystem* Backend = GI ? GI->GetSubsystem<UT66BackendSubsystem>() : nullptr;
-	if (Backend && Backend->HasCachedLeaderboard(CacheKey))
+	const FT66LeaderboardSnapshotPtr Cached = Backend ? Backend->GetCachedLeaderboard(CacheKey) : nullptr;
+	if (Cached.IsValid() && Cached->Entries.Num() > 0)
 	{
-		const TArray<FLeaderboardEntry> CachedEntries = Backend->GetCachedLeaderboard(CacheKey);
-
-		if (CachedEntries.Num() > 0)
-		{
-			// Use backend data when the backend actually has something for this key.
-			LeaderboardEntries = CachedEntries;
-		}
-		else
-		{
-			LeaderboardEntries.Reset();
-		}
-	}
-	else if (Backend)
-	{
-		LeaderboardEntries.Reset();
+		// Use backend data when the backend actually has something for this key.
+		LeaderboardEntries = Cached->Entries;
 	}
 	else
 	{
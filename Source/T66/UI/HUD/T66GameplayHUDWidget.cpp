@@ -94,6 +94,8 @@ void UT66GameplayHUDWidget::NativeTick(const FGeometry& MyGeometry, float InDelt
 	}
 
 	GetPresentationController().Tick(InDeltaTime);
+	RefreshEnemyIndicators();
+	RefreshCombatText();
 
 	if (AT66PlayerController* T66PC = Cast<AT66PlayerController>(GetOwningPlayer()))
 	{
@@ -2241,6 +2241,22 @@ TSharedRef<SWidget> UT66GameplayHUDWidget::BuildSlateUI()
 			&TutorialHintBorder
 		)
 		]
+		// Manual lock bullseye, projected and painted as one layer.
+		+ SOverlay::Slot()
+		.HAlign(HAlign_Fill)
+		.VAlign(VAlign_Fill)
+		[
+			SAssignNew(EnemyIndicatorLayer, ST66EnemyIndicatorLayerWidget)
+			.Visibility(EVisibility::HitTestInvisible)
+		]
+		// Floating damage numbers from UT66FloatingCombatTextSubsystem, painted as one layer.
+		+ SOverlay::Slot()
+		.HAlign(HAlign_Fill)
+		.VAlign(VAlign_Fill)
+		[
+			SAssignNew(CombatTextLayer, ST66CombatTextLayerWidget)
+			.Visibility(EVisibility::HitTestInvisible)
+		]
 		// Center crosshair (screen center; camera unchanged)
 		+ SOverlay::Slot()
 		.HAlign(HAlign_Center)
@@ -530,3 +530,118 @@ void UT66GameplayHUDWidget::SetInteractive(bool bInteractive)
 	SetVisibility(bInteractive ? ESlateVisibility::Visible : ESlateVisibility::SelfHitTestInvisible);
 }
 
+
+void UT66GameplayHUDWidget::RefreshEnemyIndicators()
+{
+	if (!EnemyIndicatorLayer.IsValid())
+	{
+		return;
+	}
+
+	EnemyIndicatorScratch.Reset();
+
+	APlayerController* PC = GetOwningPlayer();
+	UWorld* World = GetWorld();
+	UT66ActorRegistrySubsystem* Registry = World ? World->GetSubsystem<UT66ActorRegistrySubsystem>() : nullptr;
+	int32 ViewportSizeX = 0;
+	int32 ViewportSizeY = 0;
+	if (PC)
+	{
+		PC->GetViewportSize(ViewportSizeX, ViewportSizeY);
+	}
+
+	if (Registry && ViewportSizeX > 0 && ViewportSizeY > 0)
+	{
+		const FVector2D ViewportSize(static_cast<float>(ViewportSizeX), static_cast<float>(ViewportSizeY));
+		static constexpr float OffscreenMargin = 0.05f;
+		auto ProjectToViewport = [&](const FVector& WorldLocation, FVector2D& OutNormalized) -> bool
+		{
+			FVector2D ScreenPosition = FVector2D::ZeroVector;
+			if (!PC->ProjectWorldLocationToScreen(WorldLocation, ScreenPosition, true))
+			{
+				return false;
+			}
+
+			OutNormalized = ScreenPosition / ViewportSize;
+			return OutNormalized.X >= -OffscreenMargin && OutNormalized.X <= 1.f + OffscreenMargin
+				&& OutNormalized.Y >= -OffscreenMargin && OutNormalized.Y <= 1.f + OffscreenMargin;
+		};
+
+		for (const TWeakObjectPtr<AT66EnemyBase>& WeakEnemy : Registry->GetEnemies())
+		{
+			const AT66EnemyBase* Enemy = WeakEnemy.Get();
+			// Enemy health bars stay hidden; only the manual lock bullseye is drawn.
+			if (!Enemy || Enemy->CurrentHP <= 0 || Enemy->IsHidden() || !Enemy->IsLockedIndicatorShown())
+			{
+				continue;
+			}
+
+			FT66EnemyIndicatorEntry Entry;
+			if (ProjectToViewport(Enemy->GetActorLocation() + FVector(0.f, 0.f, Enemy->LockIndicatorHeightOffset), Entry.LockPosition))
+			{
+				EnemyIndicatorScratch.Add(Entry);
+			}
+		}
+	}
+
+	EnemyIndicatorLayer->SetEntries(EnemyIndicatorScratch);
+}
+
+void UT66GameplayHUDWidget::RefreshCombatText()
+{
+	if (!CombatTextLayer.IsValid())
+	{
+		return;
+	}
+
+	CombatTextScratch.Reset();
+
+	APlayerController* PC = GetOwningPlayer();
+	UWorld* World = GetWorld();
+	UGameInstance* GI = GetGameInstance();
+	UT66FloatingCombatTextSubsystem* FloatingText = GI ? GI->GetSubsystem<UT66FloatingCombatTextSubsystem>() : nullptr;
+	int32 ViewportSizeX = 0;
+	int32 ViewportSizeY = 0;
+	if (PC)
+	{
+		PC->GetViewportSize(ViewportSizeX, ViewportSizeY);
+	}
+
+	if (FloatingText && World && ViewportSizeX > 0 && ViewportSizeY > 0)
+	{
+		const FVector2D ViewportSize(static_cast<float>(ViewportSizeX), static_cast<float>(ViewportSizeY));
+		const double NowSeconds = World->GetTimeSeconds();
+		for (const FT66FloatingCombatTextEntry& Entry : FloatingText->GetEntries())
+		{
+			if (!FloatingText->IsEntryLive(Entry, World, NowSeconds))
+			{
+				continue;
+			}
+
+			// Numbers follow their target while it lives and hold their last position once it is gone.
+			const AActor* Target = Entry.Target.Get();
+			const FVector AnchorLocation = ((Target && !Target->IsHidden()) ? Target->GetActorLocation() : Entry.LastAnchorLocation) + Entry.Offset;
+			FVector2D ScreenPosition = FVector2D::ZeroVector;
+			if (!PC->ProjectWorldLocationToScreen(AnchorLocation, ScreenPosition, true))
+			{
+				continue;
+			}
+
+			const FVector2D Normalized = ScreenPosition / ViewportSize;
+			if (Normalized.X < 0.f || Normalized.X > 1.f || Normalized.Y < 0.f || Normalized.Y > 1.f)
+			{
+				continue;
+			}
+
+			FT66CombatTextDrawEntry& DrawEntry = CombatTextScratch.AddDefaulted_GetRef();
+			DrawEntry.Position = Normalized;
+			DrawEntry.Text = Entry.DisplayText;
+			DrawEntry.Color = Entry.Color;
+			DrawEntry.FontSize = Entry.FontSize;
+			DrawEntry.Age01 = FMath::Clamp(static_cast<float>(NowSeconds - Entry.LastHitTimeSeconds) / UT66FloatingCombatTextSubsystem::TextLifetimeSeconds, 0.f, 1.f);
+			DrawEntry.bMerged = Entry.HitCount > 1;
+		}
+	}
+
+	CombatTextLayer->SetEntries(CombatTextScratch);
+}
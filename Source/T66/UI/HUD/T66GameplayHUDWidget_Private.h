@@ -11,6 +11,7 @@
 #include "Core/T66BackendSubsystem.h"
 #include "Core/T66RunStateSubsystem.h"
 #include "Core/T66DamageLogSubsystem.h"
+#include "Core/T66FloatingCombatTextSubsystem.h"
 #include "Core/T66GameInstance.h"
 #include "Core/T66LeaderboardSubsystem.h"
 #include "Core/T66LeaderboardRunSummarySaveGame.h"
@@ -65,6 +66,8 @@
 #include "Styling/CoreStyle.h"
 #include "Styling/SlateBrush.h"
 #include "Rendering/DrawElements.h"
+#include "Rendering/SlateRenderer.h"
+#include "Fonts/FontMeasure.h"
 #include "Math/TransformCalculus2D.h"
 #include "Rendering/SlateRenderTransform.h"
 #include "Engine/Texture2D.h"
@@ -1312,6 +1315,192 @@ public:
 	}
 };
 
+/** Full-viewport layer that paints every manual lock bullseye in one pass. */
+class ST66EnemyIndicatorLayerWidget : public SLeafWidget
+{
+public:
+	SLATE_BEGIN_ARGS(ST66EnemyIndicatorLayerWidget) {}
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs)
+	{
+		SetCanTick(false);
+	}
+
+	/** Swaps the gathered entries into the layer; InOutEntries receives the previous frame's buffer for reuse. */
+	void SetEntries(TArray<FT66EnemyIndicatorEntry>& InOutEntries)
+	{
+		if (InOutEntries.Num() == 0 && Entries.Num() == 0)
+		{
+			return;
+		}
+
+		Swap(Entries, InOutEntries);
+		Invalidate(EInvalidateWidget::Paint);
+	}
+
+	virtual FVector2D ComputeDesiredSize(float) const override
+	{
+		return FVector2D::ZeroVector;
+	}
+
+	virtual int32 OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect,
+		FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const override
+	{
+		if (Entries.Num() == 0)
+		{
+			return LayerId;
+		}
+
+		const FVector2D Size = AllottedGeometry.GetLocalSize();
+		const float TimeSeconds = static_cast<float>(FSlateApplication::Get().GetCurrentTime());
+		const float Pulse = 1.f + (0.05f * (0.5f + (0.5f * FMath::Sin(TimeSeconds * 7.f))));
+		for (const FT66EnemyIndicatorEntry& Entry : Entries)
+		{
+			PaintLockBullseye(AllottedGeometry, OutDrawElements, LayerId, Entry.LockPosition * Size, Pulse);
+		}
+
+		return LayerId + 7;
+	}
+
+private:
+	static void PaintLockBullseye(const FGeometry& AllottedGeometry, FSlateWindowElementList& OutDrawElements, const int32 BaseLayer, const FVector2D& Center, const float Pulse)
+	{
+		auto DrawRing = [&](const float Radius, const float Thickness, const FLinearColor& Color, const int32 DrawLayer)
+		{
+			static constexpr int32 NumSeg = 28;
+			TArray<FVector2D> Points;
+			Points.Reserve(NumSeg + 1);
+			for (int32 SegmentIndex = 0; SegmentIndex <= NumSeg; ++SegmentIndex)
+			{
+				const float Angle = 2.f * PI * (static_cast<float>(SegmentIndex) / static_cast<float>(NumSeg));
+				Points.Add(Center + FVector2D(FMath::Cos(Angle) * Radius, FMath::Sin(Angle) * Radius));
+			}
+
+			FSlateDrawElement::MakeLines(OutDrawElements, DrawLayer, AllottedGeometry.ToPaintGeometry(), Points, ESlateDrawEffect::None, Color, true, Thickness);
+		};
+
+		auto DrawLine = [&](const FVector2D& Start, const FVector2D& End, const FLinearColor& Color, const float Thickness, const int32 DrawLayer)
+		{
+			TArray<FVector2D> Points;
+			Points.Add(Start);
+			Points.Add(End);
+			FSlateDrawElement::MakeLines(OutDrawElements, DrawLayer, AllottedGeometry.ToPaintGeometry(), Points, ESlateDrawEffect::None, Color, false, Thickness);
+		};
+
+		DrawRing(15.5f * Pulse, 6.f, FLinearColor(0.f, 0.f, 0.f, 0.38f), BaseLayer);
+		DrawRing(15.f * Pulse, 5.f, FLinearColor(0.84f, 0.08f, 0.08f, 0.98f), BaseLayer + 1);
+		DrawRing(10.f, 4.5f, FLinearColor(0.98f, 0.95f, 0.92f, 0.98f), BaseLayer + 2);
+		DrawRing(5.5f, 4.f, FLinearColor(0.84f, 0.08f, 0.08f, 0.98f), BaseLayer + 3);
+
+		const FLinearColor TickColor(1.f, 0.95f, 0.92f, 0.92f);
+		DrawLine(Center + FVector2D(-18.f, 0.f), Center + FVector2D(-10.f, 0.f), TickColor, 1.8f, BaseLayer + 4);
+		DrawLine(Center + FVector2D(10.f, 0.f), Center + FVector2D(18.f, 0.f), TickColor, 1.8f, BaseLayer + 4);
+		DrawLine(Center + FVector2D(0.f, -18.f), Center + FVector2D(0.f, -10.f), TickColor, 1.8f, BaseLayer + 4);
+		DrawLine(Center + FVector2D(0.f, 10.f), Center + FVector2D(0.f, 18.f), TickColor, 1.8f, BaseLayer + 4);
+
+		DrawLine(Center + FVector2D(-3.2f, 0.f), Center + FVector2D(3.2f, 0.f), FLinearColor::White, 2.f, BaseLayer + 5);
+		DrawLine(Center + FVector2D(0.f, -3.2f), Center + FVector2D(0.f, 3.2f), FLinearColor::White, 2.f, BaseLayer + 5);
+		DrawRing(1.7f, 4.f, FLinearColor::White, BaseLayer + 6);
+	}
+
+	TArray<FT66EnemyIndicatorEntry> Entries;
+};
+
+/** Full-viewport layer that paints every live floating damage number with one text element each on a shared layer. */
+class ST66CombatTextLayerWidget : public SLeafWidget
+{
+public:
+	SLATE_BEGIN_ARGS(ST66CombatTextLayerWidget) {}
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs)
+	{
+		SetCanTick(false);
+	}
+
+	/** Swaps the gathered entries into the layer; InOutEntries receives the previous frame's buffer for reuse. */
+	void SetEntries(TArray<FT66CombatTextDrawEntry>& InOutEntries)
+	{
+		if (InOutEntries.Num() == 0 && Entries.Num() == 0)
+		{
+			return;
+		}
+
+		Swap(Entries, InOutEntries);
+		Invalidate(EInvalidateWidget::Paint);
+	}
+
+	virtual FVector2D ComputeDesiredSize(float) const override
+	{
+		return FVector2D::ZeroVector;
+	}
+
+	virtual int32 OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect,
+		FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const override
+	{
+		if (Entries.Num() == 0)
+		{
+			return LayerId;
+		}
+
+		static constexpr float RisePixels = 36.f;
+		static constexpr float FadeStart01 = 0.65f;
+		static constexpr int32 MergedPopFontBonus = 4;
+		static constexpr float MergedPopSeconds01 = 0.12f;
+
+		const FVector2D Size = AllottedGeometry.GetLocalSize();
+		for (const FT66CombatTextDrawEntry& Entry : Entries)
+		{
+			// A merged hit briefly bumps the size so rolling totals still read as new impacts.
+			const int32 FontSize = Entry.FontSize + ((Entry.bMerged && Entry.Age01 < MergedPopSeconds01) ? MergedPopFontBonus : 0);
+			const FSlateFontInfo Font = FT66Style::Tokens::FontBold(FontSize);
+			const FVector2D TextSize(MeasureGlyphRun(Entry.Text, Font, FontSize), static_cast<float>(FontSize) * 1.3f);
+			const FVector2D Anchor = (Entry.Position * Size) - FVector2D(0.f, RisePixels * Entry.Age01);
+			const float Alpha = Entry.Age01 <= FadeStart01 ? 1.f : FMath::Clamp(1.f - ((Entry.Age01 - FadeStart01) / (1.f - FadeStart01)), 0.f, 1.f);
+
+			FLinearColor Color = Entry.Color;
+			Color.A *= Alpha;
+			FSlateDrawElement::MakeText(
+				OutDrawElements,
+				LayerId,
+				AllottedGeometry.ToPaintGeometry(FVector2f(TextSize), FSlateLayoutTransform(FVector2f(Anchor - (TextSize * 0.5f)))),
+				Entry.Text,
+				Font,
+				ESlateDrawEffect::None,
+				Color);
+		}
+
+		return LayerId + 1;
+	}
+
+private:
+	/** Sums cached per-glyph advances; numbers only use digits and separators, so the cache stays tiny. */
+	float MeasureGlyphRun(const FString& Text, const FSlateFontInfo& Font, const int32 FontSize) const
+	{
+		const TSharedRef<FSlateFontMeasure> FontMeasure = FSlateApplication::Get().GetRenderer()->GetFontMeasureService();
+		float Width = 0.f;
+		for (const TCHAR Glyph : Text)
+		{
+			const uint64 Key = (static_cast<uint64>(static_cast<uint32>(FontSize)) << 32) | static_cast<uint64>(Glyph);
+			if (const float* CachedAdvance = GlyphAdvanceCache.Find(Key))
+			{
+				Width += *CachedAdvance;
+				continue;
+			}
+
+			const float Advance = static_cast<float>(FontMeasure->Measure(FString(1, &Glyph), Font).X);
+			GlyphAdvanceCache.Add(Key, Advance);
+			Width += Advance;
+		}
+
+		return Width;
+	}
+
+	TArray<FT66CombatTextDrawEntry> Entries;
+	mutable TMap<uint64, float> GlyphAdvanceCache;
+};
+
 struct FT66MapMarker
 {
 	FVector2D WorldXY = FVector2D::ZeroVector;
@@ -2389,25 +2578,6 @@ namespace
 		Backend->FetchLeaderboard(TypeToken, TEXT("alltime"), PartyToken, DifficultyToken, FilterToken);
 	}
 
-	bool FindStagePacingPointForStage(const UT66LeaderboardRunSummarySaveGame* Snapshot, const int32 Stage, FT66StagePacingPoint& OutPoint)
-	{
-		if (!Snapshot)
-		{
-			return false;
-		}
-
-		for (const FT66StagePacingPoint& Point : Snapshot->StagePacingPoints)
-		{
-			if (Point.Stage == Stage)
-			{
-				OutPoint = Point;
-				return true;
-			}
-		}
-
-		return false;
-	}
-
 	FText FormatHudTimerValue(const float Seconds)
 	{
 		const float ClampedSeconds = FMath::Max(0.f, Seconds);
@@ -294,18 +294,13 @@ void UT66GameplayHUDWidget::RefreshBeatTargets()
 			}
 
 			const FString CacheKey = MakeHudBeatTargetCacheKey(Type, T66GI->SelectedPartySize, T66GI->SelectedDifficulty, Filter);
-			if (!Backend->HasCachedLeaderboard(CacheKey))
+			const FT66LeaderboardSnapshotPtr Cached = Backend->GetCachedLeaderboard(CacheKey);
+			if (!Cached.IsValid() || Cached->Entries.Num() <= 0)
 			{
 				return;
 			}
 
-			const TArray<FLeaderboardEntry> Entries = Backend->GetCachedLeaderboard(CacheKey);
-			if (Entries.Num() <= 0)
-			{
-				return;
-			}
-
-			const FLeaderboardEntry& Entry = Entries[0];
+			const FLeaderboardEntry& Entry = Cached->Entries[0];
 			OutTarget.bValid = true;
 			OutTarget.Score = Entry.Score;
 			OutTarget.TimeSeconds = Entry.TimeSeconds;
@@ -340,18 +335,52 @@ void UT66GameplayHUDWidget::RefreshBeatTargets()
 		}
 	};
 
-	auto LoadPacingSummary = [Backend](const FT66ResolvedBeatTarget& Target) -> UT66LeaderboardRunSummarySaveGame*
+	// Pacing reads only need StagePacingPoints, so each target's summary is reduced to a sorted curve once
+	// and later refreshes binary-search it instead of reloading the summary.
+	auto ResolvePacingCurve = [this, Backend](const FT66ResolvedBeatTarget& Target, FPacingCurve UT66GameplayHUDWidget::* CurveMember) -> const FPacingCurve*
 	{
 		if (!Target.bSupportsPacing)
 		{
 			return nullptr;
 		}
 
+		FPacingCurve& Curve = this->*CurveMember;
+		const FString SourceKey = Target.LocalRunSummarySlotName.IsEmpty()
+			? FString::Printf(TEXT("entry:%s"), *Target.EntryId)
+			: FString::Printf(TEXT("slot:%s"), *Target.LocalRunSummarySlotName);
+		if (Curve.SourceKey != SourceKey)
+		{
+			Curve = FPacingCurve{};
+			Curve.SourceKey = SourceKey;
+		}
+		if (Curve.bReady)
+		{
+			return &Curve;
+		}
+
 		if (!Target.LocalRunSummarySlotName.IsEmpty())
 		{
-			if (UGameplayStatics::DoesSaveGameExist(Target.LocalRunSummarySlotName, 0))
+			if (!Curve.bRequested)
 			{
-				return Cast<UT66LeaderboardRunSummarySaveGame>(UGameplayStatics::LoadGameFromSlot(Target.LocalRunSummarySlotName, 0));
+				Curve.bRequested = true;
+				TWeakObjectPtr<UT66GameplayHUDWidget> WeakThis(this);
+				UGameplayStatics::AsyncLoadGameFromSlot(Target.LocalRunSummarySlotName, 0, FAsyncLoadGameFromSlotDelegate::CreateLambda(
+					[WeakThis, CurveMember, SourceKey](const FString& SlotName, const int32 UserIndex, USaveGame* LoadedGame)
+					{
+						UT66GameplayHUDWidget* Widget = WeakThis.Get();
+						if (!Widget || (Widget->*CurveMember).SourceKey != SourceKey)
+						{
+							return;
+						}
+
+						FPacingCurve& LoadedCurve = Widget->*CurveMember;
+						if (const UT66LeaderboardRunSummarySaveGame* Summary = Cast<UT66LeaderboardRunSummarySaveGame>(LoadedGame))
+						{
+							T66LeaderboardPacing::BuildStageCurve(Summary->StagePacingPoints, LoadedCurve.Points);
+						}
+						LoadedCurve.bReady = true;
+						Widget->MarkHUDDirty();
+					}));
 			}
 			return nullptr;
 		}
@@ -363,9 +392,15 @@ void UT66GameplayHUDWidget::RefreshBeatTargets()
 
 		if (Backend->HasCachedRunSummary(Target.EntryId))
 		{
-			return Backend->GetCachedRunSummary(Target.EntryId);
+			if (const UT66LeaderboardRunSummarySaveGame* Summary = Backend->GetCachedRunSummary(Target.EntryId))
+			{
+				T66LeaderboardPacing::BuildStageCurve(Summary->StagePacingPoints, Curve.Points);
+			}
+			Curve.bReady = true;
+			return &Curve;
 		}
 
+		// The backend de-duplicates in-flight fetches; asking again retries after a failed response.
 		Backend->FetchRunSummary(Target.EntryId);
 		return nullptr;
 	};
@@ -390,12 +425,12 @@ void UT66GameplayHUDWidget::RefreshBeatTargets()
 
 	if (ScorePacingText.IsValid())
 	{
-		UT66LeaderboardRunSummarySaveGame* PacingSummary = PS->GetShowScorePacing() ? LoadPacingSummary(ScoreTarget) : nullptr;
+		const FPacingCurve* PacingCurve = PS->GetShowScorePacing() ? ResolvePacingCurve(ScoreTarget, &UT66GameplayHUDWidget::ScorePacingCurve) : nullptr;
 		FT66StagePacingPoint PacingPoint;
 		if (PS->GetShowScorePacing()
 			&& !RunState->IsInStageCatchUp()
-			&& PacingSummary
-			&& FindStagePacingPointForStage(PacingSummary, RunState->GetCurrentStage(), PacingPoint)
+			&& PacingCurve
+			&& T66LeaderboardPacing::FindStagePoint(PacingCurve->Points, RunState->GetCurrentStage(), PacingPoint)
 			&& PacingPoint.Score > 0)
 		{
 			ScorePacingText->SetText(FText::Format(
@@ -430,13 +465,13 @@ void UT66GameplayHUDWidget::RefreshBeatTargets()
 
 	if (SpeedRunPacingText.IsValid())
 	{
-		UT66LeaderboardRunSummarySaveGame* PacingSummary = (bShowLiveRunTime && PS->GetShowTimePacing()) ? LoadPacingSummary(TimeTarget) : nullptr;
+		const FPacingCurve* PacingCurve = (bShowLiveRunTime && PS->GetShowTimePacing()) ? ResolvePacingCurve(TimeTarget, &UT66GameplayHUDWidget::TimePacingCurve) : nullptr;
 		FT66StagePacingPoint PacingPoint;
 		if (bShowLiveRunTime
 			&& PS->GetShowTimePacing()
 			&& !RunState->IsInStageCatchUp()
-			&& PacingSummary
-			&& FindStagePacingPointForStage(PacingSummary, RunState->GetCurrentStage(), PacingPoint)
+			&& PacingCurve
+			&& T66LeaderboardPacing::FindStagePoint(PacingCurve->Points, RunState->GetCurrentStage(), PacingPoint)
 			&& PacingPoint.ElapsedSeconds > 0.f)
 		{
 			SpeedRunPacingText->SetText(FText::Format(
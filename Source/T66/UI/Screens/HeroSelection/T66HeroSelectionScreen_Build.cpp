@@ -177,11 +177,25 @@ TSharedRef<SWidget> UT66HeroSelectionScreen::BuildSlateUI()
 		: (PartySubsystem && PartySubsystem->HasRemotePartyMembers());
 	const bool bUsePartyReadyFlow = bPartyLobbyContextActive && (!bIsLocalPartyHost || bHasRemotePartyMembers);
 	const bool bCanEditDifficulty = !bUsePartyReadyFlow || bIsLocalPartyHost;
-	const bool bLocalReady = SessionSubsystem && SessionSubsystem->IsLocalLobbyReady();
+	// Ready state is read live so toggling ready only needs a view refresh; roster changes still rebuild.
 	const bool bCanStartPartyRun = !bUsePartyReadyFlow || !SessionSubsystem || SessionSubsystem->AreAllPartyMembersReadyForGameplay();
-	const FText PrimaryActionText = bUsePartyReadyFlow && !bIsLocalPartyHost
-		? (bLocalReady ? UnreadyText : ReadyText)
-		: (bCanStartPartyRun ? EnterText : WaitingForPartyText);
+	const TAttribute<bool> CanStartPartyRun = TAttribute<bool>::CreateLambda([SessionSubsystem, bUsePartyReadyFlow]() -> bool
+	{
+		return !bUsePartyReadyFlow || !SessionSubsystem || SessionSubsystem->AreAllPartyMembersReadyForGameplay();
+	});
+	const TAttribute<bool> IsLocalPartyReady = TAttribute<bool>::CreateLambda([SessionSubsystem, bUsePartyReadyFlow]() -> bool
+	{
+		return !bUsePartyReadyFlow || !SessionSubsystem || SessionSubsystem->IsLocalLobbyReady();
+	});
+	const TAttribute<FText> PrimaryActionText = TAttribute<FText>::CreateLambda(
+		[SessionSubsystem, bUsePartyReadyFlow, bIsLocalPartyHost, CanStartPartyRun, UnreadyText, ReadyText, EnterText, WaitingForPartyText]() -> FText
+	{
+		if (bUsePartyReadyFlow && !bIsLocalPartyHost)
+		{
+			return SessionSubsystem && SessionSubsystem->IsLocalLobbyReady() ? UnreadyText : ReadyText;
+		}
+		return CanStartPartyRun.Get() ? EnterText : WaitingForPartyText;
+	});
 
 	SkinTargetOptions.Empty();
 	SkinTargetOptions.Add(MakeShared<FString>(CurrentHeroDisplayName.ToString()));
@@ -199,7 +213,6 @@ TSharedRef<SWidget> UT66HeroSelectionScreen::BuildSlateUI()
 		CurrentInfoTargetOption = InfoTargetOptions[bShowingCompanionInfo ? 1 : 0];
 	}
 	UT66BuffSubsystem* TempBuffSubsystem = T66GI ? T66GI->GetSubsystem<UT66BuffSubsystem>() : nullptr;
-	UT66UITexturePoolSubsystem* SelectionTexPool = T66GI ? T66GI->GetSubsystem<UT66UITexturePoolSubsystem>() : nullptr;
 	if (FParse::Param(FCommandLine::Get(), TEXT("T66HeroSelectionBuffPicker")))
 	{
 		TemporaryBuffPickerSlotIndex = FMath::Clamp(TemporaryBuffPickerSlotIndex, 0, UT66BuffSubsystem::MaxSelectedSingleUseBuffs - 1);
@@ -272,21 +285,19 @@ TSharedRef<SWidget> UT66HeroSelectionScreen::BuildSlateUI()
 	{
 		HeroPreviewController->RefreshCompanionPreviewPanel(T66GI, PreviewedCompanionID, bShowingCompanionInfo);
 	}
-	const TArray<ET66SecondaryStatType> ActiveTempBuffSlots = TempBuffSubsystem ? TempBuffSubsystem->GetSelectedSingleUseBuffSlots() : TArray<ET66SecondaryStatType>{};
-	SelectedTemporaryBuffBrushes.Reset();
-	SelectedTemporaryBuffBrushes.SetNum(UT66BuffSubsystem::MaxSelectedSingleUseBuffs);
-	for (int32 SlotIndex = 0; SlotIndex < UT66BuffSubsystem::MaxSelectedSingleUseBuffs; ++SlotIndex)
-	{
-		const ET66SecondaryStatType SlotStat = ActiveTempBuffSlots.IsValidIndex(SlotIndex) ? ActiveTempBuffSlots[SlotIndex] : ET66SecondaryStatType::None;
-		SelectedTemporaryBuffBrushes[SlotIndex] = T66IsLiveSecondaryStatType(SlotStat)
-			? T66TemporaryBuffUI::CreateSecondaryBuffBrush(SelectionTexPool, this, SlotStat, FVector2D(42.f, 42.f))
-			: nullptr;
-	}
+	RefreshSelectedTemporaryBuffBrushes();
 
-	auto MakeSelectedTemporaryBuffSlot = [&, bDrugsUnlocked](int32 SlotIndex) -> TSharedRef<SWidget>
+	// Slot contents are bound so equip, buy and clear only need a view refresh.
+	auto MakeSelectedTemporaryBuffSlot = [this, TempBuffSubsystem, bDrugsUnlocked](int32 SlotIndex) -> TSharedRef<SWidget>
 	{
-		const bool bFilled = SelectedTemporaryBuffBrushes.IsValidIndex(SlotIndex) && SelectedTemporaryBuffBrushes[SlotIndex].IsValid();
-		const bool bOwnedForSlot = TempBuffSubsystem ? TempBuffSubsystem->IsSelectedSingleUseBuffSlotOwned(SlotIndex) : true;
+		auto IsSlotFilled = [this, SlotIndex]() -> bool
+		{
+			return SelectedTemporaryBuffBrushes.IsValidIndex(SlotIndex) && SelectedTemporaryBuffBrushes[SlotIndex].IsValid();
+		};
+		auto IsSlotOwned = [TempBuffSubsystem, SlotIndex]() -> bool
+		{
+			return TempBuffSubsystem ? TempBuffSubsystem->IsSelectedSingleUseBuffSlotOwned(SlotIndex) : true;
+		};
 		return SNew(SBox)
 			.IsEnabled(bDrugsUnlocked)
 			[
@@ -298,38 +309,57 @@ TSharedRef<SWidget> UT66HeroSelectionScreen::BuildSlateUI()
 					.SetMinWidth(50.f)
 					.SetHeight(50.f)
 					.SetPadding(FMargin(0.f))
-					.SetColor(bOwnedForSlot ? FT66Style::Tokens::Panel : FLinearColor(0.14f, 0.07f, 0.07f, 1.0f))
+					.SetColor(TAttribute<FSlateColor>::CreateLambda([IsSlotOwned]() -> FSlateColor
+					{
+						return FSlateColor(IsSlotOwned() ? FT66Style::Tokens::Panel : FLinearColor(0.14f, 0.07f, 0.07f, 1.0f));
+					}))
 					.SetContent(
 						SNew(SOverlay)
 						+ SOverlay::Slot()
 						[
 							SNew(SBorder)
 							.BorderImage(FCoreStyle::Get().GetBrush("WhiteBrush"))
-							.BorderBackgroundColor(bOwnedForSlot ? FT66Style::Tokens::Panel2 : FLinearColor(0.22f, 0.10f, 0.10f, 1.0f))
+							.BorderBackgroundColor_Lambda([IsSlotOwned]() -> FSlateColor
+							{
+								return FSlateColor(IsSlotOwned() ? FT66Style::Tokens::Panel2 : FLinearColor(0.22f, 0.10f, 0.10f, 1.0f));
+							})
 						]
 						+ SOverlay::Slot()
 						.HAlign(HAlign_Center)
 						.VAlign(VAlign_Center)
 						[
-							bFilled
-							? StaticCastSharedRef<SWidget>(
-								SNew(SScaleBox)
-								.Stretch(EStretch::ScaleToFit)
-								[
-									SNew(SImage)
-									.Image_Lambda([this, SlotIndex]() -> const FSlateBrush*
-									{
-										return SelectedTemporaryBuffBrushes.IsValidIndex(SlotIndex) && SelectedTemporaryBuffBrushes[SlotIndex].IsValid()
-											? SelectedTemporaryBuffBrushes[SlotIndex].Get()
-											: nullptr;
-									})
-									.ColorAndOpacity(FLinearColor(1.f, 1.f, 1.f, bOwnedForSlot ? 1.0f : 0.55f))
-								])
-							: StaticCastSharedRef<SWidget>(
-								SNew(STextBlock)
-								.Text(NSLOCTEXT("T66.HeroSelection", "TempBuffEmptySlot", "+"))
-								.Font(FT66Style::Tokens::FontBold(18))
-								.ColorAndOpacity(FT66Style::Tokens::TextMuted))
+							SNew(SScaleBox)
+							.Stretch(EStretch::ScaleToFit)
+							.Visibility_Lambda([IsSlotFilled]() -> EVisibility
+							{
+								return IsSlotFilled() ? EVisibility::HitTestInvisible : EVisibility::Collapsed;
+							})
+							[
+								SNew(SImage)
+								.Image_Lambda([this, SlotIndex]() -> const FSlateBrush*
+								{
+									return SelectedTemporaryBuffBrushes.IsValidIndex(SlotIndex) && SelectedTemporaryBuffBrushes[SlotIndex].IsValid()
+										? SelectedTemporaryBuffBrushes[SlotIndex].Get()
+										: nullptr;
+								})
+								.ColorAndOpacity_Lambda([IsSlotOwned]() -> FSlateColor
+								{
+									return FSlateColor(FLinearColor(1.f, 1.f, 1.f, IsSlotOwned() ? 1.0f : 0.55f));
+								})
+							]
+						]
+						+ SOverlay::Slot()
+						.HAlign(HAlign_Center)
+						.VAlign(VAlign_Center)
+						[
+							SNew(STextBlock)
+							.Text(NSLOCTEXT("T66.HeroSelection", "TempBuffEmptySlot", "+"))
+							.Font(FT66Style::Tokens::FontBold(18))
+							.ColorAndOpacity(FT66Style::Tokens::TextMuted)
+							.Visibility_Lambda([IsSlotFilled]() -> EVisibility
+							{
+								return IsSlotFilled() ? EVisibility::Collapsed : EVisibility::HitTestInvisible;
+							})
 						]
 					))
 			];
@@ -625,252 +655,6 @@ TSharedRef<SWidget> UT66HeroSelectionScreen::BuildSlateUI()
 			FMargin(6.f, 5.f));
 	};
 
-	auto MakeTemporaryBuffPickerModal = [this,
-		TempBuffSubsystem,
-		SelectionTexPool,
-		Loc,
-		BodyTextFontSize]() -> TSharedRef<SWidget>
-	{
-		TemporaryBuffPickerBrushes.Reset();
-		const int32 FocusedSlotIndex = FMath::Clamp(
-			TemporaryBuffPickerSlotIndex,
-			0,
-			UT66BuffSubsystem::MaxSelectedSingleUseBuffs - 1);
-		const TArray<ET66SecondaryStatType> ActiveSlots = TempBuffSubsystem
-			? TempBuffSubsystem->GetSelectedSingleUseBuffSlots()
-			: TArray<ET66SecondaryStatType>{};
-		const ET66SecondaryStatType FocusedSlotStat = ActiveSlots.IsValidIndex(FocusedSlotIndex)
-			? ActiveSlots[FocusedSlotIndex]
-			: ET66SecondaryStatType::None;
-
-		TSharedRef<SVerticalBox> BuffRows = SNew(SVerticalBox);
-		for (ET66SecondaryStatType StatType : UT66BuffSubsystem::GetAllSingleUseBuffTypes())
-		{
-			const int32 OwnedCount = TempBuffSubsystem ? TempBuffSubsystem->GetOwnedSingleUseBuffCount(StatType) : 0;
-			const int32 AssignedCount = TempBuffSubsystem ? TempBuffSubsystem->GetSelectedSingleUseBuffSlotAssignedCountForStat(StatType) : 0;
-			const int32 AssignedOutsideFocused = AssignedCount - (FocusedSlotStat == StatType ? 1 : 0);
-			const bool bCanEquip = OwnedCount > AssignedOutsideFocused;
-			const bool bFocusedSlotMatches = FocusedSlotStat == StatType;
-			const int32 BuffCost = TempBuffSubsystem ? TempBuffSubsystem->GetSingleUseBuffCost() : UT66BuffSubsystem::SingleUseBuffCostCC;
-			const bool bCanBuy = TempBuffSubsystem && TempBuffSubsystem->GetChadCouponBalance() >= BuffCost;
-			const FText NameText = GetHeroSelectionDrugName(StatType);
-			const FText EffectText = GetHeroSelectionDrugEffectText(StatType, Loc);
-			const FText CountText = FText::Format(
-				NSLOCTEXT("T66.HeroSelection", "TempBuffPickerCountsOwnedOnly", "Owned {0}"),
-				FText::AsNumber(OwnedCount));
-
-			TSharedPtr<FSlateBrush> BuffBrush = T66TemporaryBuffUI::CreateSecondaryBuffBrush(
-				SelectionTexPool,
-				this,
-				StatType,
-				FVector2D(34.f, 34.f));
-			TemporaryBuffPickerBrushes.Add(BuffBrush);
-
-			const TSharedRef<SWidget> IconWidget = BuffBrush.IsValid()
-				? StaticCastSharedRef<SWidget>(
-					SNew(SImage)
-					.Image(BuffBrush.Get()))
-				: StaticCastSharedRef<SWidget>(SNew(SSpacer));
-
-			BuffRows->AddSlot()
-			.AutoHeight()
-			.Padding(0.f, 0.f, 0.f, 6.f)
-			[
-				MakeHeroSelectionRowShell(
-					SNew(SHorizontalBox)
-					+ SHorizontalBox::Slot()
-					.AutoWidth()
-					.VAlign(VAlign_Center)
-					.Padding(0.f, 0.f, 10.f, 0.f)
-					[
-						SNew(SBox)
-						.WidthOverride(36.f)
-						.HeightOverride(36.f)
-						[
-							IconWidget
-						]
-					]
-					+ SHorizontalBox::Slot()
-					.FillWidth(1.f)
-					.VAlign(VAlign_Center)
-					[
-						SNew(SVerticalBox)
-						+ SVerticalBox::Slot()
-						.AutoHeight()
-						[
-							SNew(SHorizontalBox)
-							+ SHorizontalBox::Slot()
-							.AutoWidth()
-							.VAlign(VAlign_Center)
-							[
-								SNew(STextBlock)
-								.Text(NameText)
-								.Font(FT66Style::Tokens::FontBold(BodyTextFontSize + 3))
-								.ColorAndOpacity(FT66Style::Tokens::Text)
-							]
-							+ SHorizontalBox::Slot()
-							.AutoWidth()
-							.VAlign(VAlign_Center)
-							.Padding(12.f, 0.f, 0.f, 0.f)
-							[
-								SNew(STextBlock)
-								.Text(EffectText)
-								.Font(FT66Style::Tokens::FontBold(BodyTextFontSize + 1))
-								.ColorAndOpacity(FT66Style::Tokens::TextMuted)
-							]
-						]
-						+ SVerticalBox::Slot()
-						.AutoHeight()
-						.Padding(0.f, 2.f, 0.f, 0.f)
-						[
-							SNew(STextBlock)
-							.Text(CountText)
-							.Font(FT66Style::Tokens::FontRegular(BodyTextFontSize - 2))
-							.ColorAndOpacity(FT66Style::Tokens::TextMuted)
-						]
-					]
-					+ SHorizontalBox::Slot()
-					.AutoWidth()
-					.VAlign(VAlign_Center)
-					.Padding(10.f, 0.f, 0.f, 0.f)
-					[
-						MakeHeroSelectionButton(
-							FT66ButtonParams(
-								FText::GetEmpty(),
-								FOnClicked::CreateUObject(this, &UT66HeroSelectionScreen::HandleTemporaryBuffBuyClicked, StatType),
-								ET66ButtonType::Neutral)
-							.SetMinWidth(100.f)
-							.SetHeight(36.f)
-							.SetFontSize(15)
-							.SetPadding(FMargin(10.f, 7.f))
-							.SetContent(
-								SNew(SHorizontalBox)
-								+ SHorizontalBox::Slot()
-								.AutoWidth()
-								.VAlign(VAlign_Center)
-								[
-									SNew(STextBlock)
-									.Text(NSLOCTEXT("T66.HeroSelection", "TempBuffBuy", "BUY"))
-									.Font(FT66Style::Tokens::FontBold(15))
-									.ColorAndOpacity(FT66Style::Tokens::Text)
-								]
-								+ SHorizontalBox::Slot()
-								.AutoWidth()
-								.VAlign(VAlign_Center)
-								.Padding(6.f, 0.f, 0.f, 0.f)
-								[
-									SNew(STextBlock)
-									.Text(FText::AsNumber(BuffCost))
-									.Font(FT66Style::Tokens::FontBold(15))
-									.ColorAndOpacity(FT66Style::Tokens::Text)
-								]
-								+ SHorizontalBox::Slot()
-								.AutoWidth()
-								.VAlign(VAlign_Center)
-								.Padding(5.f, 0.f, 0.f, 0.f)
-								[
-									SNew(SBox)
-									.WidthOverride(23.f)
-									.HeightOverride(18.f)
-									[
-										SNew(SImage)
-										.Image_Lambda([this]() -> const FSlateBrush*
-										{
-											return ACBalanceIconBrush.IsValid() ? ACBalanceIconBrush.Get() : nullptr;
-										})
-									]
-								])
-							.SetEnabled(bCanBuy))
-					]
-					+ SHorizontalBox::Slot()
-					.AutoWidth()
-					.VAlign(VAlign_Center)
-					.Padding(8.f, 0.f, 0.f, 0.f)
-					[
-						MakeHeroSelectionButton(
-							FT66ButtonParams(
-								bFocusedSlotMatches
-									? NSLOCTEXT("T66.HeroSelection", "TempBuffEquipped", "EQUIPPED")
-									: NSLOCTEXT("T66.HeroSelection", "TempBuffEquip", "EQUIP"),
-								FOnClicked::CreateUObject(this, &UT66HeroSelectionScreen::HandleTemporaryBuffEquipClicked, StatType),
-								bFocusedSlotMatches ? ET66ButtonType::Primary : ET66ButtonType::Neutral)
-							.SetMinWidth(108.f)
-							.SetHeight(36.f)
-							.SetFontSize(15)
-							.SetPadding(FMargin(10.f, 7.f))
-							.SetEnabled(bCanEquip || bFocusedSlotMatches))
-					],
-					FMargin(12.f, 10.f))
-			];
-		}
-
-		const TSharedRef<SWidget> PickerContent = MakeHeroSelectionPanelShell(
-			SNew(SVerticalBox)
-			+ SVerticalBox::Slot()
-			.AutoHeight()
-			[
-				SNew(SHorizontalBox)
-				+ SHorizontalBox::Slot()
-				.FillWidth(1.f)
-				.VAlign(VAlign_Center)
-				[
-					SNew(SVerticalBox)
-					+ SVerticalBox::Slot()
-					.AutoHeight()
-					[
-						SNew(STextBlock)
-						.Text(NSLOCTEXT("T66.HeroSelection", "TempBuffPickerTitle", "Choose Drugs"))
-						.Font(FT66Style::Tokens::FontBold(24))
-						.ColorAndOpacity(FT66Style::Tokens::Text)
-					]
-					+ SVerticalBox::Slot()
-					.AutoHeight()
-					.Padding(0.f, 2.f, 0.f, 0.f)
-					[
-						SNew(STextBlock)
-						.Text(FText::Format(
-							NSLOCTEXT("T66.HeroSelection", "TempBuffPickerSlotHint", "Slot {0}"),
-							FText::AsNumber(FocusedSlotIndex + 1)))
-						.Font(FT66Style::Tokens::FontRegular(BodyTextFontSize))
-						.ColorAndOpacity(FT66Style::Tokens::TextMuted)
-					]
-				]
-				+ SHorizontalBox::Slot()
-				.AutoWidth()
-				.VAlign(VAlign_Center)
-				[
-					MakeHeroSelectionButton(
-						FT66ButtonParams(
-							NSLOCTEXT("T66.Common", "Close", "CLOSE"),
-							FOnClicked::CreateUObject(this, &UT66HeroSelectionScreen::HandleTemporaryBuffPickerCloseClicked),
-							ET66ButtonType::Neutral)
-						.SetMinWidth(96.f)
-						.SetHeight(36.f)
-						.SetFontSize(15))
-				]
-			]
-			+ SVerticalBox::Slot()
-			.FillHeight(1.f)
-			.Padding(0.f, 14.f, 0.f, 0.f)
-			[
-				SNew(SScrollBox)
-				+ SScrollBox::Slot()
-				.Padding(0.f, 0.f, 14.f, 0.f)
-				[
-					BuffRows
-				]
-			],
-			FMargin(22.f, 18.f),
-			false);
-
-		return T66ScreenSlateHelpers::MakeCenteredScrimModal(
-			PickerContent,
-			FMargin(0.f),
-			680.f,
-			560.f,
-			true);
-	};
-
 	auto MakeCompanionUnityPanel = [this,
 		bDotaTheme,
 		SelectionInsetFill,
@@ -1392,7 +1176,8 @@ TSharedRef<SWidget> UT66HeroSelectionScreen::BuildSlateUI()
 		PartySubsystem,
 		T66GI,
 		SessionSubsystem,
-		bUsePartyReadyFlow]() -> TSharedRef<SWidget>
+		bUsePartyReadyFlow,
+		IsLocalPartyReady]() -> TSharedRef<SWidget>
 	{
 		const FLinearColor LeaderSlotAccent(0.29f, 0.24f, 0.13f, 1.0f);
 		const FLinearColor PartySlotAccent(0.15f, 0.17f, 0.19f, 1.0f);
@@ -1573,7 +1358,6 @@ TSharedRef<SWidget> UT66HeroSelectionScreen::BuildSlateUI()
 				];
 		}
 
-		const bool bLocalPartyReady = !bUsePartyReadyFlow || !SessionSubsystem || SessionSubsystem->IsLocalLobbyReady();
 		PartySlots->AddSlot()
 			.AutoWidth()
 			.Padding(10.f, 0.f, 0.f, 0.f)
@@ -1584,15 +1368,21 @@ TSharedRef<SWidget> UT66HeroSelectionScreen::BuildSlateUI()
 				[
 					SNew(SBorder)
 					.BorderImage(GetHeroSelectionPartySlotBrush())
-					.BorderBackgroundColor(bLocalPartyReady ? ReadyFill : NotReadyFill)
+					.BorderBackgroundColor_Lambda([IsLocalPartyReady, ReadyFill, NotReadyFill]() -> FSlateColor
+					{
+						return FSlateColor(IsLocalPartyReady.Get() ? ReadyFill : NotReadyFill);
+					})
 					.Padding(7.f)
 					.HAlign(HAlign_Center)
 					.VAlign(VAlign_Center)
 					[
 						SNew(STextBlock)
-						.Text(bLocalPartyReady
-							? NSLOCTEXT("T66.HeroSelection", "PartyReadyBoxReady", "READY")
-							: NSLOCTEXT("T66.HeroSelection", "PartyReadyBoxNotReady", "NOT READY"))
+						.Text_Lambda([IsLocalPartyReady]() -> FText
+						{
+							return IsLocalPartyReady.Get()
+								? NSLOCTEXT("T66.HeroSelection", "PartyReadyBoxReady", "READY")
+								: NSLOCTEXT("T66.HeroSelection", "PartyReadyBoxNotReady", "NOT READY");
+						})
 						.Font(FT66Style::Tokens::FontBold(15))
 						.ColorAndOpacity(FT66Style::Tokens::Text)
 						.Justification(ETextJustify::Center)
@@ -1636,6 +1426,7 @@ TSharedRef<SWidget> UT66HeroSelectionScreen::BuildSlateUI()
 		bIsLocalPartyHost,
 		bCanEditDifficulty,
 		bCanStartPartyRun,
+		CanStartPartyRun,
 		PrimaryActionText,
 		PrimaryCtaFontSize,
 		DifficultyMenuFontSize,
@@ -1700,9 +1491,10 @@ TSharedRef<SWidget> UT66HeroSelectionScreen::BuildSlateUI()
 				.FillWidth(1.0f)
 				[
 					MakeHeroSelectionButton(FT66ButtonParams(
-						PrimaryActionText,
+						FText::GetEmpty(),
 						FOnClicked::CreateUObject(this, &UT66HeroSelectionScreen::HandleEnterClicked),
 						ET66ButtonType::Primary)
+						.SetDynamicLabel(PrimaryActionText)
 						.SetMinWidth(0.f)
 						.SetHeight(FooterActionHeight)
 						.SetPadding(FMargin(12.f, 8.f))
@@ -1783,17 +1575,21 @@ TSharedRef<SWidget> UT66HeroSelectionScreen::BuildSlateUI()
 			[
 				SNew(SBox)
 				.HeightOverride(FooterActionHeight)
-				.IsEnabled(bCanStartPartyRun)
+				.IsEnabled(CanStartPartyRun)
 				[
 					MakeHeroSelectionSpriteButton(FT66ButtonParams(
-						PrimaryActionText,
+						FText::GetEmpty(),
 						FOnClicked::CreateUObject(this, &UT66HeroSelectionScreen::HandleEnterClicked),
 						bCanStartPartyRun ? ET66ButtonType::Primary : ET66ButtonType::Neutral)
+						.SetDynamicLabel(PrimaryActionText)
 						.SetMinWidth(0.f)
 						.SetHeight(FooterActionHeight)
 						.SetPadding(FMargin(12.f, 8.f))
 						.SetFontSize(PrimaryCtaFontSize),
-						TAttribute<ET66HeroSpriteFamily>(bCanStartPartyRun ? ET66HeroSpriteFamily::ToggleOn : ET66HeroSpriteFamily::CompactNeutral))
+						TAttribute<ET66HeroSpriteFamily>::CreateLambda([CanStartPartyRun]() -> ET66HeroSpriteFamily
+						{
+							return CanStartPartyRun.Get() ? ET66HeroSpriteFamily::ToggleOn : ET66HeroSpriteFamily::CompactNeutral;
+						}))
 				]
 			]
 			+ SHorizontalBox::Slot()
@@ -2663,19 +2459,317 @@ TSharedRef<SWidget> UT66HeroSelectionScreen::BuildSlateUI()
 		HeroPreviewController->UpdateHeroPreviewVideo(PreviewedHeroID, bShowingCompanionInfo);
 	}
 
+	// The drug picker opens, closes and refreshes in place inside this host.
+	const TSharedRef<SWidget> ScreenRoot = SNew(SOverlay)
+		+ SOverlay::Slot()
+		[
+			Root
+		]
+		+ SOverlay::Slot()
+		[
+			SAssignNew(TemporaryBuffPickerHost, SBox)
+		];
+	RefreshTemporaryBuffPicker();
+
+	return ScreenRoot;
+}
+
+bool UT66HeroSelectionScreen::RefreshBoundWidgets()
+{
+	if (!TemporaryBuffPickerHost.IsValid())
+	{
+		return false;
+	}
+
+	RefreshSelectedTemporaryBuffBrushes();
+	RefreshTemporaryBuffPicker();
+	return true;
+}
+
+void UT66HeroSelectionScreen::RefreshSelectedTemporaryBuffBrushes()
+{
+	UT66GameInstance* T66GI = Cast<UT66GameInstance>(UGameplayStatics::GetGameInstance(this));
+	UT66BuffSubsystem* TempBuffSubsystem = T66GI ? T66GI->GetSubsystem<UT66BuffSubsystem>() : nullptr;
+	UT66UITexturePoolSubsystem* SelectionTexPool = T66GI ? T66GI->GetSubsystem<UT66UITexturePoolSubsystem>() : nullptr;
+	const TArray<ET66SecondaryStatType> ActiveTempBuffSlots = TempBuffSubsystem ? TempBuffSubsystem->GetSelectedSingleUseBuffSlots() : TArray<ET66SecondaryStatType>{};
+	SelectedTemporaryBuffBrushes.Reset();
+	SelectedTemporaryBuffBrushes.SetNum(UT66BuffSubsystem::MaxSelectedSingleUseBuffs);
+	for (int32 SlotIndex = 0; SlotIndex < UT66BuffSubsystem::MaxSelectedSingleUseBuffs; ++SlotIndex)
+	{
+		const ET66SecondaryStatType SlotStat = ActiveTempBuffSlots.IsValidIndex(SlotIndex) ? ActiveTempBuffSlots[SlotIndex] : ET66SecondaryStatType::None;
+		SelectedTemporaryBuffBrushes[SlotIndex] = T66IsLiveSecondaryStatType(SlotStat)
+			? T66TemporaryBuffUI::CreateSecondaryBuffBrush(SelectionTexPool, this, SlotStat, FVector2D(42.f, 42.f))
+			: nullptr;
+	}
+}
+
+void UT66HeroSelectionScreen::RefreshTemporaryBuffPicker()
+{
+	if (!TemporaryBuffPickerHost.IsValid())
+	{
+		return;
+	}
+
+	// Keep the old picker's brushes alive until its widgets have been swapped out.
+	const TArray<TSharedPtr<FSlateBrush>> PreviousPickerBrushes = MoveTemp(TemporaryBuffPickerBrushes);
+	TemporaryBuffPickerBrushes.Reset();
 	if (bShowingTemporaryBuffPicker)
 	{
-		return SNew(SOverlay)
-			+ SOverlay::Slot()
+		TemporaryBuffPickerHost->SetContent(BuildTemporaryBuffPickerModal());
+		TemporaryBuffPickerHost->SetVisibility(EVisibility::SelfHitTestInvisible);
+	}
+	else
+	{
+		TemporaryBuffPickerHost->SetContent(SNullWidget::NullWidget);
+		TemporaryBuffPickerHost->SetVisibility(EVisibility::Collapsed);
+	}
+}
+
+TSharedRef<SWidget> UT66HeroSelectionScreen::BuildTemporaryBuffPickerModal()
+{
+	UT66GameInstance* T66GI = Cast<UT66GameInstance>(UGameplayStatics::GetGameInstance(this));
+	UT66BuffSubsystem* TempBuffSubsystem = T66GI ? T66GI->GetSubsystem<UT66BuffSubsystem>() : nullptr;
+	UT66UITexturePoolSubsystem* SelectionTexPool = T66GI ? T66GI->GetSubsystem<UT66UITexturePoolSubsystem>() : nullptr;
+	UT66LocalizationSubsystem* Loc = GetLocSubsystem();
+	const int32 BodyTextFontSize = 15;
+
+	TemporaryBuffPickerBrushes.Reset();
+	const int32 FocusedSlotIndex = FMath::Clamp(
+		TemporaryBuffPickerSlotIndex,
+		0,
+		UT66BuffSubsystem::MaxSelectedSingleUseBuffs - 1);
+	const TArray<ET66SecondaryStatType> ActiveSlots = TempBuffSubsystem
+		? TempBuffSubsystem->GetSelectedSingleUseBuffSlots()
+		: TArray<ET66SecondaryStatType>{};
+	const ET66SecondaryStatType FocusedSlotStat = ActiveSlots.IsValidIndex(FocusedSlotIndex)
+		? ActiveSlots[FocusedSlotIndex]
+		: ET66SecondaryStatType::None;
+
+	TSharedRef<SVerticalBox> BuffRows = SNew(SVerticalBox);
+	for (ET66SecondaryStatType StatType : UT66BuffSubsystem::GetAllSingleUseBuffTypes())
+	{
+		const int32 OwnedCount = TempBuffSubsystem ? TempBuffSubsystem->GetOwnedSingleUseBuffCount(StatType) : 0;
+		const int32 AssignedCount = TempBuffSubsystem ? TempBuffSubsystem->GetSelectedSingleUseBuffSlotAssignedCountForStat(StatType) : 0;
+		const int32 AssignedOutsideFocused = AssignedCount - (FocusedSlotStat == StatType ? 1 : 0);
+		const bool bCanEquip = OwnedCount > AssignedOutsideFocused;
+		const bool bFocusedSlotMatches = FocusedSlotStat == StatType;
+		const int32 BuffCost = TempBuffSubsystem ? TempBuffSubsystem->GetSingleUseBuffCost() : UT66BuffSubsystem::SingleUseBuffCostCC;
+		const bool bCanBuy = TempBuffSubsystem && TempBuffSubsystem->GetChadCouponBalance() >= BuffCost;
+		const FText NameText = GetHeroSelectionDrugName(StatType);
+		const FText EffectText = GetHeroSelectionDrugEffectText(StatType, Loc);
+		const FText CountText = FText::Format(
+			NSLOCTEXT("T66.HeroSelection", "TempBuffPickerCountsOwnedOnly", "Owned {0}"),
+			FText::AsNumber(OwnedCount));
+
+		TSharedPtr<FSlateBrush> BuffBrush = T66TemporaryBuffUI::CreateSecondaryBuffBrush(
+			SelectionTexPool,
+			this,
+			StatType,
+			FVector2D(34.f, 34.f));
+		TemporaryBuffPickerBrushes.Add(BuffBrush);
+
+		const TSharedRef<SWidget> IconWidget = BuffBrush.IsValid()
+			? StaticCastSharedRef<SWidget>(
+				SNew(SImage)
+				.Image(BuffBrush.Get()))
+			: StaticCastSharedRef<SWidget>(SNew(SSpacer));
+
+		BuffRows->AddSlot()
+		.AutoHeight()
+		.Padding(0.f, 0.f, 0.f, 6.f)
+		[
+			MakeHeroSelectionRowShell(
+				SNew(SHorizontalBox)
+				+ SHorizontalBox::Slot()
+				.AutoWidth()
+				.VAlign(VAlign_Center)
+				.Padding(0.f, 0.f, 10.f, 0.f)
+				[
+					SNew(SBox)
+					.WidthOverride(36.f)
+					.HeightOverride(36.f)
+					[
+						IconWidget
+					]
+				]
+				+ SHorizontalBox::Slot()
+				.FillWidth(1.f)
+				.VAlign(VAlign_Center)
+				[
+					SNew(SVerticalBox)
+					+ SVerticalBox::Slot()
+					.AutoHeight()
+					[
+						SNew(SHorizontalBox)
+						+ SHorizontalBox::Slot()
+						.AutoWidth()
+						.VAlign(VAlign_Center)
+						[
+							SNew(STextBlock)
+							.Text(NameText)
+							.Font(FT66Style::Tokens::FontBold(BodyTextFontSize + 3))
+							.ColorAndOpacity(FT66Style::Tokens::Text)
+						]
+						+ SHorizontalBox::Slot()
+						.AutoWidth()
+						.VAlign(VAlign_Center)
+						.Padding(12.f, 0.f, 0.f, 0.f)
+						[
+							SNew(STextBlock)
+							.Text(EffectText)
+							.Font(FT66Style::Tokens::FontBold(BodyTextFontSize + 1))
+							.ColorAndOpacity(FT66Style::Tokens::TextMuted)
+						]
+					]
+					+ SVerticalBox::Slot()
+					.AutoHeight()
+					.Padding(0.f, 2.f, 0.f, 0.f)
+					[
+						SNew(STextBlock)
+						.Text(CountText)
+						.Font(FT66Style::Tokens::FontRegular(BodyTextFontSize - 2))
+						.ColorAndOpacity(FT66Style::Tokens::TextMuted)
+					]
+				]
+				+ SHorizontalBox::Slot()
+				.AutoWidth()
+				.VAlign(VAlign_Center)
+				.Padding(10.f, 0.f, 0.f, 0.f)
+				[
+					MakeHeroSelectionButton(
+						FT66ButtonParams(
+							FText::GetEmpty(),
+							FOnClicked::CreateUObject(this, &UT66HeroSelectionScreen::HandleTemporaryBuffBuyClicked, StatType),
+							ET66ButtonType::Neutral)
+						.SetMinWidth(100.f)
+						.SetHeight(36.f)
+						.SetFontSize(15)
+						.SetPadding(FMargin(10.f, 7.f))
+						.SetContent(
+							SNew(SHorizontalBox)
+							+ SHorizontalBox::Slot()
+							.AutoWidth()
+							.VAlign(VAlign_Center)
+							[
+								SNew(STextBlock)
+								.Text(NSLOCTEXT("T66.HeroSelection", "TempBuffBuy", "BUY"))
+								.Font(FT66Style::Tokens::FontBold(15))
+								.ColorAndOpacity(FT66Style::Tokens::Text)
+							]
+							+ SHorizontalBox::Slot()
+							.AutoWidth()
+							.VAlign(VAlign_Center)
+							.Padding(6.f, 0.f, 0.f, 0.f)
+							[
+								SNew(STextBlock)
+								.Text(FText::AsNumber(BuffCost))
+								.Font(FT66Style::Tokens::FontBold(15))
+								.ColorAndOpacity(FT66Style::Tokens::Text)
+							]
+							+ SHorizontalBox::Slot()
+							.AutoWidth()
+							.VAlign(VAlign_Center)
+							.Padding(5.f, 0.f, 0.f, 0.f)
+							[
+								SNew(SBox)
+								.WidthOverride(23.f)
+								.HeightOverride(18.f)
+								[
+									SNew(SImage)
+									.Image_Lambda([this]() -> const FSlateBrush*
+									{
+										return ACBalanceIconBrush.IsValid() ? ACBalanceIconBrush.Get() : nullptr;
+									})
+								]
+							])
+						.SetEnabled(bCanBuy))
+				]
+				+ SHorizontalBox::Slot()
+				.AutoWidth()
+				.VAlign(VAlign_Center)
+				.Padding(8.f, 0.f, 0.f, 0.f)
+				[
+					MakeHeroSelectionButton(
+						FT66ButtonParams(
+							bFocusedSlotMatches
+								? NSLOCTEXT("T66.HeroSelection", "TempBuffEquipped", "EQUIPPED")
+								: NSLOCTEXT("T66.HeroSelection", "TempBuffEquip", "EQUIP"),
+							FOnClicked::CreateUObject(this, &UT66HeroSelectionScreen::HandleTemporaryBuffEquipClicked, StatType),
+							bFocusedSlotMatches ? ET66ButtonType::Primary : ET66ButtonType::Neutral)
+						.SetMinWidth(108.f)
+						.SetHeight(36.f)
+						.SetFontSize(15)
+						.SetPadding(FMargin(10.f, 7.f))
+						.SetEnabled(bCanEquip || bFocusedSlotMatches))
+				],
+				FMargin(12.f, 10.f))
+		];
+	}
+
+	const TSharedRef<SWidget> PickerContent = MakeHeroSelectionPanelShell(
+		SNew(SVerticalBox)
+		+ SVerticalBox::Slot()
+		.AutoHeight()
+		[
+			SNew(SHorizontalBox)
+			+ SHorizontalBox::Slot()
+			.FillWidth(1.f)
+			.VAlign(VAlign_Center)
+			[
+				SNew(SVerticalBox)
+				+ SVerticalBox::Slot()
+				.AutoHeight()
+				[
+					SNew(STextBlock)
+					.Text(NSLOCTEXT("T66.HeroSelection", "TempBuffPickerTitle", "Choose Drugs"))
+					.Font(FT66Style::Tokens::FontBold(24))
+					.ColorAndOpacity(FT66Style::Tokens::Text)
+				]
+				+ SVerticalBox::Slot()
+				.AutoHeight()
+				.Padding(0.f, 2.f, 0.f, 0.f)
+				[
+					SNew(STextBlock)
+					.Text(FText::Format(
+						NSLOCTEXT("T66.HeroSelection", "TempBuffPickerSlotHint", "Slot {0}"),
+						FText::AsNumber(FocusedSlotIndex + 1)))
+					.Font(FT66Style::Tokens::FontRegular(BodyTextFontSize))
+					.ColorAndOpacity(FT66Style::Tokens::TextMuted)
+				]
+			]
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.VAlign(VAlign_Center)
 			[
-				Root
+				MakeHeroSelectionButton(
+					FT66ButtonParams(
+						NSLOCTEXT("T66.Common", "Close", "CLOSE"),
+						FOnClicked::CreateUObject(this, &UT66HeroSelectionScreen::HandleTemporaryBuffPickerCloseClicked),
+						ET66ButtonType::Neutral)
+					.SetMinWidth(96.f)
+					.SetHeight(36.f)
+					.SetFontSize(15))
 			]
-			+ SOverlay::Slot()
+		]
+		+ SVerticalBox::Slot()
+		.FillHeight(1.f)
+		.Padding(0.f, 14.f, 0.f, 0.f)
+		[
+			SNew(SScrollBox)
+			+ SScrollBox::Slot()
+			.Padding(0.f, 0.f, 14.f, 0.f)
 			[
-				MakeTemporaryBuffPickerModal()
-			];
-	}
-
-	return Root;
+				BuffRows
+			]
+		],
+		FMargin(22.f, 18.f),
+		false);
+
+	return T66ScreenSlateHelpers::MakeCenteredScrimModal(
+		PickerContent,
+		FMargin(0.f),
+		680.f,
+		560.f,
+		true);
 }
 
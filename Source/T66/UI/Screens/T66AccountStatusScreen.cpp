@@ -7,7 +7,6 @@
 #include "Core/T66CompanionUnlockSubsystem.h"
 #include "Core/T66GameInstance.h"
 #include "Core/T66LeaderboardSubsystem.h"
-#include "Core/T66LeaderboardRunSummarySaveGame.h"
 #include "Core/T66LocalizationSubsystem.h"
 #include "Core/T66SteamHelper.h"
 #include "Core/T66BuffSubsystem.h"
@@ -1137,7 +1136,7 @@ TSharedRef<SWidget> UT66AccountStatusScreen::BuildSlateUI()
 	};
 
 	TMap<FString, FName> PBHeroIdBySlot;
-	auto ResolvePBHeroID = [&PBHeroIdBySlot](const FString& SlotName) -> FName
+	auto ResolvePBHeroID = [&PBHeroIdBySlot, LB](const FString& SlotName) -> FName
 	{
 		if (SlotName.IsEmpty())
 		{
@@ -1150,15 +1149,10 @@ TSharedRef<SWidget> UT66AccountStatusScreen::BuildSlateUI()
 		}
 
 		FName HeroID = NAME_None;
-		if (UGameplayStatics::DoesSaveGameExist(SlotName, 0))
+		FT66RunSummaryHeader Header;
+		if (LB && LB->GetRunSummaryHeader(SlotName, Header))
 		{
-			if (USaveGame* SaveGame = UGameplayStatics::LoadGameFromSlot(SlotName, 0))
-			{
-				if (const UT66LeaderboardRunSummarySaveGame* Summary = Cast<UT66LeaderboardRunSummarySaveGame>(SaveGame))
-				{
-					HeroID = Summary->HeroID;
-				}
-			}
+			HeroID = Header.HeroID;
 		}
 
 		PBHeroIdBySlot.Add(SlotName, HeroID);
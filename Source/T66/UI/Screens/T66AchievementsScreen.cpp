@@ -396,9 +396,9 @@ namespace
 			.SetVisibility(Params.Visibility));
 	}
 
-	TSharedRef<SWidget> MakeAchievementsProgressBar(const float Percent, const float Height)
+	TSharedRef<SWidget> MakeAchievementsProgressBar(const TAttribute<float>& Percent, const float Height)
 	{
-		const float Pct = FMath::Clamp(Percent, 0.f, 1.f);
+		auto ClampedPct = [Percent]() { return FMath::Clamp(Percent.Get(), 0.f, 1.f); };
 		const FSlateBrush* ShellBrush = ResolveAchievementsGeneratedBrush(MakeSettingsAssetPath(TEXT("settings_dropdown_field.png")));
 		const FSlateBrush* FillBrush = ResolveAchievementsGeneratedBrush(T66ProgressFillAssetPath, FVector2D(512.f, 64.f));
 
@@ -414,15 +414,15 @@ namespace
 				[
 					SNew(SHorizontalBox)
 					+ SHorizontalBox::Slot()
-					.FillWidth(FMath::Max(Pct, 0.001f))
+					.FillWidth(TAttribute<float>::CreateLambda([ClampedPct]() { return FMath::Max(ClampedPct(), 0.001f); }))
 					[
 						SNew(SBorder)
-						.Visibility(Pct > 0.001f ? EVisibility::Visible : EVisibility::Collapsed)
+						.Visibility_Lambda([ClampedPct]() { return ClampedPct() > 0.001f ? EVisibility::Visible : EVisibility::Collapsed; })
 						.BorderImage(FillBrush ? FillBrush : FCoreStyle::Get().GetBrush("WhiteBrush"))
 						.BorderBackgroundColor(FillBrush ? FLinearColor::White : FLinearColor(0.14f, 0.02f, 0.36f, 1.0f))
 					]
 					+ SHorizontalBox::Slot()
-					.FillWidth(FMath::Max(1.f - Pct, 0.001f))
+					.FillWidth(TAttribute<float>::CreateLambda([ClampedPct]() { return FMath::Max(1.f - ClampedPct(), 0.001f); }))
 					[
 						SNew(SSpacer)
 					]
@@ -621,31 +621,13 @@ TSharedRef<SWidget> UT66AchievementsScreen::BuildSlateUI()
 	UT66LocalizationSubsystem* Loc = GetLocSubsystem();
 
 	const FText AchievementsText = Loc ? Loc->GetText_Achievements() : NSLOCTEXT("T66.Achievements", "Title", "ACHIEVEMENTS");
-	const FText SteamText = NSLOCTEXT("T66.Achievements", "SteamTab", "STEAM");
-	const FText SecretText = NSLOCTEXT("T66.Achievements", "SecretTab", "SECRET");
 	const FLinearColor ShellFill = T66AchievementsShellFill();
 	const FLinearColor InsetFill = T66AchievementsInsetFill();
 	const float TopInset = T66ScreenSlateHelpers::GetFrontendChromeTopInset(UIManager);
 
 	RefreshAchievements();
-	const TArray<FAchievementData> StandardAchievements = GetAchievementsForCategory(ET66AchievementCategory::Standard);
-	const int32 UnlockedStandardAchievements = GetUnlockedAchievementCountForCategory(ET66AchievementCategory::Standard);
-	const float StandardProgress = StandardAchievements.Num() > 0
-		? static_cast<float>(UnlockedStandardAchievements) / static_cast<float>(StandardAchievements.Num())
-		: 0.0f;
-	const bool bShowingSecret = ActiveTab == EAchievementTab::Secret;
-
-	auto MakeTabButton = [this](const FText& Label, bool bActive, bool bLeft, FReply(UT66AchievementsScreen::*Handler)()) -> TSharedRef<SWidget>
-	{
-		return MakeAchievementsGeneratedButton(
-			FT66ButtonParams(Label, FOnClicked::CreateUObject(this, Handler), bActive ? ET66ButtonType::ToggleActive : ET66ButtonType::Neutral)
-			.SetMinWidth(T66ScreenSlateHelpers::GetFrontendChromeMetrics().TabMinWidth)
-			.SetHeight(T66ScreenSlateHelpers::GetFrontendChromeMetrics().TabHeight),
-			ResolveAchievementsToggleButtonStyle(bActive, bLeft),
-			T66ScreenSlateHelpers::MakeFrontendChromeTabFont(),
-			bActive ? T66AchievementsTabActiveText() : T66AchievementsTabInactiveText(),
-			T66ScreenSlateHelpers::GetFrontendChromeMetrics().TabPadding);
-	};
+	RefreshViewState();
+	const TWeakObjectPtr<UT66AchievementsScreen> WeakScreen(this);
 
 	const TSharedRef<SWidget> Root =
 		SNew(SBox)
@@ -677,26 +659,7 @@ TSharedRef<SWidget> UT66AchievementsScreen::BuildSlateUI()
 						.HAlign(HAlign_Center)
 						.VAlign(VAlign_Center)
 						[
-							SNew(SHorizontalBox)
-							+ SHorizontalBox::Slot()
-							.AutoWidth()
-							.Padding(0.f, 0.f, 8.f, 0.f)
-							[
-								MakeTabButton(
-									SteamText,
-									ActiveTab == EAchievementTab::Achievements,
-									true,
-									&UT66AchievementsScreen::HandleAchievementsTabClicked)
-							]
-							+ SHorizontalBox::Slot()
-							.AutoWidth()
-							[
-								MakeTabButton(
-									SecretText,
-									ActiveTab == EAchievementTab::Secret,
-									false,
-									&UT66AchievementsScreen::HandleSecretTabClicked)
-							]
+							SAssignNew(TabRowBox, SBox)
 						]
 					]
 					+ SVerticalBox::Slot()
@@ -715,17 +678,18 @@ TSharedRef<SWidget> UT66AchievementsScreen::BuildSlateUI()
 								.FillWidth(1.f)
 								[
 									SNew(STextBlock)
-									.Text_Lambda([bShowingSecret, UnlockedStandardAchievements, StandardAchievements]() -> FText
+									.Text_Lambda([WeakScreen]() -> FText
 									{
-										if (bShowingSecret)
+										const UT66AchievementsScreen* Screen = WeakScreen.Get();
+										if (!Screen || Screen->ActiveTab == EAchievementTab::Secret)
 										{
 											return NSLOCTEXT("T66.Achievements", "SecretProgressMaskedLabel", "???");
 										}
 
 										return FText::Format(
 											NSLOCTEXT("T66.Achievements", "CompletionLabel", "{0}/{1} ACHIEVEMENTS"),
-											FText::AsNumber(UnlockedStandardAchievements),
-											FText::AsNumber(StandardAchievements.Num()));
+											FText::AsNumber(Screen->ViewState.UnlockedStandard),
+											FText::AsNumber(Screen->ViewState.TotalStandard));
 									})
 									.Font(AchievementsBoldFont(18))
 									.ColorAndOpacity(FT66Style::Tokens::Text)
@@ -735,11 +699,12 @@ TSharedRef<SWidget> UT66AchievementsScreen::BuildSlateUI()
 								.HAlign(HAlign_Right)
 								[
 									SNew(STextBlock)
-									.Text_Lambda([bShowingSecret, StandardProgress]() -> FText
+									.Text_Lambda([WeakScreen]() -> FText
 									{
-										return bShowingSecret
+										const UT66AchievementsScreen* Screen = WeakScreen.Get();
+										return (!Screen || Screen->ActiveTab == EAchievementTab::Secret)
 											? NSLOCTEXT("T66.Achievements", "SecretProgressMaskedPercent", "???")
-											: FText::AsPercent(StandardProgress);
+											: FText::AsPercent(Screen->ViewState.StandardProgress);
 									})
 									.Font(AchievementsBoldFont(17))
 									.ColorAndOpacity(FT66Style::Tokens::TextMuted)
@@ -748,7 +713,13 @@ TSharedRef<SWidget> UT66AchievementsScreen::BuildSlateUI()
 							+ SVerticalBox::Slot()
 							.AutoHeight()
 							[
-								MakeAchievementsProgressBar(bShowingSecret ? 0.0f : StandardProgress, 13.f)
+								MakeAchievementsProgressBar(
+									TAttribute<float>::CreateLambda([WeakScreen]() -> float
+									{
+										const UT66AchievementsScreen* Screen = WeakScreen.Get();
+										return (Screen && Screen->ActiveTab != EAchievementTab::Secret) ? Screen->ViewState.StandardProgress : 0.0f;
+									}),
+									13.f)
 							],
 							FMargin(20.f, 18.f),
 							FLinearColor::White,
@@ -770,6 +741,7 @@ TSharedRef<SWidget> UT66AchievementsScreen::BuildSlateUI()
 				ShellFill)
 		];
 
+	RebuildTabRow();
 	RebuildAchievementList();
 	if (const FSlateBrush* SceneBackgroundBrush = ResolveAchievementsGeneratedBrush(TEXT("SourceAssets/UI/MasterLibrary/ScreenArt/MainMenu/main_menu_scene_plate_imagegen_20260425_v1.png")))
 	{
@@ -794,6 +766,78 @@ TSharedRef<SWidget> UT66AchievementsScreen::BuildSlateUI()
 	return Root;
 }
 
+bool UT66AchievementsScreen::RefreshBoundWidgets()
+{
+	if (!TabRowBox.IsValid() || !AchievementListBox.IsValid())
+	{
+		return false;
+	}
+
+	RebuildTabRow();
+	RebuildAchievementList();
+	return true;
+}
+
+void UT66AchievementsScreen::RefreshViewState()
+{
+	ViewState.TotalStandard = 0;
+	ViewState.UnlockedStandard = 0;
+	for (const FAchievementData& Achievement : AllAchievements)
+	{
+		if (Achievement.Category == ET66AchievementCategory::Standard)
+		{
+			++ViewState.TotalStandard;
+			ViewState.UnlockedStandard += Achievement.bIsUnlocked ? 1 : 0;
+		}
+	}
+
+	ViewState.StandardProgress = ViewState.TotalStandard > 0
+		? static_cast<float>(ViewState.UnlockedStandard) / static_cast<float>(ViewState.TotalStandard)
+		: 0.0f;
+}
+
+void UT66AchievementsScreen::RebuildTabRow()
+{
+	if (!TabRowBox.IsValid())
+	{
+		return;
+	}
+
+	auto MakeTabButton = [this](const FText& Label, bool bActive, bool bLeft, FReply(UT66AchievementsScreen::*Handler)()) -> TSharedRef<SWidget>
+	{
+		return MakeAchievementsGeneratedButton(
+			FT66ButtonParams(Label, FOnClicked::CreateUObject(this, Handler), bActive ? ET66ButtonType::ToggleActive : ET66ButtonType::Neutral)
+			.SetMinWidth(T66ScreenSlateHelpers::GetFrontendChromeMetrics().TabMinWidth)
+			.SetHeight(T66ScreenSlateHelpers::GetFrontendChromeMetrics().TabHeight),
+			ResolveAchievementsToggleButtonStyle(bActive, bLeft),
+			T66ScreenSlateHelpers::MakeFrontendChromeTabFont(),
+			bActive ? T66AchievementsTabActiveText() : T66AchievementsTabInactiveText(),
+			T66ScreenSlateHelpers::GetFrontendChromeMetrics().TabPadding);
+	};
+
+	TabRowBox->SetContent(
+		SNew(SHorizontalBox)
+		+ SHorizontalBox::Slot()
+		.AutoWidth()
+		.Padding(0.f, 0.f, 8.f, 0.f)
+		[
+			MakeTabButton(
+				NSLOCTEXT("T66.Achievements", "SteamTab", "STEAM"),
+				ActiveTab == EAchievementTab::Achievements,
+				true,
+				&UT66AchievementsScreen::HandleAchievementsTabClicked)
+		]
+		+ SHorizontalBox::Slot()
+		.AutoWidth()
+		[
+			MakeTabButton(
+				NSLOCTEXT("T66.Achievements", "SecretTab", "SECRET"),
+				ActiveTab == EAchievementTab::Secret,
+				false,
+				&UT66AchievementsScreen::HandleSecretTabClicked)
+		]);
+}
+
 void UT66AchievementsScreen::RebuildAchievementList()
 {
 	if (!AchievementListBox.IsValid())
@@ -803,6 +847,7 @@ void UT66AchievementsScreen::RebuildAchievementList()
 
 	AchievementListBox->ClearChildren();
 	RefreshAchievements();
+	RefreshViewState();
 
 	UT66AchievementsSubsystem* Achievements = GetAchievementsSubsystem();
 	UT66PlayerSettingsSubsystem* PlayerSettings = GetPlayerSettingsSubsystem();
@@ -941,7 +986,7 @@ void UT66AchievementsScreen::RebuildAchievementList()
 												if (PlayerSettings)
 												{
 													PlayerSettings->SetFavoriteAchievement(AchievementID, !PlayerSettings->IsFavoriteAchievement(AchievementID));
-													ForceRebuildSlate();
+													RequestViewRefresh();
 												}
 												return FReply::Handled();
 											}),
@@ -1136,7 +1181,7 @@ void UT66AchievementsScreen::OnScreenActivated_Implementation()
 
 	if (bShouldRebuildForRequestedTab)
 	{
-		ForceRebuildSlate();
+		RebuildTabRow();
 	}
 
 	if (UT66LocalizationSubsystem* Loc = GetLocSubsystem())
@@ -1199,7 +1244,7 @@ FReply UT66AchievementsScreen::HandleAchievementsTabClicked()
 	}
 
 	ActiveTab = EAchievementTab::Achievements;
-	ForceRebuildSlate();
+	RequestViewRefresh();
 	return FReply::Handled();
 }
 
@@ -1211,7 +1256,7 @@ FReply UT66AchievementsScreen::HandleSecretTabClicked()
 	}
 
 	ActiveTab = EAchievementTab::Secret;
-	ForceRebuildSlate();
+	RequestViewRefresh();
 	return FReply::Handled();
 }
 
@@ -11,6 +11,8 @@
 class UT66LocalizationSubsystem;
 class UT66AchievementsSubsystem;
 class UT66PlayerSettingsSubsystem;
+class SBox;
+class SVerticalBox;
 
 /**
  * Achievements Screen
@@ -31,6 +33,7 @@ protected:
 	virtual void OnScreenActivated_Implementation() override;
 	virtual void OnScreenDeactivated_Implementation() override;
 	virtual TSharedRef<SWidget> BuildSlateUI() override;
+	virtual bool RefreshBoundWidgets() override;
 
 private:
 	enum class EAchievementTab : uint8
@@ -39,15 +42,27 @@ private:
 		Secret,
 	};
 
+	/** Header state read by the progress bindings; refreshed together with the list. */
+	struct FAchievementsViewState
+	{
+		int32 UnlockedStandard = 0;
+		int32 TotalStandard = 0;
+		float StandardProgress = 0.f;
+	};
+
 	TArray<FAchievementData> AllAchievements;
 	TSharedPtr<SVerticalBox> AchievementListBox;
+	TSharedPtr<SBox> TabRowBox;
 	EAchievementTab ActiveTab = EAchievementTab::Achievements;
+	FAchievementsViewState ViewState;
 
 	UT66LocalizationSubsystem* GetLocSubsystem() const;
 	UT66AchievementsSubsystem* GetAchievementsSubsystem() const;
 	UT66PlayerSettingsSubsystem* GetPlayerSettingsSubsystem() const;
 
 	void RefreshAchievements();
+	void RefreshViewState();
+	void RebuildTabRow();
 	void RebuildAchievementList();
 	int32 GetUnlockedAchievementCount() const;
 	int32 GetUnlockedAchievementCountForCategory(ET66AchievementCategory Category) const;
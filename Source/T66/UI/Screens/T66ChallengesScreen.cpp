@@ -961,7 +961,18 @@ TSharedRef<SWidget> UT66ChallengesScreen::BuildSlateUI()
 			FMargin(28.f, 20.f, 28.f, 16.f));
 	};
 
-	auto MakeDraftStepRow = [this](const FString& Label, const int32 Value, const FOnClicked& OnMinus, const FOnClicked& OnPlus) -> TSharedRef<SWidget>
+	// Draft editor values are bound to DraftEditorEntry so step and cycle clicks update in place.
+	const TWeakObjectPtr<UT66ChallengesScreen> WeakScreen(this);
+	auto BindDraftValue = [WeakScreen](TFunction<FText(const UT66ChallengesScreen&)> Getter) -> TAttribute<FText>
+	{
+		return TAttribute<FText>::CreateLambda([WeakScreen, Getter = MoveTemp(Getter)]() -> FText
+		{
+			const UT66ChallengesScreen* Screen = WeakScreen.Get();
+			return Screen ? Getter(*Screen) : FText::GetEmpty();
+		});
+	};
+
+	auto MakeDraftStepRow = [this](const FString& Label, const TAttribute<FText>& Value, const FOnClicked& OnMinus, const FOnClicked& OnPlus) -> TSharedRef<SWidget>
 	{
 		return SNew(SHorizontalBox)
 			+ SHorizontalBox::Slot().FillWidth(1.f).VAlign(VAlign_Center)
@@ -978,7 +989,7 @@ TSharedRef<SWidget> UT66ChallengesScreen::BuildSlateUI()
 			+ SHorizontalBox::Slot().AutoWidth().Padding(8.f, 0.f)
 			[
 				SNew(STextBlock)
-				.Text(FText::AsNumber(Value))
+				.Text(Value)
 				.Font(FT66Style::Tokens::FontBold(12))
 				.ColorAndOpacity(ChallengeRewardTint())
 			]
@@ -988,7 +999,7 @@ TSharedRef<SWidget> UT66ChallengesScreen::BuildSlateUI()
 			];
 	};
 
-	auto MakeCycleRow = [this](const FString& Label, const FString& Value, const FOnClicked& OnPrev, const FOnClicked& OnNext) -> TSharedRef<SWidget>
+	auto MakeCycleRow = [this](const FString& Label, const TAttribute<FText>& Value, const FOnClicked& OnPrev, const FOnClicked& OnNext) -> TSharedRef<SWidget>
 	{
 		return SNew(SHorizontalBox)
 			+ SHorizontalBox::Slot().FillWidth(1.f).VAlign(VAlign_Center)
@@ -1005,7 +1016,7 @@ TSharedRef<SWidget> UT66ChallengesScreen::BuildSlateUI()
 			+ SHorizontalBox::Slot().AutoWidth().Padding(8.f, 0.f)
 			[
 				SNew(STextBlock)
-				.Text(FText::FromString(Value))
+				.Text(Value)
 				.Font(FT66Style::Tokens::FontBold(12))
 				.ColorAndOpacity(ChallengeRewardTint())
 			]
@@ -1129,7 +1140,7 @@ TSharedRef<SWidget> UT66ChallengesScreen::BuildSlateUI()
 			[
 				MakeDraftStepRow(
 					TEXT("Suggested Chad Coupons"),
-					DraftEditorEntry.SuggestedRewardChadCoupons,
+					BindDraftValue([](const UT66ChallengesScreen& Screen) { return FText::AsNumber(Screen.DraftEditorEntry.SuggestedRewardChadCoupons); }),
 					FOnClicked::CreateUObject(this, &UT66ChallengesScreen::HandleAdjustDraftReward, -5),
 					FOnClicked::CreateUObject(this, &UT66ChallengesScreen::HandleAdjustDraftReward, +5))
 			];
@@ -1147,7 +1158,7 @@ TSharedRef<SWidget> UT66ChallengesScreen::BuildSlateUI()
 		[
 			MakeDraftStepRow(
 				TEXT("Start Level"),
-				DraftEditorEntry.Rules.StartLevelOverride,
+				BindDraftValue([](const UT66ChallengesScreen& Screen) { return FText::AsNumber(Screen.DraftEditorEntry.Rules.StartLevelOverride); }),
 				FOnClicked::CreateUObject(this, &UT66ChallengesScreen::HandleAdjustDraftStartLevel, -1),
 				FOnClicked::CreateUObject(this, &UT66ChallengesScreen::HandleAdjustDraftStartLevel, +1))
 		];
@@ -1185,18 +1196,19 @@ TSharedRef<SWidget> UT66ChallengesScreen::BuildSlateUI()
 			TPair<FString, EDraftStatField>(TEXT("Speed"), EDraftStatField::Speed),
 		};
 
-		auto GetDraftStatValue = [this](const EDraftStatField Field)
+		auto GetDraftStatValue = [](const UT66ChallengesScreen& Screen, const EDraftStatField Field)
 		{
+			const auto& BonusStats = Screen.DraftEditorEntry.Rules.BonusStats;
 			switch (Field)
 			{
-			case EDraftStatField::Damage: return DraftEditorEntry.Rules.BonusStats.Damage;
-			case EDraftStatField::AttackSpeed: return DraftEditorEntry.Rules.BonusStats.AttackSpeed;
-			case EDraftStatField::AttackScale: return DraftEditorEntry.Rules.BonusStats.AttackScale;
-			case EDraftStatField::Accuracy: return DraftEditorEntry.Rules.BonusStats.Accuracy;
-			case EDraftStatField::Armor: return DraftEditorEntry.Rules.BonusStats.Armor;
-			case EDraftStatField::Evasion: return DraftEditorEntry.Rules.BonusStats.Evasion;
-			case EDraftStatField::Luck: return DraftEditorEntry.Rules.BonusStats.Luck;
-			case EDraftStatField::Speed: return DraftEditorEntry.Rules.BonusStats.Speed;
+			case EDraftStatField::Damage: return BonusStats.Damage;
+			case EDraftStatField::AttackSpeed: return BonusStats.AttackSpeed;
+			case EDraftStatField::AttackScale: return BonusStats.AttackScale;
+			case EDraftStatField::Accuracy: return BonusStats.Accuracy;
+			case EDraftStatField::Armor: return BonusStats.Armor;
+			case EDraftStatField::Evasion: return BonusStats.Evasion;
+			case EDraftStatField::Luck: return BonusStats.Luck;
+			case EDraftStatField::Speed: return BonusStats.Speed;
 			default: return 0;
 			}
 		};
@@ -1207,7 +1219,7 @@ TSharedRef<SWidget> UT66ChallengesScreen::BuildSlateUI()
 			[
 				MakeDraftStepRow(
 					StatField.Key,
-					GetDraftStatValue(StatField.Value),
+					BindDraftValue([GetDraftStatValue, Field = StatField.Value](const UT66ChallengesScreen& Screen) { return FText::AsNumber(GetDraftStatValue(Screen, Field)); }),
 					FOnClicked::CreateUObject(this, &UT66ChallengesScreen::HandleAdjustDraftStatClicked, StatField.Value, -5),
 					FOnClicked::CreateUObject(this, &UT66ChallengesScreen::HandleAdjustDraftStatClicked, StatField.Value, +5))
 			];
@@ -1217,7 +1229,7 @@ TSharedRef<SWidget> UT66ChallengesScreen::BuildSlateUI()
 		[
 			MakeCycleRow(
 				TEXT("Starting Item"),
-				GetItemLabel(DraftEditorEntry.Rules.StartingItemId),
+				BindDraftValue([](const UT66ChallengesScreen& Screen) { return FText::FromString(Screen.GetItemLabel(Screen.DraftEditorEntry.Rules.StartingItemId)); }),
 				FOnClicked::CreateUObject(this, &UT66ChallengesScreen::HandleCycleDraftStartingItemClicked, -1),
 				FOnClicked::CreateUObject(this, &UT66ChallengesScreen::HandleCycleDraftStartingItemClicked, +1))
 		];
@@ -1225,7 +1237,7 @@ TSharedRef<SWidget> UT66ChallengesScreen::BuildSlateUI()
 		[
 			MakeCycleRow(
 				TEXT("Passive Override"),
-				GetPassiveLabel(DraftEditorEntry.Rules.PassiveOverride),
+				BindDraftValue([](const UT66ChallengesScreen& Screen) { return FText::FromString(Screen.GetPassiveLabel(Screen.DraftEditorEntry.Rules.PassiveOverride)); }),
 				FOnClicked::CreateUObject(this, &UT66ChallengesScreen::HandleCycleDraftPassiveClicked, -1),
 				FOnClicked::CreateUObject(this, &UT66ChallengesScreen::HandleCycleDraftPassiveClicked, +1))
 		];
@@ -1233,7 +1245,7 @@ TSharedRef<SWidget> UT66ChallengesScreen::BuildSlateUI()
 		[
 			MakeCycleRow(
 				TEXT("Ultimate Override"),
-				GetUltimateLabel(DraftEditorEntry.Rules.UltimateOverride),
+				BindDraftValue([](const UT66ChallengesScreen& Screen) { return FText::FromString(Screen.GetUltimateLabel(Screen.DraftEditorEntry.Rules.UltimateOverride)); }),
 				FOnClicked::CreateUObject(this, &UT66ChallengesScreen::HandleCycleDraftUltimateClicked, -1),
 				FOnClicked::CreateUObject(this, &UT66ChallengesScreen::HandleCycleDraftUltimateClicked, +1))
 		];
@@ -1276,7 +1288,7 @@ TSharedRef<SWidget> UT66ChallengesScreen::BuildSlateUI()
 			[
 				MakeDraftStepRow(
 					TEXT("Minimum Stage Reached"),
-					DraftEditorEntry.Rules.RequiredStageReached,
+					BindDraftValue([](const UT66ChallengesScreen& Screen) { return FText::AsNumber(Screen.DraftEditorEntry.Rules.RequiredStageReached); }),
 					FOnClicked::CreateUObject(this, &UT66ChallengesScreen::HandleAdjustDraftRequiredStage, -1),
 					FOnClicked::CreateUObject(this, &UT66ChallengesScreen::HandleAdjustDraftRequiredStage, +1))
 			];
@@ -1284,7 +1296,7 @@ TSharedRef<SWidget> UT66ChallengesScreen::BuildSlateUI()
 			[
 				MakeDraftStepRow(
 					TEXT("Max Run Time (Seconds)"),
-					DraftEditorEntry.Rules.MaxRunTimeSeconds,
+					BindDraftValue([](const UT66ChallengesScreen& Screen) { return FText::AsNumber(Screen.DraftEditorEntry.Rules.MaxRunTimeSeconds); }),
 					FOnClicked::CreateUObject(this, &UT66ChallengesScreen::HandleAdjustDraftMaxRunTime, -30),
 					FOnClicked::CreateUObject(this, &UT66ChallengesScreen::HandleAdjustDraftMaxRunTime, +30))
 			];
@@ -1759,28 +1771,24 @@ FReply UT66ChallengesScreen::HandleCancelDraftEditorClicked()
 FReply UT66ChallengesScreen::HandleAdjustDraftReward(const int32 Delta)
 {
 	DraftEditorEntry.SuggestedRewardChadCoupons = T66CommunityContentLimits::ClampRewardChadCoupons(DraftEditorEntry.SuggestedRewardChadCoupons + Delta);
-	ForceRebuildSlate();
 	return FReply::Handled();
 }
 
 FReply UT66ChallengesScreen::HandleAdjustDraftStartLevel(const int32 Delta)
 {
 	DraftEditorEntry.Rules.StartLevelOverride = T66CommunityContentLimits::ClampStartLevelOverride(DraftEditorEntry.Rules.StartLevelOverride + Delta);
-	ForceRebuildSlate();
 	return FReply::Handled();
 }
 
 FReply UT66ChallengesScreen::HandleAdjustDraftRequiredStage(const int32 Delta)
 {
 	DraftEditorEntry.Rules.RequiredStageReached = T66CommunityContentLimits::ClampRequiredStageReached(DraftEditorEntry.Rules.RequiredStageReached + Delta);
-	ForceRebuildSlate();
 	return FReply::Handled();
 }
 
 FReply UT66ChallengesScreen::HandleAdjustDraftMaxRunTime(const int32 Delta)
 {
 	DraftEditorEntry.Rules.MaxRunTimeSeconds = T66CommunityContentLimits::ClampRunTimeSeconds(DraftEditorEntry.Rules.MaxRunTimeSeconds + Delta);
-	ForceRebuildSlate();
 	return FReply::Handled();
 }
 
@@ -1794,28 +1802,24 @@ FReply UT66ChallengesScreen::HandleToggleDraftMaxStats()
 FReply UT66ChallengesScreen::HandleAdjustDraftStatClicked(const EDraftStatField Field, const int32 Delta)
 {
 	AdjustDraftStat(Field, Delta);
-	ForceRebuildSlate();
 	return FReply::Handled();
 }
 
 FReply UT66ChallengesScreen::HandleCycleDraftPassiveClicked(const int32 Direction)
 {
 	CycleDraftPassive(Direction);
-	ForceRebuildSlate();
 	return FReply::Handled();
 }
 
 FReply UT66ChallengesScreen::HandleCycleDraftUltimateClicked(const int32 Direction)
 {
 	CycleDraftUltimate(Direction);
-	ForceRebuildSlate();
 	return FReply::Handled();
 }
 
 FReply UT66ChallengesScreen::HandleCycleDraftStartingItemClicked(const int32 Direction)
 {
 	CycleDraftStartingItem(Direction);
-	ForceRebuildSlate();
 	return FReply::Handled();
 }
 
@@ -606,28 +606,24 @@ void UT66DailyClimbScreen::RefreshContinueAvailability()
 	FDateTime BestTimestamp = FDateTime::MinValue();
 	for (int32 SlotIndex = 0; SlotIndex < UT66SaveSubsystem::MaxSlots; ++SlotIndex)
 	{
-		if (!SaveSub->DoesSlotExist(SlotIndex))
-		{
-			continue;
-		}
-
-		UT66RunSaveGame* Loaded = SaveSub->LoadFromSlot(SlotIndex);
-		if (!Loaded
-			|| !Loaded->bIsDailyClimbRun
-			|| !Loaded->DailyClimbChallenge.IsValid()
-			|| Loaded->DailyClimbChallenge.HasCompletedAttempt()
-			|| !Loaded->RunSnapshot.bValid)
+		// Index metadata only; HandleContinueClicked does the one full load.
+		const FT66SaveSlotMeta* Meta = SaveSub->GetOccupiedSlotMeta(SlotIndex);
+		if (!Meta
+			|| !Meta->bIsDailyClimbRun
+			|| Meta->DailyClimbChallengeId.IsEmpty()
+			|| Meta->bDailyClimbAttemptCompleted
+			|| !Meta->bHasValidRunSnapshot)
 		{
 			continue;
 		}
 
 		if (!ActiveChallengeId.IsEmpty()
-			&& !Loaded->DailyClimbChallenge.ChallengeId.Equals(ActiveChallengeId, ESearchCase::CaseSensitive))
+			&& !Meta->DailyClimbChallengeId.Equals(ActiveChallengeId, ESearchCase::CaseSensitive))
 		{
 			continue;
 		}
 
-		const FDateTime SaveTimestamp = ParseDailySaveTimestamp(Loaded->LastPlayedUtc);
+		const FDateTime SaveTimestamp = ParseDailySaveTimestamp(Meta->LastPlayedUtc);
 		if (ContinueSaveSlotIndex == INDEX_NONE || SaveTimestamp >= BestTimestamp)
 		{
 			ContinueSaveSlotIndex = SlotIndex;
@@ -65,14 +65,14 @@ FReply UT66HeroSelectionScreen::HandleTemporaryBuffSlotClicked(int32 SlotIndex)
 	}
 
 	bShowingTemporaryBuffPicker = true;
-	ForceRebuildSlate();
+	RequestViewRefresh();
 	return FReply::Handled();
 }
 
 FReply UT66HeroSelectionScreen::HandleTemporaryBuffPickerCloseClicked()
 {
 	bShowingTemporaryBuffPicker = false;
-	ForceRebuildSlate();
+	RequestViewRefresh();
 	return FReply::Handled();
 }
 
@@ -95,7 +95,7 @@ FReply UT66HeroSelectionScreen::HandleTemporaryBuffBuyClicked(ET66SecondaryStatT
 		{
 			if (Buffs->PurchaseSingleUseBuff(StatType))
 			{
-				ForceRebuildSlate();
+				RequestViewRefresh();
 			}
 		}
 	}
@@ -129,7 +129,7 @@ FReply UT66HeroSelectionScreen::HandleTemporaryBuffEquipClicked(ET66SecondarySta
 			if (OwnedCount > AssignedOutsideFocused && Buffs->SetSelectedSingleUseBuffSlot(SlotIndex, StatType))
 			{
 				bShowingTemporaryBuffPicker = false;
-				ForceRebuildSlate();
+				RequestViewRefresh();
 			}
 		}
 	}
@@ -157,7 +157,7 @@ FReply UT66HeroSelectionScreen::HandleClearTemporaryBuffsClicked()
 	}
 
 	bShowingTemporaryBuffPicker = false;
-	ForceRebuildSlate();
+	RequestViewRefresh();
 	return FReply::Handled();
 }
 
@@ -477,7 +477,7 @@ void UT66HeroSelectionScreen::OnEnterTribulationClicked()
 		if (!SessionSubsystem->IsLocalPlayerPartyHost())
 		{
 			SessionSubsystem->SetLocalLobbyReady(!SessionSubsystem->IsLocalLobbyReady());
-			ForceRebuildSlate();
+			RequestViewRefresh();
 			return;
 		}
 
@@ -485,7 +485,7 @@ void UT66HeroSelectionScreen::OnEnterTribulationClicked()
 		if (!SessionSubsystem->AreAllPartyMembersReadyForGameplay(&FailureReason))
 		{
 			UE_LOG(LogT66HeroSelection, Log, TEXT("%s"), *FailureReason);
-			ForceRebuildSlate();
+			RequestViewRefresh();
 			return;
 		}
 
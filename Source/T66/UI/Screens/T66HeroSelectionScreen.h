@@ -113,6 +113,7 @@ protected:
 	virtual void OnScreenDeactivated_Implementation() override;
 	virtual void RefreshScreen_Implementation() override;
 	virtual TSharedRef<SWidget> BuildSlateUI() override;
+	virtual bool RefreshBoundWidgets() override;
 
 private:
 	TArray<FName> AllHeroIDs;
@@ -155,6 +156,9 @@ private:
 	TArray<TSharedPtr<class SImage>> CompanionCarouselImageWidgets;
 	TArray<TSharedPtr<class STextBlock>> CompanionCarouselLabelWidgets;
 
+	/** Overlay host for the drug picker; filled and cleared in place by RefreshTemporaryBuffPicker(). */
+	TSharedPtr<SBox> TemporaryBuffPickerHost;
+
 	/** Skins list container; refreshed in place when Equip/Buy changes so buttons toggle without full rebuild. */
 	TSharedPtr<SVerticalBox> SkinsListBoxWidget;
 
@@ -213,6 +217,11 @@ private:
 	void RefreshSkinsList();
 	/** Add current PlaceholderSkins rows to the given vertical box (used by BuildSlateUI and RefreshSkinsList). */
 	void AddSkinRowsToBox(const TSharedPtr<SVerticalBox>& Box);
+	/** Rebuild the selected drug slot brushes from the buff subsystem; slot widgets read them through bindings. */
+	void RefreshSelectedTemporaryBuffBrushes();
+	/** Show, rebuild or hide the drug picker inside TemporaryBuffPickerHost to match bShowingTemporaryBuffPicker. */
+	void RefreshTemporaryBuffPicker();
+	TSharedRef<SWidget> BuildTemporaryBuffPickerModal();
 	bool IsShowingCompanionSkins() const;
 	void SetShowingCompanionSkins(bool bShowCompanionSkins);
 	bool IsShowingCompanionInfo() const;
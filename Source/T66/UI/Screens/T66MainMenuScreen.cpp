@@ -1756,16 +1756,25 @@ void UT66MainMenuScreen::NativeDestruct()
 void UT66MainMenuScreen::RefreshScreen_Implementation()
 {
 	Super::RefreshScreen_Implementation();
+	RequestViewRefresh();
 
-	if (ShouldRebuildRetainedSlate())
+	if (LeaderboardPanel.IsValid())
 	{
-		ForceRebuildSlate();
+		LeaderboardPanel->SetUIManager(UIManager);
 	}
+}
 
-	if (LeaderboardPanel.IsValid())
+bool UT66MainMenuScreen::RefreshBoundWidgets()
+{
+	// Friends, party roster, lobby state and account level are baked into the tree and still
+	// need a rebuild when they change; otherwise only the friend rows are refiltered.
+	if (ShouldRebuildRetainedSlate())
 	{
-		LeaderboardPanel->SetUIManager(UIManager);
+		return false;
 	}
+
+	RefreshFriendListVisualState();
+	return true;
 }
 
 void UT66MainMenuScreen::ReleaseRetainedSlateState()
@@ -1835,13 +1844,13 @@ void UT66MainMenuScreen::HandlePartyStateChanged()
 	}
 
 	SyncToSharedPartyScreen();
-	ForceRebuildSlate();
+	RequestViewRefresh();
 }
 
 void UT66MainMenuScreen::HandleSessionStateChanged()
 {
 	SyncToSharedPartyScreen();
-	ForceRebuildSlate();
+	RequestViewRefresh();
 }
 
 void UT66MainMenuScreen::HandleFriendSearchTextChanged(const FText& NewText)
@@ -2365,7 +2374,7 @@ FReply UT66MainMenuScreen::HandleLeavePartyClicked()
 		}
 	}
 
-	ForceRebuildSlate();
+	RequestViewRefresh();
 	return FReply::Handled();
 }
 
@@ -73,6 +73,7 @@ protected:
 	virtual void OnScreenDeactivated_Implementation() override;
 	virtual void NativeDestruct() override;
 	virtual void RefreshScreen_Implementation() override;
+	virtual bool RefreshBoundWidgets() override;
 	virtual TSharedRef<SWidget> RebuildWidget() override;
 	virtual TSharedRef<SWidget> BuildSlateUI() override;
 	virtual void NativeTick(const FGeometry& MyGeometry, float InDeltaTime) override;
@@ -726,6 +726,99 @@ namespace
 		return MakeShopImageBrush(OwnedBrushes, TexPool, Requester, BrushKey, SourceRelativePath, PackagePath, ObjectPath, ImageSize);
 	}
 
+	FText GetShopStatLabel(UT66LocalizationSubsystem* Loc, ET66HeroStatType Stat)
+	{
+		if (Loc)
+		{
+			switch (Stat)
+			{
+				case ET66HeroStatType::Damage:      return Loc->GetText_Stat_Damage();
+				case ET66HeroStatType::AttackSpeed: return Loc->GetText_Stat_AttackSpeed();
+				case ET66HeroStatType::AttackScale: return Loc->GetText_Stat_AttackScale();
+				case ET66HeroStatType::Accuracy:    return Loc->GetText_Stat_Accuracy();
+				case ET66HeroStatType::Armor:       return Loc->GetText_Stat_Armor();
+				case ET66HeroStatType::Evasion:     return Loc->GetText_Stat_Evasion();
+				case ET66HeroStatType::Luck:        return Loc->GetText_Stat_Luck();
+				default: break;
+			}
+		}
+		return NSLOCTEXT("T66.PowerUp", "StatUnknown", "?");
+	}
+
+	FText MakeShopUpperText(const FText& Text)
+	{
+		return FText::FromString(Text.ToString().ToUpper());
+	}
+
+	FString GetShopDiplomaAssetSlug(ET66HeroStatType StatType)
+	{
+		switch (StatType)
+		{
+			case ET66HeroStatType::Damage:      return TEXT("damage");
+			case ET66HeroStatType::AttackSpeed: return TEXT("attack_speed");
+			case ET66HeroStatType::AttackScale: return TEXT("attack_scale");
+			case ET66HeroStatType::Accuracy:    return TEXT("accuracy");
+			case ET66HeroStatType::Armor:       return TEXT("armor");
+			case ET66HeroStatType::Evasion:     return TEXT("evasion");
+			case ET66HeroStatType::Luck:        return TEXT("luck");
+			default: break;
+		}
+
+		return TEXT("damage");
+	}
+
+	FString GetShopDiplomaRankAssetName(int32 VisibleUnlockedSteps)
+	{
+		switch (VisibleUnlockedSteps)
+		{
+			case 1: return TEXT("bachelors");
+			case 2: return TEXT("masters");
+			case 3: return TEXT("phd");
+			case 4: return TEXT("magistrate");
+			default: break;
+		}
+
+		return TEXT("");
+	}
+
+	FString GetShopDiplomaImagePath(ET66HeroStatType StatType, int32 VisibleUnlockedSteps)
+	{
+		if (VisibleUnlockedSteps <= 0)
+		{
+			return TEXT("SourceAssets/UI/PowerUp/Diplomas/Generated/dropout_cardboard_box_imagegen_20260426.png");
+		}
+
+		return FString::Printf(
+			TEXT("SourceAssets/UI/PowerUp/Diplomas/Generated/%s_%s.png"),
+			*GetShopDiplomaAssetSlug(StatType),
+			*GetShopDiplomaRankAssetName(VisibleUnlockedSteps));
+	}
+
+	FText GetShopDiplomaRankTitle(UT66LocalizationSubsystem* Loc, ET66HeroStatType StatType, int32 VisibleUnlockedSteps)
+	{
+		const FText StatLabel = GetShopStatLabel(Loc, StatType);
+		switch (VisibleUnlockedSteps)
+		{
+			case 1:
+				return FText::Format(NSLOCTEXT("T66.PowerUp", "BachelorInStat", "BACHELOR'S IN {0}"), MakeShopUpperText(StatLabel));
+			case 2:
+				return FText::Format(NSLOCTEXT("T66.PowerUp", "MasterInStat", "MASTER'S IN {0}"), MakeShopUpperText(StatLabel));
+			case 3:
+				return FText::Format(NSLOCTEXT("T66.PowerUp", "PHDInStat", "PHD IN {0}"), MakeShopUpperText(StatLabel));
+			case 4:
+				return FText::Format(NSLOCTEXT("T66.PowerUp", "MagistrateInStat", "MAGISTRATE IN {0}"), MakeShopUpperText(StatLabel));
+			default:
+				break;
+		}
+
+		const FText DropoutProgram = StatType == ET66HeroStatType::Damage
+			? NSLOCTEXT("T66.PowerUp", "DiplomaDropoutProgramStrength", "STRENGTH")
+			: MakeShopUpperText(StatLabel);
+		return FText::Format(
+			NSLOCTEXT("T66.PowerUp", "DiplomaRankDropoutUniversity", "{0} UNIVERSITY DROPOUT"),
+			DropoutProgram);
+	}
+
 }
 
 UT66PowerUpScreen::UT66PowerUpScreen(const FObjectInitializer& ObjectInitializer)
@@ -738,10 +831,8 @@ UT66PowerUpScreen::UT66PowerUpScreen(const FObjectInitializer& ObjectInitializer
 void UT66PowerUpScreen::OnScreenActivated_Implementation()
 {
 	FString RequestedPowerUpTab;
-	bool bHasRequestedPowerUpTab = false;
 	if (FParse::Value(FCommandLine::Get(), TEXT("T66PowerUpTab="), RequestedPowerUpTab))
 	{
-		bHasRequestedPowerUpTab = true;
 		bShowingSingleUse =
 			RequestedPowerUpTab.Equals(TEXT("SingleUse"), ESearchCase::IgnoreCase)
 			|| RequestedPowerUpTab.Equals(TEXT("Single"), ESearchCase::IgnoreCase)
@@ -750,14 +841,7 @@ void UT66PowerUpScreen::OnScreenActivated_Implementation()
 
 	if (HasBuiltSlateUI() && !bNeedsWarmActivationRefresh)
 	{
-		if (bHasRequestedPowerUpTab)
-		{
-			ForceRebuildSlate();
-		}
-		else
-		{
-			SetShowingSingleUse(bShowingSingleUse);
-		}
+		SetShowingSingleUse(bShowingSingleUse);
 		return;
 	}
 
@@ -789,6 +873,10 @@ void UT66PowerUpScreen::SetShowingSingleUse(bool bInShowingSingleUse)
 	{
 		PageSwitcher->SetActiveWidgetIndex(bShowingSingleUse ? 1 : 0);
 	}
+	if (TabStripHost.IsValid())
+	{
+		TabStripHost->SetContent(BuildTabStrip());
+	}
 }
 
 FReply UT66PowerUpScreen::HandleBackClicked()
@@ -836,7 +924,207 @@ void UT66PowerUpScreen::RefreshScreen_Implementation()
 {
 	Super::RefreshScreen_Implementation();
 	bNeedsWarmActivationRefresh = false;
-	ForceRebuildSlate();
+	RequestViewRefresh();
+}
+
+bool UT66PowerUpScreen::RefreshBoundWidgets()
+{
+	if (!PageSwitcher.IsValid())
+	{
+		return false;
+	}
+
+	// Coupon costs are bound live; only the diploma panels bake their rank art and title.
+	for (const TPair<ET66HeroStatType, TSharedPtr<SBox>>& PanelHost : DiplomaPanelHosts)
+	{
+		if (PanelHost.Value.IsValid())
+		{
+			PanelHost.Value->SetContent(BuildPermanentStatPanel(PanelHost.Key));
+		}
+	}
+	return true;
+}
+
+int32 UT66PowerUpScreen::GetCouponBalance() const
+{
+	UGameInstance* GI = UGameplayStatics::GetGameInstance(this);
+	if (UT66AchievementsSubsystem* Achievements = GI ? GI->GetSubsystem<UT66AchievementsSubsystem>() : nullptr)
+	{
+		return Achievements->GetChadCouponBalance();
+	}
+	const UT66BuffSubsystem* Buffs = GetBuffSubsystem();
+	return Buffs ? Buffs->GetChadCouponBalance() : 0;
+}
+
+TSharedRef<SWidget> UT66PowerUpScreen::BuildTabStrip()
+{
+	const FText PermanentTabText = NSLOCTEXT("T66.PowerUp", "PermanentTab", "DIPLOMAS");
+	const FText SingleUseTabText = NSLOCTEXT("T66.PowerUp", "SingleUseTab", "DRUGS");
+
+	return SNew(SHorizontalBox)
+		+ SHorizontalBox::Slot().AutoWidth().Padding(0.f, 0.f, 8.f, 0.f)
+		[
+			MakeShopGeneratedButton(
+				FT66ButtonParams(PermanentTabText, FOnClicked::CreateUObject(this, &UT66PowerUpScreen::HandleShowPermanentClicked), ET66ButtonType::Primary)
+				.SetMinWidth(T66ScreenSlateHelpers::GetFrontendChromeMetrics().TabMinWidth)
+				.SetHeight(T66ScreenSlateHelpers::GetFrontendChromeMetrics().TabHeight)
+				.SetColor(!bShowingSingleUse ? T66PowerUpButtonFill() : T66PowerUpNeutralButtonFill()),
+				ResolveShopToggleButtonStyle(!bShowingSingleUse, true),
+				T66ScreenSlateHelpers::MakeFrontendChromeTabFont(),
+				!bShowingSingleUse ? T66PowerUpTabActiveText() : T66PowerUpTabInactiveText(),
+				T66ScreenSlateHelpers::GetFrontendChromeMetrics().TabPadding)
+		]
+		+ SHorizontalBox::Slot().AutoWidth()
+		[
+			MakeShopGeneratedButton(
+				FT66ButtonParams(SingleUseTabText, FOnClicked::CreateUObject(this, &UT66PowerUpScreen::HandleShowSingleUseClicked), ET66ButtonType::Neutral)
+				.SetMinWidth(T66ScreenSlateHelpers::GetFrontendChromeMetrics().TabMinWidth)
+				.SetHeight(T66ScreenSlateHelpers::GetFrontendChromeMetrics().TabHeight)
+				.SetColor(bShowingSingleUse ? T66PowerUpButtonFill() : T66PowerUpNeutralButtonFill()),
+				ResolveShopToggleButtonStyle(bShowingSingleUse, false),
+				T66ScreenSlateHelpers::MakeFrontendChromeTabFont(),
+				bShowingSingleUse ? T66PowerUpTabActiveText() : T66PowerUpTabInactiveText(),
+				T66ScreenSlateHelpers::GetFrontendChromeMetrics().TabPadding)
+		];
+}
+
+TSharedRef<SWidget> UT66PowerUpScreen::BuildPermanentStatPanel(ET66HeroStatType StatType)
+{
+	UT66LocalizationSubsystem* Loc = GetLocSubsystem();
+	UT66BuffSubsystem* Buffs = GetBuffSubsystem();
+	const int32 Cost = Buffs ? Buffs->GetCostForNextFillStepUnlock(StatType) : 0;
+	const int32 UnlockedSteps = Buffs ? Buffs->GetUnlockedFillStepCount(StatType) : 0;
+	const int32 VisibleUnlockedSteps = FMath::Clamp(UnlockedSteps, 0, ShopDiplomaUpgradeCount);
+	const bool bDiplomaMaxed = VisibleUnlockedSteps >= ShopDiplomaUpgradeCount;
+	const FText ButtonText = bDiplomaMaxed
+		? NSLOCTEXT("T66.PowerUp", "Max", "MAX")
+		: NSLOCTEXT("T66.PowerUp", "Graduate", "GRADUATE");
+	const FText CostText = FText::AsNumber(Cost);
+	const FSlateBrush* DiplomaBrush = ResolveShopGeneratedBrush(GetShopDiplomaImagePath(StatType, VisibleUnlockedSteps), FVector2D(244.f, 244.f));
+	const FSlateBrush* CouponBrush = ResolveShopGeneratedBrush(TEXT("SourceAssets/UI/MasterLibrary/Slices/IconsGenerated/icon_07_coupon_ticket_imagegen_20260425_v2.png"), FVector2D(30.f, 24.f));
+	const FText DiplomaTitle = GetShopDiplomaRankTitle(Loc, StatType, VisibleUnlockedSteps);
+	const TSharedRef<SWidget> DiplomaImageWidget = DiplomaBrush
+		? StaticCastSharedRef<SWidget>(
+			SNew(SBox)
+			.WidthOverride(244.f)
+			.HeightOverride(238.f)
+			.HAlign(HAlign_Center)
+			.VAlign(VAlign_Center)
+			[
+				SNew(SScaleBox)
+				.Stretch(EStretch::ScaleToFit)
+				[
+					SNew(SImage)
+					.Image(DiplomaBrush)
+				]
+			])
+		: StaticCastSharedRef<SWidget>(
+			SNew(SBox)
+			.WidthOverride(244.f)
+			.HeightOverride(238.f)
+			.HAlign(HAlign_Center)
+			.VAlign(VAlign_Center)
+			[
+				SNew(STextBlock)
+				.Text(NSLOCTEXT("T66.PowerUp", "MissingDiplomaArt", "DIPLOMA"))
+				.Font(ShopBoldFont(20))
+				.ColorAndOpacity(FT66Style::Tokens::TextMuted)
+			]);
+
+	return MakeShopGeneratedPanel(
+		MakeShopSettingsAssetPath(TEXT("settings_content_shell_frame.png")),
+		SNew(SVerticalBox)
+		+ SVerticalBox::Slot().AutoHeight().HAlign(HAlign_Center)
+		[
+			SNew(STextBlock)
+			.Text(DiplomaTitle)
+			.Font(ShopBoldFont(28))
+			.ColorAndOpacity(FT66Style::Tokens::Text)
+			.Justification(ETextJustify::Center)
+			.AutoWrapText(true)
+			.WrapTextAt(250.f)
+		]
+		+ SVerticalBox::Slot().AutoHeight().HAlign(HAlign_Center).Padding(0.f, 12.f, 0.f, 12.f)
+		[
+			DiplomaImageWidget
+		]
+		+ SVerticalBox::Slot().FillHeight(1.f)
+		[
+			SNew(SBox)
+			.MinDesiredHeight(20.f)
+		]
+		+ SVerticalBox::Slot().AutoHeight().Padding(0.f, 2.f, 0.f, 0.f)
+		[
+			SNew(STextBlock)
+			.Text(FText::Format(
+				NSLOCTEXT("T66.PowerUp", "PermanentEffectFormat", "+{0} {1}"),
+				FText::AsNumber(ShopDiplomaStatIncrease),
+				GetShopStatLabel(Loc, StatType)))
+			.Font(ShopRegularFont(16))
+			.ColorAndOpacity(ShopPermanentCardAccent)
+			.Justification(ETextJustify::Center)
+			.AutoWrapText(true)
+			.WrapTextAt(250.f)
+		]
+		+ SVerticalBox::Slot().AutoHeight().VAlign(VAlign_Bottom).Padding(0.f, 10.f, 0.f, 0.f)
+		[
+			MakeShopGeneratedButton(
+				FT66ButtonParams(ButtonText, FOnClicked::CreateUObject(this, &UT66PowerUpScreen::HandleUnlockClicked, StatType), ET66ButtonType::Primary)
+				.SetMinWidth(0.f)
+				.SetHeight(54.f)
+				.SetColor(TAttribute<FSlateColor>::CreateLambda([this, bDiplomaMaxed, Cost]() -> FSlateColor
+				{
+					if (bDiplomaMaxed)
+					{
+						return FSlateColor(T66PowerUpButtonFill());
+					}
+
+					return FSlateColor(GetCouponBalance() >= Cost ? T66PowerUpButtonFill() : T66PowerUpButtonDisabledFill());
+				}))
+				.SetEnabled(TAttribute<bool>::CreateLambda([this, bDiplomaMaxed, Cost]() { return !bDiplomaMaxed && GetCouponBalance() >= Cost; }))
+				.SetContent(
+					SNew(SBox)
+					.HAlign(HAlign_Center)
+					.VAlign(VAlign_Center)
+					[
+						SNew(SHorizontalBox)
+						+ SHorizontalBox::Slot().AutoWidth().VAlign(VAlign_Center)
+						[
+							SNew(STextBlock)
+							.Text(ButtonText)
+							.Font(ShopBoldFont(23))
+							.ColorAndOpacity(FT66Style::Tokens::Text)
+						]
+						+ SHorizontalBox::Slot().AutoWidth().VAlign(VAlign_Center).Padding(18.f, 0.f, 0.f, 0.f)
+						[
+							SNew(STextBlock)
+							.Text(CostText)
+							.Font(ShopBoldFont(21))
+							.ColorAndOpacity(ShopPermanentCardAccent)
+							.Visibility(bDiplomaMaxed ? EVisibility::Collapsed : EVisibility::Visible)
+						]
+						+ SHorizontalBox::Slot().AutoWidth().VAlign(VAlign_Center).Padding(8.f, 0.f, 0.f, 0.f)
+						[
+							SNew(SBox)
+							.WidthOverride(30.f)
+							.HeightOverride(24.f)
+							.Visibility(bDiplomaMaxed || !CouponBrush ? EVisibility::Collapsed : EVisibility::Visible)
+							[
+								SNew(SImage)
+								.Image(CouponBrush)
+							]
+						]
+					])
+				,
+				ResolveShopCompactButtonStyle(),
+				ShopBoldFont(23),
+				FT66Style::Tokens::Text,
+				FMargin(18.f, 10.f, 18.f, 8.f)
+			)
+		],
+		FMargin(20.f, 18.f, 20.f, 18.f),
+		FLinearColor::White,
+		ShopPermanentCardFill);
 }
 
 TSharedRef<SWidget> UT66PowerUpScreen::BuildSlateUI()
@@ -847,13 +1135,10 @@ TSharedRef<SWidget> UT66PowerUpScreen::BuildSlateUI()
 	UT66BuffSubsystem* Buffs = GetBuffSubsystem();
 	UWorld* World = GetWorld();
 	UGameInstance* GI = World ? World->GetGameInstance() : nullptr;
-	UT66AchievementsSubsystem* Achievements = GI ? GI->GetSubsystem<UT66AchievementsSubsystem>() : nullptr;
 	UT66UITexturePoolSubsystem* TexPool = GI ? GI->GetSubsystem<UT66UITexturePoolSubsystem>() : nullptr;
 	OwnedBrushes.Reset();
 
 	const int32 SingleUsePercent = FMath::RoundToInt((UT66BuffSubsystem::SingleUseSecondaryBuffMultiplier - 1.f) * 100.f);
-	const FText PermanentTabText = NSLOCTEXT("T66.PowerUp", "PermanentTab", "DIPLOMAS");
-	const FText SingleUseTabText = NSLOCTEXT("T66.PowerUp", "SingleUseTab", "DRUGS");
 	const FText PermanentHintText = FText::Format(
 		NSLOCTEXT("T66.PowerUp", "PermanentHint", "Graduate diplomas for permanent +{0} primary-stat upgrades across every run."),
 		FText::AsNumber(ShopDiplomaStatIncrease));
@@ -861,26 +1146,6 @@ TSharedRef<SWidget> UT66PowerUpScreen::BuildSlateUI()
 		NSLOCTEXT("T66.PowerUp", "SingleUseHint", "Buy drug cards for +{0}% secondary-stat boosts. Owned drugs can be equipped from Hero Selection, up to 4 total per run."),
 		FText::AsNumber(SingleUsePercent));
 
-	const int32 Balance = Achievements ? Achievements->GetChadCouponBalance() : (Buffs ? Buffs->GetChadCouponBalance() : 0);
-
-	auto GetStatLabel = [Loc](ET66HeroStatType Stat) -> FText
-	{
-		if (Loc)
-		{
-			switch (Stat)
-			{
-				case ET66HeroStatType::Damage:      return Loc->GetText_Stat_Damage();
-				case ET66HeroStatType::AttackSpeed: return Loc->GetText_Stat_AttackSpeed();
-				case ET66HeroStatType::AttackScale: return Loc->GetText_Stat_AttackScale();
-				case ET66HeroStatType::Accuracy:    return Loc->GetText_Stat_Accuracy();
-				case ET66HeroStatType::Armor:       return Loc->GetText_Stat_Armor();
-				case ET66HeroStatType::Evasion:     return Loc->GetText_Stat_Evasion();
-				case ET66HeroStatType::Luck:        return Loc->GetText_Stat_Luck();
-				default: break;
-			}
-		}
-		return NSLOCTEXT("T66.PowerUp", "StatUnknown", "?");
-	};
 	auto GetSecondaryLabel = [Loc](ET66SecondaryStatType StatType) -> FText
 	{
 		return Loc ? Loc->GetText_SecondaryStatName(StatType) : FText::FromString(TEXT("?"));
@@ -930,19 +1195,11 @@ TSharedRef<SWidget> UT66PowerUpScreen::BuildSlateUI()
 			GetSecondaryLabel(StatType));
 	};
 
-	auto GetPermanentEffectText = [&](ET66HeroStatType StatType) -> FText
-	{
-		return FText::Format(
-			NSLOCTEXT("T66.PowerUp", "PermanentEffectFormat", "+{0} {1}"),
-			FText::AsNumber(ShopDiplomaStatIncrease),
-			GetStatLabel(StatType));
-	};
-
 	auto GetDrugRowTitle = [&](ET66HeroStatType StatType) -> FText
 	{
 		return FText::Format(
 			NSLOCTEXT("T66.PowerUp", "DrugRowTitle", "{0} Drugs"),
-			GetStatLabel(StatType));
+			GetShopStatLabel(Loc, StatType));
 	};
 
 	struct FSingleUseRowDef
@@ -970,214 +1227,6 @@ TSharedRef<SWidget> UT66PowerUpScreen::BuildSlateUI()
 		ET66HeroStatType::Luck
 	};
 
-	auto MakeUpperText = [](const FText& Text) -> FText
-	{
-		return FText::FromString(Text.ToString().ToUpper());
-	};
-
-	auto GetDiplomaAssetSlug = [](ET66HeroStatType StatType) -> FString
-	{
-		switch (StatType)
-		{
-			case ET66HeroStatType::Damage:      return TEXT("damage");
-			case ET66HeroStatType::AttackSpeed: return TEXT("attack_speed");
-			case ET66HeroStatType::AttackScale: return TEXT("attack_scale");
-			case ET66HeroStatType::Accuracy:    return TEXT("accuracy");
-			case ET66HeroStatType::Armor:       return TEXT("armor");
-			case ET66HeroStatType::Evasion:     return TEXT("evasion");
-			case ET66HeroStatType::Luck:        return TEXT("luck");
-			default: break;
-		}
-
-		return TEXT("damage");
-	};
-
-	auto GetDiplomaRankAssetName = [](int32 VisibleUnlockedSteps) -> FString
-	{
-		switch (VisibleUnlockedSteps)
-		{
-			case 1: return TEXT("bachelors");
-			case 2: return TEXT("masters");
-			case 3: return TEXT("phd");
-			case 4: return TEXT("magistrate");
-			default: break;
-		}
-
-		return TEXT("");
-	};
-
-	auto GetDiplomaImagePath = [&](ET66HeroStatType StatType, int32 VisibleUnlockedSteps) -> FString
-	{
-		if (VisibleUnlockedSteps <= 0)
-		{
-			return TEXT("SourceAssets/UI/PowerUp/Diplomas/Generated/dropout_cardboard_box_imagegen_20260426.png");
-		}
-
-		return FString::Printf(
-			TEXT("SourceAssets/UI/PowerUp/Diplomas/Generated/%s_%s.png"),
-			*GetDiplomaAssetSlug(StatType),
-			*GetDiplomaRankAssetName(VisibleUnlockedSteps));
-	};
-
-	auto GetDiplomaRankTitle = [&](ET66HeroStatType StatType, int32 VisibleUnlockedSteps) -> FText
-	{
-		const FText StatLabel = GetStatLabel(StatType);
-		switch (VisibleUnlockedSteps)
-		{
-			case 1:
-				return FText::Format(NSLOCTEXT("T66.PowerUp", "BachelorInStat", "BACHELOR'S IN {0}"), MakeUpperText(StatLabel));
-			case 2:
-				return FText::Format(NSLOCTEXT("T66.PowerUp", "MasterInStat", "MASTER'S IN {0}"), MakeUpperText(StatLabel));
-			case 3:
-				return FText::Format(NSLOCTEXT("T66.PowerUp", "PHDInStat", "PHD IN {0}"), MakeUpperText(StatLabel));
-			case 4:
-				return FText::Format(NSLOCTEXT("T66.PowerUp", "MagistrateInStat", "MAGISTRATE IN {0}"), MakeUpperText(StatLabel));
-			default:
-				break;
-		}
-
-		const FText DropoutProgram = StatType == ET66HeroStatType::Damage
-			? NSLOCTEXT("T66.PowerUp", "DiplomaDropoutProgramStrength", "STRENGTH")
-			: MakeUpperText(StatLabel);
-		return FText::Format(
-			NSLOCTEXT("T66.PowerUp", "DiplomaRankDropoutUniversity", "{0} UNIVERSITY DROPOUT"),
-			DropoutProgram);
-	};
-
-	auto MakePermanentStatPanel = [&](ET66HeroStatType StatType) -> TSharedRef<SWidget>
-	{
-		const int32 Cost = Buffs ? Buffs->GetCostForNextFillStepUnlock(StatType) : 0;
-		const int32 UnlockedSteps = Buffs ? Buffs->GetUnlockedFillStepCount(StatType) : 0;
-		const int32 VisibleUnlockedSteps = FMath::Clamp(UnlockedSteps, 0, ShopDiplomaUpgradeCount);
-		const bool bDiplomaMaxed = VisibleUnlockedSteps >= ShopDiplomaUpgradeCount;
-		const FText ButtonText = bDiplomaMaxed
-			? NSLOCTEXT("T66.PowerUp", "Max", "MAX")
-			: NSLOCTEXT("T66.PowerUp", "Graduate", "GRADUATE");
-		const FText CostText = FText::AsNumber(Cost);
-		const FSlateBrush* DiplomaBrush = ResolveShopGeneratedBrush(GetDiplomaImagePath(StatType, VisibleUnlockedSteps), FVector2D(244.f, 244.f));
-		const FSlateBrush* CouponBrush = ResolveShopGeneratedBrush(TEXT("SourceAssets/UI/MasterLibrary/Slices/IconsGenerated/icon_07_coupon_ticket_imagegen_20260425_v2.png"), FVector2D(30.f, 24.f));
-		const FText DiplomaTitle = GetDiplomaRankTitle(StatType, VisibleUnlockedSteps);
-		const TSharedRef<SWidget> DiplomaImageWidget = DiplomaBrush
-			? StaticCastSharedRef<SWidget>(
-				SNew(SBox)
-				.WidthOverride(244.f)
-				.HeightOverride(238.f)
-				.HAlign(HAlign_Center)
-				.VAlign(VAlign_Center)
-				[
-					SNew(SScaleBox)
-					.Stretch(EStretch::ScaleToFit)
-					[
-						SNew(SImage)
-						.Image(DiplomaBrush)
-					]
-				])
-			: StaticCastSharedRef<SWidget>(
-				SNew(SBox)
-				.WidthOverride(244.f)
-				.HeightOverride(238.f)
-				.HAlign(HAlign_Center)
-				.VAlign(VAlign_Center)
-				[
-					SNew(STextBlock)
-					.Text(NSLOCTEXT("T66.PowerUp", "MissingDiplomaArt", "DIPLOMA"))
-					.Font(ShopBoldFont(20))
-					.ColorAndOpacity(FT66Style::Tokens::TextMuted)
-				]);
-
-		return MakeShopGeneratedPanel(
-			MakeShopSettingsAssetPath(TEXT("settings_content_shell_frame.png")),
-			SNew(SVerticalBox)
-			+ SVerticalBox::Slot().AutoHeight().HAlign(HAlign_Center)
-			[
-				SNew(STextBlock)
-				.Text(DiplomaTitle)
-				.Font(ShopBoldFont(28))
-				.ColorAndOpacity(FT66Style::Tokens::Text)
-				.Justification(ETextJustify::Center)
-				.AutoWrapText(true)
-				.WrapTextAt(250.f)
-			]
-			+ SVerticalBox::Slot().AutoHeight().HAlign(HAlign_Center).Padding(0.f, 12.f, 0.f, 12.f)
-			[
-				DiplomaImageWidget
-			]
-			+ SVerticalBox::Slot().FillHeight(1.f)
-			[
-				SNew(SBox)
-				.MinDesiredHeight(20.f)
-			]
-			+ SVerticalBox::Slot().AutoHeight().Padding(0.f, 2.f, 0.f, 0.f)
-			[
-				SNew(STextBlock)
-				.Text(GetPermanentEffectText(StatType))
-				.Font(ShopRegularFont(16))
-				.ColorAndOpacity(ShopPermanentCardAccent)
-				.Justification(ETextJustify::Center)
-				.AutoWrapText(true)
-				.WrapTextAt(250.f)
-			]
-			+ SVerticalBox::Slot().AutoHeight().VAlign(VAlign_Bottom).Padding(0.f, 10.f, 0.f, 0.f)
-			[
-				MakeShopGeneratedButton(
-					FT66ButtonParams(ButtonText, FOnClicked::CreateUObject(this, &UT66PowerUpScreen::HandleUnlockClicked, StatType), ET66ButtonType::Primary)
-					.SetMinWidth(0.f)
-					.SetHeight(54.f)
-					.SetColor(TAttribute<FSlateColor>::CreateLambda([bDiplomaMaxed, Balance, Cost]() -> FSlateColor
-					{
-						if (bDiplomaMaxed)
-						{
-							return FSlateColor(T66PowerUpButtonFill());
-						}
-
-						return FSlateColor(Balance >= Cost ? T66PowerUpButtonFill() : T66PowerUpButtonDisabledFill());
-					}))
-					.SetEnabled(TAttribute<bool>::CreateLambda([bDiplomaMaxed, Balance, Cost]() { return !bDiplomaMaxed && Balance >= Cost; }))
-					.SetContent(
-						SNew(SBox)
-						.HAlign(HAlign_Center)
-						.VAlign(VAlign_Center)
-						[
-							SNew(SHorizontalBox)
-							+ SHorizontalBox::Slot().AutoWidth().VAlign(VAlign_Center)
-							[
-								SNew(STextBlock)
-								.Text(ButtonText)
-								.Font(ShopBoldFont(23))
-								.ColorAndOpacity(FT66Style::Tokens::Text)
-							]
-							+ SHorizontalBox::Slot().AutoWidth().VAlign(VAlign_Center).Padding(18.f, 0.f, 0.f, 0.f)
-							[
-								SNew(STextBlock)
-								.Text(CostText)
-								.Font(ShopBoldFont(21))
-								.ColorAndOpacity(ShopPermanentCardAccent)
-								.Visibility(bDiplomaMaxed ? EVisibility::Collapsed : EVisibility::Visible)
-							]
-							+ SHorizontalBox::Slot().AutoWidth().VAlign(VAlign_Center).Padding(8.f, 0.f, 0.f, 0.f)
-							[
-								SNew(SBox)
-								.WidthOverride(30.f)
-								.HeightOverride(24.f)
-								.Visibility(bDiplomaMaxed || !CouponBrush ? EVisibility::Collapsed : EVisibility::Visible)
-								[
-									SNew(SImage)
-									.Image(CouponBrush)
-								]
-							]
-						])
-					,
-					ResolveShopCompactButtonStyle(),
-					ShopBoldFont(23),
-					FT66Style::Tokens::Text,
-					FMargin(18.f, 10.f, 18.f, 8.f)
-				)
-			],
-			FMargin(20.f, 18.f, 20.f, 18.f),
-			FLinearColor::White,
-			ShopPermanentCardFill);
-	};
-
 	auto MakeSingleUseSecondaryCard = [&](ET66SecondaryStatType StatType) -> TSharedRef<SWidget>
 	{
 		const int32 Cost = Buffs ? Buffs->GetSingleUseBuffCost() : UT66BuffSubsystem::SingleUseBuffCostCC;
@@ -1249,11 +1298,11 @@ TSharedRef<SWidget> UT66PowerUpScreen::BuildSlateUI()
 					FT66ButtonParams(NSLOCTEXT("T66.PowerUp", "BuySingleUse", "BUY"), FOnClicked::CreateUObject(this, &UT66PowerUpScreen::HandlePurchaseSingleUseClicked, StatType), ET66ButtonType::Primary)
 					.SetMinWidth(0.f)
 					.SetHeight(44.f)
-					.SetColor(TAttribute<FSlateColor>::CreateLambda([Balance, Cost]() -> FSlateColor
+					.SetColor(TAttribute<FSlateColor>::CreateLambda([this, Cost]() -> FSlateColor
 					{
-						return FSlateColor(Balance >= Cost ? T66PowerUpButtonFill() : T66PowerUpButtonDisabledFill());
+						return FSlateColor(GetCouponBalance() >= Cost ? T66PowerUpButtonFill() : T66PowerUpButtonDisabledFill());
 					}))
-					.SetEnabled(TAttribute<bool>::CreateLambda([Balance, Cost]() { return Balance >= Cost; }))
+					.SetEnabled(TAttribute<bool>::CreateLambda([this, Cost]() { return GetCouponBalance() >= Cost; }))
 					.SetContent(
 						SNew(SBox)
 						.HAlign(HAlign_Center)
@@ -1298,17 +1347,20 @@ TSharedRef<SWidget> UT66PowerUpScreen::BuildSlateUI()
 			T66PowerUpPanelFill());
 	};
 
+	DiplomaPanelHosts.Reset();
 	TSharedRef<SHorizontalBox> DiplomaColumns = SNew(SHorizontalBox);
 	for (int32 StatIndex = 0; StatIndex < PermanentCardOrder.Num(); ++StatIndex)
 	{
+		const ET66HeroStatType StatType = PermanentCardOrder[StatIndex];
+		TSharedPtr<SBox>& PanelHost = DiplomaPanelHosts.Add(StatType);
 		DiplomaColumns->AddSlot()
 			.AutoWidth()
 			.Padding(StatIndex > 0 ? FMargin(ShopCardGap, 0.f, 0.f, 0.f) : FMargin(0.f))
 			[
-				SNew(SBox)
+				SAssignNew(PanelHost, SBox)
 				.WidthOverride(300.f)
 				[
-					MakePermanentStatPanel(PermanentCardOrder[StatIndex])
+					BuildPermanentStatPanel(StatType)
 				]
 			];
 	}
@@ -1446,30 +1498,9 @@ TSharedRef<SWidget> UT66PowerUpScreen::BuildSlateUI()
 					]
 					+ SOverlay::Slot().HAlign(HAlign_Center).VAlign(VAlign_Center)
 					[
-						SNew(SHorizontalBox)
-						+ SHorizontalBox::Slot().AutoWidth().Padding(0.f, 0.f, 8.f, 0.f)
-						[
-							MakeShopGeneratedButton(
-								FT66ButtonParams(PermanentTabText, FOnClicked::CreateUObject(this, &UT66PowerUpScreen::HandleShowPermanentClicked), ET66ButtonType::Primary)
-								.SetMinWidth(T66ScreenSlateHelpers::GetFrontendChromeMetrics().TabMinWidth)
-								.SetHeight(T66ScreenSlateHelpers::GetFrontendChromeMetrics().TabHeight)
-								.SetColor(!bShowingSingleUse ? T66PowerUpButtonFill() : T66PowerUpNeutralButtonFill()),
-								ResolveShopToggleButtonStyle(!bShowingSingleUse, true),
-								T66ScreenSlateHelpers::MakeFrontendChromeTabFont(),
-								!bShowingSingleUse ? T66PowerUpTabActiveText() : T66PowerUpTabInactiveText(),
-								T66ScreenSlateHelpers::GetFrontendChromeMetrics().TabPadding)
-						]
-						+ SHorizontalBox::Slot().AutoWidth()
+						SAssignNew(TabStripHost, SBox)
 						[
-							MakeShopGeneratedButton(
-								FT66ButtonParams(SingleUseTabText, FOnClicked::CreateUObject(this, &UT66PowerUpScreen::HandleShowSingleUseClicked), ET66ButtonType::Neutral)
-								.SetMinWidth(T66ScreenSlateHelpers::GetFrontendChromeMetrics().TabMinWidth)
-								.SetHeight(T66ScreenSlateHelpers::GetFrontendChromeMetrics().TabHeight)
-								.SetColor(bShowingSingleUse ? T66PowerUpButtonFill() : T66PowerUpNeutralButtonFill()),
-								ResolveShopToggleButtonStyle(bShowingSingleUse, false),
-								T66ScreenSlateHelpers::MakeFrontendChromeTabFont(),
-								bShowingSingleUse ? T66PowerUpTabActiveText() : T66PowerUpTabInactiveText(),
-								T66ScreenSlateHelpers::GetFrontendChromeMetrics().TabPadding)
+							BuildTabStrip()
 						]
 					]
 				]
@@ -10,6 +10,7 @@
 
 class UT66LocalizationSubsystem;
 class UT66BuffSubsystem;
+class SBox;
 struct FSlateBrush;
 
 /**
@@ -27,15 +28,22 @@ protected:
 	virtual void OnScreenActivated_Implementation() override;
 	virtual TSharedRef<SWidget> BuildSlateUI() override;
 	virtual void RefreshScreen_Implementation() override;
+	virtual bool RefreshBoundWidgets() override;
 
 private:
 	UT66LocalizationSubsystem* GetLocSubsystem() const;
 	UT66BuffSubsystem* GetBuffSubsystem() const;
 	void SetShowingSingleUse(bool bInShowingSingleUse);
+	int32 GetCouponBalance() const;
+	TSharedRef<SWidget> BuildTabStrip();
+	TSharedRef<SWidget> BuildPermanentStatPanel(ET66HeroStatType StatType);
 
 	bool bShowingSingleUse = false;
 	bool bNeedsWarmActivationRefresh = false;
 	TSharedPtr<SWidgetSwitcher> PageSwitcher;
+	TSharedPtr<SBox> TabStripHost;
+	/** One host per diploma column, refilled in place after an unlock. */
+	TMap<ET66HeroStatType, TSharedPtr<SBox>> DiplomaPanelHosts;
 	TMap<FString, TSharedPtr<FSlateBrush>> OwnedBrushes;
 
 	FReply HandleBackClicked();
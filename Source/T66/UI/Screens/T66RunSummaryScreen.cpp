@@ -768,46 +768,20 @@ void UT66RunSummaryScreen::ProcessRunSummaryLeaderboardSubmission(const bool bTr
 			return;
 		}
 
-		UT66LeaderboardRunSummarySaveGame* Snapshot = nullptr;
-		if (bSavedSnapshot && !SavedRunSummarySlotName.IsEmpty())
+		if (!bSavedSnapshot || SavedRunSummarySlotName.IsEmpty())
 		{
-			if (USaveGame* LoadedSnapshot = UGameplayStatics::LoadGameFromSlot(SavedRunSummarySlotName, 0))
-			{
-				Snapshot = Cast<UT66LeaderboardRunSummarySaveGame>(LoadedSnapshot);
-			}
-		}
-
-		if (!Snapshot)
-		{
-			UE_LOG(LogT66RunSummary, Warning, TEXT("Run Summary: Daily Climb submission skipped because the run summary snapshot could not be loaded."));
+			UE_LOG(LogT66RunSummary, Warning, TEXT("Run Summary: Daily Climb submission skipped because the run summary snapshot could not be saved."));
 			bAwaitingBackendRankData = false;
 			ResolveChadCouponsPopupForLiveRun(false);
 			bLiveRunSubmissionProcessed = true;
 			return;
 		}
 
-		const FString DisplayName = !T66GI->CurrentRunOwnerDisplayName.IsEmpty()
-			? T66GI->CurrentRunOwnerDisplayName
-			: TEXT("Player");
-		const FString DailyRequestKey = FString::Printf(TEXT("daily_submit_%s"), *T66GI->ActiveDailyClimbChallenge.ChallengeId);
-
-		Backend->SubmitDailyClimbRun(
-			DisplayName,
-			Snapshot,
-			T66GI->ActiveDailyClimbChallenge.ChallengeId,
-			T66GI->ActiveDailyClimbChallenge.AttemptId,
-			DailyRequestKey);
-
-		UE_LOG(
-			LogT66RunSummary,
-			Log,
-			TEXT("Run Summary: submitted Daily Climb result snapshotSaved=%d slot=%s challenge=%s attempt=%s stage=%d score=%d"),
-			bSavedSnapshot ? 1 : 0,
-			SavedRunSummarySlotName.IsEmpty() ? TEXT("<none>") : *SavedRunSummarySlotName,
-			*T66GI->ActiveDailyClimbChallenge.ChallengeId,
-			*T66GI->ActiveDailyClimbChallenge.AttemptId,
-			RunState->GetCurrentStage(),
-			RunState->GetCurrentScore());
+		// The submission needs the full snapshot; read the slot back off the game thread and submit when it lands.
+		UGameplayStatics::AsyncLoadGameFromSlot(
+			SavedRunSummarySlotName,
+			0,
+			FAsyncLoadGameFromSlotDelegate::CreateUObject(this, &UT66RunSummaryScreen::HandleDailyClimbSnapshotLoaded));
 
 		bNewPersonalBestScore = false;
 		bNewPersonalBestTime = false;
@@ -861,6 +835,51 @@ void UT66RunSummaryScreen::ProcessRunSummaryLeaderboardSubmission(const bool bTr
 	bLiveRunSubmissionProcessed = true;
 }
 
+void UT66RunSummaryScreen::HandleDailyClimbSnapshotLoaded(const FString& SlotName, const int32 UserIndex, USaveGame* LoadedGame)
+{
+	static_cast<void>(UserIndex);
+	if (bViewingSavedLeaderboardRunSummary || !bDailyClimbSummaryMode)
+	{
+		return;
+	}
+
+	UGameInstance* GI = GetWorld() ? GetWorld()->GetGameInstance() : nullptr;
+	UT66RunStateSubsystem* RunState = GI ? GI->GetSubsystem<UT66RunStateSubsystem>() : nullptr;
+	UT66BackendSubsystem* Backend = GI ? GI->GetSubsystem<UT66BackendSubsystem>() : nullptr;
+	UT66GameInstance* T66GI = GI ? Cast<UT66GameInstance>(GI) : nullptr;
+	UT66LeaderboardRunSummarySaveGame* Snapshot = Cast<UT66LeaderboardRunSummarySaveGame>(LoadedGame);
+	if (!Snapshot || !RunState || !Backend || !T66GI || !T66GI->ActiveDailyClimbChallenge.IsValid())
+	{
+		UE_LOG(LogT66RunSummary, Warning, TEXT("Run Summary: Daily Climb submission skipped because the run summary snapshot could not be loaded."));
+		bAwaitingBackendRankData = false;
+		ResolveChadCouponsPopupForLiveRun(false);
+		ForceRebuildSlate();
+		return;
+	}
+
+	const FString DisplayName = !T66GI->CurrentRunOwnerDisplayName.IsEmpty()
+		? T66GI->CurrentRunOwnerDisplayName
+		: TEXT("Player");
+	const FString DailyRequestKey = FString::Printf(TEXT("daily_submit_%s"), *T66GI->ActiveDailyClimbChallenge.ChallengeId);
+
+	Backend->SubmitDailyClimbRun(
+		DisplayName,
+		Snapshot,
+		T66GI->ActiveDailyClimbChallenge.ChallengeId,
+		T66GI->ActiveDailyClimbChallenge.AttemptId,
+		DailyRequestKey);
+
+	UE_LOG(
+		LogT66RunSummary,
+		Log,
+		TEXT("Run Summary: submitted Daily Climb result slot=%s challenge=%s attempt=%s stage=%d score=%d"),
+		*SlotName,
+		*T66GI->ActiveDailyClimbChallenge.ChallengeId,
+		*T66GI->ActiveDailyClimbChallenge.AttemptId,
+		RunState->GetCurrentStage(),
+		RunState->GetCurrentScore());
+}
+
 void UT66RunSummaryScreen::ProcessLiveRunFinalSubmission()
 {
 	if (bLiveRunFinalAccountingProcessed || bViewingSavedLeaderboardRunSummary)
@@ -1052,6 +1071,8 @@ void UT66RunSummaryScreen::ResetSavedRunSummaryViewerState()
 	bViewingSavedLeaderboardRunSummary = false;
 	LoadedSavedSummary = nullptr;
 	LoadedSavedSummarySlotName.Reset();
+	bSavedSummarySnapshotPending = false;
+	++SavedSummaryLoadGeneration;
 	bLogVisible = false;
 	bReportPromptVisible = false;
 	ReportReasonTextBox.Reset();
@@ -1081,21 +1102,32 @@ bool UT66RunSummaryScreen::LoadSavedRunSummaryIfRequested()
 			return true;
 		}
 
-		USaveGame* Loaded = UGameplayStatics::LoadGameFromSlot(SlotName, 0);
-		LoadedSavedSummary = Cast<UT66LeaderboardRunSummarySaveGame>(Loaded);
-		if (LoadedSavedSummary)
+		// Open straight away from the header index; stats, inventory, the event log and proof of run
+		// fill in when the full slot finishes loading in the background.
+		UT66LeaderboardRunSummarySaveGame* HeaderSummary = NewObject<UT66LeaderboardRunSummarySaveGame>(this, NAME_None, RF_Transient);
+		FT66RunSummaryHeader Header;
+		if (LB->GetRunSummaryHeader(SlotName, Header))
 		{
-			LoadedSavedSummary->HeroID = T66MigrateHeroIDFromSave(LoadedSavedSummary->HeroID);
-			bViewingSavedLeaderboardRunSummary = true;
-			LoadedSavedSummarySlotName = SlotName;
-
-			// Proof-of-run fields are schema-versioned. If not present, default to empty/unlocked.
-			if (LoadedSavedSummary->SchemaVersion >= 3)
-			{
-				ProofOfRunUrl = LoadedSavedSummary->ProofOfRunUrl;
-				bProofOfRunLocked = LoadedSavedSummary->bProofOfRunLocked;
-			}
+			HeaderSummary->RunEndedAtUtc = Header.EndedAtUtc;
+			HeaderSummary->Difficulty = Header.Difficulty;
+			HeaderSummary->PartySize = Header.PartySize;
+			HeaderSummary->HeroID = T66MigrateHeroIDFromSave(Header.HeroID);
+			HeaderSummary->CompanionID = Header.CompanionID;
+			HeaderSummary->Score = Header.Score;
+			HeaderSummary->StageReached = Header.StageReached;
+			HeaderSummary->RunDurationSeconds = Header.DurationSeconds;
+			HeaderSummary->bWasFullClear = Header.bWasFullClear;
+			HeaderSummary->bWasSpeedRunMode = Header.bWasSpeedRunMode;
 		}
+
+		LoadedSavedSummary = HeaderSummary;
+		bViewingSavedLeaderboardRunSummary = true;
+		LoadedSavedSummarySlotName = SlotName;
+		bSavedSummarySnapshotPending = true;
+		UGameplayStatics::AsyncLoadGameFromSlot(
+			SlotName,
+			0,
+			FAsyncLoadGameFromSlotDelegate::CreateUObject(this, &UT66RunSummaryScreen::HandleSavedRunSummarySlotLoaded, SavedSummaryLoadGeneration));
 		return true;
 	}
 
@@ -1118,6 +1150,39 @@ bool UT66RunSummaryScreen::LoadSavedRunSummaryIfRequested()
 	return false;
 }
 
+void UT66RunSummaryScreen::HandleSavedRunSummarySlotLoaded(const FString& SlotName, const int32 UserIndex, USaveGame* LoadedGame, const int32 LoadGeneration)
+{
+	static_cast<void>(UserIndex);
+	if (!bSavedSummarySnapshotPending || LoadGeneration != SavedSummaryLoadGeneration || SlotName != LoadedSavedSummarySlotName)
+	{
+		return;
+	}
+
+	bSavedSummarySnapshotPending = false;
+	UT66LeaderboardRunSummarySaveGame* Snapshot = Cast<UT66LeaderboardRunSummarySaveGame>(LoadedGame);
+	if (!Snapshot)
+	{
+		UE_LOG(LogT66RunSummary, Warning, TEXT("Run Summary: saved slot %s could not be loaded; showing its indexed header only."), *SlotName);
+		return;
+	}
+
+	Snapshot->HeroID = T66MigrateHeroIDFromSave(Snapshot->HeroID);
+	LoadedSavedSummary = Snapshot;
+
+	// Proof-of-run fields are schema-versioned. If not present, default to empty/unlocked.
+	if (LoadedSavedSummary->SchemaVersion >= 3)
+	{
+		ProofOfRunUrl = LoadedSavedSummary->ProofOfRunUrl;
+		bProofOfRunLocked = LoadedSavedSummary->bProofOfRunLocked;
+	}
+
+	if (IsInViewport())
+	{
+		EnsurePreviewCaptures();
+	}
+	ForceRebuildSlate();
+}
+
 TSharedRef<SWidget> UT66RunSummaryScreen::RebuildWidget()
 {
 	// Critical: Slate is built before OnScreenActivated() (AddToViewport/TakeWidget).
@@ -2581,6 +2646,12 @@ FReply UT66RunSummaryScreen::HandleMainMenuClicked() { OnMainMenuClicked(); retu
 FReply UT66RunSummaryScreen::HandleViewLogClicked() { OnViewLogClicked(); return FReply::Handled(); }
 FReply UT66RunSummaryScreen::HandleProofConfirmClicked()
 {
+	// Persisting now would write the header-only placeholder over the real slot.
+	if (bSavedSummarySnapshotPending)
+	{
+		return FReply::Handled();
+	}
+
 	const FString Url = ProofUrlTextBox.IsValid() ? ProofUrlTextBox->GetText().ToString() : ProofOfRunUrl;
 	ProofOfRunUrl = Url;
 	ProofOfRunUrl.TrimStartAndEndInline();
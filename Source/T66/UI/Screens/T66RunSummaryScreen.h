@@ -77,6 +77,8 @@ private:
 	void ProcessLiveRunFinalAccounting();
 	void ProcessLiveRunFinalSubmission();
 	void ResetSavedRunSummaryViewerState();
+	void HandleSavedRunSummarySlotLoaded(const FString& SlotName, int32 UserIndex, USaveGame* LoadedGame, int32 LoadGeneration);
+	void HandleDailyClimbSnapshotLoaded(const FString& SlotName, int32 UserIndex, USaveGame* LoadedGame);
 	bool SaveCurrentRunToSlot(bool bFromDifficultyClearSummary);
 
 	void RebuildLogItems();
@@ -134,6 +136,12 @@ private:
 	/** Save slot name associated with LoadedSavedSummary (needed to persist proof edits). */
 	FString LoadedSavedSummarySlotName;
 
+	/** True while LoadedSavedSummary only holds the indexed header fields and the full slot is still loading. */
+	bool bSavedSummarySnapshotPending = false;
+
+	/** Bumped on every viewer reset so a slot load that lands late cannot overwrite a newer summary. */
+	int32 SavedSummaryLoadGeneration = 0;
+
 	// Virtualized log list (prevents building a widget per entry).
 	TArray<TSharedPtr<FString>> LogItems;
 	TSharedPtr<SListView<TSharedPtr<FString>>> LogListView;
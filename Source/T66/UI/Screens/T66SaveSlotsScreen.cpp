@@ -390,28 +390,24 @@ namespace
 		}
 	}
 
-	void T66BuildSavedPartyPlayers(const UT66RunSaveGame* Loaded, TArray<FT66SavedPartyPlayerState>& OutPlayers)
+	void T66BuildSavedPartyPlayers(const FT66SaveSlotMeta* Meta, TArray<FT66SavedPartyPlayerState>& OutPlayers)
 	{
 		OutPlayers.Reset();
-		if (!Loaded)
+		if (!Meta)
 		{
 			return;
 		}
 
-		if (Loaded->SavedPartyPlayers.Num() > 0)
+		OutPlayers.Reserve(Meta->PartyMembers.Num());
+		for (const FT66SaveSlotPartyMemberMeta& Member : Meta->PartyMembers)
 		{
-			OutPlayers = Loaded->SavedPartyPlayers;
-			return;
+			FT66SavedPartyPlayerState& Player = OutPlayers.AddDefaulted_GetRef();
+			Player.PlayerId = Member.PlayerId;
+			Player.DisplayName = Member.DisplayName;
+			Player.HeroID = Member.HeroID;
+			Player.HeroBodyType = Member.HeroBodyType;
+			Player.bIsPartyHost = Member.bIsPartyHost;
 		}
-
-		FT66SavedPartyPlayerState& HostPlayer = OutPlayers.AddDefaulted_GetRef();
-		HostPlayer.PlayerId = Loaded->OwnerPlayerId;
-		HostPlayer.DisplayName = Loaded->OwnerDisplayName;
-		HostPlayer.HeroID = Loaded->HeroID;
-		HostPlayer.HeroBodyType = Loaded->HeroBodyType;
-		HostPlayer.CompanionID = Loaded->CompanionID;
-		HostPlayer.PlayerTransform = Loaded->PlayerTransform;
-		HostPlayer.bIsPartyHost = true;
 	}
 
 	FString T66BuildDateString(const FString& LastPlayedUtc)
@@ -463,6 +459,80 @@ UT66SaveSlotsScreen::UT66SaveSlotsScreen(const FObjectInitializer& ObjectInitial
 }
 
 TSharedRef<SWidget> UT66SaveSlotsScreen::BuildSlateUI()
+{
+	UT66GameInstance* GI = Cast<UT66GameInstance>(UGameplayStatics::GetGameInstance(this));
+	UT66LocalizationSubsystem* Loc = GI ? GI->GetSubsystem<UT66LocalizationSubsystem>() : nullptr;
+	const FText LoadGameTitleText = NSLOCTEXT("T66.SaveSlots", "LoadGameTitle", "LOAD GAME");
+	const FText BackText = Loc ? Loc->GetText_Back() : NSLOCTEXT("T66.Common", "Back", "BACK");
+	const FVector2D SafeFrameSize = FT66Style::GetSafeFrameSize();
+	const float SurfaceWidth = FMath::Max(1040.f, SafeFrameSize.X - 40.f);
+	const FMargin SurfacePadding(28.f, 22.f, 28.f, 24.f);
+
+	return SNew(SOverlay)
+		+ SOverlay::Slot()
+		.HAlign(HAlign_Fill)
+		.VAlign(VAlign_Fill)
+		[
+			MakeSaveFlowBackground()
+		]
+		+ SOverlay::Slot()
+		.HAlign(HAlign_Center)
+		.VAlign(VAlign_Fill)
+		.Padding(FMargin(20.f, 26.f, 20.f, 24.f))
+		[
+			SNew(SBox)
+			.WidthOverride(SurfaceWidth)
+			[
+				MakeSaveFlowShell(
+					SNew(SVerticalBox)
+					+ SVerticalBox::Slot()
+					.AutoHeight()
+					.Padding(0.f, 0.f, 0.f, 16.f)
+					[
+						SNew(SHorizontalBox)
+						+ SHorizontalBox::Slot()
+						.AutoWidth()
+						.VAlign(VAlign_Center)
+						[
+							MakeSaveFlowPlateButton(
+								FT66ButtonParams(BackText, FOnClicked::CreateUObject(this, &UT66SaveSlotsScreen::HandleBackClicked), ET66ButtonType::Neutral)
+								.SetMinWidth(124.f)
+								.SetHeight(T66SaveFlowActionHeight)
+								.SetFontSize(22),
+								true)
+						]
+						+ SHorizontalBox::Slot()
+						.FillWidth(1.f)
+						.HAlign(HAlign_Center)
+						.VAlign(VAlign_Center)
+						[
+							SNew(STextBlock)
+							.Text(LoadGameTitleText)
+							.Font(FT66Style::Tokens::FontBold(48))
+							.ColorAndOpacity(T66SaveFlowGoldText())
+							.Justification(ETextJustify::Center)
+						]
+						+ SHorizontalBox::Slot()
+						.AutoWidth()
+						[
+							SNew(SBox)
+							.WidthOverride(124.f)
+						]
+					]
+					+ SVerticalBox::Slot()
+					.FillHeight(1.f)
+					[
+						SAssignNew(PageBodyHost, SBox)
+						[
+							BuildSlotPageBody()
+						]
+					],
+					SurfacePadding)
+			]
+		];
+}
+
+TSharedRef<SWidget> UT66SaveSlotsScreen::BuildSlotPageBody()
 {
 	UT66GameInstance* GI = Cast<UT66GameInstance>(UGameplayStatics::GetGameInstance(this));
 	UT66SaveSubsystem* SaveSub = GI ? GI->GetSubsystem<UT66SaveSubsystem>() : nullptr;
@@ -478,8 +548,6 @@ TSharedRef<SWidget> UT66SaveSlotsScreen::BuildSlateUI()
 
 	const FText PreviewText = Loc ? Loc->GetText_Preview() : NSLOCTEXT("T66.Common", "Preview", "PREVIEW");
 	const FText LoadText = NSLOCTEXT("T66.SaveSlots", "Load", "LOAD");
-	const FText LoadGameTitleText = NSLOCTEXT("T66.SaveSlots", "LoadGameTitle", "LOAD GAME");
-	const FText BackText = Loc ? Loc->GetText_Back() : NSLOCTEXT("T66.Common", "Back", "BACK");
 	const FText PrevText = NSLOCTEXT("T66.SaveSlots", "PrevPage", "PREV");
 	const FText NextText = NSLOCTEXT("T66.SaveSlots", "NextPage", "NEXT");
 	const FText EmptySlotText = NSLOCTEXT("T66.SaveSlots", "EmptySlot", "Empty Slot");
@@ -713,10 +781,11 @@ TSharedRef<SWidget> UT66SaveSlotsScreen::BuildSlateUI()
 		}
 
 		const bool bHasVisibleSave = PageSlotHasVisibleSave.IsValidIndex(LocalIndex) && PageSlotHasVisibleSave[LocalIndex];
-		UT66RunSaveGame* Loaded = (bHasVisibleSave && SaveSub) ? SaveSub->LoadFromSlot(SlotIndex) : nullptr;
+		// Cards are rebuilt on every page flip; they only ever read the save index.
+		const FT66SaveSlotMeta* Meta = (bHasVisibleSave && SaveSub) ? SaveSub->GetOccupiedSlotMeta(SlotIndex) : nullptr;
 
 		TArray<FT66SavedPartyPlayerState> SavedPlayers;
-		T66BuildSavedPartyPlayers(Loaded, SavedPlayers);
+		T66BuildSavedPartyPlayers(Meta, SavedPlayers);
 
 		for (int32 PartyIndex = 0; PartyIndex < MaxPartyPreviewSlots; ++PartyIndex)
 		{
@@ -761,9 +830,9 @@ TSharedRef<SWidget> UT66SaveSlotsScreen::BuildSlateUI()
 			}
 		}
 
-		const bool bHasRunData = Loaded != nullptr;
+		const bool bHasRunData = Meta != nullptr;
 		const int32 RequiredPartyCount = bHasRunData
-			? FMath::Max(1, SavedPlayers.Num() > 0 ? SavedPlayers.Num() : T66PartySizeToMemberCount(Loaded->PartySize))
+			? FMath::Max(1, SavedPlayers.Num() > 0 ? SavedPlayers.Num() : T66PartySizeToMemberCount(Meta->PartySize))
 			: 1;
 		const bool bPartyCountMatches = CurrentPartyCount == RequiredPartyCount;
 		const bool bCanLoad = bHasRunData && bHostCanStartPartyLoad && bPartyCountMatches;
@@ -772,20 +841,20 @@ TSharedRef<SWidget> UT66SaveSlotsScreen::BuildSlateUI()
 			: (bCanLoad
 			? FText::Format(
 				NSLOCTEXT("T66.SaveSlots", "DifficultyParty", "{0} / {1}"),
-				T66DifficultyText(Loc, Loaded->Difficulty),
-				T66PartySizeText(Loc, Loaded->PartySize))
+				T66DifficultyText(Loc, Meta->Difficulty),
+				T66PartySizeText(Loc, Meta->PartySize))
 			: FText::Format(
 				NSLOCTEXT("T66.SaveSlots", "RequiresParty", "Requires {0} party"),
-				T66PartySizeText(Loc, Loaded->PartySize)));
+				T66PartySizeText(Loc, Meta->PartySize)));
 		const bool bIsSelected = bHasRunData && GI && GI->CurrentSaveSlotIndex == SlotIndex;
 		const FText StageText = bHasRunData
-			? FText::Format(NSLOCTEXT("T66.SaveSlots", "StageLabel", "Stage {0}"), FText::AsNumber(Loaded->StageReached))
+			? FText::Format(NSLOCTEXT("T66.SaveSlots", "StageLabel", "Stage {0}"), FText::AsNumber(Meta->StageReached))
 			: StagePlaceholderText;
 		const FText DateText = bHasRunData
-			? FText::FromString(T66BuildDateString(Loaded->LastPlayedUtc))
+			? FText::FromString(T66BuildDateString(Meta->LastPlayedUtc))
 			: DatePlaceholderText;
 		const FText TimeText = bHasRunData
-			? FText::FromString(T66BuildTimeString(Loaded->LastPlayedUtc))
+			? FText::FromString(T66BuildTimeString(Meta->LastPlayedUtc))
 			: TimePlaceholderText;
 
 		TSharedRef<SHorizontalBox> PartyRow = SNew(SHorizontalBox);
@@ -936,133 +1005,79 @@ TSharedRef<SWidget> UT66SaveSlotsScreen::BuildSlateUI()
 	const bool bCanGoPrev = CurrentPage > 0;
 	const bool bCanGoNext = CurrentPage < TotalPages - 1;
 
-	return SNew(SOverlay)
-		+ SOverlay::Slot()
-		.HAlign(HAlign_Fill)
-		.VAlign(VAlign_Fill)
+	return SNew(SVerticalBox)
+		+ SVerticalBox::Slot()
+		.AutoHeight()
 		[
-			MakeSaveFlowBackground()
+			SNew(SHorizontalBox)
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.Padding(132.f, 0.f, 0.f, 0.f)
+			[
+				MakeSaveFlowDropdown(
+					FT66DropdownParams(
+						SNew(STextBlock)
+						.Text(T66PartySizeText(Loc, ActivePartySizeFilter))
+						.Font(FT66Style::Tokens::FontBold(16))
+						.ColorAndOpacity(T66SaveFlowBrightText()),
+						MakePartySizeMenu)
+					.SetMinWidth(156.f)
+					.SetHeight(38.f)
+					.SetPadding(FMargin(12.f, 8.f)))
+			]
+			+ SHorizontalBox::Slot()
+			.FillWidth(1.f)
+			.VAlign(VAlign_Center)
+			.Padding(16.f, 0.f, 0.f, 0.f)
+			[
+				SNew(STextBlock)
+				.Text(FilterHintText)
+				.Font(FT66Style::Tokens::FontRegular(15))
+				.ColorAndOpacity(T66SaveFlowMutedText())
+			]
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.VAlign(VAlign_Center)
+			[
+				SNew(STextBlock)
+				.Text(PageText)
+				.Font(FT66Style::Tokens::FontBold(16))
+				.ColorAndOpacity(T66SaveFlowGoldText())
+			]
 		]
-		+ SOverlay::Slot()
-		.HAlign(HAlign_Center)
-		.VAlign(VAlign_Fill)
-		.Padding(FMargin(20.f, 26.f, 20.f, 24.f))
+		+ SVerticalBox::Slot()
+		.FillHeight(1.f)
+		.Padding(0.f, 18.f, 0.f, 18.f)
 		[
-			SNew(SBox)
-			.WidthOverride(SurfaceWidth)
+			CardGrid
+		]
+		+ SVerticalBox::Slot()
+		.AutoHeight()
+		[
+			SNew(SHorizontalBox)
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.Padding(0.f, 0.f, 12.f, 0.f)
 			[
-				MakeSaveFlowShell(
-					SNew(SVerticalBox)
-					+ SVerticalBox::Slot()
-					.AutoHeight()
-					.Padding(0.f, 0.f, 0.f, 16.f)
-					[
-						SNew(SHorizontalBox)
-						+ SHorizontalBox::Slot()
-						.AutoWidth()
-						.VAlign(VAlign_Center)
-						[
-							MakeSaveFlowPlateButton(
-								FT66ButtonParams(BackText, FOnClicked::CreateUObject(this, &UT66SaveSlotsScreen::HandleBackClicked), ET66ButtonType::Neutral)
-								.SetMinWidth(124.f)
-								.SetHeight(T66SaveFlowActionHeight)
-								.SetFontSize(22),
-								true)
-						]
-						+ SHorizontalBox::Slot()
-						.FillWidth(1.f)
-						.HAlign(HAlign_Center)
-						.VAlign(VAlign_Center)
-						[
-							SNew(STextBlock)
-							.Text(LoadGameTitleText)
-							.Font(FT66Style::Tokens::FontBold(48))
-							.ColorAndOpacity(T66SaveFlowGoldText())
-							.Justification(ETextJustify::Center)
-						]
-						+ SHorizontalBox::Slot()
-						.AutoWidth()
-						[
-							SNew(SBox)
-							.WidthOverride(124.f)
-						]
-					]
-					+ SVerticalBox::Slot()
-					.AutoHeight()
-					[
-						SNew(SHorizontalBox)
-						+ SHorizontalBox::Slot()
-						.AutoWidth()
-						.Padding(132.f, 0.f, 0.f, 0.f)
-						[
-							MakeSaveFlowDropdown(
-								FT66DropdownParams(
-									SNew(STextBlock)
-									.Text(T66PartySizeText(Loc, ActivePartySizeFilter))
-									.Font(FT66Style::Tokens::FontBold(16))
-									.ColorAndOpacity(T66SaveFlowBrightText()),
-									MakePartySizeMenu)
-								.SetMinWidth(156.f)
-								.SetHeight(38.f)
-								.SetPadding(FMargin(12.f, 8.f)))
-						]
-						+ SHorizontalBox::Slot()
-						.FillWidth(1.f)
-						.VAlign(VAlign_Center)
-						.Padding(16.f, 0.f, 0.f, 0.f)
-						[
-							SNew(STextBlock)
-							.Text(FilterHintText)
-							.Font(FT66Style::Tokens::FontRegular(15))
-							.ColorAndOpacity(T66SaveFlowMutedText())
-						]
-						+ SHorizontalBox::Slot()
-						.AutoWidth()
-						.VAlign(VAlign_Center)
-						[
-							SNew(STextBlock)
-							.Text(PageText)
-							.Font(FT66Style::Tokens::FontBold(16))
-							.ColorAndOpacity(T66SaveFlowGoldText())
-						]
-					]
-					+ SVerticalBox::Slot()
-					.FillHeight(1.f)
-					.Padding(0.f, 18.f, 0.f, 18.f)
-					[
-						CardGrid
-					]
-					+ SVerticalBox::Slot()
-					.AutoHeight()
-					[
-						SNew(SHorizontalBox)
-						+ SHorizontalBox::Slot()
-						.AutoWidth()
-						.Padding(0.f, 0.f, 12.f, 0.f)
-						[
-							MakeSaveFlowPlateButton(
-								FT66ButtonParams(PrevText, FOnClicked::CreateUObject(this, &UT66SaveSlotsScreen::HandlePrevPageClicked), ET66ButtonType::Neutral)
-								.SetMinWidth(118.f)
-								.SetHeight(T66SaveFlowActionHeight)
-								.SetFontSize(22)
-								.SetEnabled(bCanGoPrev),
-								bCanGoPrev)
-						]
-						+ SHorizontalBox::Slot()
-						.AutoWidth()
-						[
-							MakeSaveFlowPlateButton(
-								FT66ButtonParams(NextText, FOnClicked::CreateUObject(this, &UT66SaveSlotsScreen::HandleNextPageClicked), ET66ButtonType::Neutral)
-								.SetMinWidth(118.f)
-								.SetHeight(T66SaveFlowActionHeight)
-								.SetFontSize(22)
-								.SetEnabled(bCanGoNext),
-								bCanGoNext)
-						]
-					],
-					SurfacePadding)
+				MakeSaveFlowPlateButton(
+					FT66ButtonParams(PrevText, FOnClicked::CreateUObject(this, &UT66SaveSlotsScreen::HandlePrevPageClicked), ET66ButtonType::Neutral)
+					.SetMinWidth(118.f)
+					.SetHeight(T66SaveFlowActionHeight)
+					.SetFontSize(22)
+					.SetEnabled(bCanGoPrev),
+					bCanGoPrev)
 			]
-		];
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			[
+				MakeSaveFlowPlateButton(
+					FT66ButtonParams(NextText, FOnClicked::CreateUObject(this, &UT66SaveSlotsScreen::HandleNextPageClicked), ET66ButtonType::Neutral)
+					.SetMinWidth(118.f)
+					.SetHeight(T66SaveFlowActionHeight)
+					.SetFontSize(22)
+					.SetEnabled(bCanGoNext),
+					bCanGoNext)
+			];
 }
 
 FReply UT66SaveSlotsScreen::HandleBackClicked()
@@ -1110,18 +1125,8 @@ void UT66SaveSlotsScreen::RebuildVisibleSlotIndices()
 
 	for (int32 SlotIndex = 0; SlotIndex < UT66SaveSubsystem::MaxSlots; ++SlotIndex)
 	{
-		bool bOccupied = false;
-		FString LastPlayedUtc;
-		FString HeroDisplayName;
-		FString MapName;
-		SaveSub->GetSlotMeta(SlotIndex, bOccupied, LastPlayedUtc, HeroDisplayName, MapName);
-		if (!bOccupied)
-		{
-			continue;
-		}
-
-		UT66RunSaveGame* Loaded = SaveSub->LoadFromSlot(SlotIndex);
-		if (!Loaded || Loaded->PartySize != ActivePartySizeFilter)
+		const FT66SaveSlotMeta* Meta = SaveSub->GetOccupiedSlotMeta(SlotIndex);
+		if (!Meta || Meta->PartySize != ActivePartySizeFilter)
 		{
 			continue;
 		}
@@ -1234,7 +1239,19 @@ void UT66SaveSlotsScreen::RefreshScreen_Implementation()
 {
 	Super::RefreshScreen_Implementation();
 	RebuildVisibleSlotIndices();
-	ForceRebuildSlate();
+	RequestViewRefresh();
+}
+
+bool UT66SaveSlotsScreen::RefreshBoundWidgets()
+{
+	if (!PageBodyHost.IsValid())
+	{
+		return false;
+	}
+
+	// Page flips and filter changes only swap the filter row, cards and pager; the shell stays.
+	PageBodyHost->SetContent(BuildSlotPageBody());
+	return true;
 }
 
 void UT66SaveSlotsScreen::OnLoadClicked(const int32 SlotIndex)
@@ -8,6 +8,7 @@
 #include "T66SaveSlotsScreen.generated.h"
 
 struct FSlateBrush;
+class SBox;
 class UT66GameInstance;
 class UT66RunSaveGame;
 
@@ -50,6 +51,7 @@ protected:
 	virtual void OnScreenActivated_Implementation() override;
 	virtual TSharedRef<SWidget> BuildSlateUI() override;
 	virtual void RefreshScreen_Implementation() override;
+	virtual bool RefreshBoundWidgets() override;
 
 private:
 	static constexpr int32 SlotsPerPage = 4;
@@ -59,6 +61,9 @@ private:
 	TArray<TArray<TSharedPtr<FSlateBrush>>> SlotPartyAvatarBrushes;
 	TArray<TArray<TSharedPtr<FSlateBrush>>> SlotHeroPortraitBrushes;
 	TArray<int32> VisibleSlotIndices;
+	TSharedPtr<SBox> PageBodyHost;
+
+	TSharedRef<SWidget> BuildSlotPageBody();
 
 	void RebuildVisibleSlotIndices();
 	int32 GetVisibleSlotIndexForPageEntry(int32 LocalIndex) const;
@@ -37,7 +37,6 @@ DEFINE_LOG_CATEGORY_STATIC(LogT66FrontendTopBar, Log, All);
 
 namespace
 {
-	constexpr int32 GTopBarViewportZOrder = 50;
 	TMap<FString, TStrongObjectPtr<UTexture2D>> GTopBarFileTextureCache;
 
 	float SnapPixel(float Value)
@@ -395,7 +394,7 @@ namespace
 			SLATE_ARGUMENT(const FSlateBrush*, SelectedBrush)
 			SLATE_ARGUMENT(const FButtonStyle*, ButtonStyle)
 			SLATE_ARGUMENT(FMargin, ContentPadding)
-			SLATE_ARGUMENT(bool, IsSelected)
+			SLATE_ATTRIBUTE(bool, IsSelected)
 			SLATE_ARGUMENT(FLinearColor, FallbackOuterColor)
 			SLATE_ARGUMENT(FLinearColor, FallbackMidColor)
 			SLATE_ARGUMENT(FLinearColor, FallbackInnerColor)
@@ -412,7 +411,7 @@ namespace
 			DisabledBrush = InArgs._DisabledBrush;
 			SelectedBrush = InArgs._SelectedBrush;
 			ContentPadding = InArgs._ContentPadding;
-			bIsSelected = InArgs._IsSelected;
+			IsSelected = InArgs._IsSelected;
 			FallbackOuterColor = InArgs._FallbackOuterColor;
 			FallbackMidColor = InArgs._FallbackMidColor;
 			FallbackInnerColor = InArgs._FallbackInnerColor;
@@ -565,7 +564,7 @@ namespace
 				return PressedBrush;
 			}
 
-			if (bIsSelected && SelectedBrush)
+			if (SelectedBrush && IsSelected.Get())
 			{
 				return SelectedBrush;
 			}
@@ -610,7 +609,7 @@ namespace
 		const FSlateBrush* SelectedBrush = nullptr;
 		FButtonStyle ButtonStyle;
 		FMargin ContentPadding = FMargin(0.f);
-		bool bIsSelected = false;
+		TAttribute<bool> IsSelected = false;
 		FLinearColor FallbackOuterColor = FLinearColor::White;
 		FLinearColor FallbackMidColor = FLinearColor::White;
 		FLinearColor FallbackInnerColor = FLinearColor::White;
@@ -1213,7 +1212,13 @@ void UT66FrontendTopBarWidget::RefreshScreen_Implementation()
 		}
 	}
 
-	FT66Style::DeferRebuild(this, GTopBarViewportZOrder);
+	RequestViewRefresh();
+}
+
+bool UT66FrontendTopBarWidget::RefreshBoundWidgets()
+{
+	// Active section and coupon balance are attribute-bound; nothing to rebuild.
+	return true;
 }
 
 TSharedRef<SWidget> UT66FrontendTopBarWidget::BuildSlateUI()
@@ -1224,7 +1229,14 @@ TSharedRef<SWidget> UT66FrontendTopBarWidget::BuildSlateUI()
 	ensureMsgf(HomeButtonBrushes.NormalBrush.IsValid(), TEXT("Main menu top bar missing home button plate."));
 
 	UT66LocalizationSubsystem* Loc = GetLocSubsystem();
-	const ETopBarSection ActiveSection = GetActiveSection();
+	// Selection is read from the UI manager each frame, so screen changes only need a view refresh.
+	auto IsSectionActive = [this](const ETopBarSection Section) -> TAttribute<bool>
+	{
+		return TAttribute<bool>::CreateLambda([this, Section]() -> bool
+		{
+			return GetActiveSection() == Section;
+		});
+	};
 
 	const FText SettingsText = Loc ? Loc->GetText_Settings() : NSLOCTEXT("T66.MainMenu", "Settings", "SETTINGS");
 	const FText LanguageText = Loc ? Loc->GetText_LangButton() : NSLOCTEXT("T66.LanguageSelect", "LangButton", "LANG");
@@ -1313,7 +1325,7 @@ TSharedRef<SWidget> UT66FrontendTopBarWidget::BuildSlateUI()
 			FReply (UT66FrontendTopBarWidget::*ClickFunc)(),
 			const TSharedRef<SWidget>& ContentWidget,
 			const FMargin& ContentPadding,
-			const bool bSelected,
+			const TAttribute<bool>& IsSelected,
 			const FLinearColor& OuterColor,
 			const FLinearColor& MidColor,
 			const FLinearColor& InnerColor) -> TSharedRef<SWidget>
@@ -1330,7 +1342,7 @@ TSharedRef<SWidget> UT66FrontendTopBarWidget::BuildSlateUI()
 				.PressedBrush(BrushSet.PressedBrush.Get())
 				.DisabledBrush(BrushSet.DisabledBrush.Get())
 				.SelectedBrush(BrushSet.SelectedBrush.Get())
-				.IsSelected(bSelected)
+				.IsSelected(IsSelected)
 				.ToolTipText(TooltipText)
 				.OnClicked(FOnClicked::CreateUObject(this, ClickFunc))
 				.ContentPadding(ContentPadding)
@@ -1404,7 +1416,7 @@ TSharedRef<SWidget> UT66FrontendTopBarWidget::BuildSlateUI()
 		&UT66FrontendTopBarWidget::HandleSettingsClicked,
 		SettingsIconWidget,
 		FMargin(0.f),
-		ActiveSection == ETopBarSection::Settings,
+		IsSectionActive(ETopBarSection::Settings),
 		TransparentPlate,
 		TransparentPlate,
 		TransparentPlate);
@@ -1416,7 +1428,7 @@ TSharedRef<SWidget> UT66FrontendTopBarWidget::BuildSlateUI()
 		&UT66FrontendTopBarWidget::HandleLanguageClicked,
 		LanguageIconWidget,
 		FMargin(0.f),
-		ActiveSection == ETopBarSection::Language,
+		IsSectionActive(ETopBarSection::Language),
 		TransparentPlate,
 		TransparentPlate,
 		TransparentPlate);
@@ -1428,7 +1440,7 @@ TSharedRef<SWidget> UT66FrontendTopBarWidget::BuildSlateUI()
 		&UT66FrontendTopBarWidget::HandleAccountStatusClicked,
 		MakeLabelWidget(AccountText),
 		FMargin(0.f),
-		ActiveSection == ETopBarSection::AccountStatus,
+		IsSectionActive(ETopBarSection::AccountStatus),
 		AccountOuter,
 		AccountMid,
 		AccountInner);
@@ -1453,7 +1465,7 @@ TSharedRef<SWidget> UT66FrontendTopBarWidget::BuildSlateUI()
 				&UT66FrontendTopBarWidget::HandleHomeClicked,
 				HomeImageWidget,
 				FMargin(0.f),
-				ActiveSection == ETopBarSection::Home,
+				IsSectionActive(ETopBarSection::Home),
 				HomeOuter,
 				HomeMid,
 				HomeInner)
@@ -1466,7 +1478,7 @@ TSharedRef<SWidget> UT66FrontendTopBarWidget::BuildSlateUI()
 		&UT66FrontendTopBarWidget::HandlePowerUpClicked,
 		MakeLabelWidget(PowerUpText),
 		FMargin(0.f),
-		ActiveSection == ETopBarSection::PowerUp,
+		IsSectionActive(ETopBarSection::PowerUp),
 		NavOuter,
 		NavMid,
 		NavInner);
@@ -1478,7 +1490,7 @@ TSharedRef<SWidget> UT66FrontendTopBarWidget::BuildSlateUI()
 		&UT66FrontendTopBarWidget::HandleAchievementsClicked,
 		MakeLabelWidget(AchievementsText),
 		FMargin(0.f),
-		ActiveSection == ETopBarSection::Achievements,
+		IsSectionActive(ETopBarSection::Achievements),
 		NavOuter,
 		NavMid,
 		NavInner);
@@ -1490,7 +1502,7 @@ TSharedRef<SWidget> UT66FrontendTopBarWidget::BuildSlateUI()
 		&UT66FrontendTopBarWidget::HandleMiniGamesClicked,
 		MakeLabelWidget(MiniGamesText),
 		FMargin(0.f),
-		ActiveSection == ETopBarSection::MiniGames,
+		IsSectionActive(ETopBarSection::MiniGames),
 		NavOuter,
 		NavMid,
 		NavInner);
@@ -1513,7 +1525,7 @@ TSharedRef<SWidget> UT66FrontendTopBarWidget::BuildSlateUI()
 			CurrencyNavIcon,
 			CouponRect.Width),
 		FMargin(0.f),
-		ActiveSection == ETopBarSection::PowerUp,
+		IsSectionActive(ETopBarSection::PowerUp),
 		TransparentPlate,
 		TransparentPlate,
 		TransparentPlate);
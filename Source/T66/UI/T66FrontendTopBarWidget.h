@@ -37,6 +37,7 @@ protected:
 	virtual void NativeDestruct() override;
 	virtual void ReleaseSlateResources(bool bReleaseChildren) override;
 	virtual void RefreshScreen_Implementation() override;
+	virtual bool RefreshBoundWidgets() override;
 
 private:
 	enum class ETopBarSection : uint8
@@ -24,6 +24,8 @@ class SVerticalBox;
 class SButton;
 class SImage;
 class ST66CrosshairWidget;
+class ST66EnemyIndicatorLayerWidget;
+class ST66CombatTextLayerWidget;
 class UTexture2D;
 struct FSlateBrush;
 class ST66RingWidget;
@@ -46,6 +48,24 @@ struct FT66BossPartBarRow
 	bool bLastAlive = false;
 };
 
+struct FT66EnemyIndicatorEntry
+{
+	/** Normalized to the viewport so the layer does not depend on DPI scale. */
+	FVector2D LockPosition = FVector2D::ZeroVector;
+};
+
+struct FT66CombatTextDrawEntry
+{
+	/** Normalized viewport position of the number's anchor before the rise animation. */
+	FVector2D Position = FVector2D::ZeroVector;
+	FString Text;
+	FLinearColor Color = FLinearColor::White;
+	int32 FontSize = 18;
+	/** 0-1 through the number's lifetime since its latest merged hit. */
+	float Age01 = 0.f;
+	bool bMerged = false;
+};
+
 struct FT66HUDInteractionPromptEntry
 {
 	TWeakObjectPtr<AActor> SourceActor;
@@ -173,6 +193,8 @@ protected:
 	void UpdateTowerMapReveal(const FVector& PlayerLocation);
 	bool IsTowerMapRevealPointVisible(int32 FloorNumber, const FVector2D& WorldXY) const;
 	void RefreshFPS();
+	void RefreshEnemyIndicators();
+	void RefreshCombatText();
 	bool IsPausePresentationActive() const;
 	void RefreshPausePresentation();
 	TSharedRef<SWidget> BuildPauseStatsPanel() const;
@@ -203,6 +225,15 @@ protected:
 	FReply OnToggleImmortality();
 	FReply OnTogglePower();
 
+	/** Stage-sorted pacing checkpoints for a beat target, copied out of its run summary once per target. */
+	struct FPacingCurve
+	{
+		FString SourceKey;
+		TArray<FT66StagePacingPoint> Points;
+		bool bReady = false;
+		bool bRequested = false;
+	};
+
 	/** Cached Slate widgets for updates (set in BuildSlateUI via SAssignNew) */
 	TSharedPtr<STextBlock> NetWorthText;
 	TSharedPtr<STextBlock> GoldText;
@@ -266,6 +297,10 @@ protected:
 	TSharedPtr<ST66CrosshairWidget> CenterCrosshairWidget;
 	TSharedPtr<SBox> CenterCrosshairBox;
 	TSharedPtr<SBorder> ScopedSniperOverlayBorder;
+	TSharedPtr<ST66EnemyIndicatorLayerWidget> EnemyIndicatorLayer;
+	TArray<FT66EnemyIndicatorEntry> EnemyIndicatorScratch;
+	TSharedPtr<ST66CombatTextLayerWidget> CombatTextLayer;
+	TArray<FT66CombatTextDrawEntry> CombatTextScratch;
 	TSharedPtr<STextBlock> ScopedUltTimerText;
 	TSharedPtr<STextBlock> ScopedShotCooldownText;
 	TSharedPtr<SBorder> QuickReviveDownedOverlayBorder;
@@ -364,6 +399,8 @@ protected:
 	int32 LastDisplayedDPS = -1;
 	FLinearColor LastDisplayedDPSColor = FLinearColor::Transparent;
 	int32 LastDisplayedSpeedRunTotalCs = -1;
+	FPacingCurve ScorePacingCurve;
+	FPacingCurve TimePacingCurve;
 	int32 LastDisplayedBossCurrentHP = INDEX_NONE;
 	int32 LastDisplayedBossMaxHP = INDEX_NONE;
 	bool bLastBossBarVisible = false;
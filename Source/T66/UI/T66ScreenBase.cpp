@@ -3,7 +3,9 @@
 #include "UI/T66ScreenBase.h"
 #include "UI/T66UIManager.h"
 #include "UI/Style/T66Style.h"
+#include "Engine/World.h"
 #include "Kismet/GameplayStatics.h"
+#include "TimerManager.h"
 #include "Widgets/Layout/SBox.h"
 #include "Widgets/Layout/SBorder.h"
 #include "Widgets/Layout/SConstraintCanvas.h"
@@ -102,6 +104,40 @@ void UT66ScreenBase::ForceRebuildSlate()
 	FT66Style::DeferRebuild(this, bIsModal ? 100 : 0);
 }
 
+void UT66ScreenBase::RequestViewRefresh()
+{
+	if (!bSlateUIBuilt || bViewRefreshPending)
+	{
+		// An unbuilt screen reads current state when BuildSlateUI runs.
+		return;
+	}
+
+	UWorld* World = GetWorld();
+	if (!World || World->bIsTearingDown)
+	{
+		return;
+	}
+
+	// Same next-tick deferral as ForceRebuildSlate: the caller is often a click handler
+	// owned by one of the widgets the refresh is about to replace.
+	bViewRefreshPending = true;
+	World->GetTimerManager().SetTimerForNextTick(FTimerDelegate::CreateUObject(this, &UT66ScreenBase::FlushViewRefresh));
+}
+
+void UT66ScreenBase::FlushViewRefresh()
+{
+	bViewRefreshPending = false;
+	if (!bSlateUIBuilt)
+	{
+		return;
+	}
+
+	if (!RefreshBoundWidgets())
+	{
+		ForceRebuildSlate();
+	}
+}
+
 // ========== Slate UI Building Helpers ==========
 
 TSharedRef<SWidget> UT66ScreenBase::MakeText(const FText& Text, int32 FontSize, const FLinearColor& Color)
@@ -83,12 +83,21 @@ public:
 
 	/**
 	 * Force the underlying Slate widget tree to be rebuilt.
-	 * Use this when you need new localized text or layout changes to take effect
+	 * Reserve this for language, theme and layout changes that invalidate the whole tree
 	 * (calling TakeWidget() alone usually returns the already-built widget).
+	 * State changes should go through RequestViewRefresh instead.
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Screen")
 	void ForceRebuildSlate();
 
+	/**
+	 * Push changed screen state into the existing widget tree on the next tick.
+	 * Multiple requests in one frame coalesce. Screens that do not override
+	 * RefreshBoundWidgets fall back to a full ForceRebuildSlate.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Screen")
+	void RequestViewRefresh();
+
 	UFUNCTION(BlueprintPure, Category = "Screen")
 	bool HasBuiltSlateUI() const { return bSlateUIBuilt; }
 
@@ -106,6 +115,13 @@ protected:
 	/** Override to construct the widget */
 	virtual TSharedRef<SWidget> RebuildWidget() override;
 
+	/**
+	 * Update the built widgets in place from the screen's current state.
+	 * Bound attributes pick up changes on their own; override this to refresh the
+	 * sections that are rebuilt explicitly. Return false to request a full rebuild.
+	 */
+	virtual bool RefreshBoundWidgets() { return false; }
+
 	// ========== Slate UI Building Helpers ==========
 
 	/** Create a text block */
@@ -127,4 +143,9 @@ protected:
 
 	/** Tracks whether the screen has already been activated once. */
 	bool bHasBeenActivated = false;
+
+private:
+	void FlushViewRefresh();
+
+	bool bViewRefreshPending = false;
 };
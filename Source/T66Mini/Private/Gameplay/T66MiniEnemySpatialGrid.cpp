@@ -0,0 +1,231 @@
+// Copyright Tribulation 66. All Rights Reserved.
+
+#include "Gameplay/T66MiniEnemySpatialGrid.h"
+
+#include "Gameplay/T66MiniEnemyBase.h"
+
+namespace
+{
+	constexpr int32 T66MiniSpatialGridMarginCells = 2;
+}
+
+template <typename VisitorType>
+void FT66MiniEnemySpatialGrid::VisitRing(const FIntPoint& CenterCell, const int32 Ring, VisitorType&& Visitor) const
+{
+	const int32 MinX = FMath::Max(0, CenterCell.X - Ring);
+	const int32 MaxX = FMath::Min(CellsPerAxis - 1, CenterCell.X + Ring);
+	const int32 MinY = FMath::Max(0, CenterCell.Y - Ring);
+	const int32 MaxY = FMath::Min(CellsPerAxis - 1, CenterCell.Y + Ring);
+
+	for (int32 CellY = MinY; CellY <= MaxY; ++CellY)
+	{
+		const bool bEdgeRow = FMath::Abs(CellY - CenterCell.Y) == Ring;
+		for (int32 CellX = MinX; CellX <= MaxX; ++CellX)
+		{
+			if (!bEdgeRow && FMath::Abs(CellX - CenterCell.X) != Ring)
+			{
+				continue;
+			}
+
+			for (int32 EntryIndex = CellHeads[ToCellIndex(FIntPoint(CellX, CellY))]; EntryIndex != INDEX_NONE; EntryIndex = Entries[EntryIndex].NextInCell)
+			{
+				Visitor(Entries[EntryIndex]);
+			}
+		}
+	}
+}
+
+void FT66MiniEnemySpatialGrid::Rebuild(const FVector& ArenaOrigin, const float ArenaHalfExtent, const TArray<TObjectPtr<AT66MiniEnemyBase>>& Enemies)
+{
+	if (CellsPerAxis <= 0 || !CachedArenaOrigin.Equals(ArenaOrigin) || !FMath::IsNearlyEqual(CachedArenaHalfExtent, ArenaHalfExtent))
+	{
+		ConfigureCells(ArenaOrigin, ArenaHalfExtent);
+	}
+
+	for (int32& Head : CellHeads)
+	{
+		Head = INDEX_NONE;
+	}
+
+	Entries.Reset(Enemies.Num());
+	for (AT66MiniEnemyBase* Enemy : Enemies)
+	{
+		if (IsValid(Enemy) && !Enemy->IsEnemyDead())
+		{
+			Insert(Enemy);
+		}
+	}
+}
+
+void FT66MiniEnemySpatialGrid::Insert(AT66MiniEnemyBase* Enemy)
+{
+	if (CellsPerAxis <= 0 || !Enemy)
+	{
+		return;
+	}
+
+	const int32 CellIndex = ToCellIndex(ToCell(Enemy->GetActorLocation()));
+	FEntry& Entry = Entries.AddDefaulted_GetRef();
+	Entry.Enemy = Enemy;
+	Entry.NextInCell = CellHeads[CellIndex];
+	CellHeads[CellIndex] = Entries.Num() - 1;
+}
+
+void FT66MiniEnemySpatialGrid::Reset()
+{
+	CellsPerAxis = 0;
+	CellHeads.Reset();
+	Entries.Reset();
+}
+
+AT66MiniEnemyBase* FT66MiniEnemySpatialGrid::FindNearest(const FVector& Origin, const float MaxRange, const TConstArrayView<const AActor*> IgnoreActors) const
+{
+	if (CellsPerAxis <= 0 || Entries.Num() == 0 || MaxRange <= 0.f)
+	{
+		return nullptr;
+	}
+
+	const FIntPoint CenterCell = ToCell(Origin);
+	const int32 MaxRing = FMath::Min(CellsPerAxis, FMath::CeilToInt((MaxRange + QuerySlack) / CellSize) + 1);
+	AT66MiniEnemyBase* BestEnemy = nullptr;
+	float BestDistanceSq = FMath::Square(MaxRange);
+
+	for (int32 Ring = 0; Ring <= MaxRing; ++Ring)
+	{
+		VisitRing(CenterCell, Ring, [&](const FEntry& Entry)
+		{
+			AT66MiniEnemyBase* Candidate = ResolveCandidate(Entry, IgnoreActors);
+			if (!Candidate)
+			{
+				return;
+			}
+
+			const float DistanceSq = FVector::DistSquared2D(Origin, Candidate->GetActorLocation());
+			if (DistanceSq < BestDistanceSq)
+			{
+				BestDistanceSq = DistanceSq;
+				BestEnemy = Candidate;
+			}
+		});
+
+		// Every cell outside the scanned rings is at least Ring * CellSize away from the origin.
+		const float ScannedReach = (static_cast<float>(Ring) * CellSize) - QuerySlack;
+		if (BestEnemy && ScannedReach > 0.f && BestDistanceSq <= FMath::Square(ScannedReach))
+		{
+			break;
+		}
+	}
+
+	return BestEnemy;
+}
+
+void FT66MiniEnemySpatialGrid::ForEachInRadius(const FVector& Center, const float Radius, const TConstArrayView<const AActor*> IgnoreActors, const TFunctionRef<void(AT66MiniEnemyBase*)> Visitor) const
+{
+	if (CellsPerAxis <= 0 || Entries.Num() == 0 || Radius <= 0.f)
+	{
+		return;
+	}
+
+	const float PaddedRadius = Radius + QuerySlack;
+	const FIntPoint MinCell = ToCell(Center - FVector(PaddedRadius, PaddedRadius, 0.f));
+	const FIntPoint MaxCell = ToCell(Center + FVector(PaddedRadius, PaddedRadius, 0.f));
+	const float RadiusSq = FMath::Square(Radius);
+
+	for (int32 CellY = MinCell.Y; CellY <= MaxCell.Y; ++CellY)
+	{
+		for (int32 CellX = MinCell.X; CellX <= MaxCell.X; ++CellX)
+		{
+			for (int32 EntryIndex = CellHeads[ToCellIndex(FIntPoint(CellX, CellY))]; EntryIndex != INDEX_NONE; EntryIndex = Entries[EntryIndex].NextInCell)
+			{
+				AT66MiniEnemyBase* Candidate = ResolveCandidate(Entries[EntryIndex], IgnoreActors);
+				if (Candidate && FVector::DistSquared2D(Center, Candidate->GetActorLocation()) <= RadiusSq)
+				{
+					Visitor(Candidate);
+				}
+			}
+		}
+	}
+}
+
+void FT66MiniEnemySpatialGrid::ForEachKNearest(const FVector& Origin, const int32 K, const float MaxRange, const TConstArrayView<const AActor*> IgnoreActors, const TFunctionRef<void(AT66MiniEnemyBase*)> Visitor) const
+{
+	if (CellsPerAxis <= 0 || Entries.Num() == 0 || MaxRange <= 0.f || K <= 0)
+	{
+		return;
+	}
+
+	const FIntPoint CenterCell = ToCell(Origin);
+	const int32 MaxRing = FMath::Min(CellsPerAxis, FMath::CeilToInt((MaxRange + QuerySlack) / CellSize) + 1);
+	const float MaxRangeSq = FMath::Square(MaxRange);
+	TArray<FCandidate, TInlineAllocator<16>> Candidates;
+	auto ByDistance = [](const FCandidate& A, const FCandidate& B) { return A.DistanceSq < B.DistanceSq; };
+
+	for (int32 Ring = 0; Ring <= MaxRing; ++Ring)
+	{
+		VisitRing(CenterCell, Ring, [&](const FEntry& Entry)
+		{
+			AT66MiniEnemyBase* Candidate = ResolveCandidate(Entry, IgnoreActors);
+			if (!Candidate)
+			{
+				return;
+			}
+
+			const float DistanceSq = FVector::DistSquared2D(Origin, Candidate->GetActorLocation());
+			if (DistanceSq <= MaxRangeSq)
+			{
+				Candidates.Add({ Candidate, DistanceSq });
+			}
+		});
+
+		if (Candidates.Num() < K)
+		{
+			continue;
+		}
+
+		// Same early-out as FindNearest, applied to the K-th closest candidate.
+		Candidates.Sort(ByDistance);
+		Candidates.SetNum(K, EAllowShrinking::No);
+		const float ScannedReach = (static_cast<float>(Ring) * CellSize) - QuerySlack;
+		if (ScannedReach > 0.f && Candidates.Last().DistanceSq <= FMath::Square(ScannedReach))
+		{
+			break;
+		}
+	}
+
+	Candidates.Sort(ByDistance);
+	const int32 ResultCount = FMath::Min(K, Candidates.Num());
+	for (int32 Index = 0; Index < ResultCount; ++Index)
+	{
+		Visitor(Candidates[Index].Enemy);
+	}
+}
+
+void FT66MiniEnemySpatialGrid::ConfigureCells(const FVector& ArenaOrigin, const float ArenaHalfExtent)
+{
+	CachedArenaOrigin = ArenaOrigin;
+	CachedArenaHalfExtent = ArenaHalfExtent;
+
+	const int32 ArenaCells = FMath::Max(1, FMath::CeilToInt((ArenaHalfExtent * 2.f) / CellSize));
+	CellsPerAxis = ArenaCells + (T66MiniSpatialGridMarginCells * 2);
+	const float HalfGridSize = (static_cast<float>(CellsPerAxis) * CellSize) * 0.5f;
+	GridMin = FVector2D(ArenaOrigin.X - HalfGridSize, ArenaOrigin.Y - HalfGridSize);
+	CellHeads.Init(INDEX_NONE, CellsPerAxis * CellsPerAxis);
+}
+
+FIntPoint FT66MiniEnemySpatialGrid::ToCell(const FVector& WorldLocation) const
+{
+	return FIntPoint(
+		FMath::Clamp(FMath::FloorToInt((WorldLocation.X - GridMin.X) / CellSize), 0, CellsPerAxis - 1),
+		FMath::Clamp(FMath::FloorToInt((WorldLocation.Y - GridMin.Y) / CellSize), 0, CellsPerAxis - 1));
+}
+
+AT66MiniEnemyBase* FT66MiniEnemySpatialGrid::ResolveCandidate(const FEntry& Entry, const TConstArrayView<const AActor*> IgnoreActors) const
+{
+	AT66MiniEnemyBase* Enemy = Entry.Enemy.Get();
+	if (!Enemy || Enemy->IsEnemyDead() || IgnoreActors.Contains(Enemy))
+	{
+		return nullptr;
+	}
+
+	return Enemy;
+}
@@ -415,6 +415,8 @@ void AT66MiniGameMode::Tick(const float DeltaSeconds)
 		LiveCacheRefreshAccumulator = 0.f;
 	}
 
+	EnemySpatialGrid.Rebuild(ArenaOrigin, ArenaHalfExtent, LiveEnemies);
+
 	if (!bRunCompleted)
 	{
 		if (PostBossDelayRemaining > 0.f)
@@ -847,6 +849,7 @@ void AT66MiniGameMode::SpawnWaveEnemy()
 			EnemyDefinition->ProjectileDamage * DifficultyDamageScalar * WaveDamageScalar,
 			EnemyDefinition->PreferredRange);
 		LiveEnemies.Add(Enemy);
+		EnemySpatialGrid.Insert(Enemy);
 		if (UT66MiniVFXSubsystem* VfxSubsystem = GameInstance ? GameInstance->GetSubsystem<UT66MiniVFXSubsystem>() : nullptr)
 		{
 			VfxSubsystem->SpawnPulse(World, SpawnLocation + FVector(0.f, 0.f, 6.f), FVector(0.20f, 0.20f, 1.f), 0.14f, FLinearColor(0.96f, 0.20f, 0.18f, 0.18f), 0.55f);
@@ -937,6 +940,7 @@ void AT66MiniGameMode::SpawnBossEnemy()
 			BossDefinition->ProjectileDamage * DifficultyScalar,
 			960.f);
 		LiveEnemies.Add(Boss);
+		EnemySpatialGrid.Insert(Boss);
 	}
 
 	if (ActiveBossTelegraphActor)
@@ -1445,6 +1449,7 @@ void AT66MiniGameMode::RestoreWorldState(const UT66MiniRunSaveGame* RunSave)
 	}
 
 	LiveEnemies.Reset();
+	EnemySpatialGrid.Reset();
 	LiveTraps.Reset();
 	LiveInteractables.Reset();
 	LivePickups.Reset();
@@ -1508,6 +1513,8 @@ void AT66MiniGameMode::RestoreWorldState(const UT66MiniRunSaveGame* RunSave)
 		}
 	}
 
+	EnemySpatialGrid.Rebuild(ArenaOrigin, ArenaHalfExtent, LiveEnemies);
+
 	for (const FT66MiniPickupSnapshot& Snapshot : RunSave->PickupSnapshots)
 	{
 		if (AT66MiniPickup* Pickup = World->SpawnActor<AT66MiniPickup>(AT66MiniPickup::StaticClass(), ClampPointToArena(Snapshot.Location), FRotator::ZeroRotator, SpawnParams))
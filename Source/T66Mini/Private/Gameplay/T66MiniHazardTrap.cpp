@@ -244,17 +244,13 @@ void AT66MiniHazardTrap::ApplyPulse()
 		}
 	}
 
-	const TArray<TObjectPtr<AT66MiniEnemyBase>>* LiveEnemies = MiniGameMode ? &MiniGameMode->GetLiveEnemies() : nullptr;
-	if (LiveEnemies)
+	if (MiniGameMode)
 	{
-		for (AT66MiniEnemyBase* Enemy : *LiveEnemies)
+		TArray<AT66MiniEnemyBase*, TInlineAllocator<32>> Targets;
+		MiniGameMode->GetEnemySpatialGrid().FindInRadius(GetActorLocation(), Radius, Targets);
+		for (AT66MiniEnemyBase* Enemy : Targets)
 		{
-			if (!Enemy || Enemy->IsEnemyDead())
-			{
-				continue;
-			}
-
-			if (FVector::DistSquared2D(GetActorLocation(), Enemy->GetActorLocation()) <= FMath::Square(Radius))
+			if (!Enemy->IsEnemyDead())
 			{
 				Enemy->ApplyDamage(DamagePerPulse);
 			}
@@ -33,10 +33,10 @@
 
 namespace
 {
-	const TArray<TObjectPtr<AT66MiniEnemyBase>>* T66MiniResolveLiveEnemies(const UWorld* World)
+	const FT66MiniEnemySpatialGrid* T66MiniResolveEnemyGrid(const UWorld* World)
 	{
 		const AT66MiniGameMode* MiniGameMode = World ? World->GetAuthGameMode<AT66MiniGameMode>() : nullptr;
-		return MiniGameMode ? &MiniGameMode->GetLiveEnemies() : nullptr;
+		return MiniGameMode ? &MiniGameMode->GetEnemySpatialGrid() : nullptr;
 	}
 }
 
@@ -1132,13 +1132,25 @@ bool AT66MiniPlayerPawn::TryActivateUltimate(const FVector& TargetLocation)
 		break;
 
 	case ET66UltimateType::MeteorStrike:
-		for (int32 Index = 0; Index < 5; ++Index)
+	{
+		// Meteors land on the enemies closest to the aim point first; any left over scatter around it.
+		constexpr int32 MeteorCount = 5;
+		TArray<AT66MiniEnemyBase*, TInlineAllocator<MeteorCount>> MeteorTargets;
+		if (const FT66MiniEnemySpatialGrid* EnemyGrid = T66MiniResolveEnemyGrid(GetWorld()))
+		{
+			EnemyGrid->FindKNearest(TargetLocation, MeteorCount, 360.f, MeteorTargets);
+		}
+
+		for (int32 Index = 0; Index < MeteorCount; ++Index)
 		{
-			const FVector Offset(FMath::FRandRange(-360.f, 360.f), FMath::FRandRange(-360.f, 360.f), 0.f);
-			QueueBurst(TargetLocation + Offset, BaseDamage * 1.5f, 320.f, 0.28f + (Index * 0.12f), FLinearColor(1.0f, 0.52f, 0.18f, 0.32f), 0.f, 0.f, 0.0f, true);
+			const FVector MeteorLocation = MeteorTargets.IsValidIndex(Index)
+				? FVector(MeteorTargets[Index]->GetActorLocation().X, MeteorTargets[Index]->GetActorLocation().Y, TargetLocation.Z)
+				: TargetLocation + FVector(FMath::FRandRange(-360.f, 360.f), FMath::FRandRange(-360.f, 360.f), 0.f);
+			QueueBurst(MeteorLocation, BaseDamage * 1.5f, 320.f, 0.28f + (Index * 0.12f), FLinearColor(1.0f, 0.52f, 0.18f, 0.32f), 0.f, 0.f, 0.0f, true);
 		}
 		UltimateCooldownDuration = 20.f;
 		break;
+	}
 
 	case ET66UltimateType::ChainLightning:
 		ApplyAreaDamage(HeroLocation, 1250.f, BaseDamage * 1.18f, 0.12f, 0.f, 0.f);
@@ -1377,21 +1389,17 @@ void AT66MiniPlayerPawn::ApplyAreaDamage(const FVector& Center, const float Radi
 		return;
 	}
 
-	const TArray<TObjectPtr<AT66MiniEnemyBase>>* LiveEnemies = T66MiniResolveLiveEnemies(World);
-	if (!LiveEnemies)
+	const FT66MiniEnemySpatialGrid* EnemyGrid = T66MiniResolveEnemyGrid(World);
+	if (!EnemyGrid)
 	{
 		return;
 	}
 
-	for (AT66MiniEnemyBase* Candidate : *LiveEnemies)
+	TArray<AT66MiniEnemyBase*, TInlineAllocator<32>> Targets;
+	EnemyGrid->FindInRadius(Center, Radius, Targets);
+	for (AT66MiniEnemyBase* Candidate : Targets)
 	{
-		if (!Candidate || Candidate->IsEnemyDead())
-		{
-			continue;
-		}
-
-		const float DistanceSq = FVector::DistSquared2D(Center, Candidate->GetActorLocation());
-		if (DistanceSq > FMath::Square(Radius))
+		if (Candidate->IsEnemyDead())
 		{
 			continue;
 		}
@@ -1504,7 +1512,7 @@ void AT66MiniPlayerPawn::HandlePostDamageTaken(const float DamageTaken)
 	}
 }
 
-void AT66MiniPlayerPawn::HandlePassiveOnBasicHit(AT66MiniEnemyBase* ImpactEnemy, const FVector& ImpactLocation, const float DamageDealt)
+void AT66MiniPlayerPawn::HandlePassiveOnBasicHit(AT66MiniEnemyBase* ImpactEnemy, const FVector& ImpactLocation, const float DamageDealt, FRicochetTargets& Ricochet)
 {
 	if (!ImpactEnemy || ImpactEnemy->IsEnemyDead())
 	{
@@ -1526,7 +1534,7 @@ void AT66MiniPlayerPawn::HandlePassiveOnBasicHit(AT66MiniEnemyBase* ImpactEnemy,
 
 	if (PassiveType == ET66PassiveType::StaticCharge && (PassiveShotCounter % 4) == 0)
 	{
-		if (AT66MiniEnemyBase* SecondaryEnemy = FindClosestEnemyFromLocation(ImpactEnemy->GetActorLocation(), ImpactEnemy, 380.f))
+		if (AT66MiniEnemyBase* SecondaryEnemy = PickRicochetTarget(Ricochet, 380.f))
 		{
 			SecondaryEnemy->ApplyDamage(DamageDealt * 0.60f);
 			HandleSuccessfulHit(DamageDealt * 0.60f);
@@ -1541,7 +1549,7 @@ void AT66MiniPlayerPawn::HandlePassiveOnBasicHit(AT66MiniEnemyBase* ImpactEnemy,
 	if (PassiveType == ET66PassiveType::ChaosTheory && bChaosNextAttackBounces)
 	{
 		bChaosNextAttackBounces = false;
-		if (AT66MiniEnemyBase* SecondaryEnemy = FindClosestEnemyFromLocation(ImpactEnemy->GetActorLocation(), ImpactEnemy, 340.f))
+		if (AT66MiniEnemyBase* SecondaryEnemy = PickRicochetTarget(Ricochet, 340.f))
 		{
 			SecondaryEnemy->ApplyDamage(DamageDealt * 0.72f);
 			HandleSuccessfulHit(DamageDealt * 0.72f);
@@ -1577,8 +1585,17 @@ void AT66MiniPlayerPawn::HandleBasicAttackImpact(AT66MiniEnemyBase* ImpactEnemy,
 		return;
 	}
 
+	FRicochetTargets Ricochet;
+	Ricochet.ImpactEnemy = ImpactEnemy;
+	Ricochet.Origin = ImpactEnemy->GetActorLocation();
+	Ricochet.QueryRange = 380.f;
+	for (const FEquippedIdolRuntime& IdolRuntime : EquippedIdols)
+	{
+		Ricochet.QueryRange = FMath::Max(Ricochet.QueryRange, GetIdolRicochetRange(IdolRuntime));
+	}
+
 	const float EstimatedDamage = ((BaseDamageStat * 0.95f) + (HeroLevel * 0.45f)) * BonusDamageMultiplier * TemporaryDamageMultiplier;
-	HandlePassiveOnBasicHit(ImpactEnemy, ImpactLocation, EstimatedDamage);
+	HandlePassiveOnBasicHit(ImpactEnemy, ImpactLocation, EstimatedDamage, Ricochet);
 
 	if (EquippedIdols.Num() == 0)
 	{
@@ -1595,13 +1612,13 @@ void AT66MiniPlayerPawn::HandleBasicAttackImpact(AT66MiniEnemyBase* ImpactEnemy,
 			continue;
 		}
 
-		TriggerIdolFollowUp(IdolRuntime, ImpactEnemy, ImpactLocation);
+		TriggerIdolFollowUp(IdolRuntime, ImpactEnemy, ImpactLocation, Ricochet);
 		NextIdolProcIndex = (RuntimeIndex + 1) % IdolCount;
 		break;
 	}
 }
 
-void AT66MiniPlayerPawn::TriggerIdolFollowUp(FEquippedIdolRuntime& IdolRuntime, AT66MiniEnemyBase* ImpactEnemy, const FVector& ImpactLocation)
+void AT66MiniPlayerPawn::TriggerIdolFollowUp(FEquippedIdolRuntime& IdolRuntime, AT66MiniEnemyBase* ImpactEnemy, const FVector& ImpactLocation, FRicochetTargets& Ricochet)
 {
 	if (!ImpactEnemy || ImpactEnemy->IsEnemyDead())
 	{
@@ -1612,7 +1629,7 @@ void AT66MiniPlayerPawn::TriggerIdolFollowUp(FEquippedIdolRuntime& IdolRuntime,
 	IdolRuntime.CooldownRemaining = CooldownScale;
 
 	float FollowUpDamage = ((BaseDamageStat * 0.30f) + (IdolRuntime.BaseDamage * 0.35f) + (HeroLevel * IdolRuntime.DamagePerLevel * 0.20f)) * BonusDamageMultiplier;
-	const float Radius = FMath::Max(240.f, IdolRuntime.BaseProperty + 140.f + AoeRadiusBonus);
+	const float Radius = GetIdolFollowUpRadius(IdolRuntime);
 	const float DotTickDamage = FMath::Max(1.5f, (FollowUpDamage * 0.28f) + DotDamageBonus);
 	const float StunDuration = IdolRuntime.IdolID == FName(TEXT("Idol_Electric")) ? (0.16f + (HeroLevel * 0.004f)) : 0.f;
 	const FVector VfxLocation = ImpactLocation + FVector(0.f, 0.f, 10.f);
@@ -1627,7 +1644,7 @@ void AT66MiniPlayerPawn::TriggerIdolFollowUp(FEquippedIdolRuntime& IdolRuntime,
 			ImpactEnemy->ApplyStun(StunDuration);
 		}
 
-		if (AT66MiniEnemyBase* NextEnemy = FindClosestEnemyFromLocation(ImpactEnemy->GetActorLocation(), ImpactEnemy, FMath::Max(340.f, Radius)))
+		if (AT66MiniEnemyBase* NextEnemy = PickRicochetTarget(Ricochet, GetIdolRicochetRange(IdolRuntime)))
 		{
 			UWorld* World = GetWorld();
 			if (World)
@@ -1683,7 +1700,7 @@ void AT66MiniPlayerPawn::TriggerIdolFollowUp(FEquippedIdolRuntime& IdolRuntime,
 	SpawnIdolImpactVfx(IdolRuntime, VfxLocation, 1.0f);
 	ImpactEnemy->ApplyDamage(FollowUpDamage);
 	HandleSuccessfulHit(FollowUpDamage);
-	if (AT66MiniEnemyBase* SecondaryEnemy = FindClosestEnemyFromLocation(ImpactEnemy->GetActorLocation(), ImpactEnemy, 260.f + (BonusPierceCount * 70.f)))
+	if (AT66MiniEnemyBase* SecondaryEnemy = PickRicochetTarget(Ricochet, GetIdolRicochetRange(IdolRuntime)))
 	{
 		SpawnIdolImpactVfx(IdolRuntime, SecondaryEnemy->GetActorLocation() + FVector(0.f, 0.f, 10.f), 0.90f);
 		SecondaryEnemy->ApplyDamage(FollowUpDamage * 0.70f);
@@ -1732,25 +1749,22 @@ void AT66MiniPlayerPawn::ApplyAoeIdolBurst(const FVector& ImpactLocation, const
 		return;
 	}
 
-	const TArray<TObjectPtr<AT66MiniEnemyBase>>* LiveEnemies = T66MiniResolveLiveEnemies(World);
-	if (!LiveEnemies)
+	const FT66MiniEnemySpatialGrid* EnemyGrid = T66MiniResolveEnemyGrid(World);
+	if (!EnemyGrid)
 	{
 		return;
 	}
 
-	for (AT66MiniEnemyBase* Candidate : *LiveEnemies)
+	TArray<AT66MiniEnemyBase*, TInlineAllocator<32>> Targets;
+	EnemyGrid->FindInRadius(ImpactLocation, Radius, Targets);
+	for (AT66MiniEnemyBase* Candidate : Targets)
 	{
-		if (!Candidate || Candidate->IsEnemyDead())
+		if (Candidate->IsEnemyDead())
 		{
 			continue;
 		}
 
 		const float DistanceSq = FVector::DistSquared2D(ImpactLocation, Candidate->GetActorLocation());
-		if (DistanceSq > FMath::Square(Radius))
-		{
-			continue;
-		}
-
 		const float DistanceAlpha = 1.f - FMath::Clamp(FMath::Sqrt(DistanceSq) / FMath::Max(1.f, Radius), 0.f, 1.f);
 		const float AppliedDamage = Damage * (0.65f + (DistanceAlpha * 0.35f));
 		Candidate->ApplyDamage(AppliedDamage);
@@ -1758,38 +1772,48 @@ void AT66MiniPlayerPawn::ApplyAoeIdolBurst(const FVector& ImpactLocation, const
 	}
 }
 
-AT66MiniEnemyBase* AT66MiniPlayerPawn::FindClosestEnemyFromLocation(const FVector& Origin, const AActor* IgnoreActor, const float MaxRange) const
+float AT66MiniPlayerPawn::GetIdolFollowUpRadius(const FEquippedIdolRuntime& IdolRuntime) const
 {
-	UWorld* World = GetWorld();
-	if (!World)
+	return FMath::Max(240.f, IdolRuntime.BaseProperty + 140.f + AoeRadiusBonus);
+}
+
+float AT66MiniPlayerPawn::GetIdolRicochetRange(const FEquippedIdolRuntime& IdolRuntime) const
+{
+	if (IdolRuntime.Category.Equals(TEXT("Bounce"), ESearchCase::IgnoreCase))
 	{
-		return nullptr;
+		return FMath::Max(340.f, GetIdolFollowUpRadius(IdolRuntime));
 	}
 
-	AT66MiniEnemyBase* BestEnemy = nullptr;
-	float BestDistanceSq = FMath::Square(MaxRange);
-	const TArray<TObjectPtr<AT66MiniEnemyBase>>* LiveEnemies = T66MiniResolveLiveEnemies(World);
-	if (!LiveEnemies)
+	if (IdolRuntime.Category.Equals(TEXT("AOE"), ESearchCase::IgnoreCase) || IdolRuntime.Category.Equals(TEXT("DOT"), ESearchCase::IgnoreCase))
 	{
-		return BestEnemy;
+		return 0.f;
 	}
 
-	for (AT66MiniEnemyBase* Candidate : *LiveEnemies)
+	return 260.f + (BonusPierceCount * 70.f);
+}
+
+AT66MiniEnemyBase* AT66MiniPlayerPawn::PickRicochetTarget(FRicochetTargets& Ricochet, const float MaxRange) const
+{
+	if (!Ricochet.bQueried)
 	{
-		if (!Candidate || Candidate == IgnoreActor || Candidate->IsEnemyDead())
+		Ricochet.bQueried = true;
+		if (const FT66MiniEnemySpatialGrid* EnemyGrid = T66MiniResolveEnemyGrid(GetWorld()))
 		{
-			continue;
+			const AActor* IgnoreActors[] = { Ricochet.ImpactEnemy };
+			EnemyGrid->FindKNearest(Ricochet.Origin, FRicochetTargets::MaxPicks, Ricochet.QueryRange, Ricochet.Candidates, IgnoreActors);
 		}
+	}
 
-		const float DistanceSq = FVector::DistSquared2D(Origin, Candidate->GetActorLocation());
-		if (DistanceSq < BestDistanceSq)
+	// Candidates are closest first, so the first one still alive is what a fresh nearest query would return.
+	for (AT66MiniEnemyBase* Candidate : Ricochet.Candidates)
+	{
+		if (IsValid(Candidate) && !Candidate->IsEnemyDead())
 		{
-			BestDistanceSq = DistanceSq;
-			BestEnemy = Candidate;
+			return FVector::DistSquared2D(Ricochet.Origin, Candidate->GetActorLocation()) <= FMath::Square(MaxRange) ? Candidate : nullptr;
 		}
 	}
 
-	return BestEnemy;
+	return nullptr;
 }
 
 AT66MiniEnemyBase* AT66MiniPlayerPawn::FindBestTarget(const float MaxRange) const
@@ -1800,30 +1824,8 @@ AT66MiniEnemyBase* AT66MiniPlayerPawn::FindBestTarget(const float MaxRange) cons
 		return nullptr;
 	}
 
-	AT66MiniEnemyBase* BestEnemy = nullptr;
-	float BestDistanceSq = FMath::Square(MaxRange);
-	const TArray<TObjectPtr<AT66MiniEnemyBase>>* LiveEnemies = T66MiniResolveLiveEnemies(World);
-	if (!LiveEnemies)
-	{
-		return BestEnemy;
-	}
-
-	for (AT66MiniEnemyBase* Candidate : *LiveEnemies)
-	{
-		if (!Candidate || Candidate->IsEnemyDead())
-		{
-			continue;
-		}
-
-		const float DistanceSq = FVector::DistSquared2D(GetActorLocation(), Candidate->GetActorLocation());
-		if (DistanceSq < BestDistanceSq)
-		{
-			BestDistanceSq = DistanceSq;
-			BestEnemy = Candidate;
-		}
-	}
-
-	return BestEnemy;
+	const FT66MiniEnemySpatialGrid* EnemyGrid = T66MiniResolveEnemyGrid(World);
+	return EnemyGrid ? EnemyGrid->FindNearest(GetActorLocation(), MaxRange) : nullptr;
 }
 
 float AT66MiniPlayerPawn::GetNextLevelThreshold() const
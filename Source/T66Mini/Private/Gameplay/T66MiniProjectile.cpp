@@ -331,31 +331,23 @@ AT66MiniEnemyBase* AT66MiniProjectile::FindNextBounceTarget(AActor* IgnoreActor,
 		return nullptr;
 	}
 
-	AT66MiniEnemyBase* BestEnemy = nullptr;
-	float BestDistanceSq = FMath::Square(MaxRange);
 	const AT66MiniGameMode* MiniGameMode = World->GetAuthGameMode<AT66MiniGameMode>();
-	const TArray<TObjectPtr<AT66MiniEnemyBase>>* LiveEnemies = MiniGameMode ? &MiniGameMode->GetLiveEnemies() : nullptr;
-	if (!LiveEnemies)
+	if (!MiniGameMode)
 	{
-		return BestEnemy;
+		return nullptr;
 	}
 
-	for (AT66MiniEnemyBase* Candidate : *LiveEnemies)
+	TArray<const AActor*, TInlineAllocator<8>> IgnoreActors;
+	IgnoreActors.Add(IgnoreActor);
+	for (const TWeakObjectPtr<AActor>& HitActor : HitActors)
 	{
-		if (!Candidate || Candidate == IgnoreActor || Candidate->IsEnemyDead() || HitActors.Contains(Candidate))
-		{
-			continue;
-		}
-
-		const float DistanceSq = FVector::DistSquared2D(GetActorLocation(), Candidate->GetActorLocation());
-		if (DistanceSq < BestDistanceSq)
+		if (const AActor* Actor = HitActor.Get())
 		{
-			BestDistanceSq = DistanceSq;
-			BestEnemy = Candidate;
+			IgnoreActors.Add(Actor);
 		}
 	}
 
-	return BestEnemy;
+	return MiniGameMode->GetEnemySpatialGrid().FindNearest(GetActorLocation(), MaxRange, IgnoreActors);
 }
 
 void AT66MiniProjectile::ExplodeAt(const FVector& Location)
@@ -369,21 +361,16 @@ void AT66MiniProjectile::ExplodeAt(const FVector& Location)
 	SpawnFollowUpPulse(Location + FVector(0.f, 0.f, 6.f));
 
 	const AT66MiniGameMode* MiniGameMode = World->GetAuthGameMode<AT66MiniGameMode>();
-	const TArray<TObjectPtr<AT66MiniEnemyBase>>* LiveEnemies = MiniGameMode ? &MiniGameMode->GetLiveEnemies() : nullptr;
-	if (!LiveEnemies)
+	if (!MiniGameMode)
 	{
 		return;
 	}
 
-	for (AT66MiniEnemyBase* Candidate : *LiveEnemies)
+	TArray<AT66MiniEnemyBase*, TInlineAllocator<32>> Targets;
+	MiniGameMode->GetEnemySpatialGrid().FindInRadius(Location, Radius, Targets);
+	for (AT66MiniEnemyBase* Candidate : Targets)
 	{
-		if (!Candidate || Candidate->IsEnemyDead())
-		{
-			continue;
-		}
-
-		const float DistanceSq = FVector::DistSquared2D(Location, Candidate->GetActorLocation());
-		if (DistanceSq <= FMath::Square(Radius))
+		if (!Candidate->IsEnemyDead())
 		{
 			Candidate->ApplyDamage(FollowUpDamage);
 			T66MiniCreditSuccessfulHit(OwnerActor.Get(), FollowUpDamage);
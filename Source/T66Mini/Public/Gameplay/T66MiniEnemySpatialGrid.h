@@ -0,0 +1,73 @@
+// Copyright Tribulation 66. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class AActor;
+class AT66MiniEnemyBase;
+
+/**
+ * Uniform 2D grid over the Mini arena used for enemy targeting and area damage.
+ * Owned by AT66MiniGameMode, rebuilt once per server frame and appended to as enemies spawn mid-frame.
+ * Queries re-read live actor locations, so cell membership only needs to be frame-accurate.
+ */
+class T66MINI_API FT66MiniEnemySpatialGrid
+{
+public:
+	void Rebuild(const FVector& ArenaOrigin, float ArenaHalfExtent, const TArray<TObjectPtr<AT66MiniEnemyBase>>& Enemies);
+	void Insert(AT66MiniEnemyBase* Enemy);
+	void Reset();
+
+	int32 Num() const { return Entries.Num(); }
+
+	AT66MiniEnemyBase* FindNearest(const FVector& Origin, float MaxRange, TConstArrayView<const AActor*> IgnoreActors = {}) const;
+
+	template <typename AllocatorType>
+	void FindInRadius(const FVector& Center, float Radius, TArray<AT66MiniEnemyBase*, AllocatorType>& OutEnemies, TConstArrayView<const AActor*> IgnoreActors = {}) const
+	{
+		OutEnemies.Reset();
+		ForEachInRadius(Center, Radius, IgnoreActors, [&OutEnemies](AT66MiniEnemyBase* Enemy) { OutEnemies.Add(Enemy); });
+	}
+
+	/** Up to K enemies within MaxRange of Origin, closest first. */
+	template <typename AllocatorType>
+	void FindKNearest(const FVector& Origin, int32 K, float MaxRange, TArray<AT66MiniEnemyBase*, AllocatorType>& OutEnemies, TConstArrayView<const AActor*> IgnoreActors = {}) const
+	{
+		OutEnemies.Reset();
+		ForEachKNearest(Origin, K, MaxRange, IgnoreActors, [&OutEnemies](AT66MiniEnemyBase* Enemy) { OutEnemies.Add(Enemy); });
+	}
+
+private:
+	struct FEntry
+	{
+		TWeakObjectPtr<AT66MiniEnemyBase> Enemy;
+		int32 NextInCell = INDEX_NONE;
+	};
+
+	struct FCandidate
+	{
+		AT66MiniEnemyBase* Enemy = nullptr;
+		float DistanceSq = 0.f;
+	};
+
+	void ConfigureCells(const FVector& ArenaOrigin, float ArenaHalfExtent);
+	FIntPoint ToCell(const FVector& WorldLocation) const;
+	int32 ToCellIndex(const FIntPoint& Cell) const { return (Cell.Y * CellsPerAxis) + Cell.X; }
+	AT66MiniEnemyBase* ResolveCandidate(const FEntry& Entry, TConstArrayView<const AActor*> IgnoreActors) const;
+	void ForEachInRadius(const FVector& Center, float Radius, TConstArrayView<const AActor*> IgnoreActors, TFunctionRef<void(AT66MiniEnemyBase*)> Visitor) const;
+	void ForEachKNearest(const FVector& Origin, int32 K, float MaxRange, TConstArrayView<const AActor*> IgnoreActors, TFunctionRef<void(AT66MiniEnemyBase*)> Visitor) const;
+
+	template <typename VisitorType>
+	void VisitRing(const FIntPoint& CenterCell, int32 Ring, VisitorType&& Visitor) const;
+
+	static constexpr float CellSize = 320.f;
+	static constexpr float QuerySlack = 64.f;
+
+	FVector2D GridMin = FVector2D::ZeroVector;
+	FVector CachedArenaOrigin = FVector::ZeroVector;
+	float CachedArenaHalfExtent = 0.f;
+	int32 CellsPerAxis = 0;
+	TArray<int32> CellHeads;
+	TArray<FEntry> Entries;
+};
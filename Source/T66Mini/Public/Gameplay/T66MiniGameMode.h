@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "TimerManager.h"
 #include "GameFramework/GameModeBase.h"
+#include "Gameplay/T66MiniEnemySpatialGrid.h"
 #include "UI/T66UITypes.h"
 #include "T66MiniGameMode.generated.h"
 
@@ -53,6 +54,7 @@ public:
 	AT66MiniPlayerPawn* FindClosestPlayerPawn(const FVector& WorldLocation, bool bRequireAlive) const;
 	const TArray<TObjectPtr<AT66MiniPlayerPawn>>& GetLivePlayerPawns() const { return LivePlayerPawns; }
 	const TArray<TObjectPtr<AT66MiniEnemyBase>>& GetLiveEnemies() const { return LiveEnemies; }
+	const FT66MiniEnemySpatialGrid& GetEnemySpatialGrid() const { return EnemySpatialGrid; }
 	const TArray<TObjectPtr<AT66MiniInteractable>>& GetLiveInteractables() const { return LiveInteractables; }
 	const TArray<TObjectPtr<AT66MiniPickup>>& GetLivePickups() const { return LivePickups; }
 	void RegisterLiveTrap(AT66MiniHazardTrap* Trap);
@@ -150,6 +152,7 @@ private:
 	TObjectPtr<UAudioComponent> BattleMusicComponent;
 
 	TArray<FT66MiniCombatTextEntry> CombatTexts;
+	FT66MiniEnemySpatialGrid EnemySpatialGrid;
 	TSet<TWeakObjectPtr<class AT66MiniPlayerPawn>> PositionedPlayerPawns;
 	FTimerHandle OnlineFrontendTravelTimer;
 };
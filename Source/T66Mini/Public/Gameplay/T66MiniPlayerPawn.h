@@ -252,6 +252,19 @@ private:
 		FLinearColor Tint = FLinearColor::White;
 	};
 
+	/** Ricochets off one basic-attack impact share a single k-nearest query around the impacted enemy. */
+	struct FRicochetTargets
+	{
+		/** Static Charge, Chaos Theory and one idol follow-up can each ricochet off the same impact. */
+		static constexpr int32 MaxPicks = 3;
+
+		const AActor* ImpactEnemy = nullptr;
+		FVector Origin = FVector::ZeroVector;
+		float QueryRange = 0.f;
+		bool bQueried = false;
+		TArray<class AT66MiniEnemyBase*, TInlineAllocator<MaxPicks>> Candidates;
+	};
+
 	void ApplyItemDefinition(const struct FT66MiniItemDefinition& ItemDefinition);
 	void ApplyLevelUpBonuses(int32 LevelsToApply);
 	void InitializeFromMiniRun();
@@ -270,12 +283,14 @@ private:
 	float GetPassiveDamageMultiplierAgainst(const class AT66MiniEnemyBase* Enemy) const;
 	float ConsumeOutgoingDamageScalar(const class AT66MiniEnemyBase* Enemy);
 	void HandlePostDamageTaken(float DamageTaken);
-	void HandlePassiveOnBasicHit(class AT66MiniEnemyBase* ImpactEnemy, const FVector& ImpactLocation, float DamageDealt);
+	void HandlePassiveOnBasicHit(class AT66MiniEnemyBase* ImpactEnemy, const FVector& ImpactLocation, float DamageDealt, FRicochetTargets& Ricochet);
 	float GetUltimateBaseDamage() const;
-	void TriggerIdolFollowUp(FEquippedIdolRuntime& IdolRuntime, class AT66MiniEnemyBase* ImpactEnemy, const FVector& ImpactLocation);
+	void TriggerIdolFollowUp(FEquippedIdolRuntime& IdolRuntime, class AT66MiniEnemyBase* ImpactEnemy, const FVector& ImpactLocation, FRicochetTargets& Ricochet);
+	float GetIdolFollowUpRadius(const FEquippedIdolRuntime& IdolRuntime) const;
+	float GetIdolRicochetRange(const FEquippedIdolRuntime& IdolRuntime) const;
 	void SpawnIdolImpactVfx(const FEquippedIdolRuntime& IdolRuntime, const FVector& ImpactLocation, float ScaleMultiplier = 1.f) const;
 	void ApplyAoeIdolBurst(const FVector& ImpactLocation, float Damage, float Radius);
-	class AT66MiniEnemyBase* FindClosestEnemyFromLocation(const FVector& Origin, const AActor* IgnoreActor, float MaxRange) const;
+	class AT66MiniEnemyBase* PickRicochetTarget(FRicochetTargets& Ricochet, float MaxRange) const;
 	class AT66MiniEnemyBase* FindBestTarget(float MaxRange) const;
 	float GetNextLevelThreshold() const;
 
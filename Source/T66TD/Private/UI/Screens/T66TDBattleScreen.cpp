@@ -2,6 +2,7 @@
 
 #include "UI/Screens/T66TDBattleScreen.h"
 
+#include "Algo/BinarySearch.h"
 #include "Core/T66AchievementsSubsystem.h"
 #include "Core/T66TDDataSubsystem.h"
 #include "Core/T66TDFrontendStateSubsystem.h"
@@ -9,10 +10,12 @@
 #include "Engine/GameInstance.h"
 #include "Data/T66TDDataTypes.h"
 #include "Engine/Texture2D.h"
+#include "Framework/Application/SlateApplication.h"
 #include "Input/DragAndDrop.h"
 #include "Misc/CommandLine.h"
 #include "Misc/Paths.h"
 #include "Rendering/DrawElements.h"
+#include "Rendering/SlateRenderer.h"
 #include "Styling/CoreStyle.h"
 #include "UI/T66TDUIStyle.h"
 #include "UI/Style/T66RuntimeUIBrushAccess.h"
@@ -291,9 +294,51 @@ namespace
 	{
 		TArray<FVector2D> Points;
 		TArray<float> SegmentLengths;
+		/** Arc length from the first point to Points[i]; same count as Points. */
+		TArray<float> CumulativeLengths;
 		float TotalLength = 0.f;
 	};
 
+	/**
+	 * Coarse board grid rebuilt once per simulation step. Each cell lists live enemies furthest-progressed
+	 * first, so a tower only walks the cells its range touches and stops once no later entry can win.
+	 */
+	struct FT66TDEnemyTargetGrid
+	{
+		static constexpr int32 CellsPerAxis = 16;
+
+		/** Enemy positions sampled once for the step, indexed like Enemies. */
+		TArray<FVector2D> Positions;
+		TArray<TArray<int32>> Cells;
+
+		static int32 ToCellCoordinate(const float NormalizedValue)
+		{
+			return FMath::Clamp(FMath::FloorToInt(NormalizedValue * CellsPerAxis), 0, CellsPerAxis - 1);
+		}
+
+		void Add(const int32 EnemyIndex)
+		{
+			const FVector2D& Position = Positions[EnemyIndex];
+			Cells[ToCellCoordinate(Position.Y) * CellsPerAxis + ToCellCoordinate(Position.X)].Add(EnemyIndex);
+		}
+
+		template <typename FVisitor>
+		void ForEachCellInRadius(const FVector2D& Center, const float Radius, FVisitor&& Visit) const
+		{
+			const int32 MinX = ToCellCoordinate(Center.X - Radius);
+			const int32 MaxX = ToCellCoordinate(Center.X + Radius);
+			const int32 MinY = ToCellCoordinate(Center.Y - Radius);
+			const int32 MaxY = ToCellCoordinate(Center.Y + Radius);
+			for (int32 CellY = MinY; CellY <= MaxY; ++CellY)
+			{
+				for (int32 CellX = MinX; CellX <= MaxX; ++CellX)
+				{
+					Visit(Cells[CellY * CellsPerAxis + CellX]);
+				}
+			}
+		}
+	};
+
 	struct FT66TDQueuedSpawn
 	{
 		ET66TDEnemyFamily Family = ET66TDEnemyFamily::Roost;
@@ -631,35 +676,97 @@ namespace
 
 		const float ClampedRatio = FMath::Clamp(Ratio, 0.f, 1.f);
 		const float TargetDistance = Path.TotalLength * ClampedRatio;
-		float WalkedDistance = 0.f;
 
-		for (int32 SegmentIndex = 0; SegmentIndex < Path.SegmentLengths.Num(); ++SegmentIndex)
+		// First point at or past the target distance ends the segment we are on.
+		const int32 SegmentIndex = FMath::Clamp(
+			static_cast<int32>(Algo::LowerBound(Path.CumulativeLengths, TargetDistance)) - 1,
+			0,
+			Path.SegmentLengths.Num() - 1);
+		const float SegmentLength = Path.SegmentLengths[SegmentIndex];
+		const float LocalAlpha = SegmentLength <= KINDA_SMALL_NUMBER ? 0.f : (TargetDistance - Path.CumulativeLengths[SegmentIndex]) / SegmentLength;
+		return FMath::Lerp(Path.Points[SegmentIndex], Path.Points[SegmentIndex + 1], LocalAlpha);
+	}
+
+	/** Unit circle vertices (no closing duplicate) shared by every ring with the same segment count. */
+	const TArray<FVector2f>& GetUnitCirclePoints(const int32 SegmentCount)
+	{
+		static TMap<int32, TArray<FVector2f>> UnitCircles;
+		if (const TArray<FVector2f>* Existing = UnitCircles.Find(SegmentCount))
 		{
-			const float SegmentLength = Path.SegmentLengths[SegmentIndex];
-			if (WalkedDistance + SegmentLength >= TargetDistance || SegmentIndex == Path.SegmentLengths.Num() - 1)
-			{
-				const FVector2D Start = Path.Points[SegmentIndex];
-				const FVector2D End = Path.Points[SegmentIndex + 1];
-				const float LocalAlpha = SegmentLength <= KINDA_SMALL_NUMBER ? 0.f : (TargetDistance - WalkedDistance) / SegmentLength;
-				return FMath::Lerp(Start, End, LocalAlpha);
-			}
+			return *Existing;
+		}
 
-			WalkedDistance += SegmentLength;
+		TArray<FVector2f>& Points = UnitCircles.Add(SegmentCount);
+		Points.Reserve(SegmentCount);
+		for (int32 Index = 0; Index < SegmentCount; ++Index)
+		{
+			const float Angle = (static_cast<float>(Index) / static_cast<float>(SegmentCount)) * PI * 2.f;
+			Points.Add(FVector2f(FMath::Cos(Angle), FMath::Sin(Angle)));
 		}
 
-		return Path.Points.Last();
+		return Points;
 	}
 
-	void BuildCirclePoints(const FVector2D& Center, const float Radius, const int32 SegmentCount, TArray<FVector2f>& OutPoints)
+	/** Width of the transparent fringe on each side of a batched ring; stands in for the line antialiasing MakeLines applies. */
+	constexpr float RingFeatherWidth = 1.0f;
+
+	/**
+	 * Append a ring as an annulus so many rings can be submitted in one custom-verts element.
+	 * Each spoke carries four vertices (outer fringe, inner edge, outer edge, outer fringe) so the ring fades out over
+	 * RingFeatherWidth on both sides instead of ending in a hard, aliased edge.
+	 */
+	void AppendRingVerts(
+		const FSlateRenderTransform& RenderTransform,
+		const FVector2D& Center,
+		const float Radius,
+		const float Thickness,
+		const int32 SegmentCount,
+		const FColor& Color,
+		TArray<FSlateVertex>& OutVerts,
+		TArray<SlateIndex>& OutIndexes)
 	{
-		OutPoints.Reset();
-		OutPoints.Reserve(SegmentCount + 1);
-		for (int32 Index = 0; Index <= SegmentCount; ++Index)
+		const TArray<FVector2f>& UnitPoints = GetUnitCirclePoints(SegmentCount);
+		const FVector2f RingCenter(static_cast<float>(Center.X), static_cast<float>(Center.Y));
+		const float InnerRadius = FMath::Max(0.f, Radius - (Thickness * 0.5f));
+		const float OuterRadius = Radius + (Thickness * 0.5f);
+		const float InnerFringeRadius = FMath::Max(0.f, InnerRadius - RingFeatherWidth);
+		const float OuterFringeRadius = OuterRadius + RingFeatherWidth;
+		FColor FringeColor = Color;
+		FringeColor.A = 0;
+		const SlateIndex BaseIndex = static_cast<SlateIndex>(OutVerts.Num());
+
+		for (const FVector2f& UnitPoint : UnitPoints)
 		{
-			const float Angle = (static_cast<float>(Index) / static_cast<float>(SegmentCount)) * PI * 2.f;
-			OutPoints.Add(FVector2f(
-				static_cast<float>(Center.X + (FMath::Cos(Angle) * Radius)),
-				static_cast<float>(Center.Y + (FMath::Sin(Angle) * Radius))));
+			OutVerts.Add(FSlateVertex::Make<ESlateVertexRounding::Disabled>(RenderTransform, RingCenter + (UnitPoint * InnerFringeRadius), FVector2f::ZeroVector, FringeColor));
+			OutVerts.Add(FSlateVertex::Make<ESlateVertexRounding::Disabled>(RenderTransform, RingCenter + (UnitPoint * InnerRadius), FVector2f::ZeroVector, Color));
+			OutVerts.Add(FSlateVertex::Make<ESlateVertexRounding::Disabled>(RenderTransform, RingCenter + (UnitPoint * OuterRadius), FVector2f::ZeroVector, Color));
+			OutVerts.Add(FSlateVertex::Make<ESlateVertexRounding::Disabled>(RenderTransform, RingCenter + (UnitPoint * OuterFringeRadius), FVector2f::ZeroVector, FringeColor));
+		}
+
+		for (int32 Index = 0; Index < SegmentCount; ++Index)
+		{
+			const SlateIndex Spoke0 = BaseIndex + static_cast<SlateIndex>(Index * 4);
+			const SlateIndex Spoke1 = BaseIndex + static_cast<SlateIndex>(((Index + 1) % SegmentCount) * 4);
+			for (SlateIndex Band = 0; Band < 3; ++Band)
+			{
+				OutIndexes.Append({ Spoke0 + Band, Spoke0 + Band + 1, Spoke1 + Band + 1, Spoke0 + Band, Spoke1 + Band + 1, Spoke1 + Band });
+			}
+		}
+	}
+
+	/** Closed polyline for a ring, used when the batched path has no resource handle to draw with. */
+	void BuildRingLinePoints(const FVector2D& Center, const float Radius, const int32 SegmentCount, TArray<FVector2f>& OutPoints)
+	{
+		const TArray<FVector2f>& UnitPoints = GetUnitCirclePoints(SegmentCount);
+		const FVector2f RingCenter(static_cast<float>(Center.X), static_cast<float>(Center.Y));
+		OutPoints.Reset(SegmentCount + 1);
+		for (const FVector2f& UnitPoint : UnitPoints)
+		{
+			OutPoints.Add(RingCenter + (UnitPoint * Radius));
+		}
+		if (UnitPoints.Num() > 0)
+		{
+			OutPoints.Add(RingCenter + (UnitPoints[0] * Radius));
 		}
 	}
 
@@ -874,12 +981,14 @@ namespace
 				FT66TDPathRuntime PathRuntime;
 				PathRuntime.Points = PathPoints;
 				PathRuntime.TotalLength = 0.f;
+				PathRuntime.CumulativeLengths.Add(0.f);
 
 				for (int32 Index = 0; Index + 1 < PathRuntime.Points.Num(); ++Index)
 				{
 					const float SegmentLength = FVector2D::Distance(PathRuntime.Points[Index], PathRuntime.Points[Index + 1]);
 					PathRuntime.SegmentLengths.Add(SegmentLength);
 					PathRuntime.TotalLength += SegmentLength;
+					PathRuntime.CumulativeLengths.Add(PathRuntime.TotalLength);
 				}
 
 				if (PathRuntime.Points.Num() >= 2 && PathRuntime.TotalLength > KINDA_SMALL_NUMBER)
@@ -1332,25 +1441,41 @@ namespace
 				}
 			};
 
-			int32 PaintLayer = LayerId;
-
-			for (int32 PathIndex = 0; PathIndex < PathRuntimes.Num(); ++PathIndex)
+			const FSlateRenderTransform& RenderTransform = AllottedGeometry.GetAccumulatedRenderTransform();
+			const bool bCanBatchRings = EnsureRingResourceHandle(*WhiteBrush);
+			auto SubmitRings = [&](const int32 RingLayer)
 			{
-				TArray<FVector2f> PathPoints;
-				for (const FVector2D& Point : PathRuntimes[PathIndex].Points)
+				if (bCanBatchRings && RingIndexScratch.Num() > 0)
 				{
-					const FVector2D LocalPoint = ToLocalPoint(Point, LocalSize);
-					PathPoints.Add(FVector2f(static_cast<float>(LocalPoint.X), static_cast<float>(LocalPoint.Y)));
+					FSlateDrawElement::MakeCustomVerts(OutDrawElements, RingLayer, RingResourceHandle, RingVertexScratch, RingIndexScratch, nullptr, 0, 0);
+				}
+				RingVertexScratch.Reset();
+				RingIndexScratch.Reset();
+			};
+			auto AddRing = [&](const int32 RingLayer, const FVector2D& Center, const float Radius, const float Thickness, const int32 SegmentCount, const FLinearColor& Color)
+			{
+				if (bCanBatchRings)
+				{
+					AppendRingVerts(RenderTransform, Center, Radius, Thickness, SegmentCount, (Color * Tint).ToFColor(true), RingVertexScratch, RingIndexScratch);
+					return;
 				}
 
-				DrawLineStrip(PathPoints, 3.f, FLinearColor(1.f, 0.92f, 0.56f, 0.05f), PaintLayer + 1);
+				// No handle for the white brush: draw the ring as an antialiased line strip instead of dropping it.
+				BuildRingLinePoints(Center, Radius, SegmentCount, RingLineScratch);
+				DrawLineStrip(RingLineScratch, Thickness, Color, RingLayer);
+			};
+
+			int32 PaintLayer = LayerId;
+
+			RefreshStaticLayerIfNeeded(LocalSize);
+			for (const TArray<FVector2f>& PathStrip : StaticLayer.PathStrips)
+			{
+				DrawLineStrip(PathStrip, 3.f, FLinearColor(1.f, 0.92f, 0.56f, 0.05f), PaintLayer + 1);
 			}
 
-			for (int32 PadIndex = 0; PadIndex < LayoutDefinition.Pads.Num(); ++PadIndex)
+			for (int32 PadIndex = 0; PadIndex < StaticLayer.PadBoxes.Num(); ++PadIndex)
 			{
-				const FT66TDMapPadDefinition& Pad = LayoutDefinition.Pads[PadIndex];
-				const FVector2D PadCenter = ToLocalPoint(Pad.PositionNormalized, LocalSize);
-				const float PadRadius = FMath::Max(8.f, Pad.RadiusNormalized * LocalSize.X * 1.35f);
+				const FT66TDBoardPadBox& PadBox = StaticLayer.PadBoxes[PadIndex];
 				FLinearColor PadColor = FLinearColor(0.96f, 0.86f, 0.46f, 0.04f);
 				if (FindTowerIndexByPad(PadIndex) != INDEX_NONE)
 				{
@@ -1367,7 +1492,7 @@ namespace
 					PadColor = FLinearColor(0.98f, 0.96f, 0.70f, 0.34f);
 				}
 
-				DrawBoxAt(PadCenter, FVector2D(PadRadius * 2.0f, PadRadius * 2.0f), PadColor, PaintLayer + 2);
+				DrawBoxAt(PadBox.Center, PadBox.Size, PadColor, PaintLayer + 2);
 			}
 
 			for (const FT66TDPlacedTower& Tower : Towers)
@@ -1377,44 +1502,48 @@ namespace
 				const bool bSelected = Tower.PadIndex == SelectedPadIndex;
 				if (bSelected)
 				{
-					TArray<FVector2f> RangePoints;
-					BuildCirclePoints(TowerCenter, Tower.Profile.Range * LocalSize.X, 28, RangePoints);
-					DrawLineStrip(RangePoints, 1.5f, FLinearColor(Tower.Tint.R, Tower.Tint.G, Tower.Tint.B, 0.42f), PaintLayer + 3);
+					AddRing(PaintLayer + 3, TowerCenter, Tower.Profile.Range * LocalSize.X, 1.5f, 28, FLinearColor(Tower.Tint.R, Tower.Tint.G, Tower.Tint.B, 0.42f));
 				}
 
 				DrawBoxAt(TowerCenter, TowerSize + FVector2D(10.f, 10.f), FLinearColor(0.02f, 0.02f, 0.03f, 0.88f), PaintLayer + 4);
 				const TSharedPtr<FSlateBrush> TowerBrush = HeroBrushes.FindRef(Tower.HeroID);
 				DrawBrushAt(TowerBrush, TowerCenter, TowerSize + FVector2D(14.f, 14.f), FLinearColor::White, PaintLayer + 5);
 			}
+			SubmitRings(PaintLayer + 3);
 
+			// Modifier rings for every enemy go out as one custom-verts element on their shared layer.
 			for (const FT66TDActiveEnemy& Enemy : Enemies)
 			{
+				if (Enemy.Modifiers == ET66TDEnemyModifier::None)
+				{
+					continue;
+				}
+
 				const FVector2D EnemyCenter = ToLocalPoint(SampleEnemyPosition(Enemy), LocalSize);
 				const float EnemyRadius = FMath::Max(8.f, Enemy.Radius * LocalSize.X);
 				if (HasEnemyModifier(Enemy.Modifiers, ET66TDEnemyModifier::Shielded))
 				{
-					TArray<FVector2f> ShieldRing;
-					BuildCirclePoints(EnemyCenter, EnemyRadius + 7.f, 24, ShieldRing);
-					DrawLineStrip(ShieldRing, 2.2f, FLinearColor(0.36f, 0.72f, 0.98f, 0.65f), PaintLayer + 6);
+					AddRing(PaintLayer + 6, EnemyCenter, EnemyRadius + 7.f, 2.2f, 24, FLinearColor(0.36f, 0.72f, 0.98f, 0.65f));
 				}
 				if (HasEnemyModifier(Enemy.Modifiers, ET66TDEnemyModifier::Armored))
 				{
-					TArray<FVector2f> ArmorRing;
-					BuildCirclePoints(EnemyCenter, EnemyRadius + 4.f, 20, ArmorRing);
-					DrawLineStrip(ArmorRing, 1.8f, FLinearColor(0.82f, 0.68f, 0.26f, 0.62f), PaintLayer + 6);
+					AddRing(PaintLayer + 6, EnemyCenter, EnemyRadius + 4.f, 1.8f, 20, FLinearColor(0.82f, 0.68f, 0.26f, 0.62f));
 				}
 				if (HasEnemyModifier(Enemy.Modifiers, ET66TDEnemyModifier::Regenerating))
 				{
-					TArray<FVector2f> RegenRing;
-					BuildCirclePoints(EnemyCenter, EnemyRadius + 10.f, 18, RegenRing);
-					DrawLineStrip(RegenRing, 1.4f, FLinearColor(0.32f, 0.86f, 0.48f, 0.52f), PaintLayer + 6);
+					AddRing(PaintLayer + 6, EnemyCenter, EnemyRadius + 10.f, 1.4f, 18, FLinearColor(0.32f, 0.86f, 0.48f, 0.52f));
 				}
 				if (HasEnemyModifier(Enemy.Modifiers, ET66TDEnemyModifier::Hidden))
 				{
-					TArray<FVector2f> HiddenRing;
-					BuildCirclePoints(EnemyCenter, EnemyRadius + 13.f, 16, HiddenRing);
-					DrawLineStrip(HiddenRing, 1.2f, FLinearColor(0.42f, 0.30f, 0.62f, 0.48f), PaintLayer + 6);
+					AddRing(PaintLayer + 6, EnemyCenter, EnemyRadius + 13.f, 1.2f, 16, FLinearColor(0.42f, 0.30f, 0.62f, 0.48f));
 				}
+			}
+			SubmitRings(PaintLayer + 6);
+
+			for (const FT66TDActiveEnemy& Enemy : Enemies)
+			{
+				const FVector2D EnemyCenter = ToLocalPoint(SampleEnemyPosition(Enemy), LocalSize);
+				const float EnemyRadius = FMath::Max(8.f, Enemy.Radius * LocalSize.X);
 
 				DrawBoxAt(EnemyCenter, FVector2D((EnemyRadius * 2.f) + 6.f, (EnemyRadius * 2.f) + 6.f), FLinearColor(0.04f, 0.04f, 0.05f, 0.88f), PaintLayer + 7);
 				const TSharedPtr<FSlateBrush> EnemyBrush = Enemy.bBoss ? BossBrushes.FindRef(Enemy.VisualID) : EnemyBrushes.FindRef(Enemy.VisualID);
@@ -1464,6 +1593,66 @@ namespace
 		}
 
 	private:
+		struct FT66TDBoardPadBox
+		{
+			FVector2D Center = FVector2D::ZeroVector;
+			FVector2D Size = FVector2D::ZeroVector;
+		};
+
+		/** Path strips and pad boxes in local space; layout is fixed for the match, so only a resize rebuilds them. */
+		struct FT66TDBoardStaticLayer
+		{
+			FVector2D BuiltForSize = FVector2D(-1.f, -1.f);
+			TArray<TArray<FVector2f>> PathStrips;
+			TArray<FT66TDBoardPadBox> PadBoxes;
+		};
+
+		void RefreshStaticLayerIfNeeded(const FVector2D& LocalSize) const
+		{
+			if (StaticLayer.BuiltForSize.Equals(LocalSize))
+			{
+				return;
+			}
+
+			StaticLayer.BuiltForSize = LocalSize;
+			StaticLayer.PathStrips.Reset(PathRuntimes.Num());
+			for (const FT66TDPathRuntime& PathRuntime : PathRuntimes)
+			{
+				TArray<FVector2f>& PathStrip = StaticLayer.PathStrips.AddDefaulted_GetRef();
+				PathStrip.Reserve(PathRuntime.Points.Num());
+				for (const FVector2D& Point : PathRuntime.Points)
+				{
+					const FVector2D LocalPoint = ToLocalPoint(Point, LocalSize);
+					PathStrip.Add(FVector2f(static_cast<float>(LocalPoint.X), static_cast<float>(LocalPoint.Y)));
+				}
+			}
+
+			StaticLayer.PadBoxes.Reset(LayoutDefinition.Pads.Num());
+			for (const FT66TDMapPadDefinition& Pad : LayoutDefinition.Pads)
+			{
+				const float PadRadius = FMath::Max(8.f, Pad.RadiusNormalized * LocalSize.X * 1.35f);
+				FT66TDBoardPadBox& PadBox = StaticLayer.PadBoxes.AddDefaulted_GetRef();
+				PadBox.Center = ToLocalPoint(Pad.PositionNormalized, LocalSize);
+				PadBox.Size = FVector2D(PadRadius * 2.0f, PadRadius * 2.0f);
+			}
+		}
+
+		bool EnsureRingResourceHandle(const FSlateBrush& WhiteBrush) const
+		{
+			if (!RingResourceHandle.IsValid() && FSlateApplication::IsInitialized())
+			{
+				RingResourceHandle = FSlateApplication::Get().GetRenderer()->GetResourceHandle(WhiteBrush);
+			}
+
+			if (!RingResourceHandle.IsValid() && !bLoggedRingHandleFallback)
+			{
+				bLoggedRingHandleFallback = true;
+				UE_LOG(LogTemp, Warning, TEXT("T66TDBattleScreen: no render resource handle for the white brush; board rings fall back to per-ring line strips."));
+			}
+
+			return RingResourceHandle.IsValid();
+		}
+
 		EActiveTimerReturnType HandleActiveTimer(double, float InDeltaTime)
 		{
 			AdvanceMatch(InDeltaTime * SimulationSpeed);
@@ -1793,6 +1982,7 @@ namespace
 				}
 			}
 
+			bool bTargetGridBuilt = false;
 			for (FT66TDPlacedTower& Tower : Towers)
 			{
 				Tower.Cooldown -= DeltaTime;
@@ -1801,6 +1991,13 @@ namespace
 					continue;
 				}
 
+				// Positions are fixed for the rest of this step, so one grid serves every tower that fires.
+				if (!bTargetGridBuilt)
+				{
+					RebuildEnemyTargetGrid();
+					bTargetGridBuilt = true;
+				}
+
 				const int32 TargetIndex = FindBestTargetIndex(Tower);
 				if (TargetIndex == INDEX_NONE)
 				{
@@ -1894,40 +2091,80 @@ namespace
 			return !HasEnemyModifier(Enemy.Modifiers, ET66TDEnemyModifier::Hidden) || Profile.bCanTargetHidden;
 		}
 
-		int32 FindBestTargetIndex(const FT66TDPlacedTower& Tower) const
+		void RebuildEnemyTargetGrid()
 		{
-			int32 BestIndex = INDEX_NONE;
-			float BestScore = -FLT_MAX;
+			TargetGrid.Positions.SetNumUninitialized(Enemies.Num());
+			TargetGrid.Cells.SetNum(FT66TDEnemyTargetGrid::CellsPerAxis * FT66TDEnemyTargetGrid::CellsPerAxis);
+			for (TArray<int32>& Cell : TargetGrid.Cells)
+			{
+				Cell.Reset();
+			}
+
+			TargetOrderScratch.Reset();
 			for (int32 EnemyIndex = 0; EnemyIndex < Enemies.Num(); ++EnemyIndex)
 			{
-				const FT66TDActiveEnemy& Enemy = Enemies[EnemyIndex];
-				if (Enemy.bPendingRemoval)
+				if (!Enemies[EnemyIndex].bPendingRemoval)
 				{
-					continue;
-				}
-				if (!CanTowerHitEnemy(Tower.Profile, Enemy))
-				{
-					continue;
+					TargetGrid.Positions[EnemyIndex] = SampleEnemyPosition(Enemies[EnemyIndex]);
+					TargetOrderScratch.Add(EnemyIndex);
 				}
+			}
 
-				const FVector2D EnemyPosition = SampleEnemyPosition(Enemy);
-				const float DistanceSq = DistanceSquared(Tower.PositionNormalized, EnemyPosition);
-				if (DistanceSq > FMath::Square(Tower.Profile.Range))
-				{
-					continue;
-				}
+			TargetOrderScratch.Sort([this](const int32 A, const int32 B)
+			{
+				return Enemies[A].ProgressRatio > Enemies[B].ProgressRatio;
+			});
+			for (const int32 EnemyIndex : TargetOrderScratch)
+			{
+				TargetGrid.Add(EnemyIndex);
+			}
+		}
 
-				float Score = (Enemy.ProgressRatio * 1000.f) - DistanceSq + (Enemy.bBoss ? 100.f : 0.f);
-				if (Tower.Profile.bPrioritizeBoss && Enemy.bBoss)
-				{
-					Score += 320.f;
-				}
-				if (Score > BestScore)
+		/** Requires RebuildEnemyTargetGrid earlier in the same simulation step. */
+		int32 FindBestTargetIndex(const FT66TDPlacedTower& Tower) const
+		{
+			int32 BestIndex = INDEX_NONE;
+			float BestScore = -FLT_MAX;
+			const float RangeSq = FMath::Square(Tower.Profile.Range);
+			const float MaxBonus = 100.f + (Tower.Profile.bPrioritizeBoss ? 320.f : 0.f);
+			TargetGrid.ForEachCellInRadius(Tower.PositionNormalized, Tower.Profile.Range, [&](const TArray<int32>& Cell)
+			{
+				for (const int32 EnemyIndex : Cell)
 				{
-					BestScore = Score;
-					BestIndex = EnemyIndex;
+					const FT66TDActiveEnemy& Enemy = Enemies[EnemyIndex];
+
+					// Distance only lowers the score, so once progress plus every bonus cannot beat the best, nothing later in this cell can.
+					if ((Enemy.ProgressRatio * 1000.f) + MaxBonus <= BestScore)
+					{
+						break;
+					}
+					if (Enemy.bPendingRemoval)
+					{
+						continue;
+					}
+					if (!CanTowerHitEnemy(Tower.Profile, Enemy))
+					{
+						continue;
+					}
+
+					const float DistanceSq = DistanceSquared(Tower.PositionNormalized, TargetGrid.Positions[EnemyIndex]);
+					if (DistanceSq > RangeSq)
+					{
+						continue;
+					}
+
+					float Score = (Enemy.ProgressRatio * 1000.f) - DistanceSq + (Enemy.bBoss ? 100.f : 0.f);
+					if (Tower.Profile.bPrioritizeBoss && Enemy.bBoss)
+					{
+						Score += 320.f;
+					}
+					if (Score > BestScore)
+					{
+						BestScore = Score;
+						BestIndex = EnemyIndex;
+					}
 				}
-			}
+			});
 
 			return BestIndex;
 		}
@@ -2021,55 +2258,59 @@ namespace
 						continue;
 					}
 
-					const FVector2D EnemyPosition = SampleEnemyPosition(Enemy);
+					const FVector2D EnemyPosition = TargetGrid.Positions[CurrentEnemyIndex];
 					BeamEffects.Add({ PreviousBeamOrigin, EnemyPosition, Tower.Tint, 0.10f, 0.10f, ChainIndex == 0 ? 3.2f : 2.0f });
 					ApplyDamageToEnemy(Enemy, Tower.Profile.Damage * DamageScale, Tower.Profile, Tower);
 					HitEnemyIndices.Add(CurrentEnemyIndex);
 
 					if (Tower.Profile.SplashRadius > 0.f)
 					{
-						for (int32 SplashIndex = 0; SplashIndex < Enemies.Num(); ++SplashIndex)
+						TargetGrid.ForEachCellInRadius(EnemyPosition, Tower.Profile.SplashRadius, [&](const TArray<int32>& Cell)
 						{
-							if (SplashIndex == CurrentEnemyIndex || HitEnemyIndices.Contains(SplashIndex) || !Enemies.IsValidIndex(SplashIndex) || Enemies[SplashIndex].bPendingRemoval)
-							{
-								continue;
-							}
-							if (!CanTowerHitEnemy(Tower.Profile, Enemies[SplashIndex]))
+							for (const int32 SplashIndex : Cell)
 							{
-								continue;
+								if (SplashIndex == CurrentEnemyIndex || HitEnemyIndices.Contains(SplashIndex) || Enemies[SplashIndex].bPendingRemoval)
+								{
+									continue;
+								}
+								if (!CanTowerHitEnemy(Tower.Profile, Enemies[SplashIndex]))
+								{
+									continue;
+								}
+
+								if (DistanceSquared(EnemyPosition, TargetGrid.Positions[SplashIndex]) <= FMath::Square(Tower.Profile.SplashRadius))
+								{
+									ApplyDamageToEnemy(Enemies[SplashIndex], Tower.Profile.Damage * 0.68f, Tower.Profile, Tower);
+								}
 							}
-
-							const FVector2D SplashPosition = SampleEnemyPosition(Enemies[SplashIndex]);
-							if (DistanceSquared(EnemyPosition, SplashPosition) <= FMath::Square(Tower.Profile.SplashRadius))
-							{
-								ApplyDamageToEnemy(Enemies[SplashIndex], Tower.Profile.Damage * 0.68f, Tower.Profile, Tower);
-							}
-						}
+						});
 					}
 
 					if (ChainIndex < Tower.Profile.ChainBounces)
 					{
 						int32 BestBounceTarget = INDEX_NONE;
 						float BestBounceDistance = Tower.Profile.ChainRadius * Tower.Profile.ChainRadius;
-						for (int32 CandidateIndex = 0; CandidateIndex < Enemies.Num(); ++CandidateIndex)
+						TargetGrid.ForEachCellInRadius(EnemyPosition, Tower.Profile.ChainRadius, [&](const TArray<int32>& Cell)
 						{
-							if (HitEnemyIndices.Contains(CandidateIndex) || !Enemies.IsValidIndex(CandidateIndex) || Enemies[CandidateIndex].bPendingRemoval)
+							for (const int32 CandidateIndex : Cell)
 							{
-								continue;
-							}
-							if (!CanTowerHitEnemy(Tower.Profile, Enemies[CandidateIndex]))
-							{
-								continue;
+								if (HitEnemyIndices.Contains(CandidateIndex) || Enemies[CandidateIndex].bPendingRemoval)
+								{
+									continue;
+								}
+								if (!CanTowerHitEnemy(Tower.Profile, Enemies[CandidateIndex]))
+								{
+									continue;
+								}
+
+								const float CandidateDistance = DistanceSquared(EnemyPosition, TargetGrid.Positions[CandidateIndex]);
+								if (CandidateDistance <= BestBounceDistance)
+								{
+									BestBounceDistance = CandidateDistance;
+									BestBounceTarget = CandidateIndex;
+								}
 							}
-
-							const FVector2D CandidatePosition = SampleEnemyPosition(Enemies[CandidateIndex]);
-							const float CandidateDistance = DistanceSquared(EnemyPosition, CandidatePosition);
-							if (CandidateDistance <= BestBounceDistance)
-							{
-								BestBounceDistance = CandidateDistance;
-								BestBounceTarget = CandidateIndex;
-							}
-						}
+						});
 
 						if (BestBounceTarget != INDEX_NONE)
 						{
@@ -2594,6 +2835,8 @@ namespace
 		TArray<FT66TDActiveEnemy> Enemies;
 		TArray<FT66TDQueuedSpawn> PendingSpawns;
 		TArray<FT66TDBeamEffect> BeamEffects;
+		FT66TDEnemyTargetGrid TargetGrid;
+		TArray<int32> TargetOrderScratch;
 		TSharedPtr<FActiveTimerHandle> ActiveTimerHandle;
 		TWeakObjectPtr<UGameInstance> OwningGameInstance;
 		ET66TDMatchState MatchState = ET66TDMatchState::AwaitingWave;
@@ -2606,6 +2849,13 @@ namespace
 		float TimeUntilNextSpawn = 0.f;
 		float SimulationSpeed = 1.0f;
 		bool bPreviewPlacementValid = false;
+
+		mutable FT66TDBoardStaticLayer StaticLayer;
+		mutable FSlateResourceHandle RingResourceHandle;
+		mutable TArray<FSlateVertex> RingVertexScratch;
+		mutable TArray<SlateIndex> RingIndexScratch;
+		mutable TArray<FVector2f> RingLineScratch;
+		mutable bool bLoggedRingHandleFallback = false;
 	};
 }
 